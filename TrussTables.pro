@@ -6,7 +6,7 @@
 
 QT       += core gui
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets concurrent qml
 
 TARGET = trusstables
 TEMPLATE = app
@@ -23,13 +23,31 @@ SOURCES += src/bar.cpp \
            src/jointload.cpp \
            src/main.cpp \
            src/modelchecker.cpp \
+           src/modelfile.cpp \
+           src/modelfilewriter.cpp \
+           src/modelgraph.cpp \
+           src/modelindex.cpp \
+           src/modeljournal.cpp \
+           src/modelscript.cpp \
            src/modelsolver.cpp \
+           src/modeltablefile.cpp \
+           src/modeltablemodel.cpp \
            src/modelviewer.cpp \
+           src/parametrictruss.cpp \
+           src/pebblegame.cpp \
            src/point.cpp \
+           src/scriptengine.cpp \
            src/scrollarea.cpp \
+           src/solutionresult.cpp \
+           src/solutiontablemodel.cpp \
            src/solver.cpp \
+           src/solverstatistics.cpp \
+           src/sparseldlfactorization.cpp \
+           src/spatialindex.cpp \
+           src/substructuresolver.cpp \
            src/support.cpp \
            src/supportsettlement.cpp \
+           src/symmetrysolver.cpp \
            src/thermaleffect.cpp \
            src/unitsandlimits.cpp \
            src/dialogs/abouttrusstablesdialog.cpp \
@@ -58,10 +76,13 @@ SOURCES += src/bar.cpp \
            src/dialogs/editsupportsettlementsdialog.cpp \
            src/dialogs/editthermaleffectsdialog.cpp \
            src/dialogs/exportmodelimagedialog.cpp \
+           src/dialogs/generatetrussdialog.cpp \
            src/dialogs/modelareadialog.cpp \
            src/dialogs/notesdialog.cpp \
            src/dialogs/scaledeflectionsdialog.cpp \
            src/dialogs/scaleforcesdialog.cpp \
+           src/dialogs/scriptconsoledialog.cpp \
+           src/dialogs/solverdiagnosticsdialog.cpp \
            src/dialogs/unitsandsetupdialog.cpp
 
 HEADERS  += src/bar.h \
@@ -74,13 +95,31 @@ HEADERS  += src/bar.h \
             src/joint.h \
             src/jointload.h \
             src/modelchecker.h \
+            src/modelfile.h \
+            src/modelfilewriter.h \
+            src/modelgraph.h \
+            src/modelindex.h \
+            src/modeljournal.h \
+            src/modelscript.h \
             src/modelsolver.h \
+            src/modeltablefile.h \
+            src/modeltablemodel.h \
             src/modelviewer.h \
+            src/parametrictruss.h \
+            src/pebblegame.h \
             src/point.h \
+            src/scriptengine.h \
             src/scrollarea.h \
+            src/solutionresult.h \
+            src/solutiontablemodel.h \
             src/solver.h \
+            src/solverstatistics.h \
+            src/sparseldlfactorization.h \
+            src/spatialindex.h \
+            src/substructuresolver.h \
             src/support.h \
             src/supportsettlement.h \
+            src/symmetrysolver.h \
             src/thermaleffect.h \
             src/unitsandlimits.h \
             src/dialogs/abouttrusstablesdialog.h \
@@ -109,10 +148,13 @@ HEADERS  += src/bar.h \
             src/dialogs/editsupportsettlementsdialog.h \
             src/dialogs/editthermaleffectsdialog.h \
             src/dialogs/exportmodelimagedialog.h \
+            src/dialogs/generatetrussdialog.h \
             src/dialogs/modelareadialog.h \
             src/dialogs/notesdialog.h \
             src/dialogs/scaledeflectionsdialog.h \
             src/dialogs/scaleforcesdialog.h \
+            src/dialogs/scriptconsoledialog.h \
+            src/dialogs/solverdiagnosticsdialog.h \
             src/dialogs/unitsandsetupdialog.h
 
 FORMS    += src/ui/abouttrusstablesdialog.ui \
@@ -141,10 +183,13 @@ FORMS    += src/ui/abouttrusstablesdialog.ui \
             src/ui/editsupportsettlementsdialog.ui \
             src/ui/editthermaleffectsdialog.ui \
             src/ui/exportmodelimagedialog.ui \
+            src/ui/generatetrussdialog.ui \
             src/ui/modelareadialog.ui \
             src/ui/notesdialog.ui \
             src/ui/scaledeflectionsdialog.ui \
             src/ui/scaleforcesdialog.ui \
+            src/ui/scriptconsoledialog.ui \
+            src/ui/solverdiagnosticsdialog.ui \
             src/ui/unitsandsetupdialog.ui
 
 RESOURCES += \
@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Benchmark suite, builds trusstables-bench from the application sources
+#
+#-------------------------------------------------
+
+include(TrussTables.pro)
+
+TARGET = trusstables-bench
+
+INCLUDEPATH += src/bench
+
+SOURCES -= src/main.cpp
+
+SOURCES += src/bench/benchmain.cpp \
+           src/bench/benchmarkrunner.cpp \
+           src/bench/trussgenerator.cpp
+
+HEADERS += src/bench/benchmarkrunner.h \
+           src/bench/trussgenerator.h
@@ -0,0 +1,152 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* benchmain.cpp */
+
+#include "benchmarkrunner.h"
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QSettings>
+#include <QTextStream>
+
+#include <gsl/gsl_errno.h>
+
+int main(int argc, char *argv[])
+{
+    QApplication application(argc, argv);
+    QCoreApplication::setApplicationName(QString("trusstables-bench"));
+
+    //GSL errors are read from status codes, as in the application
+    gsl_set_error_handler_off();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QString("Times TrussTables on generated trusses and writes JSON lines. "
+                                             "Run with -platform offscreen on machines without a display."));
+    parser.addHelpOption();
+
+    QCommandLineOption typesOption(QString("types"),
+                                   QString("Comma separated truss types: pratt, howe, warren, k, lattice."),
+                                   QString("types"),
+                                   QString("pratt,howe,warren,k,lattice"));
+    QCommandLineOption sizesOption(QString("sizes"),
+                                   QString("Comma separated approximate bar counts, 10 to 1000000."),
+                                   QString("sizes"),
+                                   QString("10,100,1000,10000"));
+    QCommandLineOption stagesOption(QString("stages"),
+                                    QString("Comma separated stages: %1.").arg(BenchmarkRunner::stageNames().join(QString(", "))),
+                                    QString("stages"),
+                                    BenchmarkRunner::stageNames().join(QString(",")));
+    QCommandLineOption denseOption(QString("max-dense-dof"),
+                                   QString("Largest system timed on the dense mirror symmetry, substructure and "
+                                           "pivoted Cholesky paths."),
+                                   QString("count"),
+                                   QString::number(BenchmarkRunner::kMaxDenseDegreesOfFreedom));
+    QCommandLineOption outputOption(QString("output"),
+                                    QString("Write results to file instead of standard output."),
+                                    QString("file"));
+
+    parser.addOption(typesOption);
+    parser.addOption(sizesOption);
+    parser.addOption(stagesOption);
+    parser.addOption(denseOption);
+    parser.addOption(outputOption);
+    parser.process(application);
+
+    QTextStream errorStream(stderr);
+
+    QList<TrussGenerator::TrussType> typesList;
+
+    foreach (const QString &name, parser.value(typesOption).split(QChar(','), QString::SkipEmptyParts))
+    {
+        TrussGenerator::TrussType type;
+
+        if (!TrussGenerator::typeFromName(name, &type))
+        {
+            errorStream << QString("Unknown truss type: %1\n").arg(name);
+            return 1;
+        }
+
+        typesList.append(type);
+    }
+
+    QList<int> sizesList;
+
+    foreach (const QString &size, parser.value(sizesOption).split(QChar(','), QString::SkipEmptyParts))
+    {
+        bool ok;
+        int barsCount = size.trimmed().toInt(&ok);
+
+        if (!ok || barsCount < 1)
+        {
+            errorStream << QString("Invalid size: %1\n").arg(size);
+            return 1;
+        }
+
+        sizesList.append(barsCount);
+    }
+
+    QStringList stagesList;
+
+    foreach (const QString &stage, parser.value(stagesOption).split(QChar(','), QString::SkipEmptyParts))
+    {
+        if (!BenchmarkRunner::stageNames().contains(stage.trimmed()))
+        {
+            errorStream << QString("Unknown stage: %1\n").arg(stage);
+            return 1;
+        }
+
+        stagesList.append(stage.trimmed());
+    }
+
+    QFile outputFile;
+
+    if (parser.isSet(outputOption))
+    {
+        outputFile.setFileName(parser.value(outputOption));
+
+        if (!outputFile.open(QFile::WriteOnly | QFile::Truncate))
+        {
+            errorStream << QString("Cannot write file %1: %2\n").arg(outputFile.fileName()).arg(outputFile.errorString());
+            return 1;
+        }
+    }
+    else
+    {
+        outputFile.open(stdout, QFile::WriteOnly);
+    }
+
+    //Keep the recent files list of the application settings free of benchmark models
+
+    QTemporaryDir settingsDir;
+    QSettings::setPath(QSettings::NativeFormat, QSettings::UserScope, settingsDir.path());
+    QSettings::setPath(QSettings::IniFormat, QSettings::UserScope, settingsDir.path());
+
+    BenchmarkRunner runner(&outputFile);
+    runner.setStages(stagesList);
+    runner.setMaxDenseDegreesOfFreedom(parser.value(denseOption).toInt());
+    runner.writeHeader();
+
+    foreach (TrussGenerator::TrussType type, typesList)
+    {
+        foreach (int barsCount, sizesList)
+        {
+            runner.run(type, barsCount);
+            outputFile.flush();
+        }
+    }
+
+    return 0;
+}
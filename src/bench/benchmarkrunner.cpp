@@ -0,0 +1,520 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* benchmarkrunner.cpp */
+
+#include "benchmarkrunner.h"
+
+BenchmarkRunner::BenchmarkRunner(QIODevice *output, QObject *parent) : QObject(parent)
+{
+    mOutput                   = output;
+    mStagesList               = stageNames();
+    mMaxDenseDegreesOfFreedom = kMaxDenseDegreesOfFreedom;
+    mIsStable                 = false;
+}
+
+BenchmarkRunner::~BenchmarkRunner()
+{
+
+}
+
+QStringList BenchmarkRunner::stageNames()
+{
+    QStringList stagesList;
+    stagesList << QString("check") << QString("solve") << QString("paths") << QString("influence")
+               << QString("file") << QString("render");
+
+    return stagesList;
+}
+
+void BenchmarkRunner::setStages(const QStringList &stagesList)
+{
+    mStagesList = stagesList;
+}
+
+void BenchmarkRunner::setMaxDenseDegreesOfFreedom(int maxDenseDegreesOfFreedom)
+{
+    mMaxDenseDegreesOfFreedom = maxDenseDegreesOfFreedom;
+}
+
+void BenchmarkRunner::writeHeader()
+{
+    QString majorVersion("0");
+    QString minorVersion("0");
+    QString patchVersion("0");
+
+#ifdef TRUSSTABLES_VERSION_MAJOR
+    majorVersion = QString::number(TRUSSTABLES_VERSION_MAJOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_MINOR
+    minorVersion = QString::number(TRUSSTABLES_VERSION_MINOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_PATCH
+    patchVersion = QString::number(TRUSSTABLES_VERSION_PATCH);
+#endif
+
+    QString version = QString("%1.%2.%3").arg(majorVersion).arg(minorVersion).arg(patchVersion);
+
+#ifdef TRUSSTABLES_VERSION_LABEL
+    version += QString("-%1").arg(TRUSSTABLES_VERSION_LABEL);
+#endif
+
+    QJsonObject record;
+    record.insert(QString("version"), version);
+    record.insert(QString("qtVersion"), QString(qVersion()));
+    record.insert(QString("os"), QSysInfo::prettyProductName());
+    record.insert(QString("cpu"), QSysInfo::currentCpuArchitecture());
+    record.insert(QString("threads"), QThread::idealThreadCount());
+    record.insert(QString("stages"), QJsonArray::fromStringList(mStagesList));
+    record.insert(QString("maxDenseDegreesOfFreedom"), mMaxDenseDegreesOfFreedom);
+
+    writeRecord(QString("header"), record);
+}
+
+void BenchmarkRunner::run(TrussGenerator::TrussType type, int barsCount)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    TrussGenerator generator(type, barsCount);
+
+    mModelObject = QJsonObject();
+    mModelObject.insert(QString("truss"), TrussGenerator::typeName(type));
+    mModelObject.insert(QString("requestedBars"), barsCount);
+    mModelObject.insert(QString("joints"), generator.jointsList().size());
+    mModelObject.insert(QString("bars"), generator.barsList().size());
+    mModelObject.insert(QString("supports"), generator.supportsList().size());
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    writeRecord(QString("generate"), record);
+
+    mSolutionResult.clear();
+
+    if (mStagesList.contains(QString("check")))
+    {
+        runChecker(&generator);
+    }
+
+    if (mStagesList.contains(QString("solve")))
+    {
+        runSolve(&generator);
+    }
+
+    if (mStagesList.contains(QString("paths")))
+    {
+        runPaths(type, barsCount);
+    }
+
+    if (mStagesList.contains(QString("influence")))
+    {
+        runInfluence(&generator);
+    }
+
+    if (mStagesList.contains(QString("file")))
+    {
+        runFile(&generator);
+    }
+
+    if (mStagesList.contains(QString("render")))
+    {
+        runRender(&generator);
+    }
+
+    mSolutionResult.clear();
+}
+
+void BenchmarkRunner::setModelStability(bool stability)
+{
+    mIsStable = stability;
+}
+
+void BenchmarkRunner::setSolverStatistics(SolverStatistics statistics)
+{
+    mSolverStatistics = statistics;
+}
+
+void BenchmarkRunner::setSolutionResult(QSharedPointer<const SolutionResult> solutionResult)
+{
+    mSolutionResult = solutionResult;
+}
+
+void BenchmarkRunner::writeRecord(const QString &stage, QJsonObject record)
+{
+    record.insert(QString("stage"), stage);
+
+    QJsonObject::const_iterator i;
+
+    for (i = mModelObject.constBegin(); i != mModelObject.constEnd(); ++i)
+    {
+        record.insert(i.key(), i.value());
+    }
+
+    mOutput->write(QJsonDocument(record).toJson(QJsonDocument::Compact));
+    mOutput->write("\n");
+}
+
+void BenchmarkRunner::runChecker(TrussGenerator *generator)
+{
+    mIsStable = false;
+
+    ModelChecker *modelChecker = new ModelChecker(generator->jointsList(),
+                                                  generator->barsList(),
+                                                  generator->supportsList(),
+                                                  mUnitsAndLimits);
+
+    //Slots run on the checker thread, which has finished before the results are read
+
+    connect(modelChecker, SIGNAL(modelStabilitySignal(bool)), this, SLOT(setModelStability(bool)),
+            Qt::DirectConnection);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    modelChecker->start();
+    modelChecker->wait();
+
+    qint64 elapsedNanoseconds = timer.nsecsElapsed();
+
+    QCoreApplication::sendPostedEvents(0, QEvent::DeferredDelete);
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), elapsedNanoseconds / 1.0e+6);
+    record.insert(QString("stable"), mIsStable);
+    writeRecord(QString("check"), record);
+}
+
+qint64 BenchmarkRunner::runSolver(TrussGenerator *generator, int solutionMethods, bool includeInfluenceLoad)
+{
+    InfluenceLoadResult influenceLoadResult(0, 0);
+    QString influenceLoadName;
+    QList<InfluenceLoad *> influenceLoadsList;
+
+    if (includeInfluenceLoad)
+    {
+        influenceLoadName  = generator->influenceLoadName();
+        influenceLoadsList = generator->influenceLoadsList();
+    }
+
+    ModelSolver *modelSolver = new ModelSolver(generator->jointsList(),
+                                               generator->barsList(),
+                                               generator->supportsList(),
+                                               generator->jointLoadsList(),
+                                               true,
+                                               true,
+                                               QList<SupportSettlement *>(),
+                                               QList<ThermalEffect *>(),
+                                               QList<FabricationError *>(),
+                                               influenceLoadsList,
+                                               influenceLoadName,
+                                               &influenceLoadResult,
+                                               mUnitsAndLimits);
+
+    modelSolver->setSolutionMethods(solutionMethods);
+
+    connect(modelSolver, SIGNAL(statisticsSignal(SolverStatistics)), this, SLOT(setSolverStatistics(SolverStatistics)),
+            Qt::DirectConnection);
+    connect(modelSolver, SIGNAL(solutionSignal(QSharedPointer<const SolutionResult>)),
+            this, SLOT(setSolutionResult(QSharedPointer<const SolutionResult>)), Qt::DirectConnection);
+
+    mSolverStatistics = SolverStatistics();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    modelSolver->start();
+    modelSolver->wait();
+
+    qint64 elapsedNanoseconds = timer.nsecsElapsed();
+
+    QCoreApplication::sendPostedEvents(0, QEvent::DeferredDelete);
+
+    return elapsedNanoseconds;
+}
+
+void BenchmarkRunner::runSolve(TrussGenerator *generator)
+{
+    qint64 elapsedNanoseconds = runSolver(generator, ModelSolver::ALL_METHODS, false);
+
+    QJsonObject statisticsObject = mSolverStatistics.toJson();
+
+    foreach (const QJsonValue &value, statisticsObject.value(QString("phases")).toArray())
+    {
+        QJsonObject phaseObject = value.toObject();
+
+        if (phaseObject.value(QString("name")).toString() == QString("Assembly"))
+        {
+            QJsonObject record;
+            record.insert(QString("milliseconds"), phaseObject.value(QString("milliseconds")));
+            record.insert(QString("degreesOfFreedom"), statisticsObject.value(QString("degreesOfFreedom")));
+            record.insert(QString("stiffnessNonZeros"), statisticsObject.value(QString("stiffnessNonZeros")));
+            writeRecord(QString("assembly"), record);
+        }
+    }
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), elapsedNanoseconds / 1.0e+6);
+    record.insert(QString("method"), QString("auto"));
+    record.insert(QString("solved"), !mSolutionResult.isNull());
+    record.insert(QString("statistics"), statisticsObject);
+    writeRecord(QString("solve"), record);
+}
+
+void BenchmarkRunner::runPaths(TrussGenerator::TrussType type, int barsCount)
+{
+    //Pinned ends without inclined rollers keep every path eligible, including mirror symmetry and GMRES
+
+    TrussGenerator generator(type, barsCount, TrussGenerator::SYMMETRIC_SUPPORTS);
+
+    QStringList methodNamesList;
+    methodNamesList << QString("mirror") << QString("substructure") << QString("gmres") << QString("cholesky");
+
+    QList<int> methodsList;
+    methodsList << ModelSolver::MIRROR_SYMMETRY_METHOD << ModelSolver::SUBSTRUCTURE_METHOD
+                << ModelSolver::GMRES_METHOD << ModelSolver::PIVOTED_CHOLESKY_METHOD;
+
+    int degreesOfFreedom = 2 * generator.jointsList().size();
+
+    for (int i = 0; i < methodsList.size(); ++i)
+    {
+        QJsonObject record;
+        record.insert(QString("method"), methodNamesList.at(i));
+
+        //Every path but GMRES factorizes dense matrices
+
+        if (methodsList.at(i) != ModelSolver::GMRES_METHOD && degreesOfFreedom > mMaxDenseDegreesOfFreedom)
+        {
+            record.insert(QString("skipped"), true);
+            writeRecord(QString("path"), record);
+            continue;
+        }
+
+        mSolutionResult.clear();
+
+        qint64 elapsedNanoseconds = runSolver(&generator, methodsList.at(i), false);
+
+        record.insert(QString("milliseconds"), elapsedNanoseconds / 1.0e+6);
+        record.insert(QString("solved"), !mSolutionResult.isNull());
+        record.insert(QString("statistics"), mSolverStatistics.toJson());
+        writeRecord(QString("path"), record);
+    }
+
+    mSolutionResult.clear();
+}
+
+void BenchmarkRunner::runInfluence(TrussGenerator *generator)
+{
+    QSharedPointer<const SolutionResult> solutionResult = mSolutionResult;
+
+    qint64 elapsedNanoseconds = runSolver(generator, ModelSolver::ALL_METHODS, true);
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), elapsedNanoseconds / 1.0e+6);
+    record.insert(QString("pathJoints"), generator->influenceLoadsList().first()->path().size());
+    record.insert(QString("statistics"), mSolverStatistics.toJson());
+    writeRecord(QString("influence"), record);
+
+    mSolutionResult = solutionResult;
+}
+
+void BenchmarkRunner::runFile(TrussGenerator *generator)
+{
+    QString modelFileName = QDir(mTemporaryDir.path()).filePath(QString("model.tt"));
+    QString saveFileName  = QDir(mTemporaryDir.path()).filePath(QString("saved.tt"));
+
+    if (!mTemporaryDir.isValid() || !generator->writeModelFile(modelFileName, mUnitsAndLimits))
+    {
+        QJsonObject record;
+        record.insert(QString("skipped"), true);
+        writeRecord(QString("load"), record);
+        return;
+    }
+
+    Solver *solver = new Solver;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    bool loaded = solver->loadFile(modelFileName);
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("bytes"), QFileInfo(modelFileName).size());
+    record.insert(QString("succeeded"), loaded);
+    writeRecord(QString("load"), record);
+
+    timer.restart();
+
+    bool saved = solver->saveFile(saveFileName);
+
+    record = QJsonObject();
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("bytes"), QFileInfo(saveFileName).size());
+    record.insert(QString("succeeded"), saved);
+    writeRecord(QString("save"), record);
+
+    delete solver;
+
+    //The generated model is in the earlier format, and the saved one in the current format
+
+    solver = new Solver;
+
+    timer.restart();
+
+    bool reloaded = saved && solver->loadFile(saveFileName);
+
+    record = QJsonObject();
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("bytes"), QFileInfo(saveFileName).size());
+    record.insert(QString("succeeded"), reloaded);
+    writeRecord(QString("reload"), record);
+
+    delete solver;
+
+    //The saved model rewritten with compressed sections, and opened from that
+
+    QString compressedFileName = QDir(mTemporaryDir.path()).filePath(QString("compressed.tt"));
+
+    ModelFile savedFile;
+    ModelFile compressedFile;
+    QFile file(compressedFileName);
+
+    bool compressed = saved && savedFile.open(saveFileName) && file.open(QFile::WriteOnly);
+
+    if (compressed)
+    {
+        for (int i = 0; i < ModelFile::PROPERTIES_COUNT; ++i)
+        {
+            compressedFile.setProperty(ModelFile::Property(i), savedFile.property(ModelFile::Property(i)));
+        }
+
+        foreach (int section, savedFile.sections())
+        {
+            compressedFile.copySection(savedFile, ModelFile::Section(section));
+        }
+
+        compressedFile.setCompressed(true);
+
+        timer.restart();
+        compressed = compressedFile.write(&file);
+        file.close();
+    }
+
+    record = QJsonObject();
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("bytes"), QFileInfo(compressedFileName).size());
+    record.insert(QString("succeeded"), compressed);
+    writeRecord(QString("compressedSave"), record);
+
+    solver = new Solver;
+
+    timer.restart();
+
+    reloaded = compressed && solver->loadFile(compressedFileName);
+
+    record = QJsonObject();
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("bytes"), QFileInfo(compressedFileName).size());
+    record.insert(QString("succeeded"), reloaded);
+    writeRecord(QString("compressedReload"), record);
+
+    delete solver;
+
+    QFile::remove(modelFileName);
+    QFile::remove(saveFileName);
+    QFile::remove(compressedFileName);
+}
+
+void BenchmarkRunner::runRender(TrussGenerator *generator)
+{
+    QList<Joint *> jointsList                       = generator->jointsList();
+    QList<Bar *> barsList                           = generator->barsList();
+    QList<Support *> supportsList                   = generator->supportsList();
+    QList<JointLoad *> jointLoadsList               = generator->jointLoadsList();
+    QList<SupportSettlement *> supportSettlementsList;
+    QList<ThermalEffect *> thermalEffectsList;
+    QList<FabricationError *> fabricationErrorsList;
+    QList<InfluenceLoad *> influenceLoadsList       = generator->influenceLoadsList();
+    QString solutionInfluenceLoadName;
+    InfluenceLoadResult influenceLoadResult(0, 0);
+
+    ModelTableModel barsTableModel(ModelTableModel::BARS, &mUnitsAndLimits, &jointsList, &barsList, &supportsList);
+    barsTableModel.setColumnCount(5);
+
+    ModelViewer modelViewer(&mUnitsAndLimits,
+                            &jointsList,
+                            &barsList,
+                            &supportsList,
+                            &jointLoadsList,
+                            &supportSettlementsList,
+                            &thermalEffectsList,
+                            &fabricationErrorsList,
+                            &influenceLoadsList,
+                            &barsTableModel,
+                            &mSolutionResult,
+                            &solutionInfluenceLoadName,
+                            &influenceLoadResult);
+
+    modelViewer.updateSize(kImageWidth, kImageHeight, 75);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QImage image = modelViewer.modelImage(ModelViewer::JOINT_LOAD, ModelViewer::NO_SOLUTION, 0);
+
+    QJsonObject record;
+    record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+    record.insert(QString("display"), QString("joint loads"));
+    record.insert(QString("width"), image.width());
+    record.insert(QString("height"), image.height());
+    writeRecord(QString("render"), record);
+
+    //The viewport at the model origin, drawn into an empty tile cache and again from the cached tiles
+
+    QImage viewportImage(kViewportWidth, kViewportHeight, QImage::Format_RGB32);
+    QRegion viewportRegion(0, kImageHeight - kViewportHeight, kViewportWidth, kViewportHeight);
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        timer.restart();
+
+        modelViewer.render(&viewportImage, QPoint(), viewportRegion);
+
+        record = QJsonObject();
+        record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+        record.insert(QString("display"), QString("model tiles"));
+        record.insert(QString("cached"), pass == 1);
+        record.insert(QString("width"), viewportImage.width());
+        record.insert(QString("height"), viewportImage.height());
+        writeRecord(QString("render"), record);
+    }
+
+    if (!mSolutionResult.isNull())
+    {
+        timer.restart();
+
+        image = modelViewer.modelImage(ModelViewer::NO_LOAD, ModelViewer::BAR_LOAD, 0);
+
+        record = QJsonObject();
+        record.insert(QString("milliseconds"), timer.nsecsElapsed() / 1.0e+6);
+        record.insert(QString("display"), QString("bar loads"));
+        record.insert(QString("width"), image.width());
+        record.insert(QString("height"), image.height());
+        writeRecord(QString("render"), record);
+    }
+}
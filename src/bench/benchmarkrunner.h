@@ -0,0 +1,115 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* benchmarkrunner.h */
+
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QFile>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QObject>
+#include <QPoint>
+#include <QRegion>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QSysInfo>
+#include <QTemporaryDir>
+#include <QThread>
+
+#include <config.h>
+
+#include "influenceloadresult.h"
+#include "modelchecker.h"
+#include "modelsolver.h"
+#include "modeltablemodel.h"
+#include "modelviewer.h"
+#include "solutionresult.h"
+#include "solver.h"
+#include "solverstatistics.h"
+#include "trussgenerator.h"
+#include "unitsandlimits.h"
+
+//Times checking, solving, file input/output and rendering of generated trusses and writes one JSON object per line
+class BenchmarkRunner : public QObject
+{
+        Q_OBJECT
+
+    public:
+        explicit BenchmarkRunner(QIODevice *output, QObject *parent = 0);
+
+        ~BenchmarkRunner();
+
+        //Largest system timed alone on the dense mirror symmetry, substructure and pivoted Cholesky paths
+        static const int kMaxDenseDegreesOfFreedom = 4000;
+
+        static const int kImageWidth  = 1600;
+        static const int kImageHeight = 1200;
+
+        //Part of the model viewer drawn from tiles, as the scroll area would show it
+        static const int kViewportWidth  = 800;
+        static const int kViewportHeight = 600;
+
+        static QStringList stageNames();
+
+        void setStages(const QStringList &stagesList);
+
+        void setMaxDenseDegreesOfFreedom(int maxDenseDegreesOfFreedom);
+
+        void writeHeader();
+
+        void run(TrussGenerator::TrussType type, int barsCount);
+
+    private slots:
+        void setModelStability(bool stability);
+        void setSolverStatistics(SolverStatistics statistics);
+        void setSolutionResult(QSharedPointer<const SolutionResult> solutionResult);
+
+    private:
+        QIODevice                            *mOutput;
+        QStringList                          mStagesList;
+        int                                  mMaxDenseDegreesOfFreedom;
+        UnitsAndLimits                       mUnitsAndLimits;
+        QTemporaryDir                        mTemporaryDir;
+        QJsonObject                          mModelObject;
+        bool                                 mIsStable;
+        SolverStatistics                     mSolverStatistics;
+        QSharedPointer<const SolutionResult> mSolutionResult;
+
+        void writeRecord(const QString &stage, QJsonObject record);
+
+        void runChecker(TrussGenerator *generator);
+
+        //Run the solver thread to completion with the given solution paths enabled and return its wall time
+        qint64 runSolver(TrussGenerator *generator, int solutionMethods, bool includeInfluenceLoad);
+
+        void runSolve(TrussGenerator *generator);
+        void runPaths(TrussGenerator::TrussType type, int barsCount);
+        void runInfluence(TrussGenerator *generator);
+        void runFile(TrussGenerator *generator);
+        void runRender(TrussGenerator *generator);
+};
+
+#endif // BENCHMARKRUNNER_H
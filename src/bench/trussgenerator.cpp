@@ -0,0 +1,641 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* trussgenerator.cpp */
+
+#include "trussgenerator.h"
+
+TrussGenerator::TrussGenerator(TrussType     type,
+                               int           barsCount,
+                               SupportLayout supportLayout,
+                               QObject       *parent) : QObject(parent)
+{
+    mType = type;
+
+    int panelsCount = 0;
+
+    switch (type)
+    {
+        case PRATT_TRUSS:
+        case HOWE_TRUSS:
+            panelsCount = qMax(4, (barsCount + 3) / 4);
+            break;
+        case WARREN_TRUSS:
+            panelsCount = qMax(4, (barsCount + 1) / 4);
+            break;
+        case K_TRUSS:
+            panelsCount = qMax(4, barsCount / 6);
+            break;
+        case LATTICE_GRID:
+            panelsCount = qMax(1, int(qSqrt(barsCount / 6.0)));
+            break;
+        default:
+            break;
+    }
+
+    //An even number of panels keeps the chorded trusses mirror symmetric about midspan
+
+    if (type != LATTICE_GRID && panelsCount % 2 != 0)
+    {
+        ++panelsCount;
+    }
+
+    switch (type)
+    {
+        case PRATT_TRUSS:
+            generatePrattTruss(panelsCount, false);
+            addSpanSupports(0, panelsCount / 2, panelsCount, supportLayout);
+            break;
+        case HOWE_TRUSS:
+            generatePrattTruss(panelsCount, true);
+            addSpanSupports(0, panelsCount / 2, panelsCount, supportLayout);
+            break;
+        case WARREN_TRUSS:
+            generateWarrenTruss(panelsCount);
+            addSpanSupports(0, panelsCount / 2, panelsCount, supportLayout);
+            break;
+        case K_TRUSS:
+            generateKTruss(panelsCount);
+            addSpanSupports(0, panelsCount / 2, panelsCount, supportLayout);
+            break;
+        case LATTICE_GRID:
+            generateLatticeGrid(2 * panelsCount, panelsCount);
+            addSpanSupports(0, panelsCount, 2 * panelsCount, supportLayout);
+            break;
+        default:
+            break;
+    }
+
+    addLoads();
+}
+
+TrussGenerator::~TrussGenerator()
+{
+
+}
+
+QString TrussGenerator::typeName(TrussType type)
+{
+    switch (type)
+    {
+        case PRATT_TRUSS:
+            return QString("pratt");
+        case HOWE_TRUSS:
+            return QString("howe");
+        case WARREN_TRUSS:
+            return QString("warren");
+        case K_TRUSS:
+            return QString("k");
+        case LATTICE_GRID:
+            return QString("lattice");
+        default:
+            return QString();
+    }
+}
+
+bool TrussGenerator::typeFromName(const QString &name, TrussType *type)
+{
+    QList<TrussType> typesList;
+    typesList << PRATT_TRUSS << HOWE_TRUSS << WARREN_TRUSS << K_TRUSS << LATTICE_GRID;
+
+    foreach (TrussType trussType, typesList)
+    {
+        if (typeName(trussType) == name.trimmed().toLower())
+        {
+            *type = trussType;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TrussGenerator::TrussType TrussGenerator::type() const
+{
+    return mType;
+}
+
+const QList<Joint *> &TrussGenerator::jointsList() const
+{
+    return mJointsList;
+}
+
+const QList<Bar *> &TrussGenerator::barsList() const
+{
+    return mBarsList;
+}
+
+const QList<Support *> &TrussGenerator::supportsList() const
+{
+    return mSupportsList;
+}
+
+const QList<JointLoad *> &TrussGenerator::jointLoadsList() const
+{
+    return mJointLoadsList;
+}
+
+const QList<InfluenceLoad *> &TrussGenerator::influenceLoadsList() const
+{
+    return mInfluenceLoadsList;
+}
+
+QString TrussGenerator::influenceLoadName() const
+{
+    return QString("Bench");
+}
+
+bool TrussGenerator::writeModelFile(const QString &fileName, const UnitsAndLimits &unitsAndLimits) const
+{
+    QSaveFile saveFile(fileName);
+
+    if (!saveFile.open(QSaveFile::WriteOnly))
+    {
+        return false;
+    }
+
+    QDataStream out(&saveFile);
+    out.setVersion(QDataStream::Qt_5_4);
+    out << quint32(0x25438F7BEA4);
+
+    QString majorVersion("0");
+    QString minorVersion("0");
+    QString patchVersion("0");
+
+#ifdef TRUSSTABLES_VERSION_MAJOR
+    majorVersion = QString::number(TRUSSTABLES_VERSION_MAJOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_MINOR
+    minorVersion = QString::number(TRUSSTABLES_VERSION_MINOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_PATCH
+    patchVersion = QString::number(TRUSSTABLES_VERSION_PATCH);
+#endif
+
+    out << QString("%1.%2.%3").arg(majorVersion).arg(minorVersion).arg(patchVersion);
+
+    //Description and Units
+
+    out << QString("%1 truss benchmark model").arg(typeName(mType));
+    out << unitsAndLimits.system();
+    out << unitsAndLimits.coordinateUnit();
+    out << unitsAndLimits.areaUnit();
+    out << unitsAndLimits.modulusUnit();
+    out << unitsAndLimits.unitWeightUnit();
+    out << unitsAndLimits.loadUnit();
+    out << unitsAndLimits.supportSettlementUnit();
+    out << unitsAndLimits.temperatureChangeUnit();
+    out << unitsAndLimits.thermalCoefficientUnit();
+    out << unitsAndLimits.lengthErrorUnit();
+
+    //Joint Coordinates
+
+    QList<qreal> xCoordinateList;
+    QList<qreal> yCoordinateList;
+
+    foreach (Joint *joint, mJointsList)
+    {
+        xCoordinateList.append(joint->xCoordinate());
+        yCoordinateList.append(joint->yCoordinate());
+    }
+
+    out << xCoordinateList;
+    out << yCoordinateList;
+
+    //Bars
+
+    QList<qint32> firstJointList;
+    QList<qint32> secondJointList;
+    QList<qreal> areaList;
+    QList<qreal> modulusList;
+    QList<qreal> factorList;
+    QList<qreal> unitWeightList;
+
+    QHash<Joint *, int> jointNumbersHash;
+
+    for (int i = 0; i < mJointsList.size(); ++i)
+    {
+        jointNumbersHash.insert(mJointsList.at(i), i + 1);
+    }
+
+    foreach (Bar *bar, mBarsList)
+    {
+        firstJointList.append(qint32(jointNumbersHash.value(bar->firstJoint())));
+        secondJointList.append(qint32(jointNumbersHash.value(bar->secondJoint())));
+        areaList.append(bar->area());
+        modulusList.append(bar->modulus());
+        factorList.append(bar->factor());
+        unitWeightList.append(bar->unitWeight());
+    }
+
+    out << QString("value");
+    out << firstJointList;
+    out << secondJointList;
+    out << areaList;
+    out << modulusList;
+    out << factorList;
+    out << unitWeightList;
+
+    //Supports
+
+    QList<qint32> supportJointList;
+    QList<qint32> supportTypeList;
+    QList<qreal> supportAngleList;
+
+    foreach (Support *support, mSupportsList)
+    {
+        qint32 supportType = 3;
+
+        switch (support->type())
+        {
+            case UnitsAndLimits::FIXED_LEFT:
+                supportType = 0;
+                break;
+            case UnitsAndLimits::FIXED_TOP:
+                supportType = 1;
+                break;
+            case UnitsAndLimits::FIXED_RIGHT:
+                supportType = 2;
+                break;
+            case UnitsAndLimits::FIXED_BOTTOM:
+                supportType = 3;
+                break;
+            case UnitsAndLimits::ROLLER:
+                supportType = 4;
+                break;
+            case UnitsAndLimits::ROLLER_LEFT:
+                supportType = 5;
+                break;
+            case UnitsAndLimits::ROLLER_TOP:
+                supportType = 6;
+                break;
+            case UnitsAndLimits::ROLLER_RIGHT:
+                supportType = 7;
+                break;
+            case UnitsAndLimits::ROLLER_BOTTOM:
+                supportType = 8;
+                break;
+            default:
+                break;
+        }
+
+        supportJointList.append(qint32(jointNumbersHash.value(support->supportJoint())));
+        supportTypeList.append(supportType);
+        supportAngleList.append(support->angle());
+    }
+
+    out << supportJointList;
+    out << supportTypeList;
+    out << supportAngleList;
+
+    //Loads
+
+    out << true;
+
+    QList<qint32> loadJointList;
+    QList<qreal> loadHorizontalComponentList;
+    QList<qreal> loadVerticalComponentList;
+    QList<QString> loadPositionList;
+
+    foreach (JointLoad *load, mJointLoadsList)
+    {
+        loadJointList.append(qint32(jointNumbersHash.value(load->loadJoint())));
+        loadHorizontalComponentList.append(load->horizontalComponent());
+        loadVerticalComponentList.append(load->verticalComponent());
+        loadPositionList.append(load->position());
+    }
+
+    out << loadJointList;
+    out << loadHorizontalComponentList;
+    out << loadVerticalComponentList;
+    out << loadPositionList;
+
+    //No support settlements, thermal effects or fabrication errors
+
+    out << QList<qint32>() << QList<qreal>();
+    out << QList<qint32>() << QList<qreal>() << QList<qreal>();
+    out << QList<qint32>() << QList<qreal>();
+
+    //Influence Loads
+
+    int count = mInfluenceLoadsList.size();
+    out << count;
+
+    for (int i = 0; i < count; ++i)
+    {
+        out << mInfluenceLoadsList.at(i)->name();
+        out << mInfluenceLoadsList.at(i)->direction();
+
+        QList<qint32> pathList;
+
+        foreach (int jointNumber, mInfluenceLoadsList.at(i)->path())
+        {
+            pathList.append(qint32(jointNumber));
+        }
+
+        out << pathList;
+        out << mInfluenceLoadsList.at(i)->pointLoads();
+        out << mInfluenceLoadsList.at(i)->pointLoadPositions();
+    }
+
+    return saveFile.commit();
+}
+
+int TrussGenerator::addJoint(qreal x, qreal y)
+{
+    Joint *joint = new Joint(x, y, this);
+    mJointsList.append(joint);
+
+    return mJointsList.size() - 1;
+}
+
+void TrussGenerator::addBar(int firstJointIndex, int secondJointIndex)
+{
+    Joint *jointA = mJointsList.at(firstJointIndex);
+    Joint *jointB = mJointsList.at(secondJointIndex);
+
+    jointA->connectedJoints()->append(jointB);
+    jointB->connectedJoints()->append(jointA);
+
+    Bar *bar = new Bar(jointA, jointB, kArea, kModulus, 1.0, kUnitWeight, this);
+    mBarsList.append(bar);
+
+    jointA->attachedBars()->append(bar);
+    jointB->attachedBars()->append(bar);
+}
+
+void TrussGenerator::addSupport(UnitsAndLimits::SupportType type, qreal angle, int jointIndex)
+{
+    Joint *joint     = mJointsList.at(jointIndex);
+    Support *support = new Support(type, angle, joint, this);
+
+    joint->setSupported(true);
+    mSupportsList.append(support);
+}
+
+void TrussGenerator::generatePrattTruss(int panelsCount, bool howe)
+{
+    //Bottom chord joints 0 to n, top chord joints n + 1 to 2n - 1 above bottom joints 1 to n - 1
+
+    int n = panelsCount;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        addJoint(i * kPanelLength, 0.0);
+        mPathList.append(i + 1);
+
+        if (i > 0 && i < n)
+        {
+            mLoadedJointsList.append(i);
+        }
+    }
+
+    for (int i = 1; i < n; ++i)
+    {
+        addJoint(i * kPanelLength, kHeight);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addBar(i, i + 1);
+    }
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        addBar(n + i, n + i + 1);
+    }
+
+    for (int i = 1; i < n; ++i)
+    {
+        addBar(i, n + i);
+    }
+
+    addBar(0, n + 1);
+    addBar(n, 2 * n - 1);
+
+    //Pratt diagonals slope down towards midspan, Howe diagonals slope up towards midspan
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        bool descending = (2 * i < n);
+
+        if (howe)
+        {
+            descending = !descending;
+        }
+
+        if (descending)
+        {
+            addBar(n + i, i + 1);
+        }
+        else
+        {
+            addBar(i, n + i + 1);
+        }
+    }
+}
+
+void TrussGenerator::generateWarrenTruss(int panelsCount)
+{
+    //Bottom chord joints 0 to n, top chord joints n + 1 to 2n above the panel midpoints
+
+    int n = panelsCount;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        addJoint(i * kPanelLength, 0.0);
+        mPathList.append(i + 1);
+
+        if (i > 0 && i < n)
+        {
+            mLoadedJointsList.append(i);
+        }
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addJoint((i + 0.5) * kPanelLength, kHeight);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addBar(i, i + 1);
+        addBar(i, n + 1 + i);
+        addBar(n + 1 + i, i + 1);
+    }
+
+    for (int i = 0; i < n - 1; ++i)
+    {
+        addBar(n + 1 + i, n + 2 + i);
+    }
+}
+
+void TrussGenerator::generateKTruss(int panelsCount)
+{
+    //Bottom chord joints 0 to n, top chord joints n + 1 to 2n + 1 and mid-height joints 2n + 2 to 3n on the
+    //interior verticals, each braced by a pair of diagonals to the vertical on its side of midspan
+
+    int n = panelsCount;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        addJoint(i * kPanelLength, 0.0);
+        mPathList.append(i + 1);
+
+        if (i > 0 && i < n)
+        {
+            mLoadedJointsList.append(i);
+        }
+    }
+
+    for (int i = 0; i <= n; ++i)
+    {
+        addJoint(i * kPanelLength, kHeight);
+    }
+
+    for (int i = 1; i < n; ++i)
+    {
+        addJoint(i * kPanelLength, 0.5 * kHeight);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addBar(i, i + 1);
+        addBar(n + 1 + i, n + 2 + i);
+    }
+
+    addBar(0, n + 1);
+    addBar(n, 2 * n + 1);
+
+    for (int i = 1; i < n; ++i)
+    {
+        int midJoint = 2 * n + 1 + i;
+
+        addBar(i, midJoint);
+        addBar(midJoint, n + 1 + i);
+
+        if (2 * i <= n)
+        {
+            addBar(midJoint, i - 1);
+            addBar(midJoint, n + i);
+        }
+
+        if (2 * i >= n)
+        {
+            addBar(midJoint, i + 1);
+            addBar(midJoint, n + 2 + i);
+        }
+    }
+}
+
+void TrussGenerator::generateLatticeGrid(int columnsCount, int rowsCount)
+{
+    //Square cells braced by one diagonal each, mirrored about the middle column
+
+    int rowJointsCount = columnsCount + 1;
+
+    for (int r = 0; r <= rowsCount; ++r)
+    {
+        for (int c = 0; c <= columnsCount; ++c)
+        {
+            addJoint(c * kPanelLength, r * kPanelLength);
+        }
+    }
+
+    for (int c = 0; c <= columnsCount; ++c)
+    {
+        mPathList.append(c + 1);
+
+        if (c > 0 && c < columnsCount)
+        {
+            mLoadedJointsList.append(c);
+        }
+    }
+
+    for (int r = 0; r <= rowsCount; ++r)
+    {
+        for (int c = 0; c < columnsCount; ++c)
+        {
+            addBar(r * rowJointsCount + c, r * rowJointsCount + c + 1);
+        }
+    }
+
+    for (int r = 0; r < rowsCount; ++r)
+    {
+        for (int c = 0; c <= columnsCount; ++c)
+        {
+            addBar(r * rowJointsCount + c, (r + 1) * rowJointsCount + c);
+        }
+
+        for (int c = 0; c < columnsCount; ++c)
+        {
+            if (2 * c < columnsCount)
+            {
+                addBar(r * rowJointsCount + c, (r + 1) * rowJointsCount + c + 1);
+            }
+            else
+            {
+                addBar(r * rowJointsCount + c + 1, (r + 1) * rowJointsCount + c);
+            }
+        }
+    }
+}
+
+void TrussGenerator::addSpanSupports(int           leftJointIndex,
+                                     int           middleJointIndex,
+                                     int           rightJointIndex,
+                                     SupportLayout supportLayout)
+{
+    if (supportLayout == SYMMETRIC_SUPPORTS)
+    {
+        addSupport(UnitsAndLimits::FIXED_BOTTOM, 0.0, leftJointIndex);
+        addSupport(UnitsAndLimits::FIXED_BOTTOM, 0.0, rightJointIndex);
+    }
+    else
+    {
+        addSupport(UnitsAndLimits::FIXED_BOTTOM, 0.0, leftJointIndex);
+        addSupport(UnitsAndLimits::ROLLER_BOTTOM, 0.0, middleJointIndex);
+        addSupport(UnitsAndLimits::ROLLER, kRollerAngle, rightJointIndex);
+    }
+}
+
+void TrussGenerator::addLoads()
+{
+    foreach (int jointIndex, mLoadedJointsList)
+    {
+        Joint *joint = mJointsList.at(jointIndex);
+
+        if (!joint->isSupported())
+        {
+            mJointLoadsList.append(new JointLoad(joint, 0.0, -kJointLoad, QString("tail"), this));
+        }
+    }
+
+    QList<qreal> pointLoads;
+    pointLoads << kJointLoad << kJointLoad;
+
+    QList<qreal> pointLoadPositions;
+    pointLoadPositions << 0.0 << kPanelLength;
+
+    mInfluenceLoadsList.append(new InfluenceLoad(influenceLoadName(),
+                                                 QString("LR"),
+                                                 mPathList,
+                                                 pointLoads,
+                                                 pointLoadPositions,
+                                                 this));
+}
@@ -0,0 +1,121 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* trussgenerator.h */
+
+#ifndef TRUSSGENERATOR_H
+#define TRUSSGENERATOR_H
+
+#include <QDataStream>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QSaveFile>
+#include <QString>
+#include <QtMath>
+
+#include <config.h>
+
+#include "bar.h"
+#include "influenceload.h"
+#include "joint.h"
+#include "jointload.h"
+#include "support.h"
+#include "unitsandlimits.h"
+
+//Builds synthetic plane trusses of a requested size for the benchmark suite
+class TrussGenerator : public QObject
+{
+        Q_OBJECT
+
+    public:
+        enum TrussType
+        {
+            PRATT_TRUSS,
+            HOWE_TRUSS,
+            WARREN_TRUSS,
+            K_TRUSS,
+            LATTICE_GRID
+        };
+
+        enum SupportLayout
+        {
+            MIXED_SUPPORTS,
+            SYMMETRIC_SUPPORTS
+        };
+
+        //Generated model has approximately barsCount bars
+        TrussGenerator(TrussType     type,
+                       int           barsCount,
+                       SupportLayout supportLayout = MIXED_SUPPORTS,
+                       QObject       *parent       = 0);
+
+        ~TrussGenerator();
+
+        static const qreal kPanelLength = 4.0;
+        static const qreal kHeight      = 4.0;
+        static const qreal kArea        = 2500.0;
+        static const qreal kModulus     = 200.0;
+        static const qreal kUnitWeight  = 77.0;
+        static const qreal kJointLoad   = 10.0;
+        static const qreal kRollerAngle = 30.0;
+
+        static QString typeName(TrussType type);
+
+        static bool typeFromName(const QString &name, TrussType *type);
+
+        TrussType type() const;
+
+        const QList<Joint *> &jointsList() const;
+
+        const QList<Bar *> &barsList() const;
+
+        const QList<Support *> &supportsList() const;
+
+        const QList<JointLoad *> &jointLoadsList() const;
+
+        const QList<InfluenceLoad *> &influenceLoadsList() const;
+
+        QString influenceLoadName() const;
+
+        //Write the model in the TrussTables file format with area and modulus values
+        bool writeModelFile(const QString &fileName, const UnitsAndLimits &unitsAndLimits) const;
+
+    private:
+        TrussType              mType;
+        QList<Joint *>         mJointsList;
+        QList<Bar *>           mBarsList;
+        QList<Support *>       mSupportsList;
+        QList<JointLoad *>     mJointLoadsList;
+        QList<InfluenceLoad *> mInfluenceLoadsList;
+        QList<int>             mLoadedJointsList;
+        QList<int>             mPathList;
+
+        int addJoint(qreal x, qreal y);
+        void addBar(int firstJointIndex, int secondJointIndex);
+        void addSupport(UnitsAndLimits::SupportType type, qreal angle, int jointIndex);
+
+        //Chorded trusses carry one load per bottom chord joint and use the bottom chord as the load path
+        void generatePrattTruss(int panelsCount, bool howe);
+        void generateWarrenTruss(int panelsCount);
+        void generateKTruss(int panelsCount);
+        void generateLatticeGrid(int columnsCount, int rowsCount);
+
+        void addSpanSupports(int leftJointIndex, int middleJointIndex, int rightJointIndex, SupportLayout supportLayout);
+        void addLoads();
+};
+
+#endif // TRUSSGENERATOR_H
@@ -60,12 +60,15 @@ void AddBarsDialog::updateMirrorJointOptions()
 {
     ui->mirrorJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList jointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        int jointNumber = mJointsList->indexOf(joint) + 1;
-        ui->mirrorJointComboBox->addItem(QString::number(jointNumber));
+        jointNumbers.append(QString::number(i + 1));
     }
 
+    ui->mirrorJointComboBox->addItems(jointNumbers);
+
     ui->mirrorJointComboBox->setCurrentIndex(-1);
     ui->mirrorAxisComboBox->setCurrentIndex(-1);
 }
@@ -165,12 +168,15 @@ void AddBarsDialog::updateFirstJointOptions()
 {
     ui->fromJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList jointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        int jointNumber = mJointsList->indexOf(joint) + 1;
-        ui->fromJointComboBox->addItem(QString::number(jointNumber));
+        jointNumbers.append(QString::number(i + 1));
     }
 
+    ui->fromJointComboBox->addItems(jointNumbers);
+
     ui->fromJointComboBox->setCurrentIndex(-1);
     ui->toJointComboBox->clear();
     updateMirrorJointOptions();
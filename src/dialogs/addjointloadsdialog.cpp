@@ -53,12 +53,15 @@ void AddJointLoadsDialog::updateJoints()
 {
     ui->loadJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList jointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        int jointNumber = mJointsList->indexOf(joint) + 1;
-        ui->loadJointComboBox->addItem(QString::number(jointNumber));
+        jointNumbers.append(QString::number(i + 1));
     }
 
+    ui->loadJointComboBox->addItems(jointNumbers);
+
     ui->loadJointComboBox->setCurrentIndex(-1);
 }
 
@@ -54,12 +54,15 @@ void AddJointsDialog::updateJoints()
 {
     ui->mirrorJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList jointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        int jointNumber = mJointsList->indexOf(joint) + 1;
-        ui->mirrorJointComboBox->addItem(QString::number(jointNumber));
+        jointNumbers.append(QString::number(i + 1));
     }
 
+    ui->mirrorJointComboBox->addItems(jointNumbers);
+
     ui->mirrorAxisComboBox->setCurrentIndex(-1);
     ui->mirrorJointComboBox->setCurrentIndex(-1);
 }
@@ -67,17 +67,20 @@ void AddSupportsDialog::updateJoints()
 {
     ui->supportJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList supportJointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        if (joint->isSupported())
+        if (mJointsList->at(i)->isSupported())
         {
             continue;
         }
 
-        int supportJointNumber = mJointsList->indexOf(joint) + 1;
-        ui->supportJointComboBox->addItem(QString::number(supportJointNumber));
+        supportJointNumbers.append(QString::number(i + 1));
     }
 
+    ui->supportJointComboBox->addItems(supportJointNumbers);
+
     ui->supportJointComboBox->setCurrentIndex(-1);
 }
 
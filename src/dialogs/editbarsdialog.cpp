@@ -118,12 +118,15 @@ void EditBarsDialog::updateFirstJointOptions()
     mBarsTableView->clearSelection();
     ui->fromJointComboBox->clear();
 
-    foreach (Joint *joint, *mJointsList)
+    QStringList jointNumbers;
+
+    for (int i = 0; i < mJointsList->size(); ++i)
     {
-        int jointNumber = mJointsList->indexOf(joint) + 1;
-        ui->fromJointComboBox->addItem(QString::number(jointNumber));
+        jointNumbers.append(QString::number(i + 1));
     }
 
+    ui->fromJointComboBox->addItems(jointNumbers);
+
     ui->fromJointComboBox->setCurrentIndex(-1);
 }
 
@@ -19,13 +19,13 @@
 #include "exportmodelimagedialog.h"
 #include "ui_exportmodelimagedialog.h"
 
-ExportModelImageDialog::ExportModelImageDialog(QPixmap *pixmap,
-                                               QString *lastExportModelImageLocation,
-                                               QWidget *parent) : QDialog(parent),
+ExportModelImageDialog::ExportModelImageDialog(ModelViewer *modelViewer,
+                                               QString     *lastExportModelImageLocation,
+                                               QWidget     *parent) : QDialog(parent),
     ui(new Ui::ExportModelImageDialog)
 {
     ui->setupUi(this);
-    mPixmap                       = pixmap;
+    mModelViewer                  = modelViewer;
     mLastExportModelImageLocation = lastExportModelImageLocation;
     mPoint                        = QPoint(0, 0);
 
@@ -94,7 +94,7 @@ void ExportModelImageDialog::exportImage()
     {
         QFileInfo fileInfo(fileName);
         *mLastExportModelImageLocation = fileInfo.dir().path();
-        mPixmap->save(fileName, format, quality);
+        mModelViewer->modelPixmap().save(fileName, format, quality);
     }
 }
 
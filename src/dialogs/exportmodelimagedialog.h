@@ -23,6 +23,8 @@
 #include <QDialog>
 #include <QFileDialog>
 
+#include "modelviewer.h"
+
 namespace Ui
 {
     class ExportModelImageDialog;
@@ -33,9 +35,9 @@ class ExportModelImageDialog : public QDialog
         Q_OBJECT
 
     public:
-        explicit ExportModelImageDialog(QPixmap *pixmap                       = 0,
-                                        QString *lastExportModelImageLocation = 0,
-                                        QWidget *parent                       = 0);
+        explicit ExportModelImageDialog(ModelViewer *modelViewer                  = 0,
+                                        QString     *lastExportModelImageLocation = 0,
+                                        QWidget     *parent                       = 0);
 
         ~ExportModelImageDialog();
 
@@ -50,7 +52,7 @@ class ExportModelImageDialog : public QDialog
 
     private:
         Ui::ExportModelImageDialog *ui;
-        QPixmap                    *mPixmap;
+        ModelViewer                *mModelViewer;
         QString                    *mLastExportModelImageLocation;
         QPoint                     mPoint;
 };
@@ -0,0 +1,254 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* generatetrussdialog.cpp */
+
+#include "generatetrussdialog.h"
+#include "ui_generatetrussdialog.h"
+
+GenerateTrussDialog::GenerateTrussDialog(UnitsAndLimits *unitsAndLimits,
+                                         QList<Joint *> *jointsList,
+                                         QTableView     *barsTableView,
+                                         QWidget        *parent) : QDialog(parent), ui(new Ui::GenerateTrussDialog)
+{
+    ui->setupUi(this);
+
+    //Topologies in the order of ParametricTruss::Topology
+
+    ui->topologyComboBox->addItem(tr("Pratt"));
+    ui->topologyComboBox->addItem(tr("Howe"));
+    ui->topologyComboBox->addItem(tr("Warren"));
+    ui->topologyComboBox->addItem(tr("K"));
+    ui->topologyComboBox->addItem(tr("Bowstring"));
+    ui->topologyComboBox->addItem(tr("Fan"));
+    ui->topologyComboBox->addItem(tr("Grid"));
+    ui->topologyComboBox->addItem(tr("Triangulated grid"));
+    ui->topologyComboBox->setCurrentIndex(0);
+
+    //Member groups in the order of ParametricTruss::MemberGroup
+
+    QStringList groupNames;
+    groupNames << tr("Top chord") << tr("Bottom chord") << tr("Verticals") << tr("Diagonals");
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        mAreaDoubleSpinBoxes.append(new QDoubleSpinBox(this));
+        mModulusDoubleSpinBoxes.append(new QDoubleSpinBox(this));
+        mFactorDoubleSpinBoxes.append(new QDoubleSpinBox(this));
+        mUnitWeightDoubleSpinBoxes.append(new QDoubleSpinBox(this));
+
+        ui->memberGroupsGridLayout->addWidget(new QLabel(groupNames.at(i), this), i + 1, 0);
+        ui->memberGroupsGridLayout->addWidget(mAreaDoubleSpinBoxes.at(i), i + 1, 1);
+        ui->memberGroupsGridLayout->addWidget(mModulusDoubleSpinBoxes.at(i), i + 1, 2);
+        ui->memberGroupsGridLayout->addWidget(mFactorDoubleSpinBoxes.at(i), i + 1, 3);
+        ui->memberGroupsGridLayout->addWidget(mUnitWeightDoubleSpinBoxes.at(i), i + 1, 4);
+    }
+
+    mUnitsAndLimits = unitsAndLimits;
+    mJointsList     = jointsList;
+    mBarsTableView  = barsTableView;
+    mPoint          = QPoint(0, 0);
+
+    updateUnits();
+    updateAreaModulusFactorOption();
+    setRowsOption(ui->topologyComboBox->currentIndex());
+
+    connect(ui->topologyComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(setRowsOption(int)));
+    connect(ui->generatePushButton, SIGNAL(clicked()), this, SLOT(generateTruss()));
+}
+
+GenerateTrussDialog::~GenerateTrussDialog()
+{
+    delete ui;
+}
+
+QPoint GenerateTrussDialog::position() const
+{
+    return mPoint;
+}
+
+void GenerateTrussDialog::updateUnits()
+{
+    ui->panelLengthLabel->setText(tr("Panel length (%1)").arg(mUnitsAndLimits->coordinateUnit()));
+    ui->depthLabel->setText(tr("Depth (%1)").arg(mUnitsAndLimits->coordinateUnit()));
+    ui->camberLabel->setText(tr("Camber (%1)").arg(mUnitsAndLimits->coordinateUnit()));
+    ui->areaLabel->setText(tr("Area (%1)").arg(mUnitsAndLimits->areaUnit()));
+    ui->modulusLabel->setText(tr("Modulus (%1)").arg(mUnitsAndLimits->modulusUnit()));
+    ui->unitWeightLabel->setText(tr("Unit weight (%1)").arg(mUnitsAndLimits->unitWeightUnit()));
+
+    ui->panelLengthDoubleSpinBox->setMinimum(0.0);
+    ui->panelLengthDoubleSpinBox->setMaximum(mUnitsAndLimits->maxXCoordinate());
+    ui->panelLengthDoubleSpinBox->setDecimals(mUnitsAndLimits->deltaXDecimals());
+    ui->panelLengthDoubleSpinBox->clear();
+    ui->panelLengthDoubleSpinBox->setValue(1.0);
+
+    ui->depthDoubleSpinBox->setMinimum(0.0);
+    ui->depthDoubleSpinBox->setMaximum(mUnitsAndLimits->maxYCoordinate());
+    ui->depthDoubleSpinBox->setDecimals(mUnitsAndLimits->deltaYDecimals());
+    ui->depthDoubleSpinBox->clear();
+    ui->depthDoubleSpinBox->setValue(1.0);
+
+    ui->camberDoubleSpinBox->setMinimum(0.0);
+    ui->camberDoubleSpinBox->setMaximum(mUnitsAndLimits->maxYCoordinate());
+    ui->camberDoubleSpinBox->setDecimals(mUnitsAndLimits->deltaYDecimals());
+    ui->camberDoubleSpinBox->clear();
+    ui->camberDoubleSpinBox->setValue(0.0);
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        mAreaDoubleSpinBoxes.at(i)->setMinimum(mUnitsAndLimits->minArea());
+        mAreaDoubleSpinBoxes.at(i)->setMaximum(mUnitsAndLimits->maxArea());
+        mAreaDoubleSpinBoxes.at(i)->setDecimals(mUnitsAndLimits->areaDecimals());
+        mAreaDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minArea());
+
+        mModulusDoubleSpinBoxes.at(i)->setMinimum(mUnitsAndLimits->minModulus());
+        mModulusDoubleSpinBoxes.at(i)->setMaximum(mUnitsAndLimits->maxModulus());
+        mModulusDoubleSpinBoxes.at(i)->setDecimals(mUnitsAndLimits->modulusDecimals());
+        mModulusDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minModulus());
+
+        mFactorDoubleSpinBoxes.at(i)->setMinimum(mUnitsAndLimits->minFactor());
+        mFactorDoubleSpinBoxes.at(i)->setMaximum(mUnitsAndLimits->maxFactor());
+        mFactorDoubleSpinBoxes.at(i)->setDecimals(mUnitsAndLimits->factorDecimals());
+        mFactorDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minFactor());
+
+        mUnitWeightDoubleSpinBoxes.at(i)->setMinimum(mUnitsAndLimits->minUnitWeight());
+        mUnitWeightDoubleSpinBoxes.at(i)->setMaximum(mUnitsAndLimits->maxUnitWeight());
+        mUnitWeightDoubleSpinBoxes.at(i)->setDecimals(mUnitsAndLimits->unitWeightDecimals());
+        mUnitWeightDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minUnitWeight());
+    }
+}
+
+void GenerateTrussDialog::updateAreaModulusFactorOption()
+{
+    bool factorOption = (mBarsTableView->model()->columnCount() == 3);
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        if (factorOption)
+        {
+            mAreaDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minArea());
+            mModulusDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minModulus());
+            mUnitWeightDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minUnitWeight());
+        }
+        else
+        {
+            mFactorDoubleSpinBoxes.at(i)->setValue(mUnitsAndLimits->minFactor());
+        }
+
+        mAreaDoubleSpinBoxes.at(i)->setEnabled(!factorOption);
+        mModulusDoubleSpinBoxes.at(i)->setEnabled(!factorOption);
+        mUnitWeightDoubleSpinBoxes.at(i)->setEnabled(!factorOption);
+        mFactorDoubleSpinBoxes.at(i)->setEnabled(factorOption);
+    }
+}
+
+void GenerateTrussDialog::setRowsOption(int topologyIndex)
+{
+    ParametricTruss::Topology topology = ParametricTruss::Topology(topologyIndex);
+
+    ui->panelsSpinBox->setMinimum(ParametricTruss::minPanelsCount(topology));
+    ui->rowsSpinBox->setEnabled(ParametricTruss::hasRows(topology));
+}
+
+void GenerateTrussDialog::generateTruss()
+{
+    ParametricTruss truss(ParametricTruss::Topology(ui->topologyComboBox->currentIndex()),
+                          ui->panelsSpinBox->value(),
+                          ui->panelLengthDoubleSpinBox->value(),
+                          ui->depthDoubleSpinBox->value(),
+                          ui->camberDoubleSpinBox->value(),
+                          ui->rowsSpinBox->value());
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        truss.setSection(ParametricTruss::MemberGroup(i),
+                         mAreaDoubleSpinBoxes.at(i)->value(),
+                         mModulusDoubleSpinBoxes.at(i)->value(),
+                         mFactorDoubleSpinBoxes.at(i)->value(),
+                         mUnitWeightDoubleSpinBoxes.at(i)->value());
+    }
+
+    //Extent of the model with the truss placed beside it
+
+    qreal xRange = truss.xOffset(*mJointsList) + truss.width();
+    qreal yRange = truss.height();
+
+    foreach (Joint *joint, *mJointsList)
+    {
+        yRange = qMax(yRange, joint->yCoordinate());
+    }
+
+    if (!(xRange < mUnitsAndLimits->maxXCoordinate()) || !(yRange < mUnitsAndLimits->maxYCoordinate()))
+    {
+        QString infoText = QString("Invalid input\n"
+                                   "Model extent : %1 x %2 %5\n"
+                                   "Valid range\n"
+                                   "Max : < %3 x %4 %5")
+                .arg(QString::number(xRange, 'g', 3))
+                .arg(QString::number(yRange, 'g', 3))
+                .arg(QString::number(mUnitsAndLimits->maxXCoordinate(), 'g', 3))
+                .arg(QString::number(mUnitsAndLimits->maxYCoordinate(), 'g', 3))
+                .arg(mUnitsAndLimits->coordinateUnit());
+
+        showInputError(tr("Panels, panel length, depth and/or camber : Input error"), infoText);
+        ui->panelsSpinBox->setFocus();
+        ui->panelsSpinBox->selectAll();
+        return;
+    }
+
+    //The row height is held to the bar length limits too, so that a shallow Warren truss cannot lay its top chord
+    //joints on the bottom chord
+
+    qreal minLength = qMin(truss.minMemberLength(), truss.depth() / truss.rowsCount());
+    qreal maxLength = truss.maxMemberLength();
+
+    if (!(mUnitsAndLimits->minBarLength() < minLength) || !(maxLength < mUnitsAndLimits->maxBarLength()))
+    {
+        QString infoText = QString("Invalid input\n"
+                                   "Member lengths : %1 to %2 %5\n"
+                                   "Valid range\n"
+                                   "Min : > %3 %5\n"
+                                   "Max : < %4 %5")
+                .arg(QString::number(minLength, 'g', 3))
+                .arg(QString::number(maxLength, 'g', 3))
+                .arg(QString::number(mUnitsAndLimits->minBarLength(), 'g', 3))
+                .arg(QString::number(mUnitsAndLimits->maxBarLength(), 'g', 3))
+                .arg(mUnitsAndLimits->coordinateUnit());
+
+        showInputError(tr("Panel length and/or depth : Input error"), infoText);
+        ui->panelLengthDoubleSpinBox->setFocus();
+        ui->panelLengthDoubleSpinBox->selectAll();
+        return;
+    }
+
+    emit inputsSignal(truss);
+}
+
+void GenerateTrussDialog::showInputError(const QString &text, const QString &infoText)
+{
+    QMessageBox messageBox(this);
+    messageBox.setWindowTitle(tr("Input Validation"));
+    messageBox.setText(text);
+    messageBox.setInformativeText(infoText);
+    messageBox.setIcon(QMessageBox::Warning);
+    messageBox.exec();
+}
+
+void GenerateTrussDialog::closeEvent(QCloseEvent *event)
+{
+    mPoint = this->pos();
+    event->accept();
+}
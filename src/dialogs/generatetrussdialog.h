@@ -0,0 +1,79 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* generatetrussdialog.h */
+
+#ifndef GENERATETRUSSDIALOG_H
+#define GENERATETRUSSDIALOG_H
+
+#include <QCloseEvent>
+#include <QDialog>
+#include <QDoubleSpinBox>
+#include <QLabel>
+#include <QMessageBox>
+#include <QTableView>
+
+#include "joint.h"
+#include "parametrictruss.h"
+#include "unitsandlimits.h"
+
+namespace Ui
+{
+    class GenerateTrussDialog;
+}
+
+class GenerateTrussDialog : public QDialog
+{
+        Q_OBJECT
+
+    public:
+        explicit GenerateTrussDialog(UnitsAndLimits *unitsAndLimits = 0,
+                                     QList<Joint *> *jointsList     = 0,
+                                     QTableView     *barsTableView  = 0,
+                                     QWidget        *parent         = 0);
+
+        ~GenerateTrussDialog();
+
+        QPoint position() const;
+
+        void updateUnits();
+        void updateAreaModulusFactorOption();
+
+    signals:
+        void inputsSignal(const ParametricTruss &truss);
+
+    public slots:
+        void setRowsOption(int topologyIndex);
+        void generateTruss();
+
+    protected:
+        void closeEvent(QCloseEvent *event);
+
+    private:
+        Ui::GenerateTrussDialog *ui;
+        UnitsAndLimits          *mUnitsAndLimits;
+        QList<Joint *>          *mJointsList;
+        QTableView              *mBarsTableView;
+        QList<QDoubleSpinBox *> mAreaDoubleSpinBoxes;
+        QList<QDoubleSpinBox *> mModulusDoubleSpinBoxes;
+        QList<QDoubleSpinBox *> mFactorDoubleSpinBoxes;
+        QList<QDoubleSpinBox *> mUnitWeightDoubleSpinBoxes;
+        QPoint                  mPoint;
+
+        void showInputError(const QString &text, const QString &infoText);
+};
+
+#endif // GENERATETRUSSDIALOG_H
@@ -0,0 +1,111 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* scriptconsoledialog.cpp */
+
+#include "scriptconsoledialog.h"
+#include "ui_scriptconsoledialog.h"
+
+ScriptConsoleDialog::ScriptConsoleDialog(Solver  *solver,
+                                         QString *lastOpenLocation,
+                                         QWidget *parent) : QDialog(parent),
+    ui(new Ui::ScriptConsoleDialog)
+{
+    ui->setupUi(this);
+    mScriptEngine     = new ScriptEngine(solver, this);
+    mLastOpenLocation = lastOpenLocation;
+    mPoint            = QPoint(0, 0);
+    ui->scriptTextEdit->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    ui->outputTextEdit->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    connect(mScriptEngine, SIGNAL(outputSignal(QString)), this, SLOT(appendOutput(QString)));
+    connect(ui->openPushButton, SIGNAL(clicked()), this, SLOT(openScript()));
+    connect(ui->runPushButton, SIGNAL(clicked()), this, SLOT(runScript()));
+    connect(ui->clearPushButton, SIGNAL(clicked()), ui->outputTextEdit, SLOT(clear()));
+    connect(ui->buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+}
+
+ScriptConsoleDialog::~ScriptConsoleDialog()
+{
+    delete ui;
+}
+
+QPoint ScriptConsoleDialog::position() const
+{
+    return mPoint;
+}
+
+void ScriptConsoleDialog::openScript()
+{
+    QString fileName = QFileDialog::getOpenFileName(this,
+                                                    tr("Open Script"),
+                                                    *mLastOpenLocation,
+                                                    tr("JavaScript file(*.js)"));
+
+    if (fileName.isEmpty())
+    {
+        return;
+    }
+
+    QFile file(fileName);
+
+    if (!file.open(QFile::ReadOnly | QFile::Text))
+    {
+        QString s1, s2;
+        s1 = tr("TrussTables");
+        s2 = tr("Cannot read file %1:\n%2.").arg(file.fileName()).arg(file.errorString());
+        QMessageBox::warning(this, s1, s2);
+        return;
+    }
+
+    QFileInfo fileInfo(fileName);
+    *mLastOpenLocation = fileInfo.dir().path();
+
+    QTextStream in(&file);
+    in.setCodec("UTF-8");
+
+    mScriptFileName = fileName;
+    ui->scriptTextEdit->setPlainText(in.readAll());
+}
+
+void ScriptConsoleDialog::runScript()
+{
+    //Checks and solves wait in an event loop, so the script is not started again meanwhile
+    ui->runPushButton->setEnabled(false);
+    ui->openPushButton->setEnabled(false);
+
+    mScriptEngine->evaluate(ui->scriptTextEdit->toPlainText(), mScriptFileName);
+
+    ui->runPushButton->setEnabled(true);
+    ui->openPushButton->setEnabled(true);
+}
+
+void ScriptConsoleDialog::appendOutput(QString text)
+{
+    ui->outputTextEdit->appendPlainText(text);
+}
+
+void ScriptConsoleDialog::reject()
+{
+    mPoint = this->pos();
+    QDialog::reject();
+}
+
+void ScriptConsoleDialog::closeEvent(QCloseEvent *event)
+{
+    mPoint = this->pos();
+    event->accept();
+}
@@ -0,0 +1,67 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* scriptconsoledialog.h */
+
+#ifndef SCRIPTCONSOLEDIALOG_H
+#define SCRIPTCONSOLEDIALOG_H
+
+#include <QCloseEvent>
+#include <QDialog>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QFontDatabase>
+#include <QMessageBox>
+#include <QTextStream>
+
+#include "scriptengine.h"
+
+namespace Ui
+{
+    class ScriptConsoleDialog;
+}
+
+class ScriptConsoleDialog : public QDialog
+{
+        Q_OBJECT
+
+    public:
+        explicit ScriptConsoleDialog(Solver  *solver,
+                                     QString *lastOpenLocation,
+                                     QWidget *parent = 0);
+
+        ~ScriptConsoleDialog();
+
+        QPoint position() const;
+
+    protected:
+        void reject();
+        void closeEvent(QCloseEvent *event);
+
+    private slots:
+        void openScript();
+        void runScript();
+        void appendOutput(QString text);
+
+    private:
+        Ui::ScriptConsoleDialog *ui;
+        ScriptEngine            *mScriptEngine;
+        QString                 *mLastOpenLocation;
+        QString                 mScriptFileName;
+        QPoint                  mPoint;
+};
+
+#endif // SCRIPTCONSOLEDIALOG_H
@@ -0,0 +1,103 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solverdiagnosticsdialog.cpp */
+
+#include "solverdiagnosticsdialog.h"
+#include "ui_solverdiagnosticsdialog.h"
+
+SolverDiagnosticsDialog::SolverDiagnosticsDialog(QString *lastExportDiagnosticsLocation,
+                                                 QWidget *parent) : QDialog(parent),
+    ui(new Ui::SolverDiagnosticsDialog)
+{
+    ui->setupUi(this);
+    mLastExportDiagnosticsLocation = lastExportDiagnosticsLocation;
+    mPoint                         = QPoint(0, 0);
+    ui->diagnosticsTextEdit->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    ui->exportPushButton->setEnabled(false);
+
+    connect(ui->exportPushButton, SIGNAL(clicked()), this, SLOT(exportJson()));
+    connect(ui->buttonBox, SIGNAL(accepted()), this, SLOT(accept()));
+}
+
+SolverDiagnosticsDialog::~SolverDiagnosticsDialog()
+{
+    delete ui;
+}
+
+QPoint SolverDiagnosticsDialog::position() const
+{
+    return mPoint;
+}
+
+void SolverDiagnosticsDialog::setStatistics(const SolverStatistics &statistics)
+{
+    mStatistics = statistics;
+
+    ui->diagnosticsTextEdit->clear();
+
+    if (mStatistics.isEmpty())
+    {
+        ui->diagnosticsTextEdit->setText(tr("No solver run yet."));
+    }
+    else
+    {
+        ui->diagnosticsTextEdit->setText(mStatistics.toText());
+    }
+
+    ui->exportPushButton->setEnabled(!mStatistics.isEmpty());
+}
+
+void SolverDiagnosticsDialog::exportJson()
+{
+    QString fileName = QFileDialog::getSaveFileName(this,
+                                                    tr("Export File"),
+                                                    *mLastExportDiagnosticsLocation + tr("/diagnostics.json"),
+                                                    tr("JSON file(*.json)"));
+
+    if (fileName.isEmpty())
+    {
+        return;
+    }
+
+    QFileInfo fileInfo(fileName);
+    *mLastExportDiagnosticsLocation = fileInfo.dir().path();
+
+    QSaveFile saveFile(fileName);
+    saveFile.setDirectWriteFallback(true);
+
+    if (!saveFile.open(QSaveFile::WriteOnly)
+            || saveFile.write(QJsonDocument(mStatistics.toJson()).toJson()) == -1
+            || !saveFile.commit())
+    {
+        QString s1, s2;
+        s1 = tr("TrussTables");
+        s2 = tr("Cannot write file %1:\n%2.").arg(saveFile.fileName()).arg(saveFile.errorString());
+        QMessageBox::warning(this, s1, s2);
+    }
+}
+
+void SolverDiagnosticsDialog::accept()
+{
+    mPoint = this->pos();
+    QDialog::accept();
+}
+
+void SolverDiagnosticsDialog::closeEvent(QCloseEvent *event)
+{
+    mPoint = this->pos();
+    event->accept();
+}
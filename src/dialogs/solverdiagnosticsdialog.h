@@ -0,0 +1,65 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solverdiagnosticsdialog.h */
+
+#ifndef SOLVERDIAGNOSTICSDIALOG_H
+#define SOLVERDIAGNOSTICSDIALOG_H
+
+#include <QCloseEvent>
+#include <QDialog>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QFontDatabase>
+#include <QJsonDocument>
+#include <QMessageBox>
+#include <QSaveFile>
+
+#include "solverstatistics.h"
+
+namespace Ui
+{
+    class SolverDiagnosticsDialog;
+}
+
+class SolverDiagnosticsDialog : public QDialog
+{
+        Q_OBJECT
+
+    public:
+        explicit SolverDiagnosticsDialog(QString *lastExportDiagnosticsLocation, QWidget *parent = 0);
+
+        ~SolverDiagnosticsDialog();
+
+        QPoint position() const;
+
+        void setStatistics(const SolverStatistics &statistics);
+
+    protected:
+        void accept();
+        void closeEvent(QCloseEvent *event);
+
+    private slots:
+        void exportJson();
+
+    private:
+        Ui::SolverDiagnosticsDialog *ui;
+        QString                     *mLastExportDiagnosticsLocation;
+        SolverStatistics            mStatistics;
+        QPoint                      mPoint;
+};
+
+#endif // SOLVERDIAGNOSTICSDIALOG_H
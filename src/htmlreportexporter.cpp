@@ -23,7 +23,7 @@ HtmlReportExporter::HtmlReportExporter(const QString              &title,
                                        const QString              &exportDirectory,
                                        QList<Joint *>             *jointsList,
                                        QList<Bar *>               *barsList,
-                                       QStandardItemModel         *barsStandardItemModel,
+                                       ModelTableModel            *barsTableModel,
                                        QList<Support *>           *supportsList,
                                        ModelViewer                *modelVIewer,
                                        QCheckBox                  *jointLoadsCheckBox,
@@ -37,11 +37,7 @@ HtmlReportExporter::HtmlReportExporter(const QString              &title,
                                        QList<ThermalEffect *>     *thermalEffectsList,
                                        QList<FabricationError *>  *fabricationErrorsList,
                                        QList<InfluenceLoad *>     *influenceLoadsList,
-                                       QList<qreal>               *horizontalDeflectionComponentsList,
-                                       QList<qreal>               *verticalDeflectionComponentsList,
-                                       QList<qreal>               *barLoadsList,
-                                       QList<qreal>               *reactionHorizontalComponentsList,
-                                       QList<qreal>               *reactionVerticalComponentsList,
+                                       const QSharedPointer<const SolutionResult> &solutionResult,
                                        QString                    *solutionInfluenceLoadName,
                                        InfluenceLoadResult        *influenceLoadResult,
                                        UnitsAndLimits             *unitsAndLimits,
@@ -52,7 +48,7 @@ HtmlReportExporter::HtmlReportExporter(const QString              &title,
     mExportDirectory                    = exportDirectory;
     mJointsList                         = jointsList;
     mBarsList                           = barsList;
-    mBarsStandardItemModel              = barsStandardItemModel;
+    mBarsTableModel                     = barsTableModel;
     mSupportsList                       = supportsList;
     mModelViewer                        = modelVIewer;
     mJointLoadsCheckBox                 = jointLoadsCheckBox;
@@ -66,11 +62,7 @@ HtmlReportExporter::HtmlReportExporter(const QString              &title,
     mThermalEffectsList                 = thermalEffectsList;
     mFabricationErrorsList              = fabricationErrorsList;
     mInfluenceLoadsList                 = influenceLoadsList;
-    mHorizontalDeflectionComponentsList = horizontalDeflectionComponentsList;
-    mVerticalDeflectionComponentsList   = verticalDeflectionComponentsList;
-    mBarLoadsList                       = barLoadsList;
-    mReactionHorizontalComponentsList   = reactionHorizontalComponentsList;
-    mReactionVerticalComponentsList     = reactionVerticalComponentsList;
+    mSolutionResult                     = solutionResult;
     mSolutionInfluenceLoadName          = solutionInfluenceLoadName;
     mInfluenceLoadResult                = influenceLoadResult;
     mUnitsAndLimits                     = unitsAndLimits;
@@ -90,6 +82,9 @@ void HtmlReportExporter::exportHtmlReport()
     {
         QTextStream dataTextStream(&dataFile);
 
+        //Joint, bar and support numbers in the tables below come from one lookup built up front
+        ModelIndex modelIndex(*mJointsList, *mBarsList, *mSupportsList);
+
         QString htmlText;
         htmlText.append("<!DOCTYPE HTML>\n");
         htmlText.append("<html lang=\"en_US\">\n");
@@ -140,7 +135,7 @@ void HtmlReportExporter::exportHtmlReport()
             htmlText.append("<tr>\n");
             htmlText.append(tr("<td>Axial Rigidity Option</td>\n"));
 
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 htmlText.append(tr("<td>%1</td>\n").arg(tr("value")));
             }
@@ -489,7 +484,7 @@ void HtmlReportExporter::exportHtmlReport()
             htmlText.append("<th>First Joint</th>\n");
             htmlText.append("<th>Second Joint</th>\n");
 
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 //Area of Section
 
@@ -577,8 +572,8 @@ void HtmlReportExporter::exportHtmlReport()
             {
                 Joint *jointA    = mBarsList->at(i)->firstJoint();
                 Joint *jointB    = mBarsList->at(i)->secondJoint();
-                int jointNumberA = mJointsList->indexOf(jointA) + 1;
-                int jointNumberB = mJointsList->indexOf(jointB) + 1;
+                int jointNumberA = modelIndex.jointIndex(jointA) + 1;
+                int jointNumberB = modelIndex.jointIndex(jointB) + 1;
                 qreal factor     = mBarsList->at(i)->factor();
                 qreal area       = mBarsList->at(i)->area();
                 qreal modulus    = mBarsList->at(i)->modulus();
@@ -589,7 +584,7 @@ void HtmlReportExporter::exportHtmlReport()
                 htmlText.append(tr("<td>%1</td>\n").arg(QString::number(jointNumberA)));
                 htmlText.append(tr("<td>%1</td>\n").arg(QString::number(jointNumberB)));
 
-                if (mBarsStandardItemModel->columnCount() == 5)
+                if (mBarsTableModel->columnCount() == 5)
                 {
                     htmlText.append(tr("<td>%1</td>\n").arg(QString::number(area, 'f',
                                                                             mUnitsAndLimits->areaDecimals())));
@@ -627,7 +622,7 @@ void HtmlReportExporter::exportHtmlReport()
             for (int i = 0; i < count; ++i)
             {
                 Joint *joint                     = mSupportsList->at(i)->supportJoint();
-                int jointNumber                  = mJointsList->indexOf(joint) + 1;
+                int jointNumber                  = modelIndex.jointIndex(joint) + 1;
                 UnitsAndLimits::SupportType type = mSupportsList->at(i)->type();
                 QString supportTypeName;
                 qreal angle                      = mSupportsList->at(i)->angle();
@@ -731,7 +726,7 @@ void HtmlReportExporter::exportHtmlReport()
                         for (int i = 0; i < count; ++i)
                         {
                             Joint *joint    = mJointLoadsList->at(i)->loadJoint();
-                            int jointNumber = mJointsList->indexOf(joint) + 1;
+                            int jointNumber = modelIndex.jointIndex(joint) + 1;
                             qreal H         = mJointLoadsList->at(i)->horizontalComponent();
                             qreal V         = mJointLoadsList->at(i)->verticalComponent();
 
@@ -880,8 +875,8 @@ void HtmlReportExporter::exportHtmlReport()
                         {
                             Support *support  = mSupportSettlementsList->at(i)->settlementSupport();
                             Joint *joint      = support->supportJoint();
-                            int supportNumber = mSupportsList->indexOf(support) + 1;
-                            int jointNumber   = mJointsList->indexOf(joint) + 1;
+                            int supportNumber = modelIndex.supportIndex(support) + 1;
+                            int jointNumber   = modelIndex.jointIndex(joint) + 1;
                             qreal settlement  = mSupportSettlementsList->at(i)->settlement();
 
                             htmlText.append("<tr>\n");
@@ -958,7 +953,7 @@ void HtmlReportExporter::exportHtmlReport()
                         for (int i = 0; i < count; ++i)
                         {
                             Bar *bar                 = mThermalEffectsList->at(i)->thermalEffectBar();
-                            int barNumber            = mBarsList->indexOf(bar) + 1;
+                            int barNumber            = modelIndex.barIndex(bar) + 1;
                             qreal temperatureChange  = mThermalEffectsList->at(i)->temperatureChange();
                             qreal thermalCoefficient = mThermalEffectsList->at(i)->thermalCoefficient();
 
@@ -1042,7 +1037,7 @@ void HtmlReportExporter::exportHtmlReport()
                         for (int i = 0; i < count; ++i)
                         {
                             Bar *bar          = mFabricationErrorsList->at(i)->fabricationErrorBar();
-                            int barNumber     = mBarsList->indexOf(bar) + 1;
+                            int barNumber     = modelIndex.barIndex(bar) + 1;
                             qreal lengthError = mFabricationErrorsList->at(i)->lengthError();
 
                             htmlText.append("<tr>\n");
@@ -1194,11 +1189,11 @@ void HtmlReportExporter::exportHtmlReport()
 
         {//Joint Deflections
 
-            if (!mHorizontalDeflectionComponentsList->isEmpty())
+            if (!mSolutionResult.isNull() && mSolutionResult->hasJointDeflections())
             {
                 htmlText.append("<br><br><table>\n");
 
-                if (mBarsStandardItemModel->columnCount() == 5)
+                if (mBarsTableModel->columnCount() == 5)
                 {
                     htmlText.append("<caption><b>Joint Deflections</b></caption>\n");
 
@@ -1250,12 +1245,12 @@ void HtmlReportExporter::exportHtmlReport()
                     htmlText.append("</tr>\n");
                 }
 
-                count = mHorizontalDeflectionComponentsList->size();
+                count = mSolutionResult->jointsCount();
 
                 for (int i = 0; i < count; ++i)
                 {
-                    qreal horizontalComponent = mHorizontalDeflectionComponentsList->at(i);
-                    qreal verticalComponent   = mVerticalDeflectionComponentsList->at(i);
+                    qreal horizontalComponent = mSolutionResult->horizontalDeflection(i);
+                    qreal verticalComponent   = mSolutionResult->verticalDeflection(i);
 
                     htmlText.append("<tr>\n");
                     htmlText.append(tr("<td>%1</td>\n").arg(QString::number(i + 1)));
@@ -1266,7 +1261,7 @@ void HtmlReportExporter::exportHtmlReport()
 
                 htmlText.append("</table>\n");
 
-                if (mBarsStandardItemModel->columnCount() == 5)
+                if (mBarsTableModel->columnCount() == 5)
                 {
                     {//Joint Deflections Image
 
@@ -1289,7 +1284,7 @@ void HtmlReportExporter::exportHtmlReport()
 
         {//Bar Loads
 
-            if (!mBarLoadsList->isEmpty())
+            if (!mSolutionResult.isNull() && mSolutionResult->hasBarLoads())
             {
                 htmlText.append("<br><br><table>\n");
 
@@ -1309,11 +1304,11 @@ void HtmlReportExporter::exportHtmlReport()
 
                 htmlText.append("</tr>\n");
 
-                count = mBarLoadsList->size();
+                count = mSolutionResult->barsCount();
 
                 for (int i = 0; i < count; ++i)
                 {
-                    qreal barLoad = mBarLoadsList->at(i);
+                    qreal barLoad = mSolutionResult->barLoad(i);
 
                     htmlText.append("<tr>\n");
                     htmlText.append(tr("<td>%1</td>\n").arg(QString::number(i + 1)));
@@ -1343,7 +1338,7 @@ void HtmlReportExporter::exportHtmlReport()
 
         {//Support Reactions
 
-            if (!mReactionHorizontalComponentsList->isEmpty())
+            if (!mSolutionResult.isNull() && mSolutionResult->hasSupportReactions())
             {
                 htmlText.append("<br><br><table>\n");
 
@@ -1365,15 +1360,15 @@ void HtmlReportExporter::exportHtmlReport()
 
                 htmlText.append("</tr>\n");
 
-                count = mReactionHorizontalComponentsList->size();
+                count = mSolutionResult->reactionsCount();
 
                 for (int i = 0; i < count; ++i)
                 {
                     Support *support = mSupportsList->at(i);
                     Joint *joint     = support->supportJoint();
-                    int jointNumber  = mJointsList->indexOf(joint) + 1;
-                    qreal h          = mReactionHorizontalComponentsList->at(i);
-                    qreal v          = mReactionVerticalComponentsList->at(i);
+                    int jointNumber  = modelIndex.jointIndex(joint) + 1;
+                    qreal h          = mSolutionResult->reactionHorizontalComponent(i);
+                    qreal v          = mSolutionResult->reactionVerticalComponent(i);
 
                     htmlText.append("<tr>\n");
                     QString s1(QString::number(i + 1));
@@ -1423,7 +1418,7 @@ void HtmlReportExporter::exportHtmlReport()
 
                 count = influenceLoad->path().size();
 
-                if (mInfluenceLoadResult->influenceLoadOrdinatesList(0).size() == count)
+                if (mInfluenceLoadResult->isComplete() && mInfluenceLoadResult->ordinatesCount() == count)
                 {
                     htmlText.append(tr("<p>Influence Load Analysed:&nbsp;%1</p>\n").arg(*mSolutionInfluenceLoadName));
 
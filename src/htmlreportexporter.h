@@ -25,7 +25,7 @@
 #include <QDir>
 #include <QFile>
 #include <QObject>
-#include <QStandardItemModel>
+#include <QSharedPointer>
 #include <QTextStream>
 #include <QTime>
 #include <QUrl>
@@ -36,8 +36,11 @@
 #include "influenceloadresult.h"
 #include "joint.h"
 #include "jointload.h"
+#include "modelindex.h"
+#include "modeltablemodel.h"
 #include "modelviewer.h"
 #include "notesdialog.h"
+#include "solutionresult.h"
 #include "support.h"
 #include "supportsettlement.h"
 #include "thermaleffect.h"
@@ -53,7 +56,7 @@ class HtmlReportExporter : public QObject
                                     const QString              &exportDirectory                    = QString(),
                                     QList<Joint *>             *jointsList                         = 0,
                                     QList<Bar *>               *barsList                           = 0,
-                                    QStandardItemModel         *barsStandardItemModel              = 0,
+                                    ModelTableModel            *barsTableModel                     = 0,
                                     QList<Support *>           *supportsList                       = 0,
                                     ModelViewer                *modelVIewer                        = 0,
                                     QCheckBox                  *jointLoadsCheckBox                 = 0,
@@ -67,11 +70,7 @@ class HtmlReportExporter : public QObject
                                     QList<ThermalEffect *>     *thermalEffectsList                 = 0,
                                     QList<FabricationError *>  *fabricationErrorsList              = 0,
                                     QList<InfluenceLoad *>     *influenceLoadsList                 = 0,
-                                    QList<qreal>               *horizontalDeflectionComponentsList = 0,
-                                    QList<qreal>               *verticalDeflectionComponentsList   = 0,
-                                    QList<qreal>               *barLoadsList                       = 0,
-                                    QList<qreal>               *reactionHorizontalComponentsList   = 0,
-                                    QList<qreal>               *reactionVerticalComponentsList     = 0,
+                                    const QSharedPointer<const SolutionResult> &solutionResult = QSharedPointer<const SolutionResult>(),
                                     QString                    *solutionInfluenceLoadName          = 0,
                                     InfluenceLoadResult        *influenceLoadResult                = 0,
                                     UnitsAndLimits             *unitsAndLimits                     = 0,
@@ -88,7 +87,7 @@ class HtmlReportExporter : public QObject
         QString                    mExportDirectory;
         QList<Joint *>             *mJointsList;
         QList<Bar *>               *mBarsList;
-        QStandardItemModel         *mBarsStandardItemModel;
+        ModelTableModel            *mBarsTableModel;
         QList<Support *>           *mSupportsList;
         ModelViewer                *mModelViewer;
         QCheckBox                  *mJointLoadsCheckBox;
@@ -102,11 +101,7 @@ class HtmlReportExporter : public QObject
         QList<ThermalEffect *>     *mThermalEffectsList;
         QList<FabricationError *>  *mFabricationErrorsList;
         QList<InfluenceLoad *>     *mInfluenceLoadsList;
-        QList<qreal>               *mHorizontalDeflectionComponentsList;
-        QList<qreal>               *mVerticalDeflectionComponentsList;
-        QList<qreal>               *mBarLoadsList;
-        QList<qreal>               *mReactionHorizontalComponentsList;
-        QList<qreal>               *mReactionVerticalComponentsList;
+        QSharedPointer<const SolutionResult> mSolutionResult;
         QString                    *mSolutionInfluenceLoadName;
         InfluenceLoadResult        *mInfluenceLoadResult;
         UnitsAndLimits             *mUnitsAndLimits;
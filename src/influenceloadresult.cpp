@@ -18,26 +18,100 @@
 
 #include "influenceloadresult.h"
 
-InfluenceLoadResult::InfluenceLoadResult(int barsCount, int ordinatesCount, QObject *parent) : QObject(parent)
+InfluenceLoadOrdinatesSpan::InfluenceLoadOrdinatesSpan(const double *doubleData,
+                                                       const float  *floatData,
+                                                       int          size,
+                                                       int          stride)
 {
-    mBarsCount      = barsCount;
-    mOrdinatesCount = ordinatesCount;
+    mDoubleData = doubleData;
+    mFloatData  = floatData;
+    mSize       = size;
+    mStride     = stride;
+}
 
-    for (int i = 0; i < mBarsCount; ++i)
+int InfluenceLoadOrdinatesSpan::size() const
+{
+    return mSize;
+}
+
+bool InfluenceLoadOrdinatesSpan::isEmpty() const
+{
+    return mSize == 0;
+}
+
+qreal InfluenceLoadOrdinatesSpan::at(int index) const
+{
+    Q_ASSERT(index >= 0 && index < mSize);
+
+    if (mDoubleData)
     {
-        mInfluenceLoadOrdinatesLists.append(new QList<qreal>);
-        mMinLoadList.append(0.0);
-        mMinLoadPositionList.append(QString());
-        mMaxLoadList.append(0.0);
-        mMaxLoadPositionList.append(QString());
+        return mDoubleData[index * mStride];
+    }
+    else
+    {
+        return mFloatData[index * mStride];
+    }
+}
+
+qreal InfluenceLoadOrdinatesSpan::maxMagnitude() const
+{
+    qreal maxMagnitude = 0.0;
+
+    for (int i = 0; i < mSize; ++i)
+    {
+        qreal magnitude = qAbs(at(i));
+
+        if (magnitude > maxMagnitude)
+        {
+            maxMagnitude = magnitude;
+        }
     }
+
+    return maxMagnitude;
+}
+
+InfluenceLoadResult::InfluenceLoadResult(int barsCount, int ordinatesCount, QObject *parent) : QObject(parent)
+{
+    mBarsCount            = barsCount;
+    mOrdinatesCount       = ordinatesCount;
+    mSolvedOrdinatesCount = 0;
+    mPrecision            = DOUBLE_PRECISION;
+
+    allocate();
 }
 
 InfluenceLoadResult::~InfluenceLoadResult()
 {
-    foreach (QList<qreal> *list, mInfluenceLoadOrdinatesLists)
+
+}
+
+InfluenceLoadOrdinatesSpan InfluenceLoadResult::barOrdinates(int barIndex) const
+{
+    Q_ASSERT(barIndex >= 0 && barIndex < mBarsCount);
+
+    int offset = barIndex * mOrdinatesCount;
+
+    if (mPrecision == SINGLE_PRECISION)
+    {
+        return InfluenceLoadOrdinatesSpan(0, mFloatOrdinates.constData() + offset, mOrdinatesCount, 1);
+    }
+    else
+    {
+        return InfluenceLoadOrdinatesSpan(mDoubleOrdinates.constData() + offset, 0, mOrdinatesCount, 1);
+    }
+}
+
+InfluenceLoadOrdinatesSpan InfluenceLoadResult::pathOrdinates(int ordinateIndex) const
+{
+    Q_ASSERT(ordinateIndex >= 0 && ordinateIndex < mOrdinatesCount);
+
+    if (mPrecision == SINGLE_PRECISION)
+    {
+        return InfluenceLoadOrdinatesSpan(0, mFloatOrdinates.constData() + ordinateIndex, mBarsCount, mOrdinatesCount);
+    }
+    else
     {
-        delete list;
+        return InfluenceLoadOrdinatesSpan(mDoubleOrdinates.constData() + ordinateIndex, 0, mBarsCount, mOrdinatesCount);
     }
 }
 
@@ -51,45 +125,62 @@ int InfluenceLoadResult::ordinatesCount() const
     return mOrdinatesCount;
 }
 
-void InfluenceLoadResult::setParameters(int barsCount, int ordinatesCount)
+int InfluenceLoadResult::solvedOrdinatesCount() const
 {
-    foreach (QList<qreal> *list, mInfluenceLoadOrdinatesLists)
-    {
-        delete list;
-    }
+    return mSolvedOrdinatesCount;
+}
 
-    mInfluenceLoadOrdinatesLists.clear();
-    mMinLoadList.clear();
-    mMinLoadPositionList.clear();
-    mMaxLoadList.clear();
-    mMaxLoadPositionList.clear();
+bool InfluenceLoadResult::isComplete() const
+{
+    return (mBarsCount > 0) && (mOrdinatesCount > 0) && (mSolvedOrdinatesCount == mOrdinatesCount);
+}
 
-    mBarsCount      = barsCount;
-    mOrdinatesCount = ordinatesCount;
+InfluenceLoadResult::Precision InfluenceLoadResult::precision() const
+{
+    return mPrecision;
+}
 
-    for (int i = 0; i < mBarsCount; ++i)
-    {
-        mInfluenceLoadOrdinatesLists.append(new QList<qreal>);
-        mMinLoadList.append(0.0);
-        mMinLoadPositionList.append(QString());
-        mMaxLoadList.append(0.0);
-        mMaxLoadPositionList.append(QString());
-    }
+void InfluenceLoadResult::setParameters(int barsCount, int ordinatesCount, Precision precision)
+{
+    mBarsCount            = barsCount;
+    mOrdinatesCount       = ordinatesCount;
+    mSolvedOrdinatesCount = 0;
+    mPrecision            = precision;
+
+    allocate();
 }
 
-const QList<qreal> &InfluenceLoadResult::influenceLoadOrdinatesList(int index) const
+qreal InfluenceLoadResult::ordinate(int barIndex, int ordinateIndex) const
 {
-    return *mInfluenceLoadOrdinatesLists.at(index);
+    int index = barIndex * mOrdinatesCount + ordinateIndex;
+
+    if (mPrecision == SINGLE_PRECISION)
+    {
+        return mFloatOrdinates.at(index);
+    }
+    else
+    {
+        return mDoubleOrdinates.at(index);
+    }
 }
 
-void InfluenceLoadResult::setInfluenceLoadOrdinatesList(int index, const QList<qreal> &list)
+void InfluenceLoadResult::setOrdinate(int barIndex, int ordinateIndex, qreal value)
 {
-    *mInfluenceLoadOrdinatesLists[index] = list;
+    int index = barIndex * mOrdinatesCount + ordinateIndex;
+
+    if (mPrecision == SINGLE_PRECISION)
+    {
+        mFloatOrdinates[index] = static_cast<float>(value);
+    }
+    else
+    {
+        mDoubleOrdinates[index] = value;
+    }
 }
 
-void InfluenceLoadResult::appendInfluenceLoadOrdinatesListValue(int listIndex, qreal value)
+void InfluenceLoadResult::setSolvedOrdinatesCount(int count)
 {
-    mInfluenceLoadOrdinatesLists[listIndex]->append(value);
+    mSolvedOrdinatesCount = qBound(0, count, mOrdinatesCount);
 }
 
 qreal InfluenceLoadResult::minLoad(int index) const
@@ -134,17 +225,48 @@ void InfluenceLoadResult::setMaxLoadPosition(int index, const QString &maxLoadPo
 
 void InfluenceLoadResult::resetParameters()
 {
-    mBarsCount      = 0;
-    mOrdinatesCount = 0;
+    mBarsCount            = 0;
+    mOrdinatesCount       = 0;
+    mSolvedOrdinatesCount = 0;
+    mPrecision            = DOUBLE_PRECISION;
+
+    allocate();
+
+    mDoubleOrdinates.squeeze();
+    mFloatOrdinates.squeeze();
+}
+
+void InfluenceLoadResult::allocate()
+{
+    //Single contiguous block for all ordinates; the previous capacity is kept for reuse
+    int size = mBarsCount * mOrdinatesCount;
 
-    foreach (QList<qreal> *list, mInfluenceLoadOrdinatesLists)
+    if (mPrecision == SINGLE_PRECISION)
     {
-        delete list;
+        mDoubleOrdinates.clear();
+        mFloatOrdinates.fill(0.0f, size);
+    }
+    else
+    {
+        mFloatOrdinates.clear();
+        mDoubleOrdinates.fill(0.0, size);
     }
 
-    mInfluenceLoadOrdinatesLists.clear();
     mMinLoadList.clear();
     mMinLoadPositionList.clear();
     mMaxLoadList.clear();
     mMaxLoadPositionList.clear();
+
+    mMinLoadList.reserve(mBarsCount);
+    mMinLoadPositionList.reserve(mBarsCount);
+    mMaxLoadList.reserve(mBarsCount);
+    mMaxLoadPositionList.reserve(mBarsCount);
+
+    for (int i = 0; i < mBarsCount; ++i)
+    {
+        mMinLoadList.append(0.0);
+        mMinLoadPositionList.append(QString());
+        mMaxLoadList.append(0.0);
+        mMaxLoadPositionList.append(QString());
+    }
 }
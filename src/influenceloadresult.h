@@ -21,22 +21,60 @@
 
 #include <QObject>
 #include <QStringList>
+#include <QVector>
+
+//Read-only view over a row (one bar, all ordinates) or a column (all bars, one ordinate)
+//of the influence load ordinates matrix
+class InfluenceLoadOrdinatesSpan
+{
+    public:
+        InfluenceLoadOrdinatesSpan(const double *doubleData = 0,
+                                   const float  *floatData  = 0,
+                                   int          size        = 0,
+                                   int          stride      = 1);
+
+        int size() const;
+
+        bool isEmpty() const;
+
+        qreal at(int index) const;
+
+        qreal maxMagnitude() const;
+
+    private:
+        const double *mDoubleData;
+        const float  *mFloatData;
+        int          mSize;
+        int          mStride;
+};
 
 class InfluenceLoadResult : public QObject
 {
         Q_OBJECT
 
     public:
+        enum Precision
+        {
+            DOUBLE_PRECISION,
+            SINGLE_PRECISION
+        };
+
         explicit InfluenceLoadResult(int barsCount, int ordinatesCount, QObject *parent = 0);
         ~InfluenceLoadResult();
 
+        InfluenceLoadOrdinatesSpan barOrdinates(int barIndex) const;
+        InfluenceLoadOrdinatesSpan pathOrdinates(int ordinateIndex) const;
+
     public slots:
         int barsCount() const;
         int ordinatesCount() const;
-        void setParameters(int barsCount, int ordinatesCount);
-        const QList<qreal> &influenceLoadOrdinatesList(int index) const;
-        void setInfluenceLoadOrdinatesList(int index, const QList<qreal> &list);
-        void appendInfluenceLoadOrdinatesListValue(int listIndex, qreal value);
+        int solvedOrdinatesCount() const;
+        bool isComplete() const;
+        Precision precision() const;
+        void setParameters(int barsCount, int ordinatesCount, Precision precision = DOUBLE_PRECISION);
+        qreal ordinate(int barIndex, int ordinateIndex) const;
+        void setOrdinate(int barIndex, int ordinateIndex, qreal value);
+        void setSolvedOrdinatesCount(int count);
         qreal minLoad(int index) const;
         void setMinLoad(int index, qreal minLoad);
         const QString &minloadPosition(int index) const;
@@ -48,13 +86,18 @@ class InfluenceLoadResult : public QObject
         void resetParameters();
 
     private:
-        int                  mBarsCount;
-        int                  mOrdinatesCount;
-        QList<QList<qreal>*> mInfluenceLoadOrdinatesLists;
-        QList<qreal>         mMinLoadList;
-        QStringList          mMinLoadPositionList;
-        QList<qreal>         mMaxLoadList;
-        QStringList          mMaxLoadPositionList;
+        int             mBarsCount;
+        int             mOrdinatesCount;
+        int             mSolvedOrdinatesCount;
+        Precision       mPrecision;
+        QVector<double> mDoubleOrdinates; //Row-major, barsCount x ordinatesCount
+        QVector<float>  mFloatOrdinates;  //Row-major, barsCount x ordinatesCount
+        QList<qreal>    mMinLoadList;
+        QStringList     mMinLoadPositionList;
+        QList<qreal>    mMaxLoadList;
+        QStringList     mMaxLoadPositionList;
+
+        void allocate();
 };
 
 #endif // INFLUENCELOADRESULT_H
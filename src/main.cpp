@@ -16,22 +16,41 @@
 
 /* main.cpp */
 
+#include "scriptengine.h"
 #include "solver.h"
 #include <QApplication>
 
+#include <gsl/gsl_errno.h>
+
 int main(int argc, char *argv[])
 {
     QApplication application(argc, argv);
-    Solver solver;
+
+    //Solvers read the GSL status codes and fall back to other methods, so GSL errors must not abort. The handler is
+    //process-wide and is set once here, before any solver or checker thread starts.
+    gsl_set_error_handler_off();
 
     QStringList arguments = QCoreApplication::arguments();
 
+    //trusstables --script file.js runs the script on a hidden model and exits without showing a window
+
+    int scriptIndex = arguments.indexOf(QString("--script"));
+
+    if ((scriptIndex > 0) && (scriptIndex + 1 < arguments.size()))
+    {
+        ScriptEngine scriptEngine;
+        return scriptEngine.evaluateFile(arguments.at(scriptIndex + 1)) ? 0 : 1;
+    }
+
+    Solver solver;
+
     if (arguments.size() > 1 && QFile::exists(arguments.last()))
     {
         solver.loadFile(arguments.last());
     }
 
     solver.show();
+    solver.recoverAutosaves();
 
     return application.exec();
 }
@@ -24,19 +24,54 @@ ModelChecker::ModelChecker(const QList<Joint *>   &jointsList,
                            const UnitsAndLimits   &unitsAndLimits,
                            QObject                *parent) : QThread(parent)
 {
-    mJointsList     = jointsList;
-    mBarsList       = barsList;
-    mSupportsList   = supportsList;
-    mUnitsAndLimits = unitsAndLimits;
+    mOriginalBarsList     = barsList;
+    mOriginalSupportsList = supportsList;
+    mUnitsAndLimits       = unitsAndLimits;
 
-    mDegreeOfIndeterminacy = 0;
+    //Check copies of the joints, bars and supports so that the model can be edited while the check runs
+
+    QHash<Joint *, Joint *> jointCopies;
+    jointCopies.reserve(jointsList.size());
+
+    foreach (Joint *joint, jointsList)
+    {
+        Joint *copy = new Joint(joint->xCoordinate(), joint->yCoordinate());
+        copy->setSupported(joint->isSupported());
+        jointCopies.insert(joint, copy);
+        mJointsList.append(copy);
+    }
+
+    foreach (Bar *bar, barsList)
+    {
+        Joint *firstJoint  = jointCopies.value(bar->firstJoint());
+        Joint *secondJoint = jointCopies.value(bar->secondJoint());
+        Bar *copy          = new Bar(firstJoint, secondJoint);
+
+        firstJoint->connectedJoints()->append(secondJoint);
+        secondJoint->connectedJoints()->append(firstJoint);
+        firstJoint->attachedBars()->append(copy);
+        secondJoint->attachedBars()->append(copy);
+        mBarsList.append(copy);
+    }
+
+    foreach (Support *support, supportsList)
+    {
+        mSupportsList.append(new Support(support->type(),
+                                         support->angle(),
+                                         jointCopies.value(support->supportJoint())));
+    }
+
+    mDegreeOfIndeterminacy     = 0;
+    mMechanismDegreesOfFreedom = 0;
 
     connect(this, SIGNAL(finished()), this, SLOT(deleteLater()));
 }
 
 ModelChecker::~ModelChecker()
 {
-
+    qDeleteAll(mSupportsList);
+    qDeleteAll(mBarsList);
+    qDeleteAll(mJointsList);
 }
 
 Support *ModelChecker::jointSupport(Joint *joint)
@@ -85,7 +120,11 @@ void ModelChecker::run()
         return;
     }
 
-    if (hasDisconnectedParts())
+    //Connectivity, degrees and supports of all joints in one linear pass
+
+    ModelGraph graph(mJointsList, mBarsList, mSupportsList);
+
+    if (hasDisconnectedParts(graph))
     {
         QString note("Model has disconnected joints and bars.");
         emit notesSignal(note);
@@ -93,7 +132,7 @@ void ModelChecker::run()
         return;
     }
 
-    if (hasDanglingBar())
+    if (hasDanglingBar(graph))
     {
         QString note("Model has joint connected to single bar only.");
         emit notesSignal(note);
@@ -101,7 +140,7 @@ void ModelChecker::run()
         return;
     }
 
-    if (hasFixedJoints())
+    if (hasFixedJoints(graph))
     {
         QString note("Model has all joints fixed.");
         emit notesSignal(note);
@@ -109,7 +148,7 @@ void ModelChecker::run()
         return;
     }
 
-    if (hasInsufficientSupports())
+    if (hasInsufficientSupports(graph, Removal()))
     {
         QString note("Model unstable (external) due to insufficient supports.");
         emit notesSignal(note);
@@ -117,7 +156,7 @@ void ModelChecker::run()
         return;
     }
 
-    if (hasInsufficientBars())
+    if (hasInsufficientBars(graph, Removal()))
     {
         QString note("Model unstable (internal) due to insufficient number of bars.");
         emit notesSignal(note);
@@ -133,6 +172,53 @@ void ModelChecker::run()
         return;
     }
 
+    bool isGenericMechanism = false;
+
+    if (hasGenericMechanism(graph))
+    {
+        QString note("Model unstable (internal) due to bars configuration.");
+
+        QStringList jointNumbersList;
+
+        foreach (int index, mMechanismJoints)
+        {
+            if (jointNumbersList.size() == kMaxReportedDegreesOfFreedom)
+            {
+                jointNumbersList.append(tr("..."));
+                break;
+            }
+
+            jointNumbersList.append(QString::number(index + 1));
+        }
+
+        note.append(tr("\nGeneric mechanism (%1 degrees of freedom) at joints : ").arg(mMechanismDegreesOfFreedom));
+        note.append(jointNumbersList.join(tr(", ")));
+
+        if (!mOverBracedBars.isEmpty())
+        {
+            QStringList barNumbersList;
+
+            foreach (int index, mOverBracedBars)
+            {
+                if (barNumbersList.size() == kMaxReportedDegreesOfFreedom)
+                {
+                    barNumbersList.append(tr("..."));
+                    break;
+                }
+
+                barNumbersList.append(QString::number(index + 1));
+            }
+
+            note.append(tr("\nOver-braced bars : "));
+            note.append(barNumbersList.join(tr(", ")));
+        }
+
+        //Numeric work continues only to find the mechanism modes
+
+        emit notesSignal(note);
+        isGenericMechanism = true;
+    }
+
     //---------------------------------------------------------------------------------------------------------------
 
     //Create substitute joints and bars for inclined roller support
@@ -170,7 +256,7 @@ void ModelChecker::run()
     foreach (Support *support, mSupportsList)
     {
         UnitsAndLimits::SupportType type = support->type();
-        int index                        = mJointsList.indexOf(support->supportJoint());
+        int index                        = graph.jointIndex(support->supportJoint());
 
         switch (type)
         {
@@ -220,22 +306,31 @@ void ModelChecker::run()
         mBarsList.append(bar);
     }
 
-    int order                              = 2 * mJointsList.size();
-    int orderReduced                       = order - fixedDegreesOfFreedom.size();
-    gsl_matrix *partitionedStiffnessMatrix = gsl_matrix_calloc(orderReduced, orderReduced);
+    int order                                = 2 * mJointsList.size();
+    int orderReduced                         = order - fixedDegreesOfFreedom.size();
+    gsl_spmatrix *partitionedStiffnessMatrix = gsl_spmatrix_alloc(orderReduced, orderReduced);
 
     qreal epsilonMagnitudeSmall = 1.0e-12;
 
     QList<int> degreesOfFreedom;
+    QVector<int> reducedIndices(order, -1);
+
+    foreach (int index, fixedDegreesOfFreedom)
+    {
+        reducedIndices[index] = -2;
+    }
 
     for (int i = 0; i < order; ++i)
     {
-        if (!fixedDegreesOfFreedom.contains(i))
+        if (reducedIndices.at(i) == -1)
         {
+            reducedIndices[i] = degreesOfFreedom.size();
             degreesOfFreedom.append(i);
         }
     }
 
+    ModelIndex modelIndex(mJointsList);
+
     foreach (Bar *bar, mBarsList)
     {
         qreal x1     = bar->firstJoint()->xCoordinate();
@@ -249,11 +344,11 @@ void ModelChecker::run()
         qreal S      = deltaY / length;
 
         QList<int> indexList;
-        int index = mJointsList.indexOf(bar->firstJoint());
+        int index = modelIndex.jointIndex(bar->firstJoint());
         indexList.append(2 * index);
         indexList.append(2 * index + 1);
 
-        index = mJointsList.indexOf(bar->secondJoint());
+        index = modelIndex.jointIndex(bar->secondJoint());
         indexList.append(2 * index);
         indexList.append(2 * index + 1);
 
@@ -273,36 +368,32 @@ void ModelChecker::run()
                     int row = indexList[i];
                     int col = indexList[j];
 
-                    if (degreesOfFreedom.contains(row) && degreesOfFreedom.contains(col))
-                    {
-                        int rowIndex = degreesOfFreedom.indexOf(row);
-                        int colIndex = degreesOfFreedom.indexOf(col);
+                    int rowIndex = reducedIndices.at(row);
+                    int colIndex = reducedIndices.at(col);
 
-                        if (rowIndex >= colIndex)
-                        {
-                            qreal currentValue = gsl_matrix_get(partitionedStiffnessMatrix, rowIndex, colIndex);
-                            currentValue += value;
-                            gsl_matrix_set(partitionedStiffnessMatrix, rowIndex, colIndex, currentValue);
-                        }
+                    if (rowIndex >= 0 && colIndex >= 0 && rowIndex >= colIndex)
+                    {
+                        qreal currentValue = gsl_spmatrix_get(partitionedStiffnessMatrix, rowIndex, colIndex);
+                        currentValue += value;
+                        gsl_spmatrix_set(partitionedStiffnessMatrix, rowIndex, colIndex, currentValue);
                     }
                 }
             }
         }
     }
 
-    foreach (Joint *joint, substituteJointsList)
-    {
-        mJointsList.removeOne(joint);
-    }
-
-    foreach (Bar *bar, substituteBarsList)
-    {
-        mBarsList.removeOne(bar);
-    }
+    //The substitutes were appended last, so they are dropped from the ends without searching
+    mJointsList.erase(mJointsList.end() - substituteJointsList.size(), mJointsList.end());
+    mBarsList.erase(mBarsList.end() - substituteBarsList.size(), mBarsList.end());
 
     //---------------------------------------------------------------------------------------------------------------
 
-    if (hasUnstableConfiguration(partitionedStiffnessMatrix))
+    //A single factorization serves the stability check and every bar redundancy check
+
+    SparseLdlFactorization factorization(partitionedStiffnessMatrix);
+    gsl_spmatrix_free(partitionedStiffnessMatrix);
+
+    if (hasUnstableConfiguration(factorization) || isGenericMechanism)
     {
         foreach (Joint *joint, substituteJointsList)
         {
@@ -314,222 +405,91 @@ void ModelChecker::run()
             delete bar;
         }
 
-        gsl_matrix_free(partitionedStiffnessMatrix);
-
-        QString note("Model unstable (internal) due to bars configuration.");
-        emit notesSignal(note);
-        emit progressSignal(100);
-        return;
-    }
-
-    emit progressSignal(50);
-    emit modelStabilitySignal(true);
-
-    QList<Bar *> redundantBarsList;
-
-    //Check each bar for redundancy by removing the bar and running checks
-    int barsCount = mBarsList.size();
-
-    for (int index = 0; index < barsCount; index++)
-    {
-        Bar* bar      = mBarsList[index];
-        Joint *jointA = bar->firstJoint();
-        Joint *jointB = bar->secondJoint();
-
-        bool removeFirstJoint  = false;
-        bool removeSecondJoint = false;
-        Support *support       = 0;
-        int removeJointIndex   = 0;
-        int removeSupportIndex = 0;
-
-        if (bar->firstJoint()->attachedBars()->size() == 1)
-        {
-            removeFirstJoint = true;
-            support          = jointSupport(jointA);
-        }
-
-        if (bar->secondJoint()->attachedBars()->size() == 1)
-        {
-            removeSecondJoint = true;
-            support           = jointSupport(jointB);
-        }
-
-        jointA->attachedBars()->removeOne(bar);
-        jointB->attachedBars()->removeOne(bar);
-        jointA->connectedJoints()->removeOne(jointB);
-        jointB->connectedJoints()->removeOne(jointA);
-        mBarsList.removeAt(index);
+        emit mechanismModesSignal(mechanismModes(factorization, degreesOfFreedom));
 
-        if (removeFirstJoint)
+        if (isGenericMechanism)
         {
-            removeJointIndex = mJointsList.indexOf(jointA);
-            mJointsList.removeAt(removeJointIndex);
-            removeSupportIndex = mSupportsList.indexOf(support);
-            mSupportsList.removeAt(removeSupportIndex);
+            emit progressSignal(100);
+            return;
         }
 
-        if (removeSecondJoint)
-        {
-            removeJointIndex = mJointsList.indexOf(jointB);
-            mJointsList.removeAt(removeJointIndex);
-            removeSupportIndex = mSupportsList.indexOf(support);
-            mSupportsList.removeAt(removeSupportIndex);
-        }
-
-        qreal x1     = bar->firstJoint()->xCoordinate();
-        qreal y1     = bar->firstJoint()->yCoordinate();
-        qreal x2     = bar->secondJoint()->xCoordinate();
-        qreal y2     = bar->secondJoint()->yCoordinate();
-        qreal deltaX = x2 - x1;
-        qreal deltaY = y2 - y1;
-        qreal length = std::sqrt(std::pow(deltaX, 2.0) + std::pow(deltaY, 2.0));
-        qreal C      = deltaX / length;
-        qreal S      = deltaY / length;
-
-        QList<int> indexList;
-        int jointIndex = mJointsList.indexOf(bar->firstJoint());
-        indexList.append(2 * jointIndex);
-        indexList.append(2 * jointIndex + 1);
-
-        jointIndex = mJointsList.indexOf(bar->secondJoint());
-        indexList.append(2 * jointIndex);
-        indexList.append(2 * jointIndex + 1);
-
-        qreal matrix[4][4] = {{ C * C,  C * S, -C * C, -C * S},
-                              { C * S,  S * S, -C * S, -S * S},
-                              {-C * C, -C * S,  C * C,  C * S},
-                              {-C * S, -S * S,  C * S,  S * S}};
+        QString note("Model unstable (internal) due to bars configuration.");
 
-        if (removeFirstJoint || removeSecondJoint)
+        if (!mZeroEnergyDegreesOfFreedom.isEmpty())
         {
-            bool checkA = mJointsList.size() < 3;
-
-            bool checkB = false;
-
-            if (!checkA)
-            {
-                checkB = mBarsList.size() < 2;
-            }
+            //Joints and directions free to move without straining any bar, substitute roller joints excluded
 
-            bool checkC = false;
+            QStringList jointsDirectionsList;
 
-            if (!checkA && !checkB)
+            foreach (int index, mZeroEnergyDegreesOfFreedom)
             {
-                checkC = mSupportsList.size() < 2;
-            }
-
-            bool checkD = false;
+                int degreeOfFreedom = degreesOfFreedom.at(index);
+                int jointNumber     = degreeOfFreedom / 2 + 1;
 
-            if (!checkA && !checkB && !checkC)
-            {
-                checkD = hasInsufficientBars();
-            }
-
-            bool checkE = false;
+                if (jointNumber <= mJointsList.size())
+                {
+                    QString direction = (degreeOfFreedom % 2 == 0) ? tr("x") : tr("y");
+                    jointsDirectionsList.append(tr("%1 (%2)").arg(jointNumber).arg(direction));
+                }
 
-            if (!checkA && !checkB && !checkC && !checkD)
-            {
-                checkE = hasInsufficientSupports();
+                if (jointsDirectionsList.size() == kMaxReportedDegreesOfFreedom)
+                {
+                    jointsDirectionsList.append(tr("..."));
+                    break;
+                }
             }
 
-            if (!checkA && !checkB && !checkC && !checkD && !checkE)
-            {
-                redundantBarsList.append(bar);
-            }
+            note.append(tr("\nZero-energy degrees of freedom at joints : "));
+            note.append(jointsDirectionsList.join(tr(", ")));
         }
-        else
-        {
-            for (int i = 0; i < 4; ++i)
-            {
-                for (int j = 0; j < 4; ++j)
-                {
-                    qreal value = matrix[i][j] / length;
-
-                    if (std::fabs(value) > epsilonMagnitudeSmall)
-                    {
-                        int row = indexList[i];
-                        int col = indexList[j];
 
-                        if (degreesOfFreedom.contains(row) && degreesOfFreedom.contains(col))
-                        {
-                            int rowIndex = degreesOfFreedom.indexOf(row);
-                            int colIndex = degreesOfFreedom.indexOf(col);
-
-                            if (rowIndex >= colIndex)
-                            {
-                                qreal currentValue = gsl_matrix_get(partitionedStiffnessMatrix, rowIndex, colIndex);
-                                currentValue -= value;
-                                gsl_matrix_set(partitionedStiffnessMatrix, rowIndex, colIndex, currentValue);
-                            }
-                        }
-                    }
-                }
-            }
+        emit notesSignal(note);
+        emit progressSignal(100);
+        return;
+    }
 
-            bool check = hasUnstableConfiguration(partitionedStiffnessMatrix);
+    emit progressSignal(50);
+    emit modelStabilitySignal(true);
 
-            if (!check)
-            {
-                redundantBarsList.append(bar);
-            }
-        }
+    //Every bar and support is a redundancy candidate checked against the unchanged model, so the candidates run
+    //concurrently. Removing a bar keeps the model stable unless its leverage h = k b' inv(K) b is one, that is unless
+    //the bar carries no self-stress state; the leverages of all bars follow from the selected inverse of K. Bars
+    //ending on a joint with no other bar and supports are checked by counts with the bar, joint or support left out.
+    factorization.computeSelectedInverse();
 
-        jointA->attachedBars()->append(bar);
-        jointB->attachedBars()->append(bar);
-        jointA->connectedJoints()->append(jointB);
-        jointB->connectedJoints()->append(jointA);
-        mBarsList.insert(index, bar);
+    QVector<RedundancyCheck> checksList;
+    int barsCount = mBarsList.size();
 
-        if (removeFirstJoint)
+    for (int index = 0; index < barsCount; ++index)
+    {
+        int firstJoint  = graph.barFirstJoint(index);
+        int secondJoint = graph.barSecondJoint(index);
+
+        RedundancyCheck check;
+        check.checker        = this;
+        check.graph          = &graph;
+        check.factorization  = &factorization;
+        check.reducedIndices = &reducedIndices;
+        check.removal        = Removal(index);
+        check.isRedundant    = false;
+
+        if (graph.degree(firstJoint) == 1)
         {
-            mJointsList.insert(removeJointIndex, jointA);
-            mSupportsList.insert(removeSupportIndex, support);
+            check.removal = Removal(index,
+                                    firstJoint,
+                                    graph.modelIndex().supportIndex(graph.jointSupport(firstJoint)));
         }
 
-        if (removeSecondJoint)
+        if (graph.degree(secondJoint) == 1)
         {
-            mJointsList.insert(removeJointIndex, jointB);
-            mSupportsList.insert(removeSupportIndex, support);
+            check.removal = Removal(index,
+                                    secondJoint,
+                                    graph.modelIndex().supportIndex(graph.jointSupport(secondJoint)));
         }
 
-        if (!removeFirstJoint && !removeSecondJoint)
-        {
-            for (int i = 0; i < 4; ++i)
-            {
-                for (int j = 0; j < 4; ++j)
-                {
-                    qreal value = matrix[i][j] / length;
-
-                    if (std::fabs(value) > epsilonMagnitudeSmall)
-                    {
-                        int row = indexList[i];
-                        int col = indexList[j];
-
-                        if (degreesOfFreedom.contains(row) && degreesOfFreedom.contains(col))
-                        {
-                            int rowIndex = degreesOfFreedom.indexOf(row);
-                            int colIndex = degreesOfFreedom.indexOf(col);
-
-                            if (rowIndex >= colIndex)
-                            {
-                                qreal currentValue = gsl_matrix_get(partitionedStiffnessMatrix, rowIndex, colIndex);
-                                currentValue += value;
-                                gsl_matrix_set(partitionedStiffnessMatrix, rowIndex, colIndex, currentValue);
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        checksList.append(check);
     }
 
-    emit redundantBarsListSignal(redundantBarsList);
-
-    emit progressSignal(75);
-
-    QList<Support *> redundantSupportsList;
-
-    //Check each support for redundancy by removing the support and running checks
     int supportsCount = mSupportsList.size();
 
     for (int index = 0; index < supportsCount; ++index)
@@ -547,101 +507,61 @@ void ModelChecker::run()
             continue;
         }
 
-        Joint *joint         = support->supportJoint();
-        Bar *bar             = 0;
-        int removeBarIndex   = 0;
-        int removeJointIndex = 0;
-        Joint *jointA        = 0;
-        Joint *jointB        = 0;
-
-        if (joint->attachedBars()->size() == 1)
-        {
-            bar    = joint->attachedBars()->first();
-            jointA = bar->firstJoint();
-            jointB = bar->secondJoint();
-
-            jointA->attachedBars()->removeOne(bar);
-            jointB->attachedBars()->removeOne(bar);
-            jointA->connectedJoints()->removeOne(jointB);
-            jointB->connectedJoints()->removeOne(jointA);
-            removeBarIndex = mBarsList.indexOf(bar);
-            mBarsList.removeAt(removeBarIndex);
-            removeJointIndex = mJointsList.indexOf(joint);
-            mJointsList.removeAt(removeJointIndex);
-            mSupportsList.removeOne(support);
+        int joint = graph.jointIndex(support->supportJoint());
 
-            bool checkA = mJointsList.size() < 3;
+        RedundancyCheck check;
+        check.checker        = this;
+        check.graph          = &graph;
+        check.factorization  = &factorization;
+        check.reducedIndices = &reducedIndices;
+        check.removal        = Removal(-1, -1, index);
+        check.isRedundant    = false;
 
-            bool checkB = false;
+        if (graph.degree(joint) == 1)
+        {
+            check.removal = Removal(graph.adjacentBars().at(graph.adjacencyBegin(joint)), joint, index);
+        }
 
-            if (!checkA)
-            {
-                checkB = mBarsList.size() < 2;
-            }
+        checksList.append(check);
+    }
 
-            bool checkC = false;
+    QFuture<void> future = QtConcurrent::map(checksList, &ModelChecker::checkRedundancy);
 
-            if (!checkA && !checkB)
-            {
-                checkC = mSupportsList.size() < 2;
-            }
+    while (!future.isFinished())
+    {
+        if (future.progressMaximum() > 0)
+        {
+            emit progressSignal(50 + (50 * future.progressValue()) / (future.progressMaximum() + 1));
+        }
 
-            bool checkD = false;
+        QThread::msleep(kProgressInterval);
+    }
 
-            if (!checkA && !checkB && !checkC)
-            {
-                checkD = hasInsufficientBars();
-            }
+    future.waitForFinished();
 
-            bool checkE = false;
+    QList<Bar *> redundantBarsList;
+    QList<Support *> redundantSupportsList;
 
-            if (!checkA && !checkB && !checkC && !checkD)
-            {
-                checkE = hasInsufficientSupports();
-            }
+    for (int i = 0; i < checksList.size(); ++i)
+    {
+        const RedundancyCheck &check = checksList.at(i);
 
-            if (!checkA && !checkB && !checkC && !checkD && !checkE)
-            {
-                redundantSupportsList.append(support);
-            }
+        if (!check.isRedundant)
+        {
+            continue;
+        }
 
-            jointA->attachedBars()->append(bar);
-            jointB->attachedBars()->append(bar);
-            jointA->connectedJoints()->append(jointB);
-            jointB->connectedJoints()->append(jointA);
-            mBarsList.insert(removeBarIndex, bar);
-            mJointsList.insert(removeJointIndex, joint);
-            mSupportsList.insert(index, support);
+        if (i < barsCount)
+        {
+            redundantBarsList.append(mOriginalBarsList.at(check.removal.bar));
         }
         else
         {
-            mSupportsList.removeOne(support);
-
-            bool checkA = mSupportsList.size() < 2;
-
-            bool checkB = false;
-
-            if (!checkA)
-            {
-                checkB = hasInsufficientSupports();
-            }
-
-            bool checkC = false;
-
-            if (!checkA && !checkB)
-            {
-                checkC = hasUnstableConfiguration(partitionedStiffnessMatrix);
-            }
-
-            if (!checkA && !checkB && !checkC)
-            {
-                redundantSupportsList.append(support);
-            }
-
-            mSupportsList.insert(index, support);
+            redundantSupportsList.append(mOriginalSupportsList.at(check.removal.support));
         }
     }
 
+    emit redundantBarsListSignal(redundantBarsList);
     emit redundantSupportsListSignal(redundantSupportsList);
 
     QString note;
@@ -651,7 +571,7 @@ void ModelChecker::run()
     note.append(tr("Supports count          : ") + QString::number(mSupportsList.size()) + tr("\n"));
 
     //Determine degree of indeterminacy
-    hasInsufficientBars();
+    hasInsufficientBars(graph, Removal(), &mDegreeOfIndeterminacy);
 
     if (mDegreeOfIndeterminacy > 0)
     {
@@ -668,117 +588,58 @@ void ModelChecker::run()
         delete bar;
     }
 
-    gsl_matrix_free(partitionedStiffnessMatrix);
-
     emit notesSignal(note);
     emit progressSignal(100);
 
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasDisconnectedParts()
+bool ModelChecker::hasDisconnectedParts(const ModelGraph &graph)
 {
     //---------------------------------------------------------------------------------------------------------------
 
     //Check if structure has disconnected parts
-    int index = 0;
-    QList<Joint *> connectedJointsList;
-    connectedJointsList.append(mJointsList.at(index));
-
-    forever
-    {
-        foreach (Joint *joint, *connectedJointsList.at(index)->connectedJoints())
-        {
-            if (!connectedJointsList.contains(joint))
-            {
-                connectedJointsList.append(joint);
-            }
-        }
-
-        if (!(index == (connectedJointsList.size() - 1)))
-        {
-            ++index;
-        }
-        else
-        {
-            if (connectedJointsList.size() == mJointsList.size())
-            {
-                return false;
-            }
-            else
-            {
-                return true;
-            }
-        }
-    }
+    return !graph.isConnected();
 
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasDanglingBar()
+bool ModelChecker::hasDanglingBar(const ModelGraph &graph)
 {
     //---------------------------------------------------------------------------------------------------------------
 
     //Check if structure has dangling bar
-    foreach (Joint *joint, mJointsList)
-    {
-        bool checkA = joint->attachedBars()->size() == 1;
-        bool checkB = !joint->isSupported();
-
-        if (checkA && checkB)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return !graph.danglingBars().isEmpty();
 
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasFixedJoints()
+bool ModelChecker::hasFixedJoints(const ModelGraph &graph)
 {
     //---------------------------------------------------------------------------------------------------------------
 
     //Check if structure has all joints fixed
-    foreach (Joint *joint, mJointsList)
-    {
-        if (joint->isSupported())
-        {
-            Support *support = jointSupport(joint);
-
-            bool checkA = support->type() == UnitsAndLimits::FIXED_BOTTOM;
-            bool checkB = support->type() == UnitsAndLimits::FIXED_LEFT;
-            bool checkC = support->type() == UnitsAndLimits::FIXED_TOP;
-            bool checkD = support->type() == UnitsAndLimits::FIXED_RIGHT;
-
-            bool checkE = (checkA || checkB || checkC || checkD);
-
-            if (!checkE)
-            {
-                return false;
-            }
-        }
-        else
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return graph.hasAllJointsFixed();
 
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasInsufficientSupports()
+bool ModelChecker::hasInsufficientSupports(const ModelGraph &graph, const Removal &removal) const
 {
     //---------------------------------------------------------------------------------------------------------------
 
     //Check for instability due to insufficient supports
     int fixedSupportsCount = 0;
 
-    foreach (Support *support, mSupportsList)
+    for (int index = 0; index < mSupportsList.size(); ++index)
     {
+        if (index == removal.support)
+        {
+            continue;
+        }
+
+        Support *support = mSupportsList.at(index);
+
         bool checkA = support->type() == UnitsAndLimits::FIXED_BOTTOM;
         bool checkB = support->type() == UnitsAndLimits::FIXED_LEFT;
         bool checkC = support->type() == UnitsAndLimits::FIXED_TOP;
@@ -792,7 +653,9 @@ bool ModelChecker::hasInsufficientSupports()
         }
     }
 
-    if (mBarsList.size() == fixedSupportsCount)
+    int barsCount = mBarsList.size() - (removal.bar >= 0 ? 1 : 0);
+
+    if (barsCount == fixedSupportsCount)
     {
         return false; // Stability guaranteed
     }
@@ -804,8 +667,14 @@ bool ModelChecker::hasInsufficientSupports()
         QList<qreal> slopesList;
         QList<QPointF> pointsList;
 
-        foreach (Support *support, mSupportsList)
+        for (int index = 0; index < mSupportsList.size(); ++index)
         {
+            if (index == removal.support)
+            {
+                continue;
+            }
+
+            Support *support = mSupportsList.at(index);
             qreal slope;
             QPointF point;
             Joint *joint      = support->supportJoint();
@@ -814,9 +683,11 @@ bool ModelChecker::hasInsufficientSupports()
             point.setX(xCoordinate);
             point.setY(yCoordinate);
 
-            if (support->supportJoint()->attachedBars()->size() == 1)
+            int jointIndex = graph.jointIndex(joint);
+
+            if (attachedBarsCount(graph, jointIndex, removal) == 1)
             {
-                Bar *bar = support->supportJoint()->attachedBars()->first();
+                Bar *bar = mBarsList.at(firstAttachedBar(graph, jointIndex, removal));
 
                 qreal x1     = bar->firstJoint()->xCoordinate();
                 qreal y1     = bar->firstJoint()->yCoordinate();
@@ -970,19 +841,33 @@ bool ModelChecker::hasInsufficientSupports()
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasInsufficientBars()
+bool ModelChecker::hasInsufficientBars(const ModelGraph &graph,
+                                       const Removal    &removal,
+                                       int              *degreeOfIndeterminacy) const
 {
     //---------------------------------------------------------------------------------------------------------------
 
     //Check for instability due to insufficient bars
-    int jointsCount            = mJointsList.size();
-    int barsCount              = mBarsList.size();
+    int jointsCount            = mJointsList.size() - (removal.joint >= 0 ? 1 : 0);
+    int barsCount              = mBarsList.size() - (removal.bar >= 0 ? 1 : 0);
     int supportComponentsCount = 0;
     int fixedSupportsCount     = 0;
-    mDegreeOfIndeterminacy     = 0;
+    Support *removedSupport    = (removal.support >= 0) ? mSupportsList.at(removal.support) : 0;
 
-    foreach (Support *support, mSupportsList)
+    if (degreeOfIndeterminacy != 0)
     {
+        *degreeOfIndeterminacy = 0;
+    }
+
+    for (int index = 0; index < mSupportsList.size(); ++index)
+    {
+        if (index == removal.support)
+        {
+            continue;
+        }
+
+        Support *support = mSupportsList.at(index);
+
         bool checkA = support->type() == UnitsAndLimits::FIXED_BOTTOM;
         bool checkB = support->type() == UnitsAndLimits::FIXED_LEFT;
         bool checkC = support->type() == UnitsAndLimits::FIXED_TOP;
@@ -998,18 +883,23 @@ bool ModelChecker::hasInsufficientBars()
 
     if (barsCount == fixedSupportsCount) //Stability guaranteed
     {
-        if ((3 * barsCount) > (2 * jointsCount))
+        if (((3 * barsCount) > (2 * jointsCount)) && degreeOfIndeterminacy != 0)
         {
-            mDegreeOfIndeterminacy = (3 * barsCount) - (2 * jointsCount);
+            *degreeOfIndeterminacy = (3 * barsCount) - (2 * jointsCount);
         }
 
         return false;
     }
     else
     {
-        foreach (Joint *joint, mJointsList)
+        for (int index = 0; index < graph.jointsCount(); ++index)
         {
-            if (joint->attachedBars()->size() == 1)
+            if (index == removal.joint)
+            {
+                continue;
+            }
+
+            if (attachedBarsCount(graph, index, removal) == 1)
             {
                 --jointsCount;
                 --barsCount;
@@ -1017,10 +907,10 @@ bool ModelChecker::hasInsufficientBars()
             }
             else
             {
-                if (joint->isSupported())
-                {
-                    Support *support = jointSupport(joint);
+                Support *support = graph.jointSupport(index);
 
+                if (support != 0 && support != removedSupport)
+                {
                     UnitsAndLimits::SupportType type = support->type();
 
                     switch (type)
@@ -1045,9 +935,9 @@ bool ModelChecker::hasInsufficientBars()
             }
         }
 
-        if ((barsCount + supportComponentsCount) > 2 * jointsCount)
+        if (((barsCount + supportComponentsCount) > 2 * jointsCount) && degreeOfIndeterminacy != 0)
         {
-            mDegreeOfIndeterminacy = (barsCount + supportComponentsCount) - 2 * jointsCount;
+            *degreeOfIndeterminacy = (barsCount + supportComponentsCount) - 2 * jointsCount;
         }
 
         if ((barsCount + supportComponentsCount) < 2 * jointsCount)
@@ -1063,6 +953,41 @@ bool ModelChecker::hasInsufficientBars()
     //---------------------------------------------------------------------------------------------------------------
 }
 
+int ModelChecker::attachedBarsCount(const ModelGraph &graph, int joint, const Removal &removal) const
+{
+    //---------------------------------------------------------------------------------------------------------------
+
+    //Bars attached to the joint once the removed bar is left out
+    int count = graph.degree(joint);
+
+    if (removal.bar >= 0 && (graph.barFirstJoint(removal.bar) == joint || graph.barSecondJoint(removal.bar) == joint))
+    {
+        --count;
+    }
+
+    return count;
+
+    //---------------------------------------------------------------------------------------------------------------
+}
+
+int ModelChecker::firstAttachedBar(const ModelGraph &graph, int joint, const Removal &removal) const
+{
+    //---------------------------------------------------------------------------------------------------------------
+
+    //First bar attached to the joint other than the removed bar
+    for (int p = graph.adjacencyBegin(joint); p < graph.adjacencyEnd(joint); ++p)
+    {
+        if (graph.adjacentBars().at(p) != removal.bar)
+        {
+            return graph.adjacentBars().at(p);
+        }
+    }
+
+    return -1;
+
+    //---------------------------------------------------------------------------------------------------------------
+}
+
 bool ModelChecker::hasFixedBars()
 {
     //---------------------------------------------------------------------------------------------------------------
@@ -1103,46 +1028,286 @@ bool ModelChecker::hasFixedBars()
     //---------------------------------------------------------------------------------------------------------------
 }
 
-bool ModelChecker::hasUnstableConfiguration(gsl_matrix *matrix)
+bool ModelChecker::hasGenericMechanism(const ModelGraph &graph)
 {
     //---------------------------------------------------------------------------------------------------------------
 
-    //Check for instability due to bars configuration
+    //Check for a mechanism in every placement of the joints by the pebble game. The supports tie joints to a ground
+    //body made rigid by a bar between two ground vertices, a fixed support by two bars and a roller by one. Each
+    //roller bar ends at a ground vertex of its own, pinned to the ground body, so that roller reaction lines are in
+    //general position rather than all meeting at one ground point.
+
+    int jointsCount  = graph.jointsCount();
+    int firstGround  = jointsCount;
+    int secondGround = jointsCount + 1;
+    int rollersCount = 0;
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        if (graph.jointSupport(i) != 0 && !graph.isFixedJoint(i))
+        {
+            ++rollersCount;
+        }
+    }
 
-    qreal epsilonMagnitudeSmall = 1.0e-6;
+    PebbleGame pebbleGame(jointsCount + 2 + rollersCount);
+    pebbleGame.addEdge(firstGround, secondGround);
 
-    int order = matrix->size1;
+    mMechanismJoints.clear();
+    mOverBracedBars.clear();
+    mMechanismDegreesOfFreedom = 0;
 
-    gsl_matrix *lower = gsl_matrix_calloc(order, order);
-    gsl_matrix_memcpy(lower, matrix);
+    int rollerGround = secondGround + 1;
 
-    //turn-off error handler
-    gsl_set_error_handler_off();
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        if (graph.jointSupport(i) == 0)
+        {
+            continue;
+        }
 
-    int status = gsl_linalg_cholesky_decomp1(lower);
-    //fprintf(stderr, "\nCholesky decomposition: %s\n", gsl_strerror(status));
+        if (graph.isFixedJoint(i))
+        {
+            pebbleGame.addEdge(i, firstGround);
+            pebbleGame.addEdge(i, secondGround);
+        }
+        else
+        {
+            pebbleGame.addEdge(rollerGround, firstGround);
+            pebbleGame.addEdge(rollerGround, secondGround);
+            pebbleGame.addEdge(i, rollerGround);
+            ++rollerGround;
+        }
+    }
 
-    //restore error handler
-    gsl_set_error_handler(NULL);
+    for (int i = 0; i < graph.barsCount(); ++i)
+    {
+        if (!pebbleGame.addEdge(graph.barFirstJoint(i), graph.barSecondJoint(i)))
+        {
+            mOverBracedBars.append(i);
+        }
+    }
+
+    mMechanismDegreesOfFreedom = pebbleGame.degreesOfFreedom();
 
-    if (status != GSL_SUCCESS)
+    if (mMechanismDegreesOfFreedom == 0)
     {
-        gsl_matrix_free(lower);
-        return true;
+        mOverBracedBars.clear();
+        return false;
     }
 
-    for (int i = 0; i < order; ++i)
+    //Ground vertices added for rollers are not model joints
+
+    foreach (int vertex, pebbleGame.flexibleVertices(firstGround, secondGround))
     {
-        if (std::fabs(gsl_matrix_get(lower, i, i)) < epsilonMagnitudeSmall)
+        if (vertex < jointsCount)
         {
-            gsl_matrix_free(lower);
-            return true;
+            mMechanismJoints.append(vertex);
         }
     }
 
-    gsl_matrix_free(lower);
-    return false;
+    return true;
+
+    //---------------------------------------------------------------------------------------------------------------
+}
+
+QList<QVector<qreal> > ModelChecker::mechanismModes(const SparseLdlFactorization &factorization,
+                                                    const QList<int>             &degreesOfFreedom) const
+{
+    //---------------------------------------------------------------------------------------------------------------
+
+    //A unit load at each zero-energy pivot, held by its spring, deflects the model in a multiple of a zero-energy
+    //mode; together these loads span the null space of the reduced stiffness matrix. Modes are made orthogonal and
+    //scaled to a largest joint movement of one, with x and y components of every joint in turn.
+
+    QList<QVector<qreal> > reducedModesList;
+    QList<QVector<qreal> > modesList;
+    int order = factorization.order();
+
+    foreach (int index, factorization.zeroEnergyDegreesOfFreedom())
+    {
+        if (reducedModesList.size() == kMaxMechanismModes)
+        {
+            break;
+        }
+
+        QVector<qreal> mode(order, 0.0);
+        mode[index] = 1.0;
+        factorization.solve(mode);
+
+        foreach (const QVector<qreal> &previousMode, reducedModesList)
+        {
+            qreal product = 0.0;
+
+            for (int i = 0; i < order; ++i)
+            {
+                product += mode.at(i) * previousMode.at(i);
+            }
+
+            for (int i = 0; i < order; ++i)
+            {
+                mode[i] -= product * previousMode.at(i);
+            }
+        }
+
+        qreal norm = 0.0;
+
+        for (int i = 0; i < order; ++i)
+        {
+            norm += mode.at(i) * mode.at(i);
+        }
+
+        if (norm <= 0.0)
+        {
+            continue;
+        }
+
+        norm = std::sqrt(norm);
+
+        for (int i = 0; i < order; ++i)
+        {
+            mode[i] /= norm;
+        }
+
+        reducedModesList.append(mode);
+    }
+
+    int jointsDegreesOfFreedom = 2 * mJointsList.size();
+
+    foreach (const QVector<qreal> &reducedMode, reducedModesList)
+    {
+        QVector<qreal> mode(jointsDegreesOfFreedom, 0.0);
+        qreal maxMovement = 0.0;
+
+        for (int i = 0; i < order; ++i)
+        {
+            //Substitute roller joints are left out
+
+            if (degreesOfFreedom.at(i) < jointsDegreesOfFreedom)
+            {
+                mode[degreesOfFreedom.at(i)] = reducedMode.at(i);
+            }
+        }
+
+        for (int i = 0; i < jointsDegreesOfFreedom; i += 2)
+        {
+            maxMovement = qMax(maxMovement, std::sqrt(mode.at(i) * mode.at(i) + mode.at(i + 1) * mode.at(i + 1)));
+        }
+
+        if (maxMovement > 0.0)
+        {
+            for (int i = 0; i < jointsDegreesOfFreedom; ++i)
+            {
+                mode[i] /= maxMovement;
+            }
+
+            modesList.append(mode);
+        }
+    }
+
+    return modesList;
 
     //---------------------------------------------------------------------------------------------------------------
 }
 
+bool ModelChecker::hasUnstableConfiguration(const SparseLdlFactorization &factorization)
+{
+    //---------------------------------------------------------------------------------------------------------------
+
+    //Check for instability due to bars configuration
+
+    mZeroEnergyDegreesOfFreedom = factorization.zeroEnergyDegreesOfFreedom();
+
+    return factorization.isSingular();
+
+    //---------------------------------------------------------------------------------------------------------------
+}
+
+void ModelChecker::checkRedundancy(RedundancyCheck &check)
+{
+    //---------------------------------------------------------------------------------------------------------------
+
+    //Check one redundancy candidate against the unchanged model, which all candidates share read only
+    const ModelChecker *checker = check.checker;
+    const ModelGraph &graph     = *check.graph;
+    const Removal &removal      = check.removal;
+
+    if (removal.joint >= 0)
+    {
+        //Bar, its end joint with no other bar and the support of that joint removed
+
+        bool checkA = (graph.jointsCount() - 1) < 3;
+        bool checkB = (graph.barsCount() - 1) < 2;
+        bool checkC = (checker->mSupportsList.size() - 1) < 2;
+
+        bool checkD = false;
+
+        if (!checkA && !checkB && !checkC)
+        {
+            checkD = checker->hasInsufficientBars(graph, removal);
+        }
+
+        bool checkE = false;
+
+        if (!checkA && !checkB && !checkC && !checkD)
+        {
+            checkE = checker->hasInsufficientSupports(graph, removal);
+        }
+
+        check.isRedundant = !checkA && !checkB && !checkC && !checkD && !checkE;
+    }
+    else if (removal.bar >= 0)
+    {
+        //Bar removed, the model stays stable while the bar leverage is below one
+
+        Joint *firstJoint  = checker->mJointsList.at(graph.barFirstJoint(removal.bar));
+        Joint *secondJoint = checker->mJointsList.at(graph.barSecondJoint(removal.bar));
+
+        qreal deltaX = secondJoint->xCoordinate() - firstJoint->xCoordinate();
+        qreal deltaY = secondJoint->yCoordinate() - firstJoint->yCoordinate();
+        qreal length = std::sqrt(std::pow(deltaX, 2.0) + std::pow(deltaY, 2.0));
+        qreal C      = deltaX / length;
+        qreal S      = deltaY / length;
+
+        int firstIndex  = graph.barFirstJoint(removal.bar);
+        int secondIndex = graph.barSecondJoint(removal.bar);
+
+        int indexList[4]    = {2 * firstIndex, 2 * firstIndex + 1, 2 * secondIndex, 2 * secondIndex + 1};
+        qreal directions[4] = {C, S, -C, -S};
+
+        QVector<int> indices;
+        QVector<qreal> values;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            int reducedIndex = check.reducedIndices->at(indexList[i]);
+
+            if (reducedIndex >= 0)
+            {
+                indices.append(reducedIndex);
+                values.append(directions[i]);
+            }
+        }
+
+        qreal leverage = check.factorization->inverseQuadraticForm(indices, values) / length;
+
+        check.isRedundant = 1.0 - leverage > kRedundancyTolerance;
+    }
+    else
+    {
+        //Support removed, the stiffness matrix does not change and is already known to be stable
+
+        bool checkA = (checker->mSupportsList.size() - 1) < 2;
+
+        bool checkB = false;
+
+        if (!checkA)
+        {
+            checkB = checker->hasInsufficientSupports(graph, removal);
+        }
+
+        check.isRedundant = !checkA && !checkB;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------
+}
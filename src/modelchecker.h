@@ -21,16 +21,23 @@
 
 #include <cmath>
 
+#include <QFuture>
+#include <QHash>
 #include <QPointF>
+#include <QStringList>
 #include <QThread>
+#include <QVector>
+#include <QtConcurrent>
 #include <QtMath>
 
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
 
 #include "bar.h"
 #include "joint.h"
+#include "modelgraph.h"
+#include "modelindex.h"
+#include "pebblegame.h"
+#include "sparseldlfactorization.h"
 #include "support.h"
 #include "unitsandlimits.h"
 
@@ -49,6 +56,18 @@ class ModelChecker : public QThread
 
         Support *jointSupport(Joint *joint);
 
+        //Degrees of freedom, joints or bars listed in an instability note
+        static const int kMaxReportedDegreesOfFreedom = 10;
+
+        //A bar is redundant when its leverage falls short of one by more than this
+        static const qreal kRedundancyTolerance = 1.0e-9;
+
+        //Zero-energy modes found for an unstable model
+        static const int kMaxMechanismModes = 10;
+
+        //Milliseconds between progress updates while the redundancy checks run
+        static const int kProgressInterval = 50;
+
     protected:
         void run();
 
@@ -57,35 +76,82 @@ class ModelChecker : public QThread
         void redundantBarsListSignal(QList<Bar* > barsList);
         void redundantSupportsListSignal(QList<Support* > supportsList);
         void modelStabilitySignal(bool stability);
+        void mechanismModesSignal(QList<QVector<qreal> > modesList);
         void progressSignal(int progress);
 
     private:
+        //Bar, joint and support left out of the model for one redundancy candidate, -1 where none
+        struct Removal
+        {
+            Removal(int removedBar = -1, int removedJoint = -1, int removedSupport = -1)
+            {
+                bar     = removedBar;
+                joint   = removedJoint;
+                support = removedSupport;
+            }
+
+            int bar;
+            int joint;
+            int support;
+        };
+
+        struct RedundancyCheck
+        {
+            const ModelChecker           *checker;
+            const ModelGraph             *graph;
+            const SparseLdlFactorization *factorization;
+            const QVector<int>           *reducedIndices;
+            Removal                      removal;
+            bool                         isRedundant;
+        };
+
+        static void checkRedundancy(RedundancyCheck &check);
+
         QList<Joint *>   mJointsList;
         QList<Bar *>     mBarsList;
         QList<Support *> mSupportsList;
+        QList<Bar *>     mOriginalBarsList;
+        QList<Support *> mOriginalSupportsList;
         UnitsAndLimits   mUnitsAndLimits;
         int              mDegreeOfIndeterminacy;
+        QList<int>       mZeroEnergyDegreesOfFreedom;
+        QList<int>       mMechanismJoints;
+        QList<int>       mOverBracedBars;
+        int              mMechanismDegreesOfFreedom;
 
         //Check if structure has disconnected parts
-        bool hasDisconnectedParts();
+        bool hasDisconnectedParts(const ModelGraph &graph);
 
         //Check if structure has dangling bar
-        bool hasDanglingBar();
+        bool hasDanglingBar(const ModelGraph &graph);
 
         //Check if structure has all joints fixed
-        bool hasFixedJoints();
+        bool hasFixedJoints(const ModelGraph &graph);
 
         //Check for instability due to insufficient supports
-        bool hasInsufficientSupports();
+        bool hasInsufficientSupports(const ModelGraph &graph, const Removal &removal) const;
 
         //Check for instability due to insufficient bars
-        bool hasInsufficientBars();
+        bool hasInsufficientBars(const ModelGraph &graph,
+                                 const Removal    &removal,
+                                 int              *degreeOfIndeterminacy = 0) const;
+
+        int attachedBarsCount(const ModelGraph &graph, int joint, const Removal &removal) const;
+
+        int firstAttachedBar(const ModelGraph &graph, int joint, const Removal &removal) const;
 
         //Check for bars with fixed ends
         bool hasFixedBars();
 
+        //Check for a generic mechanism by the (2, 3) pebble game before any numeric work
+        bool hasGenericMechanism(const ModelGraph &graph);
+
+        //Null space vectors of the reduced stiffness matrix as joint movements
+        QList<QVector<qreal> > mechanismModes(const SparseLdlFactorization &factorization,
+                                              const QList<int>             &degreesOfFreedom) const;
+
         //Check for instability due to bars configuration
-        bool hasUnstableConfiguration(gsl_matrix *matrix = 0);
+        bool hasUnstableConfiguration(const SparseLdlFactorization &factorization);
 };
 
 #endif // MODELCHECKER_H
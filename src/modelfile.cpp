@@ -0,0 +1,1126 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelfile.cpp */
+
+#include "modelfile.h"
+
+ModelFile::ModelFile()
+{
+    mData           = 0;
+    mSize           = 0;
+    mError          = NO_FILE_ERROR;
+    mIsLegacyFormat = false;
+    mIsCompressed   = false;
+
+    for (int i = 0; i < PROPERTIES_COUNT; ++i)
+    {
+        mProperties.append(QString());
+    }
+}
+
+ModelFile::~ModelFile()
+{
+
+}
+
+bool ModelFile::open(const QString &fileName)
+{
+    mFile.setFileName(fileName);
+
+    if (!mFile.open(QFile::ReadOnly))
+    {
+        mError = OPEN_ERROR;
+        return false;
+    }
+
+    mSize = mFile.size();
+
+    uchar magic[4];
+
+    if (mFile.read(reinterpret_cast<char *>(magic), 4) != 4)
+    {
+        mError = FORMAT_ERROR;
+        return false;
+    }
+
+    if (qFromBigEndian<quint32>(magic) == kLegacyMagic)
+    {
+        mIsLegacyFormat = true;
+
+        bool isRead = readLegacyFormat();
+        mFile.close();
+
+        if (!isRead)
+        {
+            mError = FORMAT_ERROR;
+            return false;
+        }
+
+        return true;
+    }
+
+    if (qFromLittleEndian<quint32>(magic) != kMagic)
+    {
+        mError = FORMAT_ERROR;
+        return false;
+    }
+
+    //Sections are read from the mapping as they are asked for, and pages not asked for are never read
+
+    mData = mFile.map(0, mSize);
+
+    if (mData == 0)
+    {
+        mFile.seek(0);
+        mContents = mFile.readAll();
+        mData     = reinterpret_cast<const uchar *>(mContents.constData());
+        mSize     = mContents.size();
+    }
+
+    if (!readSectionTable())
+    {
+        mError = FORMAT_ERROR;
+        return false;
+    }
+
+    return true;
+}
+
+bool ModelFile::openContents(const QByteArray &contents)
+{
+    mContents = contents;
+    mData     = reinterpret_cast<const uchar *>(mContents.constData());
+    mSize     = mContents.size();
+
+    if ((mSize < 4) || (qFromLittleEndian<quint32>(mData) != kMagic) || !readSectionTable())
+    {
+        mError = FORMAT_ERROR;
+        return false;
+    }
+
+    return true;
+}
+
+ModelFile::Error ModelFile::error() const
+{
+    return mError;
+}
+
+bool ModelFile::isLegacyFormat() const
+{
+    return mIsLegacyFormat;
+}
+
+bool ModelFile::hasSection(Section section) const
+{
+    return mSectionEntries.contains(section);
+}
+
+QList<int> ModelFile::sections() const
+{
+    QList<int> sections = mSectionEntries.keys();
+    sections.removeAll(PROPERTIES);
+    std::sort(sections.begin(), sections.end());
+
+    return sections;
+}
+
+QByteArray ModelFile::sectionBytes(Section section) const
+{
+    QHash<int, QByteArray>::const_iterator buffer = mSectionBuffers.constFind(section);
+
+    if (buffer != mSectionBuffers.constEnd())
+    {
+        return buffer.value();
+    }
+
+    if (!mSectionEntries.contains(section))
+    {
+        return QByteArray();
+    }
+
+    quint64 count;
+    quint64 length;
+    const uchar *data = sectionData(section, ElementType(mSectionEntries.value(section).type), &count, &length);
+
+    if (data == 0)
+    {
+        return QByteArray();
+    }
+
+    return QByteArray(reinterpret_cast<const char *>(data), int(length));
+}
+
+int ModelFile::count(Section section) const
+{
+    if (!mSectionEntries.contains(section))
+    {
+        return 0;
+    }
+
+    return int(mSectionEntries.value(section).count);
+}
+
+QString ModelFile::property(Property property) const
+{
+    return mProperties.value(property);
+}
+
+QVector<qreal> ModelFile::reals(Section section) const
+{
+    QVector<qreal> reals;
+
+    quint64 count;
+    quint64 length;
+    const uchar *data = sectionData(section, REAL, &count, &length);
+
+    if (data == 0)
+    {
+        return reals;
+    }
+
+    reals.resize(int(count));
+
+    for (int i = 0; i < reals.size(); ++i)
+    {
+        quint64 bits = qFromLittleEndian<quint64>(data + 8 * i);
+        double value;
+        std::memcpy(&value, &bits, 8);
+        reals[i] = value;
+    }
+
+    return reals;
+}
+
+QVector<qint32> ModelFile::integers(Section section) const
+{
+    QVector<qint32> integers;
+
+    quint64 count;
+    quint64 length;
+    const uchar *data = sectionData(section, INTEGER, &count, &length);
+
+    if (data == 0)
+    {
+        return integers;
+    }
+
+    integers.resize(int(count));
+
+    for (int i = 0; i < integers.size(); ++i)
+    {
+        integers[i] = qFromLittleEndian<qint32>(data + 4 * i);
+    }
+
+    return integers;
+}
+
+QStringList ModelFile::texts(Section section) const
+{
+    quint64 count;
+    quint64 length;
+    const uchar *data = sectionData(section, TEXT, &count, &length);
+
+    if (data == 0)
+    {
+        return QStringList();
+    }
+
+    return decodeTexts(data, count, length);
+}
+
+bool ModelFile::isConsistent() const
+{
+    int jointsCount      = count(JOINT_X_COORDINATES);
+    int barsCount        = count(BAR_FIRST_JOINTS);
+    int supportsCount    = count(SUPPORT_JOINTS);
+    int jointLoadsCount  = count(JOINT_LOAD_JOINTS);
+    int settlementsCount = count(SETTLEMENT_SUPPORTS);
+    int thermalCount     = count(THERMAL_EFFECT_BARS);
+    int fabricationCount = count(FABRICATION_ERROR_BARS);
+    int influenceCount   = count(INFLUENCE_LOAD_NAMES);
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Sizes
+    // -----------------------------------------------------------------------------------------------------------------
+
+    bool checkA = (count(JOINT_Y_COORDINATES) == jointsCount);
+    bool checkB = (count(BAR_SECOND_JOINTS) == barsCount) && (count(BAR_AREAS) == barsCount);
+    bool checkC = (count(BAR_MODULI) == barsCount) && (count(BAR_FACTORS) == barsCount);
+    bool checkD = (count(BAR_UNIT_WEIGHTS) == barsCount);
+    bool checkE = (count(SUPPORT_TYPES) == supportsCount) && (count(SUPPORT_ANGLES) == supportsCount);
+    bool checkF = (count(JOINT_LOAD_HORIZONTAL_COMPONENTS) == jointLoadsCount);
+    bool checkG = (count(JOINT_LOAD_VERTICAL_COMPONENTS) == jointLoadsCount);
+    bool checkH = (count(JOINT_LOAD_POSITIONS) == jointLoadsCount);
+    bool checkI = (count(SETTLEMENTS) == settlementsCount);
+    bool checkJ = (count(TEMPERATURE_CHANGES) == thermalCount) && (count(THERMAL_COEFFICIENTS) == thermalCount);
+    bool checkK = (count(LENGTH_ERRORS) == fabricationCount);
+    bool checkL = (count(INFLUENCE_LOAD_DIRECTIONS) == influenceCount);
+    bool checkM = (count(INFLUENCE_LOAD_PATH_SIZES) == influenceCount);
+    bool checkN = (count(INFLUENCE_LOAD_POINT_LOAD_COUNTS) == influenceCount);
+
+    if (!(checkA && checkB && checkC && checkD && checkE && checkF && checkG && checkH && checkI && checkJ && checkK
+          && checkL && checkM && checkN))
+    {
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Numbers, one-based
+    // -----------------------------------------------------------------------------------------------------------------
+
+    QVector<qint32> firstJoints  = integers(BAR_FIRST_JOINTS);
+    QVector<qint32> secondJoints = integers(BAR_SECOND_JOINTS);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        bool checkO = (firstJoints.at(i) >= 1) && (firstJoints.at(i) <= jointsCount);
+        bool checkP = (secondJoints.at(i) >= 1) && (secondJoints.at(i) <= jointsCount);
+
+        if (!checkO || !checkP || (firstJoints.at(i) == secondJoints.at(i)))
+        {
+            return false;
+        }
+    }
+
+    QVector<qint32> supportTypes = integers(SUPPORT_TYPES);
+
+    for (int i = 0; i < supportsCount; ++i)
+    {
+        if ((supportTypes.at(i) < 0) || (supportTypes.at(i) > 8))
+        {
+            return false;
+        }
+    }
+
+    QList<QPair<Section, int> > numbers;
+    numbers.append(qMakePair(SUPPORT_JOINTS, jointsCount));
+    numbers.append(qMakePair(JOINT_LOAD_JOINTS, jointsCount));
+    numbers.append(qMakePair(SETTLEMENT_SUPPORTS, supportsCount));
+    numbers.append(qMakePair(THERMAL_EFFECT_BARS, barsCount));
+    numbers.append(qMakePair(FABRICATION_ERROR_BARS, barsCount));
+    numbers.append(qMakePair(INFLUENCE_LOAD_PATHS, jointsCount));
+
+    for (int i = 0; i < numbers.size(); ++i)
+    {
+        foreach (qint32 number, integers(numbers.at(i).first))
+        {
+            if ((number < 1) || (number > numbers.at(i).second))
+            {
+                return false;
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Influence load paths and point loads, one after the other
+    // -----------------------------------------------------------------------------------------------------------------
+
+    qint64 pathsSize      = 0;
+    qint64 pointLoadsSize = 0;
+
+    foreach (qint32 size, integers(INFLUENCE_LOAD_PATH_SIZES))
+    {
+        if (size < 0)
+        {
+            return false;
+        }
+
+        pathsSize += size;
+    }
+
+    foreach (qint32 size, integers(INFLUENCE_LOAD_POINT_LOAD_COUNTS))
+    {
+        if (size < 0)
+        {
+            return false;
+        }
+
+        pointLoadsSize += size;
+    }
+
+    bool checkQ = (pathsSize == count(INFLUENCE_LOAD_PATHS));
+    bool checkR = (pointLoadsSize == count(INFLUENCE_LOAD_POINT_LOADS));
+    bool checkS = (pointLoadsSize == count(INFLUENCE_LOAD_POINT_LOAD_POSITIONS));
+
+    return (checkQ && checkR && checkS);
+}
+
+void ModelFile::setProperty(Property property, const QString &text)
+{
+    mProperties[property] = text;
+}
+
+void ModelFile::setReals(Section section, const QVector<qreal> &reals)
+{
+    QByteArray buffer(8 * reals.size(), Qt::Uninitialized);
+    uchar *data = reinterpret_cast<uchar *>(buffer.data());
+
+    for (int i = 0; i < reals.size(); ++i)
+    {
+        double value = reals.at(i);
+        quint64 bits;
+        std::memcpy(&bits, &value, 8);
+        qToLittleEndian<quint64>(bits, data + 8 * i);
+    }
+
+    SectionEntry entry;
+    entry.type     = REAL;
+    entry.encoding = RAW_ENCODING;
+    entry.count    = quint64(reals.size());
+    entry.offset   = 0;
+    entry.length   = quint64(buffer.size());
+
+    mSectionEntries.insert(section, entry);
+    mSectionBuffers.insert(section, buffer);
+}
+
+void ModelFile::setIntegers(Section section, const QVector<qint32> &integers)
+{
+    QByteArray buffer(4 * integers.size(), Qt::Uninitialized);
+    uchar *data = reinterpret_cast<uchar *>(buffer.data());
+
+    for (int i = 0; i < integers.size(); ++i)
+    {
+        qToLittleEndian<qint32>(integers.at(i), data + 4 * i);
+    }
+
+    SectionEntry entry;
+    entry.type     = INTEGER;
+    entry.encoding = RAW_ENCODING;
+    entry.count    = quint64(integers.size());
+    entry.offset   = 0;
+    entry.length   = quint64(buffer.size());
+
+    mSectionEntries.insert(section, entry);
+    mSectionBuffers.insert(section, buffer);
+}
+
+void ModelFile::setTexts(Section section, const QStringList &texts)
+{
+    QByteArray buffer = encodeTexts(texts);
+
+    SectionEntry entry;
+    entry.type     = TEXT;
+    entry.encoding = RAW_ENCODING;
+    entry.count    = quint64(texts.size());
+    entry.offset   = 0;
+    entry.length   = quint64(buffer.size());
+
+    mSectionEntries.insert(section, entry);
+    mSectionBuffers.insert(section, buffer);
+}
+
+void ModelFile::copySection(const ModelFile &modelFile, Section section)
+{
+    if (!modelFile.mSectionEntries.contains(section) || (section == PROPERTIES))
+    {
+        return;
+    }
+
+    QByteArray buffer = modelFile.sectionBytes(section);
+
+    SectionEntry entry = modelFile.mSectionEntries.value(section);
+    entry.encoding     = RAW_ENCODING;
+    entry.offset       = 0;
+    entry.length       = quint64(buffer.size());
+
+    mSectionEntries.insert(section, entry);
+    mSectionBuffers.insert(section, buffer);
+}
+
+void ModelFile::setCompressed(bool compressed)
+{
+    mIsCompressed = compressed;
+}
+
+bool ModelFile::write(QIODevice *device) const
+{
+    QByteArray properties = encodeTexts(mProperties);
+
+    QList<int> sections = mSectionEntries.keys();
+    sections.removeAll(PROPERTIES);
+    std::sort(sections.begin(), sections.end());
+    sections.prepend(PROPERTIES);
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Header and section table, with the sections laid out after them at aligned offsets
+    // -----------------------------------------------------------------------------------------------------------------
+
+    int sectionsCount   = sections.size();
+    quint64 tableOffset = kHeaderSize;
+    quint64 offset      = tableOffset + quint64(sectionsCount) * kSectionEntrySize;
+
+    QByteArray header(int(offset), '\0');
+    uchar *headerData = reinterpret_cast<uchar *>(header.data());
+
+    QVector<const uchar *> sectionsData(sectionsCount);
+    QVector<quint64> sectionsLength(sectionsCount);
+    QVector<QByteArray> encodedSections(sectionsCount);
+    bool hasCompressedSections = false;
+
+    for (int i = 0; i < sectionsCount; ++i)
+    {
+        int section = sections.at(i);
+        quint32 type;
+        quint64 count;
+
+        if (section == PROPERTIES)
+        {
+            type              = TEXT;
+            count             = quint64(mProperties.size());
+            sectionsData[i]   = reinterpret_cast<const uchar *>(properties.constData());
+            sectionsLength[i] = quint64(properties.size());
+        }
+        else
+        {
+            type            = mSectionEntries.value(section).type;
+            sectionsData[i] = sectionData(Section(section), ElementType(type), &count, &sectionsLength[i]);
+        }
+
+        //Sections that do not shrink are written as they are
+
+        quint32 encoding = RAW_ENCODING;
+
+        if (mIsCompressed && (section != PROPERTIES) && (sectionsLength.at(i) >= quint64(kMinCompressedLength)))
+        {
+            QByteArray encoded = encodeSection(sectionsData.at(i), int(sectionsLength.at(i)), ElementType(type));
+
+            if (!encoded.isEmpty() && (quint64(encoded.size()) < sectionsLength.at(i)))
+            {
+                encodedSections[i]    = encoded;
+                sectionsData[i]       = reinterpret_cast<const uchar *>(encodedSections.at(i).constData());
+                sectionsLength[i]     = quint64(encoded.size());
+                encoding              = COMPRESSED_ENCODING;
+                hasCompressedSections = true;
+            }
+        }
+
+        offset = (offset + kAlignment - 1) / kAlignment * kAlignment;
+
+        uchar *entryData = headerData + tableOffset + i * kSectionEntrySize;
+        qToLittleEndian<quint32>(quint32(section), entryData);
+        qToLittleEndian<quint32>(type | (encoding << 16), entryData + 4);
+        qToLittleEndian<quint64>(count, entryData + 8);
+        qToLittleEndian<quint64>(offset, entryData + 16);
+        qToLittleEndian<quint64>(sectionsLength.at(i), entryData + 24);
+
+        offset += sectionsLength.at(i);
+    }
+
+    quint16 majorVersion = hasCompressedSections ? kMajorVersion : kFirstMajorVersion;
+
+    qToLittleEndian<quint32>(kMagic, headerData);
+    qToLittleEndian<quint16>(majorVersion, headerData + 4);
+    qToLittleEndian<quint16>(kMinorVersion, headerData + 6);
+    qToLittleEndian<quint32>(quint32(sectionsCount), headerData + 8);
+    qToLittleEndian<quint32>(0, headerData + 12);
+    qToLittleEndian<quint64>(tableOffset, headerData + 16);
+
+    if (device->write(header) != header.size())
+    {
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Sections
+    // -----------------------------------------------------------------------------------------------------------------
+
+    qint64 position = header.size();
+    const char padding[kAlignment] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+    for (int i = 0; i < sectionsCount; ++i)
+    {
+        qint64 paddingLength = (kAlignment - position % kAlignment) % kAlignment;
+
+        if (device->write(padding, paddingLength) != paddingLength)
+        {
+            return false;
+        }
+
+        qint64 length = qint64(sectionsLength.at(i));
+
+        if (device->write(reinterpret_cast<const char *>(sectionsData.at(i)), length) != length)
+        {
+            return false;
+        }
+
+        position += paddingLength + length;
+    }
+
+    return true;
+}
+
+bool ModelFile::readSectionTable()
+{
+    if (mSize < kHeaderSize)
+    {
+        return false;
+    }
+
+    //A newer major version changes what is in the sections, which this reader cannot follow
+
+    quint16 majorVersion = qFromLittleEndian<quint16>(mData + 4);
+
+    if ((majorVersion < kFirstMajorVersion) || (majorVersion > kMajorVersion))
+    {
+        return false;
+    }
+
+    quint64 size          = quint64(mSize);
+    quint32 sectionsCount = qFromLittleEndian<quint32>(mData + 8);
+    quint64 tableOffset   = qFromLittleEndian<quint64>(mData + 16);
+
+    if ((tableOffset > size) || (quint64(sectionsCount) > (size - tableOffset) / kSectionEntrySize))
+    {
+        return false;
+    }
+
+    for (quint32 i = 0; i < sectionsCount; ++i)
+    {
+        const uchar *entryData = mData + tableOffset + i * kSectionEntrySize;
+
+        int section = int(qFromLittleEndian<quint32>(entryData));
+
+        quint32 type = qFromLittleEndian<quint32>(entryData + 4);
+
+        SectionEntry entry;
+        entry.type     = type & 0xFFFF;
+        entry.encoding = type >> 16;
+        entry.count    = qFromLittleEndian<quint64>(entryData + 8);
+        entry.offset   = qFromLittleEndian<quint64>(entryData + 16);
+        entry.length   = qFromLittleEndian<quint64>(entryData + 24);
+
+        //Sections are handed out as byte arrays and decoded with int lengths, so longer ones are rejected here
+        //rather than narrowed
+
+        bool checkOffset = (entry.offset > size) || (entry.length > size - entry.offset);
+        bool checkLength = (entry.count > quint64(INT_MAX)) || (entry.length > quint64(INT_MAX));
+
+        if (checkOffset || checkLength)
+        {
+            return false;
+        }
+
+        if ((entry.encoding != RAW_ENCODING) && (entry.encoding != COMPRESSED_ENCODING))
+        {
+            return false;
+        }
+
+        //The counts of compressed sections are checked against their decoded length when they are decoded
+
+        bool checkA = (entry.type == REAL) && (entry.count > entry.length / 8);
+        bool checkB = (entry.type == INTEGER) && (entry.count > entry.length / 4);
+        bool checkC = (entry.type == TEXT) && (entry.count > entry.length / 4);
+
+        if ((entry.encoding == RAW_ENCODING) && (checkA || checkB || checkC))
+        {
+            return false;
+        }
+
+        mSectionEntries.insert(section, entry);
+    }
+
+    QStringList properties = texts(PROPERTIES);
+
+    for (int i = 0; i < qMin(properties.size(), int(PROPERTIES_COUNT)); ++i)
+    {
+        mProperties[i] = properties.at(i);
+    }
+
+    return true;
+}
+
+bool ModelFile::readLegacyFormat()
+{
+    mFile.seek(0);
+
+    QDataStream in(&mFile);
+    in.setVersion(QDataStream::Qt_5_4);
+
+    quint32 magic;
+    in >> magic;
+
+    //Version, description and units
+
+    for (int i = VERSION; i <= LENGTH_ERROR_UNIT; ++i)
+    {
+        in >> mProperties[i];
+    }
+
+    //Joint coordinates
+
+    QList<qreal> xCoordinateList;
+    QList<qreal> yCoordinateList;
+
+    in >> xCoordinateList;
+    in >> yCoordinateList;
+
+    setReals(JOINT_X_COORDINATES, xCoordinateList.toVector());
+    setReals(JOINT_Y_COORDINATES, yCoordinateList.toVector());
+
+    //Bars
+
+    QList<qint32> firstJointList;
+    QList<qint32> secondJointList;
+    QList<qreal> areaList;
+    QList<qreal> modulusList;
+    QList<qreal> factorList;
+    QList<qreal> unitWeightList;
+
+    in >> mProperties[AXIAL_RIGIDITY_OPTION];
+    in >> firstJointList;
+    in >> secondJointList;
+    in >> areaList;
+    in >> modulusList;
+    in >> factorList;
+    in >> unitWeightList;
+
+    setIntegers(BAR_FIRST_JOINTS, firstJointList.toVector());
+    setIntegers(BAR_SECOND_JOINTS, secondJointList.toVector());
+    setReals(BAR_AREAS, areaList.toVector());
+    setReals(BAR_MODULI, modulusList.toVector());
+    setReals(BAR_FACTORS, factorList.toVector());
+    setReals(BAR_UNIT_WEIGHTS, unitWeightList.toVector());
+
+    //Supports
+
+    QList<qint32> supportJointList;
+    QList<qint32> supportTypeList;
+    QList<qreal> supportAngleList;
+
+    in >> supportJointList;
+    in >> supportTypeList;
+    in >> supportAngleList;
+
+    setIntegers(SUPPORT_JOINTS, supportJointList.toVector());
+    setIntegers(SUPPORT_TYPES, supportTypeList.toVector());
+    setReals(SUPPORT_ANGLES, supportAngleList.toVector());
+
+    bool hasLoads = false;
+    in >> hasLoads;
+
+    if (hasLoads)
+    {
+        //Joint loads
+
+        QList<qint32> loadJointList;
+        QList<qreal> loadHorizontalComponentList;
+        QList<qreal> loadVerticalComponentList;
+        QList<QString> loadPositionList;
+
+        in >> loadJointList;
+        in >> loadHorizontalComponentList;
+        in >> loadVerticalComponentList;
+        in >> loadPositionList;
+
+        setIntegers(JOINT_LOAD_JOINTS, loadJointList.toVector());
+        setReals(JOINT_LOAD_HORIZONTAL_COMPONENTS, loadHorizontalComponentList.toVector());
+        setReals(JOINT_LOAD_VERTICAL_COMPONENTS, loadVerticalComponentList.toVector());
+        setTexts(JOINT_LOAD_POSITIONS, QStringList(loadPositionList));
+
+        //Support settlements
+
+        QList<qint32> settlementSupportList;
+        QList<qreal> settlementList;
+
+        in >> settlementSupportList;
+        in >> settlementList;
+
+        setIntegers(SETTLEMENT_SUPPORTS, settlementSupportList.toVector());
+        setReals(SETTLEMENTS, settlementList.toVector());
+
+        //Thermal effects
+
+        QList<qint32> thermalEffectBarList;
+        QList<qreal> temperatureChangeList;
+        QList<qreal> thermalCoefficientList;
+
+        in >> thermalEffectBarList;
+        in >> temperatureChangeList;
+        in >> thermalCoefficientList;
+
+        setIntegers(THERMAL_EFFECT_BARS, thermalEffectBarList.toVector());
+        setReals(TEMPERATURE_CHANGES, temperatureChangeList.toVector());
+        setReals(THERMAL_COEFFICIENTS, thermalCoefficientList.toVector());
+
+        //Assembly/Fabrication errors
+
+        QList<qint32> fabricationErrorBarList;
+        QList<qreal> lengthErrorList;
+
+        in >> fabricationErrorBarList;
+        in >> lengthErrorList;
+
+        setIntegers(FABRICATION_ERROR_BARS, fabricationErrorBarList.toVector());
+        setReals(LENGTH_ERRORS, lengthErrorList.toVector());
+
+        //Influence loads, one after the other, kept as the sections of the new format keep them
+
+        int influenceLoadCount = 0;
+        in >> influenceLoadCount;
+
+        QStringList names;
+        QStringList directions;
+        QVector<qint32> pathSizes;
+        QVector<qint32> paths;
+        QVector<qint32> pointLoadCounts;
+        QVector<qreal> pointLoads;
+        QVector<qreal> pointLoadPositions;
+
+        for (int i = 0; (i < influenceLoadCount) && (in.status() == QDataStream::Ok); ++i)
+        {
+            QString name;
+            QString direction;
+            QList<qint32> pathList;
+            QList<qreal> pointLoadList;
+            QList<qreal> pointLoadPositionList;
+
+            in >> name;
+            in >> direction;
+            in >> pathList;
+            in >> pointLoadList;
+            in >> pointLoadPositionList;
+
+            names.append(name);
+            directions.append(direction);
+            pathSizes.append(qint32(pathList.size()));
+            paths += pathList.toVector();
+            pointLoadCounts.append(qint32(pointLoadList.size()));
+            pointLoads += pointLoadList.toVector();
+            pointLoadPositions += pointLoadPositionList.toVector();
+        }
+
+        setTexts(INFLUENCE_LOAD_NAMES, names);
+        setTexts(INFLUENCE_LOAD_DIRECTIONS, directions);
+        setIntegers(INFLUENCE_LOAD_PATH_SIZES, pathSizes);
+        setIntegers(INFLUENCE_LOAD_PATHS, paths);
+        setIntegers(INFLUENCE_LOAD_POINT_LOAD_COUNTS, pointLoadCounts);
+        setReals(INFLUENCE_LOAD_POINT_LOADS, pointLoads);
+        setReals(INFLUENCE_LOAD_POINT_LOAD_POSITIONS, pointLoadPositions);
+    }
+
+    return (in.status() != QDataStream::ReadCorruptData);
+}
+
+const uchar *ModelFile::sectionData(Section section, ElementType type, quint64 *count, quint64 *length) const
+{
+    QHash<int, SectionEntry>::const_iterator entry = mSectionEntries.constFind(section);
+
+    if ((entry == mSectionEntries.constEnd()) || (entry.value().type != quint32(type)))
+    {
+        return 0;
+    }
+
+    *count  = entry.value().count;
+    *length = entry.value().length;
+
+    QHash<int, QByteArray>::const_iterator buffer = mSectionBuffers.constFind(section);
+
+    if (buffer != mSectionBuffers.constEnd())
+    {
+        return reinterpret_cast<const uchar *>(buffer.value().constData());
+    }
+
+    if (entry.value().encoding == COMPRESSED_ENCODING)
+    {
+        if (!mDecodedBuffers.contains(section) && !decodeSection(section, entry.value()))
+        {
+            return 0;
+        }
+
+        const QByteArray &decoded = mDecodedBuffers[section];
+        *length                   = quint64(decoded.size());
+        return reinterpret_cast<const uchar *>(decoded.constData());
+    }
+
+    return mData + entry.value().offset;
+}
+
+bool ModelFile::decodeSection(int section, const SectionEntry &entry) const
+{
+    const uchar *data = mData + entry.offset;
+
+    if (entry.length < quint64(kEncodedHeaderSize))
+    {
+        return false;
+    }
+
+    quint32 blockSize     = qFromLittleEndian<quint32>(data);
+    quint32 blocksCount   = qFromLittleEndian<quint32>(data + 4);
+    quint64 decodedLength = qFromLittleEndian<quint64>(data + 8);
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Layout checked before anything is decoded
+    // -----------------------------------------------------------------------------------------------------------------
+
+    if ((blockSize == 0) || (blockSize % kAlignment != 0) || (blockSize > quint32(INT_MAX)) ||
+        (decodedLength > quint64(INT_MAX)))
+    {
+        return false;
+    }
+
+    bool checkA = (entry.type == REAL) && (entry.count > decodedLength / 8);
+    bool checkB = (entry.type == INTEGER) && (entry.count > decodedLength / 4);
+    bool checkC = (entry.type == TEXT) && (entry.count > decodedLength / 4);
+    bool checkD = (quint64(blocksCount) != (decodedLength + blockSize - 1) / blockSize);
+    bool checkE = (quint64(blocksCount) > (entry.length - kEncodedHeaderSize) / 4);
+
+    if (checkA || checkB || checkC || checkD || checkE)
+    {
+        return false;
+    }
+
+    QByteArray decoded(int(decodedLength), Qt::Uninitialized);
+    uchar *decodedData = reinterpret_cast<uchar *>(decoded.data());
+
+    QVector<Block> blocks(int(blocksCount));
+    quint64 sourceOffset = kEncodedHeaderSize + 4 * quint64(blocksCount);
+
+    for (int i = 0; i < blocks.size(); ++i)
+    {
+        quint64 sourceLength = qFromLittleEndian<quint32>(data + kEncodedHeaderSize + 4 * i);
+
+        if (sourceLength > entry.length - sourceOffset)
+        {
+            return false;
+        }
+
+        quint64 targetOffset = quint64(i) * blockSize;
+
+        Block &block       = blocks[i];
+        block.source       = data + sourceOffset;
+        block.sourceLength = int(sourceLength);
+        block.target       = decodedData + targetOffset;
+        block.targetLength = int(qMin(quint64(blockSize), decodedLength - targetOffset));
+        block.type         = ElementType(entry.type);
+        block.isDone       = false;
+
+        sourceOffset += sourceLength;
+    }
+
+    QtConcurrent::blockingMap(blocks, decodeBlock);
+
+    for (int i = 0; i < blocks.size(); ++i)
+    {
+        if (!blocks.at(i).isDone)
+        {
+            return false;
+        }
+    }
+
+    mDecodedBuffers.insert(section, decoded);
+    return true;
+}
+
+QByteArray ModelFile::encodeSection(const uchar *data, int length, ElementType type)
+{
+    int blocksCount = (length + kCompressionBlockSize - 1) / kCompressionBlockSize;
+
+    QVector<Block> blocks(blocksCount);
+
+    for (int i = 0; i < blocksCount; ++i)
+    {
+        int offset = i * kCompressionBlockSize;
+
+        Block &block       = blocks[i];
+        block.source       = data + offset;
+        block.sourceLength = qMin(int(kCompressionBlockSize), length - offset);
+        block.target       = 0;
+        block.targetLength = 0;
+        block.type         = type;
+        block.isDone       = false;
+    }
+
+    QtConcurrent::blockingMap(blocks, encodeBlock);
+
+    QByteArray encoded(kEncodedHeaderSize + 4 * blocksCount, '\0');
+    uchar *encodedData = reinterpret_cast<uchar *>(encoded.data());
+
+    qToLittleEndian<quint32>(quint32(kCompressionBlockSize), encodedData);
+    qToLittleEndian<quint32>(quint32(blocksCount), encodedData + 4);
+    qToLittleEndian<quint64>(quint64(length), encodedData + 8);
+
+    for (int i = 0; i < blocksCount; ++i)
+    {
+        if (!blocks.at(i).isDone)
+        {
+            return QByteArray();
+        }
+
+        qToLittleEndian<quint32>(quint32(blocks.at(i).encoded.size()), encodedData + kEncodedHeaderSize + 4 * i);
+    }
+
+    for (int i = 0; i < blocksCount; ++i)
+    {
+        encoded.append(blocks.at(i).encoded);
+    }
+
+    return encoded;
+}
+
+void ModelFile::encodeBlock(Block &block)
+{
+    QByteArray filtered(block.sourceLength, Qt::Uninitialized);
+    filterBlock(block.source, block.sourceLength, block.type, reinterpret_cast<uchar *>(filtered.data()));
+
+    block.encoded = qCompress(filtered, kCompressionLevel);
+    block.isDone  = !block.encoded.isEmpty();
+}
+
+void ModelFile::decodeBlock(Block &block)
+{
+    QByteArray filtered = qUncompress(block.source, block.sourceLength);
+
+    if (filtered.size() != block.targetLength)
+    {
+        return;
+    }
+
+    unfilterBlock(reinterpret_cast<const uchar *>(filtered.constData()), block.targetLength, block.type, block.target);
+    block.isDone = true;
+}
+
+void ModelFile::filterBlock(const uchar *data, int length, ElementType type, uchar *filtered)
+{
+    if (type == REAL)
+    {
+        int count        = length / 8;
+        quint64 previous = 0;
+
+        for (int i = 0; i < count; ++i)
+        {
+            quint64 bits = qFromLittleEndian<quint64>(data + 8 * i);
+            quint64 delta = bits ^ previous;
+            previous      = bits;
+
+            for (int j = 0; j < 8; ++j)
+            {
+                filtered[j * count + i] = uchar(delta >> (8 * j));
+            }
+        }
+    }
+    else if (type == INTEGER)
+    {
+        int count        = length / 4;
+        quint32 previous = 0;
+
+        for (int i = 0; i < count; ++i)
+        {
+            quint32 value      = qFromLittleEndian<quint32>(data + 4 * i);
+            quint32 difference = value - previous;
+            previous           = value;
+
+            for (int j = 0; j < 4; ++j)
+            {
+                filtered[j * count + i] = uchar(difference >> (8 * j));
+            }
+        }
+    }
+    else
+    {
+        std::memcpy(filtered, data, length);
+    }
+}
+
+void ModelFile::unfilterBlock(const uchar *filtered, int length, ElementType type, uchar *data)
+{
+    if (type == REAL)
+    {
+        int count        = length / 8;
+        quint64 previous = 0;
+
+        for (int i = 0; i < count; ++i)
+        {
+            quint64 delta = 0;
+
+            for (int j = 0; j < 8; ++j)
+            {
+                delta |= quint64(filtered[j * count + i]) << (8 * j);
+            }
+
+            previous = delta ^ previous;
+            qToLittleEndian<quint64>(previous, data + 8 * i);
+        }
+    }
+    else if (type == INTEGER)
+    {
+        int count        = length / 4;
+        quint32 previous = 0;
+
+        for (int i = 0; i < count; ++i)
+        {
+            quint32 difference = 0;
+
+            for (int j = 0; j < 4; ++j)
+            {
+                difference |= quint32(filtered[j * count + i]) << (8 * j);
+            }
+
+            previous = previous + difference;
+            qToLittleEndian<quint32>(previous, data + 4 * i);
+        }
+    }
+    else
+    {
+        std::memcpy(data, filtered, length);
+    }
+}
+
+QByteArray ModelFile::encodeTexts(const QStringList &texts)
+{
+    QByteArray buffer;
+
+    foreach (const QString &text, texts)
+    {
+        QByteArray utf8 = text.toUtf8();
+        uchar size[4];
+        qToLittleEndian<quint32>(quint32(utf8.size()), size);
+
+        buffer.append(reinterpret_cast<const char *>(size), 4);
+        buffer.append(utf8);
+    }
+
+    return buffer;
+}
+
+QStringList ModelFile::decodeTexts(const uchar *data, quint64 count, quint64 length)
+{
+    QStringList texts;
+    quint64 position = 0;
+
+    for (quint64 i = 0; i < count; ++i)
+    {
+        if (length - position < 4)
+        {
+            break;
+        }
+
+        quint64 size = qFromLittleEndian<quint32>(data + position);
+        position += 4;
+
+        if (size > length - position)
+        {
+            break;
+        }
+
+        texts.append(QString::fromUtf8(reinterpret_cast<const char *>(data + position), int(size)));
+        position += size;
+    }
+
+    return texts;
+}
@@ -0,0 +1,290 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelfile.h */
+
+#ifndef MODELFILE_H
+#define MODELFILE_H
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QIODevice>
+#include <QList>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+#include <QtEndian>
+
+//Contents of a model file as arrays, one section each. Model files start with a header and a table of the sections
+//in the file, with the type, count, offset and length of each, followed by the sections as little-endian arrays of
+//doubles, 32-bit integers or length-prefixed UTF-8 texts, each aligned to 8 bytes:
+//
+//  quint32 magic, quint16 major version, quint16 minor version, quint32 sections count, quint32 reserved,
+//  quint64 section table offset
+//  per section : quint32 section, quint32 type, quint64 count, quint64 offset, quint64 length
+//
+//Opening a file reads the header and the table only, with the file mapped into memory where it can be, and each
+//section is decoded when it is asked for. Sections a reader does not know are skipped, and a newer minor version
+//adds sections only. Files of the earlier single stream format are read whole into the same sections.
+//
+//A saved solution is kept in sections from SOLUTION_FINGERPRINT on, with a fingerprint of the inputs it was solved
+//from so that a reader can tell whether it still belongs to the model in the file. JOURNAL_MODEL_FILE_NAME is only
+//found in autosave journals.
+//
+//A section may be written compressed, with the encoding in the high half of its type. A compressed section is split
+//into blocks that are filtered and compressed with qCompress one by one:
+//
+//  quint32 block size, quint32 blocks count, quint64 decoded length, per block: quint32 compressed length,
+//  then the compressed blocks
+//
+//The filter stores each double as its bits XOR those of the one before and each integer as its difference from the
+//one before, then groups the bytes of a block by their place in an element, so that the exponent bytes of similar
+//coordinates, or the high bytes of close joint numbers, run together. Blocks are compressed and decoded in parallel,
+//and a compressed section is decoded when it is first asked for.
+class ModelFile
+{
+    public:
+        //Section numbers are kept in the file and must not change
+        enum Section
+        {
+            PROPERTIES                          = 1,
+            JOINT_X_COORDINATES                 = 10,
+            JOINT_Y_COORDINATES                 = 11,
+            BAR_FIRST_JOINTS                    = 20,
+            BAR_SECOND_JOINTS                   = 21,
+            BAR_AREAS                           = 22,
+            BAR_MODULI                          = 23,
+            BAR_FACTORS                         = 24,
+            BAR_UNIT_WEIGHTS                    = 25,
+            SUPPORT_JOINTS                      = 30,
+            SUPPORT_TYPES                       = 31,
+            SUPPORT_ANGLES                      = 32,
+            JOINT_LOAD_JOINTS                   = 40,
+            JOINT_LOAD_HORIZONTAL_COMPONENTS    = 41,
+            JOINT_LOAD_VERTICAL_COMPONENTS      = 42,
+            JOINT_LOAD_POSITIONS                = 43,
+            SETTLEMENT_SUPPORTS                 = 50,
+            SETTLEMENTS                         = 51,
+            THERMAL_EFFECT_BARS                 = 60,
+            TEMPERATURE_CHANGES                 = 61,
+            THERMAL_COEFFICIENTS                = 62,
+            FABRICATION_ERROR_BARS              = 70,
+            LENGTH_ERRORS                       = 71,
+            INFLUENCE_LOAD_NAMES                = 80,
+            INFLUENCE_LOAD_DIRECTIONS           = 81,
+            INFLUENCE_LOAD_PATH_SIZES           = 82,
+            INFLUENCE_LOAD_PATHS                = 83,
+            INFLUENCE_LOAD_POINT_LOAD_COUNTS    = 84,
+            INFLUENCE_LOAD_POINT_LOADS          = 85,
+            INFLUENCE_LOAD_POINT_LOAD_POSITIONS = 86,
+            SOLUTION_FINGERPRINT                = 100,
+            SOLUTION_OPTIONS                    = 101,
+            SOLUTION_TEXTS                      = 102,
+            JOINT_HORIZONTAL_DEFLECTIONS        = 110,
+            JOINT_VERTICAL_DEFLECTIONS          = 111,
+            BAR_LOADS                           = 112,
+            REACTION_HORIZONTAL_COMPONENTS      = 113,
+            REACTION_VERTICAL_COMPONENTS        = 114,
+            REACTION_JOINTS                     = 115,
+            INFLUENCE_RESULT_SIZES              = 120,
+            INFLUENCE_RESULT_ORDINATES          = 121,
+            INFLUENCE_RESULT_MIN_LOADS          = 122,
+            INFLUENCE_RESULT_MIN_LOAD_POSITIONS = 123,
+            INFLUENCE_RESULT_MAX_LOADS          = 124,
+            INFLUENCE_RESULT_MAX_LOAD_POSITIONS = 125,
+            JOURNAL_MODEL_FILE_NAME             = 130
+        };
+
+        //Texts of the properties section, in this order
+        enum Property
+        {
+            VERSION,
+            DESCRIPTION,
+            SYSTEM,
+            COORDINATE_UNIT,
+            AREA_UNIT,
+            MODULUS_UNIT,
+            UNIT_WEIGHT_UNIT,
+            LOAD_UNIT,
+            SUPPORT_SETTLEMENT_UNIT,
+            TEMPERATURE_CHANGE_UNIT,
+            THERMAL_COEFFICIENT_UNIT,
+            LENGTH_ERROR_UNIT,
+            AXIAL_RIGIDITY_OPTION,
+            PROPERTIES_COUNT
+        };
+
+        enum ElementType
+        {
+            REAL    = 1,
+            INTEGER = 2,
+            TEXT    = 3
+        };
+
+        enum Encoding
+        {
+            RAW_ENCODING        = 0,
+            COMPRESSED_ENCODING = 1
+        };
+
+        enum Error
+        {
+            NO_FILE_ERROR,
+            OPEN_ERROR,
+            FORMAT_ERROR
+        };
+
+        ModelFile();
+
+        ~ModelFile();
+
+        //Read the header and section table of a model file, or all of a file in the earlier format
+        bool open(const QString &fileName);
+
+        //Read the header and section table of a model file image held in memory
+        bool openContents(const QByteArray &contents);
+
+        Error error() const;
+
+        bool isLegacyFormat() const;
+
+        bool hasSection(Section section) const;
+
+        //Sections in the file or set, other than the properties, in section order
+        QList<int> sections() const;
+
+        //Encoded bytes of a section, shared with the section where it was set
+        QByteArray sectionBytes(Section section) const;
+
+        //Elements in a section, zero when the file does not have it
+        int count(Section section) const;
+
+        QString property(Property property) const;
+
+        QVector<qreal> reals(Section section) const;
+
+        QVector<qint32> integers(Section section) const;
+
+        QStringList texts(Section section) const;
+
+        //Whether the sections of each list agree in size, with joint, bar and support numbers in range
+        bool isConsistent() const;
+
+        void setProperty(Property property, const QString &text);
+
+        void setReals(Section section, const QVector<qreal> &reals);
+
+        void setIntegers(Section section, const QVector<qint32> &integers);
+
+        void setTexts(Section section, const QStringList &texts);
+
+        //Set a section to a copy of the section of another model file, without decoding it
+        void copySection(const ModelFile &modelFile, Section section);
+
+        //Compress the sections written that shrink by it, off by default
+        void setCompressed(bool compressed);
+
+        //Write the properties and the sections set, in section order
+        bool write(QIODevice *device) const;
+
+        //The magic is written little-endian. Files of the earlier format start with the low 32 bits of their magic
+        //number, big-endian.
+        static const quint32 kMagic       = 0x4C4D5454;
+        static const quint32 kLegacyMagic = 0x38F7BEA4;
+
+        //Files with no compressed section are written with the first major version, which earlier readers open
+        static const quint16 kFirstMajorVersion = 2;
+        static const quint16 kMajorVersion      = 3;
+        static const quint16 kMinorVersion = 1;
+
+        static const int kHeaderSize       = 24;
+        static const int kSectionEntrySize = 32;
+        static const int kAlignment        = 8;
+
+        //Decoded bytes of a compressed block, a multiple of the element sizes, and the smallest section compressed
+        static const int kCompressionBlockSize = 1 << 20;
+        static const int kMinCompressedLength  = 512;
+        static const int kCompressionLevel     = 6;
+        static const int kEncodedHeaderSize    = 16;
+
+    private:
+        struct SectionEntry
+        {
+            quint32 type;
+            quint32 encoding;
+            quint64 count;
+            quint64 offset;
+            quint64 length;
+        };
+
+        //One block of a compressed section, the source read and the target written by one task
+        struct Block
+        {
+            const uchar *source;
+            int         sourceLength;
+            uchar       *target;
+            int         targetLength;
+            ElementType type;
+            QByteArray  encoded;
+            bool        isDone;
+        };
+
+        bool readSectionTable();
+
+        bool readLegacyFormat();
+
+        //Data of a section of the type, with its count, or 0 when the file does not have it
+        const uchar *sectionData(Section section, ElementType type, quint64 *count, quint64 *length) const;
+
+        //Decode a compressed section into the decoded buffers
+        bool decodeSection(int section, const SectionEntry &entry) const;
+
+        static QByteArray encodeSection(const uchar *data, int length, ElementType type);
+
+        static void encodeBlock(Block &block);
+        static void decodeBlock(Block &block);
+
+        static void filterBlock(const uchar *data, int length, ElementType type, uchar *filtered);
+        static void unfilterBlock(const uchar *filtered, int length, ElementType type, uchar *data);
+
+        static QByteArray encodeTexts(const QStringList &texts);
+
+        static QStringList decodeTexts(const uchar *data, quint64 count, quint64 length);
+
+        QFile                          mFile;
+        const uchar                    *mData;
+        qint64                         mSize;
+        QByteArray                     mContents;
+        QHash<int, SectionEntry>       mSectionEntries;
+        QHash<int, QByteArray>         mSectionBuffers;
+        mutable QHash<int, QByteArray> mDecodedBuffers;
+        QStringList                    mProperties;
+        Error                          mError;
+        bool                           mIsLegacyFormat;
+        bool                           mIsCompressed;
+
+        Q_DISABLE_COPY(ModelFile)
+};
+
+#endif // MODELFILE_H
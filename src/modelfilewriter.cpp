@@ -0,0 +1,72 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelfilewriter.cpp */
+
+#include "modelfilewriter.h"
+
+ModelFileWriter::ModelFileWriter(ModelFile *snapshot, const QString &fileName, QObject *parent) : QThread(parent)
+{
+    mSnapshot = snapshot;
+    mJournal  = 0;
+    mFileName = fileName;
+
+    connect(this, SIGNAL(finished()), this, SLOT(deleteLater()));
+}
+
+ModelFileWriter::ModelFileWriter(ModelFile *snapshot, ModelJournal *journal, QObject *parent) : QThread(parent)
+{
+    mSnapshot = snapshot;
+    mJournal  = journal;
+    mFileName = journal->fileName();
+
+    connect(this, SIGNAL(finished()), this, SLOT(deleteLater()));
+}
+
+ModelFileWriter::~ModelFileWriter()
+{
+    delete mSnapshot;
+}
+
+void ModelFileWriter::run()
+{
+    if (mJournal != 0)
+    {
+        bool isWritten = mJournal->append(*mSnapshot);
+        emit writtenSignal(mFileName, isWritten, isWritten ? QString() : tr("Cannot write autosave journal."));
+        return;
+    }
+
+    QSaveFile saveFile(mFileName);
+    saveFile.setDirectWriteFallback(true);
+
+    if (!saveFile.open(QSaveFile::WriteOnly))
+    {
+        emit writtenSignal(mFileName, false, saveFile.errorString());
+        return;
+    }
+
+    if (!mSnapshot->write(&saveFile))
+    {
+        QString errorString = saveFile.errorString();
+        saveFile.cancelWriting();
+        emit writtenSignal(mFileName, false, errorString);
+        return;
+    }
+
+    bool isWritten = saveFile.commit();
+    emit writtenSignal(mFileName, isWritten, saveFile.errorString());
+}
@@ -0,0 +1,56 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelfilewriter.h */
+
+#ifndef MODELFILEWRITER_H
+#define MODELFILEWRITER_H
+
+#include <QSaveFile>
+#include <QThread>
+
+#include "modelfile.h"
+#include "modeljournal.h"
+
+//Writes a snapshot of a model, taken on the GUI thread by filling a model file, either as a model file through a
+//save file or as a record of an autosave journal. The snapshot shares nothing with the model lists, so the model can
+//be edited while it is written.
+class ModelFileWriter : public QThread
+{
+        Q_OBJECT
+
+    public:
+        //The writer owns the snapshot
+        ModelFileWriter(ModelFile *snapshot, const QString &fileName, QObject *parent = 0);
+
+        //The journal is left to the writer until it has finished
+        ModelFileWriter(ModelFile *snapshot, ModelJournal *journal, QObject *parent = 0);
+
+        ~ModelFileWriter();
+
+    protected:
+        void run();
+
+    signals:
+        void writtenSignal(QString fileName, bool isWritten, QString errorString);
+
+    private:
+        ModelFile    *mSnapshot;
+        ModelJournal *mJournal;
+        QString      mFileName;
+};
+
+#endif // MODELFILEWRITER_H
@@ -0,0 +1,258 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelgraph.cpp */
+
+#include "modelgraph.h"
+
+ModelGraph::ModelGraph(const QList<Joint *>   &jointsList,
+                       const QList<Bar *>     &barsList,
+                       const QList<Support *> &supportsList)
+{
+    int jointsCount = jointsList.size();
+    int barsCount   = barsList.size();
+
+    mModelIndex.rebuild(jointsList, barsList, supportsList);
+
+    //Count the bars at each joint, then place both directions of every bar
+
+    mBarJoints         = QVector<int>(2 * barsCount, -1);
+    mAdjacencyPointers = QVector<int>(jointsCount + 1, 0);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        int indexA = jointIndex(barsList.at(i)->firstJoint());
+        int indexB = jointIndex(barsList.at(i)->secondJoint());
+
+        mBarJoints[2 * i]     = indexA;
+        mBarJoints[2 * i + 1] = indexB;
+
+        if (indexA >= 0 && indexB >= 0)
+        {
+            ++mAdjacencyPointers[indexA + 1];
+            ++mAdjacencyPointers[indexB + 1];
+        }
+    }
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        mAdjacencyPointers[i + 1] += mAdjacencyPointers.at(i);
+    }
+
+    mAdjacentJoints = QVector<int>(mAdjacencyPointers.at(jointsCount));
+    mAdjacentBars   = QVector<int>(mAdjacencyPointers.at(jointsCount));
+
+    QVector<int> positions(mAdjacencyPointers);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        int indexA = mBarJoints.at(2 * i);
+        int indexB = mBarJoints.at(2 * i + 1);
+
+        if (indexA >= 0 && indexB >= 0)
+        {
+            mAdjacentJoints[positions.at(indexA)] = indexB;
+            mAdjacentBars[positions[indexA]++]    = i;
+            mAdjacentJoints[positions.at(indexB)] = indexA;
+            mAdjacentBars[positions[indexB]++]    = i;
+        }
+    }
+
+    mJointSupports = QVector<Support *>(jointsCount, 0);
+
+    foreach (Support *support, supportsList)
+    {
+        int index = jointIndex(support->supportJoint());
+
+        if (index >= 0)
+        {
+            mJointSupports[index] = support;
+        }
+    }
+
+    labelComponents();
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        for (int k = 0; k < 2; ++k)
+        {
+            int index = mBarJoints.at(2 * i + k);
+
+            if (index >= 0 && degree(index) == 1 && mJointSupports.at(index) == 0)
+            {
+                mDanglingBars.append(i);
+                break;
+            }
+        }
+    }
+}
+
+ModelGraph::~ModelGraph()
+{
+
+}
+
+int ModelGraph::jointsCount() const
+{
+    return mJointSupports.size();
+}
+
+int ModelGraph::barsCount() const
+{
+    return mBarJoints.size() / 2;
+}
+
+int ModelGraph::jointIndex(const Joint *joint) const
+{
+    return mModelIndex.jointIndex(joint);
+}
+
+const ModelIndex &ModelGraph::modelIndex() const
+{
+    return mModelIndex;
+}
+
+int ModelGraph::barFirstJoint(int bar) const
+{
+    return mBarJoints.at(2 * bar);
+}
+
+int ModelGraph::barSecondJoint(int bar) const
+{
+    return mBarJoints.at(2 * bar + 1);
+}
+
+int ModelGraph::degree(int joint) const
+{
+    return mAdjacencyPointers.at(joint + 1) - mAdjacencyPointers.at(joint);
+}
+
+int ModelGraph::adjacencyBegin(int joint) const
+{
+    return mAdjacencyPointers.at(joint);
+}
+
+int ModelGraph::adjacencyEnd(int joint) const
+{
+    return mAdjacencyPointers.at(joint + 1);
+}
+
+const QVector<int> &ModelGraph::adjacentJoints() const
+{
+    return mAdjacentJoints;
+}
+
+const QVector<int> &ModelGraph::adjacentBars() const
+{
+    return mAdjacentBars;
+}
+
+Support *ModelGraph::jointSupport(int joint) const
+{
+    return mJointSupports.at(joint);
+}
+
+bool ModelGraph::isFixedJoint(int joint) const
+{
+    Support *support = mJointSupports.at(joint);
+
+    if (support == 0)
+    {
+        return false;
+    }
+
+    UnitsAndLimits::SupportType type = support->type();
+
+    return type == UnitsAndLimits::FIXED_LEFT
+            || type == UnitsAndLimits::FIXED_TOP
+            || type == UnitsAndLimits::FIXED_RIGHT
+            || type == UnitsAndLimits::FIXED_BOTTOM;
+}
+
+int ModelGraph::componentsCount() const
+{
+    return mComponentsCount;
+}
+
+int ModelGraph::componentLabel(int joint) const
+{
+    return mComponentLabels.at(joint);
+}
+
+bool ModelGraph::isConnected() const
+{
+    return mComponentsCount <= 1;
+}
+
+const QList<int> &ModelGraph::danglingBars() const
+{
+    return mDanglingBars;
+}
+
+bool ModelGraph::hasAllJointsFixed() const
+{
+    for (int i = 0; i < jointsCount(); ++i)
+    {
+        if (!isFixedJoint(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ModelGraph::labelComponents()
+{
+    int jointsCount = mJointSupports.size();
+
+    mComponentLabels = QVector<int>(jointsCount, -1);
+    mComponentsCount = 0;
+
+    QVector<int> queue(jointsCount);
+
+    for (int root = 0; root < jointsCount; ++root)
+    {
+        if (mComponentLabels.at(root) >= 0)
+        {
+            continue;
+        }
+
+        int head = 0;
+        int tail = 0;
+
+        queue[tail++]          = root;
+        mComponentLabels[root] = mComponentsCount;
+
+        while (head < tail)
+        {
+            int joint = queue.at(head++);
+
+            for (int p = mAdjacencyPointers.at(joint); p < mAdjacencyPointers.at(joint + 1); ++p)
+            {
+                int neighbour = mAdjacentJoints.at(p);
+
+                if (mComponentLabels.at(neighbour) < 0)
+                {
+                    mComponentLabels[neighbour] = mComponentsCount;
+                    queue[tail++]               = neighbour;
+                }
+            }
+        }
+
+        ++mComponentsCount;
+    }
+}
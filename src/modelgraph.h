@@ -0,0 +1,101 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelgraph.h */
+
+#ifndef MODELGRAPH_H
+#define MODELGRAPH_H
+
+#include <QList>
+#include <QVector>
+
+#include "bar.h"
+#include "joint.h"
+#include "modelindex.h"
+#include "support.h"
+#include "unitsandlimits.h"
+
+//Adjacency of the joints of a model through its bars in compressed sparse row form, built once in linear time.
+//Joints and bars are numbered by their positions in the lists the graph is built from, and connected components
+//are labelled by a breadth first search. The graph does not follow later edits of the model.
+class ModelGraph
+{
+    public:
+        ModelGraph(const QList<Joint *>   &jointsList,
+                   const QList<Bar *>     &barsList,
+                   const QList<Support *> &supportsList);
+
+        ~ModelGraph();
+
+        int jointsCount() const;
+
+        int barsCount() const;
+
+        //Position of the joint in the joints list, -1 for a joint not in the graph
+        int jointIndex(const Joint *joint) const;
+
+        //Positions of the joints, bars and supports in the lists the graph is built from
+        const ModelIndex &modelIndex() const;
+
+        int barFirstJoint(int bar) const;
+
+        int barSecondJoint(int bar) const;
+
+        //Number of bars attached to the joint
+        int degree(int joint) const;
+
+        //The neighbours of a joint are adjacentJoints()[adjacencyBegin(joint)] up to adjacencyEnd(joint), reached
+        //through the bars at the same positions in adjacentBars()
+        int adjacencyBegin(int joint) const;
+
+        int adjacencyEnd(int joint) const;
+
+        const QVector<int> &adjacentJoints() const;
+
+        const QVector<int> &adjacentBars() const;
+
+        //Support of the joint, 0 for an unsupported joint
+        Support *jointSupport(int joint) const;
+
+        bool isFixedJoint(int joint) const;
+
+        int componentsCount() const;
+
+        int componentLabel(int joint) const;
+
+        bool isConnected() const;
+
+        //Bars ending on a joint with no other bar and no support
+        const QList<int> &danglingBars() const;
+
+        //Check if every joint has a fixed support
+        bool hasAllJointsFixed() const;
+
+    private:
+        void labelComponents();
+
+        ModelIndex                mModelIndex;
+        QVector<int>              mBarJoints;
+        QVector<int>              mAdjacencyPointers;
+        QVector<int>              mAdjacentJoints;
+        QVector<int>              mAdjacentBars;
+        QVector<Support *>        mJointSupports;
+        QVector<int>              mComponentLabels;
+        int                       mComponentsCount;
+        QList<int>                mDanglingBars;
+};
+
+#endif // MODELGRAPH_H
@@ -0,0 +1,75 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelindex.cpp */
+
+#include "modelindex.h"
+
+ModelIndex::ModelIndex()
+{
+
+}
+
+ModelIndex::ModelIndex(const QList<Joint *>   &jointsList,
+                       const QList<Bar *>     &barsList,
+                       const QList<Support *> &supportsList)
+{
+    rebuild(jointsList, barsList, supportsList);
+}
+
+void ModelIndex::rebuild(const QList<Joint *>   &jointsList,
+                         const QList<Bar *>     &barsList,
+                         const QList<Support *> &supportsList)
+{
+    mJointIndices.clear();
+    mBarIndices.clear();
+    mSupportIndices.clear();
+
+    mJointIndices.reserve(jointsList.size());
+    mBarIndices.reserve(barsList.size());
+    mSupportIndices.reserve(supportsList.size());
+
+    //Walking backwards keeps the first position of an item listed twice, as indexOf does
+    for (int i = jointsList.size() - 1; i >= 0; --i)
+    {
+        mJointIndices.insert(jointsList.at(i), i);
+    }
+
+    for (int i = barsList.size() - 1; i >= 0; --i)
+    {
+        mBarIndices.insert(barsList.at(i), i);
+    }
+
+    for (int i = supportsList.size() - 1; i >= 0; --i)
+    {
+        mSupportIndices.insert(supportsList.at(i), i);
+    }
+}
+
+int ModelIndex::jointIndex(const Joint *joint) const
+{
+    return mJointIndices.value(joint, -1);
+}
+
+int ModelIndex::barIndex(const Bar *bar) const
+{
+    return mBarIndices.value(bar, -1);
+}
+
+int ModelIndex::supportIndex(const Support *support) const
+{
+    return mSupportIndices.value(support, -1);
+}
@@ -0,0 +1,82 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelindex.h */
+
+#ifndef MODELINDEX_H
+#define MODELINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QVector>
+
+#include "bar.h"
+#include "joint.h"
+#include "support.h"
+
+//Position lookup for the joints, bars and supports of one snapshot of the model lists
+//Built in one pass, it answers what QList::indexOf answered in constant time; it must be
+//rebuilt after the lists it was built from change
+class ModelIndex
+{
+    public:
+        ModelIndex();
+
+        explicit ModelIndex(const QList<Joint *>   &jointsList,
+                            const QList<Bar *>     &barsList     = QList<Bar *>(),
+                            const QList<Support *> &supportsList = QList<Support *>());
+
+        void rebuild(const QList<Joint *>   &jointsList,
+                     const QList<Bar *>     &barsList     = QList<Bar *>(),
+                     const QList<Support *> &supportsList = QList<Support *>());
+
+        //Position of the item in its list, -1 if it is not in the list
+        int jointIndex(const Joint *joint) const;
+
+        int barIndex(const Bar *bar) const;
+
+        int supportIndex(const Support *support) const;
+
+        //Removes the items flagged in isRemoved in one pass, keeping the order of the rest
+        template <typename T>
+        static int removeFlagged(QList<T *> &list, const QVector<bool> &isRemoved);
+
+    private:
+        QHash<const Joint *, int>   mJointIndices;
+        QHash<const Bar *, int>     mBarIndices;
+        QHash<const Support *, int> mSupportIndices;
+};
+
+template <typename T>
+int ModelIndex::removeFlagged(QList<T *> &list, const QVector<bool> &isRemoved)
+{
+    QList<T *> keptList;
+    keptList.reserve(list.size());
+
+    for (int i = 0; i < list.size(); ++i)
+    {
+        if (i >= isRemoved.size() || !isRemoved.at(i))
+        {
+            keptList.append(list.at(i));
+        }
+    }
+
+    int count = list.size() - keptList.size();
+    list      = keptList;
+    return count;
+}
+
+#endif // MODELINDEX_H
@@ -0,0 +1,194 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeljournal.cpp */
+
+#include "modeljournal.h"
+
+ModelJournal::ModelJournal()
+{
+
+}
+
+void ModelJournal::setFileName(const QString &fileName)
+{
+    mFileName = fileName;
+    mProperties.clear();
+    mSectionDigests.clear();
+}
+
+QString ModelJournal::fileName() const
+{
+    return mFileName;
+}
+
+bool ModelJournal::append(const ModelFile &snapshot)
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // Sections whose digest differs from the one last written
+    // -----------------------------------------------------------------------------------------------------------------
+
+    ModelFile record;
+    QStringList properties;
+    QHash<int, QByteArray> sectionDigests;
+
+    for (int i = 0; i < ModelFile::PROPERTIES_COUNT; ++i)
+    {
+        properties.append(snapshot.property(ModelFile::Property(i)));
+        record.setProperty(ModelFile::Property(i), properties.at(i));
+    }
+
+    bool hasChanges = (properties != mProperties);
+
+    foreach (int section, snapshot.sections())
+    {
+        QByteArray bytes  = snapshot.sectionBytes(ModelFile::Section(section));
+        QByteArray digest = QCryptographicHash::hash(bytes, QCryptographicHash::Sha1);
+        sectionDigests.insert(section, digest);
+
+        if (mSectionDigests.value(section) != digest)
+        {
+            record.copySection(snapshot, ModelFile::Section(section));
+            hasChanges = true;
+        }
+    }
+
+    if (!hasChanges)
+    {
+        return true;
+    }
+
+    QBuffer image;
+    image.open(QBuffer::WriteOnly);
+
+    if (!record.write(&image))
+    {
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Record appended in one write, and flushed to disk before the digests count it as written
+    // -----------------------------------------------------------------------------------------------------------------
+
+    QByteArray header(kRecordHeaderSize, '\0');
+    uchar *headerData = reinterpret_cast<uchar *>(header.data());
+
+    qToLittleEndian<quint32>(kRecordMagic, headerData);
+    qToLittleEndian<quint32>(0, headerData + 4);
+    qToLittleEndian<quint64>(quint64(image.data().size()), headerData + 8);
+
+    QFile file(mFileName);
+
+    if (!file.open(QFile::WriteOnly | QFile::Append))
+    {
+        return false;
+    }
+
+    QByteArray bytes = header + image.data();
+
+    if ((file.write(bytes) != bytes.size()) || !file.flush())
+    {
+        return false;
+    }
+
+    mProperties     = properties;
+    mSectionDigests = sectionDigests;
+    return true;
+}
+
+void ModelJournal::clear()
+{
+    if (!mFileName.isEmpty())
+    {
+        QFile::remove(mFileName);
+    }
+
+    mProperties.clear();
+    mSectionDigests.clear();
+}
+
+bool ModelJournal::replay(const QString &fileName, ModelFile *modelFile)
+{
+    QFile file(fileName);
+
+    if (!file.open(QFile::ReadOnly))
+    {
+        return false;
+    }
+
+    int recordsCount = 0;
+
+    forever
+    {
+        QByteArray header = file.read(kRecordHeaderSize);
+
+        if (header.size() != kRecordHeaderSize)
+        {
+            break;
+        }
+
+        const uchar *headerData = reinterpret_cast<const uchar *>(header.constData());
+        quint64 length          = qFromLittleEndian<quint64>(headerData + 8);
+
+        if ((qFromLittleEndian<quint32>(headerData) != kRecordMagic) ||
+            (length > quint64(file.size() - file.pos())))
+        {
+            break;
+        }
+
+        ModelFile record;
+
+        if (!record.openContents(file.read(qint64(length))))
+        {
+            break;
+        }
+
+        for (int i = 0; i < ModelFile::PROPERTIES_COUNT; ++i)
+        {
+            modelFile->setProperty(ModelFile::Property(i), record.property(ModelFile::Property(i)));
+        }
+
+        foreach (int section, record.sections())
+        {
+            modelFile->copySection(record, ModelFile::Section(section));
+        }
+
+        ++recordsCount;
+    }
+
+    return (recordsCount > 0);
+}
+
+QString ModelJournal::directory()
+{
+    QString location = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+    return QDir(location).filePath(QString("autosave"));
+}
+
+QStringList ModelJournal::journalFileNames()
+{
+    QDir dir(directory());
+    QStringList fileNames;
+
+    QStringList nameFilters(QString("*.ttjnl"));
+
+    foreach (const QString &name, dir.entryList(nameFilters, QDir::Files, QDir::Time | QDir::Reversed))
+    {
+        fileNames.append(dir.filePath(name));
+    }
+
+    return fileNames;
+}
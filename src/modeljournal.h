@@ -0,0 +1,75 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeljournal.h */
+
+#ifndef MODELJOURNAL_H
+#define MODELJOURNAL_H
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QStandardPaths>
+#include <QString>
+#include <QStringList>
+#include <QtEndian>
+
+#include "modelfile.h"
+
+//Autosave journal of a model, a file of records that each hold a model file image with the properties and the
+//sections that changed since the record before it. The first record holds every section. A record is a header of
+//
+//  quint32 magic, quint32 reserved, quint64 image length
+//
+//followed by the image, and replaying a journal lays the sections of each record over those before. A record cut
+//short by a crash ends the replay, leaving the state of the records before it.
+class ModelJournal
+{
+    public:
+        ModelJournal();
+
+        void setFileName(const QString &fileName);
+
+        QString fileName() const;
+
+        //Append the sections of a model snapshot that differ from those already in the journal
+        bool append(const ModelFile &snapshot);
+
+        //Remove the journal file, after which the next record holds every section again
+        void clear();
+
+        //Merge the records of a journal into a model file, false when not even the first record can be read
+        static bool replay(const QString &fileName, ModelFile *modelFile);
+
+        //Directory of the journals of all windows
+        static QString directory();
+
+        //Journals in the directory, oldest first
+        static QStringList journalFileNames();
+
+        static const quint32 kRecordMagic      = 0x524A5454;
+        static const int     kRecordHeaderSize = 16;
+
+    private:
+        QString                mFileName;
+        QStringList            mProperties;
+        QHash<int, QByteArray> mSectionDigests;
+};
+
+#endif // MODELJOURNAL_H
@@ -0,0 +1,540 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelscript.cpp */
+
+#include "modelscript.h"
+#include "solver.h"
+
+ModelScript::ModelScript(QObject *parent) : QObject(parent)
+{
+    mSolver            = new Solver;
+    mOwnsSolver        = true;
+    mIsEditing         = false;
+    mIsJointIndexValid = false;
+
+    connect(mSolver, SIGNAL(jointsRenumberedSignal(QVector<int>)), this, SLOT(renumberJoints(QVector<int>)));
+}
+
+ModelScript::ModelScript(Solver *solver, QObject *parent) : QObject(parent)
+{
+    mSolver            = solver;
+    mOwnsSolver        = false;
+    mIsEditing         = false;
+    mIsJointIndexValid = false;
+
+    resetJointNumbers();
+    connect(mSolver, SIGNAL(jointsRenumberedSignal(QVector<int>)), this, SLOT(renumberJoints(QVector<int>)));
+}
+
+ModelScript::~ModelScript()
+{
+    commit();
+
+    if (mOwnsSolver)
+    {
+        delete mSolver;
+    }
+}
+
+void ModelScript::beginEdits()
+{
+    if (!mIsEditing)
+    {
+        mIsEditing = true;
+        mSolver->beginEditTransaction();
+    }
+}
+
+void ModelScript::commit()
+{
+    if (mIsEditing)
+    {
+        mIsEditing = false;
+        mSolver->commitEditTransaction();
+    }
+}
+
+bool ModelScript::open(const QString &fileName)
+{
+    commit();
+
+    //The joints of the file are numbered afresh, so the joints the script knew are not followed through the load
+    mJointPositions.clear();
+    mJointNumbers.clear();
+
+    bool isOpened = mSolver->loadFile(fileName);
+
+    resetJointNumbers();
+    return isOpened;
+}
+
+bool ModelScript::save(const QString &fileName)
+{
+    commit();
+    return mSolver->saveFile(fileName);
+}
+
+bool ModelScript::importTables(const QStringList &fileNames)
+{
+    commit();
+
+    mJointPositions.clear();
+    mJointNumbers.clear();
+
+    bool isImported = mSolver->importTables(fileNames);
+
+    resetJointNumbers();
+    return isImported;
+}
+
+bool ModelScript::exportTables(const QString &directory, const QString &format)
+{
+    commit();
+
+    if (format == ModelTableFile::fileSuffix(ModelTableFile::JSON_LINES))
+    {
+        return mSolver->exportTables(directory, ModelTableFile::JSON_LINES);
+    }
+    else
+    {
+        return mSolver->exportTables(directory, ModelTableFile::CSV);
+    }
+}
+
+int ModelScript::jointsCount() const
+{
+    return mJointPositions.size();
+}
+
+int ModelScript::barsCount() const
+{
+    return mSolver->barsList().size();
+}
+
+int ModelScript::supportsCount() const
+{
+    return mSolver->supportsList().size();
+}
+
+QVariantMap ModelScript::joint(int number) const
+{
+    QVariantMap map;
+    int jointNumber = modelJointNumber(number);
+
+    if ((jointNumber < 1) || (jointNumber > mSolver->jointsList().size()))
+    {
+        return map;
+    }
+
+    Joint *joint = mSolver->jointsList().at(jointNumber - 1);
+
+    map.insert(QString("number"), number);
+    map.insert(QString("x"), joint->xCoordinate());
+    map.insert(QString("y"), joint->yCoordinate());
+    map.insert(QString("supported"), joint->isSupported());
+    return map;
+}
+
+QVariantMap ModelScript::bar(int number) const
+{
+    QVariantMap map;
+
+    if ((number < 1) || (number > mSolver->barsList().size()))
+    {
+        return map;
+    }
+
+    if (!mIsJointIndexValid)
+    {
+        mJointIndex.rebuild(mSolver->jointsList());
+        mIsJointIndexValid = true;
+    }
+
+    Bar *bar = mSolver->barsList().at(number - 1);
+
+    qreal xComponent = bar->secondJoint()->xCoordinate() - bar->firstJoint()->xCoordinate();
+    qreal yComponent = bar->secondJoint()->yCoordinate() - bar->firstJoint()->yCoordinate();
+
+    map.insert(QString("number"), number);
+    map.insert(QString("firstJoint"), scriptJointNumber(mJointIndex.jointIndex(bar->firstJoint())));
+    map.insert(QString("secondJoint"), scriptJointNumber(mJointIndex.jointIndex(bar->secondJoint())));
+    map.insert(QString("length"), std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0)));
+
+    if (mSolver->areaModulusOption())
+    {
+        map.insert(QString("area"), bar->area());
+        map.insert(QString("modulus"), bar->modulus());
+        map.insert(QString("unitWeight"), bar->unitWeight());
+    }
+    else
+    {
+        map.insert(QString("factor"), bar->factor());
+    }
+
+    return map;
+}
+
+bool ModelScript::areaModulusOption() const
+{
+    return mSolver->areaModulusOption();
+}
+
+bool ModelScript::setAreaModulusOption(bool areaModulusOption)
+{
+    return mSolver->setAxialRigidityOption(areaModulusOption);
+}
+
+int ModelScript::addJoint(qreal xCoordinate, qreal yCoordinate)
+{
+    beginEdits();
+
+    int jointNumber = mSolver->appendJoint(xCoordinate, yCoordinate);
+
+    if (jointNumber == 0)
+    {
+        return 0;
+    }
+
+    return appendJointNumbers(jointNumber);
+}
+
+int ModelScript::addBar(int firstJoint, int secondJoint, qreal factor)
+{
+    beginEdits();
+    return mSolver->appendBar(modelJointNumber(firstJoint), modelJointNumber(secondJoint), 0.0, 0.0, factor, 0.0);
+}
+
+int ModelScript::addBar(int   firstJoint,
+                        int   secondJoint,
+                        qreal area,
+                        qreal modulus,
+                        qreal unitWeight)
+{
+    beginEdits();
+    return mSolver->appendBar(modelJointNumber(firstJoint),
+                              modelJointNumber(secondJoint),
+                              area,
+                              modulus,
+                              0.0,
+                              unitWeight);
+}
+
+bool ModelScript::addSupport(int            jointNumber,
+                             const QString &type,
+                             qreal          angle)
+{
+    UnitsAndLimits::SupportType supportType;
+
+    if (!supportTypeFromName(type, &supportType))
+    {
+        return false;
+    }
+
+    beginEdits();
+    return mSolver->appendSupport(modelJointNumber(jointNumber), supportType, angle);
+}
+
+bool ModelScript::addJointLoad(int            jointNumber,
+                               qreal          horizontalComponent,
+                               qreal          verticalComponent,
+                               const QString &position)
+{
+    //Loads need the model checked, so the edits so far are committed and the joints renumbered before the script
+    //joint is looked up in the model
+    commit();
+    return mSolver->appendJointLoad(modelJointNumber(jointNumber), horizontalComponent, verticalComponent, position);
+}
+
+int ModelScript::generate(const QVariantMap &parameters)
+{
+    QStringList topologies;
+    topologies << QString("pratt")
+               << QString("howe")
+               << QString("warren")
+               << QString("k")
+               << QString("bowstring")
+               << QString("fan")
+               << QString("grid")
+               << QString("triangulatedGrid");
+
+    int topology = topologies.indexOf(parameters.value(QString("topology"), QString("pratt")).toString());
+
+    if (topology < 0)
+    {
+        return 0;
+    }
+
+    ParametricTruss truss(ParametricTruss::Topology(topology),
+                          parameters.value(QString("panels"), 4).toInt(),
+                          parameters.value(QString("panelLength"), 1.0).toReal(),
+                          parameters.value(QString("depth"), 1.0).toReal(),
+                          parameters.value(QString("camber"), 0.0).toReal(),
+                          parameters.value(QString("rows"), 1).toInt());
+
+    QStringList groups;
+    groups << QString("topChord") << QString("bottomChord") << QString("verticals") << QString("diagonals");
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        QVariantMap section = parameters;
+
+        if (parameters.contains(groups.at(i)))
+        {
+            section = parameters.value(groups.at(i)).toMap();
+        }
+
+        setSection(&truss, ParametricTruss::MemberGroup(i), section);
+    }
+
+    beginEdits();
+
+    int jointNumber = mSolver->appendTruss(truss);
+
+    if (jointNumber == 0)
+    {
+        return 0;
+    }
+
+    return appendJointNumbers(jointNumber);
+}
+
+bool ModelScript::check()
+{
+    commit();
+    return mSolver->checkModelAndWait();
+}
+
+bool ModelScript::solve(const QVariantMap &loads)
+{
+    commit();
+
+    if (loads.isEmpty())
+    {
+        return mSolver->solveModelAndWait(true, false, false, false, false);
+    }
+
+    return mSolver->solveModelAndWait(loads.value(QString("jointLoads")).toBool(),
+                                      loads.value(QString("selfWeight")).toBool(),
+                                      loads.value(QString("supportSettlements")).toBool(),
+                                      loads.value(QString("thermalEffects")).toBool(),
+                                      loads.value(QString("fabricationErrors")).toBool(),
+                                      loads.value(QString("influenceLoad")).toString());
+}
+
+QVariantList ModelScript::jointDeflections() const
+{
+    QVariantList list;
+    QSharedPointer<const SolutionResult> result = mSolver->solutionResult();
+
+    if (result.isNull() || !result->hasJointDeflections())
+    {
+        return list;
+    }
+
+    list.reserve(mJointPositions.size());
+
+    //In the order of the script joint numbers
+
+    for (int i = 0; i < mJointPositions.size(); ++i)
+    {
+        int jointIndex = mJointPositions.at(i);
+
+        if (jointIndex >= result->jointsCount())
+        {
+            continue;
+        }
+
+        QVariantMap map;
+        map.insert(QString("joint"), i + 1);
+        map.insert(QString("horizontal"), result->horizontalDeflection(jointIndex));
+        map.insert(QString("vertical"), result->verticalDeflection(jointIndex));
+        list.append(map);
+    }
+
+    return list;
+}
+
+QVariantList ModelScript::barLoads() const
+{
+    QVariantList list;
+    QSharedPointer<const SolutionResult> result = mSolver->solutionResult();
+
+    if (result.isNull() || !result->hasBarLoads())
+    {
+        return list;
+    }
+
+    list.reserve(result->barsCount());
+
+    for (int i = 0; i < result->barsCount(); ++i)
+    {
+        QVariantMap map;
+        map.insert(QString("bar"), i + 1);
+        map.insert(QString("load"), result->barLoad(i));
+        list.append(map);
+    }
+
+    return list;
+}
+
+QVariantList ModelScript::supportReactions() const
+{
+    QVariantList list;
+    QSharedPointer<const SolutionResult> result = mSolver->solutionResult();
+
+    if (result.isNull() || !result->hasSupportReactions())
+    {
+        return list;
+    }
+
+    list.reserve(result->reactionsCount());
+
+    for (int i = 0; i < result->reactionsCount(); ++i)
+    {
+        QVariantMap map;
+        map.insert(QString("joint"), scriptJointNumber(result->reactionJointNumber(i) - 1));
+        map.insert(QString("horizontal"), result->reactionHorizontalComponent(i));
+        map.insert(QString("vertical"), result->reactionVerticalComponent(i));
+        list.append(map);
+    }
+
+    return list;
+}
+
+QVariantMap ModelScript::statistics() const
+{
+    return mSolver->solverStatistics().toJson().toVariantMap();
+}
+
+bool ModelScript::exportReport(const QString &directory)
+{
+    commit();
+    return mSolver->exportReport(directory);
+}
+
+void ModelScript::renumberJoints(QVector<int> jointPositions)
+{
+    //Joints keep their objects on renumbering while their coordinates move, so the script joints are followed by
+    //position
+
+    for (int i = 0; i < mJointPositions.size(); ++i)
+    {
+        if (mJointPositions.at(i) < jointPositions.size())
+        {
+            mJointPositions[i] = jointPositions.at(mJointPositions.at(i));
+        }
+    }
+
+    mJointNumbers.fill(0, jointPositions.size());
+
+    for (int i = 0; i < mJointPositions.size(); ++i)
+    {
+        if (mJointPositions.at(i) < mJointNumbers.size())
+        {
+            mJointNumbers[mJointPositions.at(i)] = i + 1;
+        }
+    }
+
+    mIsJointIndexValid = false;
+}
+
+void ModelScript::resetJointNumbers()
+{
+    int jointsCount = mSolver->jointsList().size();
+
+    mJointPositions.resize(jointsCount);
+    mJointNumbers.resize(jointsCount);
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        mJointPositions[i] = i;
+        mJointNumbers[i]   = i + 1;
+    }
+
+    mIsJointIndexValid = false;
+}
+
+int ModelScript::appendJointNumbers(int firstJointNumber)
+{
+    int jointsCount = mSolver->jointsList().size();
+    int number      = mJointPositions.size() + 1;
+
+    if (mJointNumbers.size() < jointsCount)
+    {
+        mJointNumbers.resize(jointsCount);
+    }
+
+    for (int i = firstJointNumber - 1; i < jointsCount; ++i)
+    {
+        mJointPositions.append(i);
+        mJointNumbers[i] = mJointPositions.size();
+    }
+
+    mIsJointIndexValid = false;
+    return number;
+}
+
+int ModelScript::modelJointNumber(int number) const
+{
+    if ((number < 1) || (number > mJointPositions.size()))
+    {
+        return 0;
+    }
+
+    return mJointPositions.at(number - 1) + 1;
+}
+
+int ModelScript::scriptJointNumber(int jointIndex) const
+{
+    return mJointNumbers.value(jointIndex);
+}
+
+bool ModelScript::supportTypeFromName(const QString &name, UnitsAndLimits::SupportType *type)
+{
+    //In the order of UnitsAndLimits::SupportType
+    QStringList names;
+    names << QString("fixedLeft")
+          << QString("fixedTop")
+          << QString("fixedRight")
+          << QString("fixedBottom")
+          << QString("roller")
+          << QString("rollerLeft")
+          << QString("rollerTop")
+          << QString("rollerRight")
+          << QString("rollerBottom");
+
+    int index = names.indexOf(name);
+
+    if (index < 0)
+    {
+        return false;
+    }
+
+    *type = UnitsAndLimits::SupportType(index);
+    return true;
+}
+
+void ModelScript::setSection(ParametricTruss              *truss,
+                             ParametricTruss::MemberGroup group,
+                             const QVariantMap            &section)
+{
+    truss->setSection(group,
+                      section.value(QString("area"), 0.0).toReal(),
+                      section.value(QString("modulus"), 0.0).toReal(),
+                      section.value(QString("factor"), 1.0).toReal(),
+                      section.value(QString("unitWeight"), 0.0).toReal());
+}
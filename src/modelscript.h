@@ -0,0 +1,166 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modelscript.h */
+
+#ifndef MODELSCRIPT_H
+#define MODELSCRIPT_H
+
+#include <cmath>
+
+#include <QJsonObject>
+#include <QObject>
+#include <QSharedPointer>
+#include <QStringList>
+#include <QVariantList>
+#include <QVariantMap>
+#include <QVector>
+
+#include "bar.h"
+#include "joint.h"
+#include "modelindex.h"
+#include "parametrictruss.h"
+#include "solutionresult.h"
+#include "solverstatistics.h"
+#include "support.h"
+#include "unitsandlimits.h"
+
+class Solver;
+
+//A model as scripts see it, either the model of an open window or a hidden model of its own. The edits of a script
+//are gathered in an edit transaction that stays open between calls. Checking, solving, saving and reporting commit
+//the edits first, which renumbers the joints of the model by position, but a script keeps the joint numbers addJoint
+//returned for as long as it runs. Joints, bars and supports are numbered from one.
+class ModelScript : public QObject
+{
+        Q_OBJECT
+
+    public:
+        //A hidden model, closed with the script
+        explicit ModelScript(QObject *parent = 0);
+
+        //The model of an open window, left open when the script ends
+        explicit ModelScript(Solver *solver, QObject *parent = 0);
+
+        ~ModelScript();
+
+        //Commit the edits of the script, as when the script ends
+        Q_INVOKABLE void commit();
+
+        Q_INVOKABLE bool open(const QString &fileName);
+
+        Q_INVOKABLE bool save(const QString &fileName);
+
+        //CSV files unless the format is "jsonl"
+        Q_INVOKABLE bool importTables(const QStringList &fileNames);
+
+        Q_INVOKABLE bool exportTables(const QString &directory, const QString &format = QString("csv"));
+
+        Q_INVOKABLE int jointsCount() const;
+
+        Q_INVOKABLE int barsCount() const;
+
+        Q_INVOKABLE int supportsCount() const;
+
+        Q_INVOKABLE QVariantMap joint(int number) const;
+
+        Q_INVOKABLE QVariantMap bar(int number) const;
+
+        Q_INVOKABLE bool areaModulusOption() const;
+
+        Q_INVOKABLE bool setAreaModulusOption(bool areaModulusOption);
+
+        Q_INVOKABLE int addJoint(qreal xCoordinate, qreal yCoordinate);
+
+        //Bars take a factor, or an area, modulus and unit weight when the model has the area modulus option
+        Q_INVOKABLE int addBar(int firstJoint, int secondJoint, qreal factor = 1.0);
+
+        Q_INVOKABLE int addBar(int   firstJoint,
+                               int   secondJoint,
+                               qreal area,
+                               qreal modulus,
+                               qreal unitWeight);
+
+        //Support types fixedLeft, fixedTop, fixedRight, fixedBottom, roller (inclined at angle), rollerLeft,
+        //rollerTop, rollerRight and rollerBottom
+        Q_INVOKABLE bool addSupport(int            jointNumber,
+                                    const QString &type,
+                                    qreal          angle = 0.0);
+
+        Q_INVOKABLE bool addJointLoad(int            jointNumber,
+                                      qreal          horizontalComponent,
+                                      qreal          verticalComponent,
+                                      const QString &position = QString("tail"));
+
+        //Standard truss from topology, panels, panelLength, depth, camber and rows, with section properties given
+        //for all members or for the topChord, bottomChord, verticals and diagonals groups. Returns the number of
+        //its first joint.
+        Q_INVOKABLE int generate(const QVariantMap &parameters);
+
+        Q_INVOKABLE bool check();
+
+        //Loads jointLoads, selfWeight, supportSettlements, thermalEffects and fabricationErrors as flags and
+        //influenceLoad by name, joint loads alone when none is given
+        Q_INVOKABLE bool solve(const QVariantMap &loads = QVariantMap());
+
+        Q_INVOKABLE QVariantList jointDeflections() const;
+
+        Q_INVOKABLE QVariantList barLoads() const;
+
+        Q_INVOKABLE QVariantList supportReactions() const;
+
+        Q_INVOKABLE QVariantMap statistics() const;
+
+        Q_INVOKABLE bool exportReport(const QString &directory);
+
+    private slots:
+        void renumberJoints(QVector<int> jointPositions);
+
+    private:
+        void beginEdits();
+
+        //Script numbers follow the joints of the model as they are, as after opening a file
+        void resetJointNumbers();
+
+        //Script numbers for the joints of the model from its joint number onwards, returning the first of them
+        int appendJointNumbers(int firstJointNumber);
+
+        //Joint number in the model of a script joint number, zero if there is no such joint
+        int modelJointNumber(int number) const;
+
+        //Script joint number of a position in the model, zero if the script does not know the joint
+        int scriptJointNumber(int jointIndex) const;
+
+        static bool supportTypeFromName(const QString &name, UnitsAndLimits::SupportType *type);
+
+        static void setSection(ParametricTruss              *truss,
+                               ParametricTruss::MemberGroup group,
+                               const QVariantMap            &section);
+
+        Solver *mSolver;
+        bool   mOwnsSolver;
+        bool   mIsEditing;
+
+        //Position in the model of each script joint, and script number of the joint at each position
+        QVector<int> mJointPositions;
+        QVector<int> mJointNumbers;
+
+        //Positions of the joints of the model, rebuilt after joints are added or renumbered
+        mutable ModelIndex mJointIndex;
+        mutable bool       mIsJointIndexValid;
+};
+
+#endif // MODELSCRIPT_H
@@ -46,6 +46,7 @@ ModelSolver::ModelSolver(const QList<Joint *>             &jointsList,
     mInfluenceLoadName      = influenceLoadName;
     mInfluenceLoadResult    = influenceLoadResult;
     mUnitsAndLimits         = unitsAndLimits;
+    mSolutionMethods        = ALL_METHODS;
 
     connect(this, SIGNAL(finished()), this, SLOT(deleteLater()));
 }
@@ -55,6 +56,31 @@ ModelSolver::~ModelSolver()
 
 }
 
+void ModelSolver::setSolutionMethods(int solutionMethods)
+{
+    mSolutionMethods = solutionMethods;
+}
+
+qreal ModelSolver::residualNorm(const gsl_spmatrix *k11CompressedColumnFormat,
+                                const gsl_vector   *loadsColumnVector,
+                                const gsl_vector   *deflectionsColumnVector) const
+{
+    gsl_vector *residualColumnVector = gsl_vector_alloc(loadsColumnVector->size);
+    gsl_vector_memcpy(residualColumnVector, loadsColumnVector);
+
+    gsl_spblas_dgemv(CblasNoTrans,
+                     1.0,
+                     k11CompressedColumnFormat,
+                     deflectionsColumnVector,
+                     -1.0,
+                     residualColumnVector);
+
+    qreal norm = gsl_blas_dnrm2(residualColumnVector);
+    gsl_vector_free(residualColumnVector);
+
+    return norm;
+}
+
 //void ModelSolver::printVector(const char *caption, gsl_vector *vector)
 //{
 //    fprintf(stderr, "\n%s\n", caption);
@@ -73,6 +99,8 @@ void ModelSolver::run()
     // Determine unit conversion factors
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Unit conversion"));
+
     qreal areaConversionFactor              = 1.0;
     qreal modulusConversionFactor           = 1.0;
     qreal lengthConversionFactor            = 1.0;
@@ -229,6 +257,8 @@ void ModelSolver::run()
     // Create substitute joints and bars for inclined roller supports
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Substitute bars"));
+
     qreal maxAreaModulus = 0.0;
     qreal maxFactor      = 0.0;
     Bar *maxBar          = 0;
@@ -326,16 +356,21 @@ void ModelSolver::run()
         mBarsList.append(bar);
     }
 
+    //Joint and bar positions are looked up here instead of scanning the lists for every bar and load
+    ModelIndex modelIndex(mJointsList, mBarsList);
+
     // -----------------------------------------------------------------------------------------------------------------
     // Determine fixed degrees of freedom
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Fixed degrees of freedom"));
+
     QList<int> fixedDegreesOfFreedom;
 
     foreach (Support *support, mSupportsList)
     {
         UnitsAndLimits::SupportType type = support->type();
-        int index                        = mJointsList.indexOf(support->supportJoint());
+        int index                        = modelIndex.jointIndex(support->supportJoint());
 
         switch (type)
         {
@@ -359,7 +394,7 @@ void ModelSolver::run()
                 {
                     if (bar->firstJoint() == support->supportJoint())
                     {
-                        index = mJointsList.indexOf(bar->secondJoint());
+                        index = modelIndex.jointIndex(bar->secondJoint());
                         break;
                     }
                 }
@@ -375,6 +410,8 @@ void ModelSolver::run()
     // Assemble stiffness matrices
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Assembly"));
+
     QList<int> degreesOfFreedom;
     int order = 2 * mJointsList.size();
 
@@ -408,11 +445,11 @@ void ModelSolver::run()
         qreal S      = deltaY / length;
 
         QList<int> indexList;
-        int index = mJointsList.indexOf(bar->firstJoint());
+        int index = modelIndex.jointIndex(bar->firstJoint());
         indexList.append(2 * index);
         indexList.append(2 * index + 1);
 
-        index = mJointsList.indexOf(bar->secondJoint());
+        index = modelIndex.jointIndex(bar->secondJoint());
         indexList.append(2 * index);
         indexList.append(2 * index + 1);
 
@@ -490,14 +527,52 @@ void ModelSolver::run()
     gsl_spmatrix *k21CompressedColumnFormat = gsl_spmatrix_ccs(k21TripletFormat);
     gsl_spmatrix *k22CompressedColumnFormat = gsl_spmatrix_ccs(k22TripletFormat);
 
+    mStatistics.setDegreesOfFreedom(order);
+    mStatistics.setStiffnessNonZeros(gsl_spmatrix_nnz(k11CompressedColumnFormat));
+
     gsl_spmatrix_free(k12TripletFormat);
     gsl_spmatrix_free(k21TripletFormat);
     gsl_spmatrix_free(k22TripletFormat);
 
+    // -----------------------------------------------------------------------------------------------------------------
+    // Detect mirror symmetry or condense repeated panels
+    // -----------------------------------------------------------------------------------------------------------------
+
+    mStatistics.beginPhase(tr("Factorization"));
+
+    SymmetrySolver *symmetrySolver         = 0;
+    SubstructureSolver *substructureSolver = 0;
+
+    //Inclined roller substitute bars make the stiffness matrix badly conditioned, so neither the half models nor
+    //the condensed panels are factorized without pivoting then and the matrix is left to the pivoted Cholesky path
+
+    if ((mSolutionMethods & MIRROR_SYMMETRY_METHOD) && substituteBarsList.isEmpty())
+    {
+        symmetrySolver = new SymmetrySolver(mJointsList, degreesOfFreedom, k11TripletFormat);
+    }
+
+    if ((!symmetrySolver || !symmetrySolver->isActive())
+            && (mSolutionMethods & SUBSTRUCTURE_METHOD)
+            && substituteBarsList.isEmpty())
+    {
+        substructureSolver = new SubstructureSolver(mJointsList, mBarsList, degreesOfFreedom, k11TripletFormat);
+    }
+
+    if (symmetrySolver && symmetrySolver->isActive())
+    {
+        mStatistics.setFactorNonZeros(symmetrySolver->factorNonZeros());
+    }
+    else if (substructureSolver && substructureSolver->isActive())
+    {
+        mStatistics.setFactorNonZeros(substructureSolver->factorNonZeros());
+    }
+
     // -----------------------------------------------------------------------------------------------------------------
     // Self-weight loads
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Self-weight loads"));
+
     QList<JointLoad *> additionalJointLoadsList;
 
     if (mIncludeSelfWeight)
@@ -543,9 +618,11 @@ void ModelSolver::run()
     // Initialise support reactions
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Support reactions setup"));
+
     QList<Joint *> supportJointsList;
-    QList<qreal> reactionHorizontalComponentsList;
-    QList<qreal> reactionVerticalComponentsList;
+    QVector<qreal> reactionHorizontalComponentsList;
+    QVector<qreal> reactionVerticalComponentsList;
 
     foreach (Support *support, mSupportsList)
     {
@@ -580,13 +657,15 @@ void ModelSolver::run()
     // Analysis for joint loads
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Joint loads"));
+
     gsl_vector *deflectionsColumnVectorU = gsl_vector_calloc(order);
     gsl_vector *loadsColumnVectorK       = gsl_vector_calloc(order);
 
     foreach (JointLoad *load, additionalJointLoadsList)
     {
         Joint *joint = load->loadJoint();
-        int indexA   = mJointsList.indexOf(joint);
+        int indexA   = modelIndex.jointIndex(joint);
         qreal V      = load->verticalComponent() * loadConversionFactor;
 
         if (supportJointsList.contains(joint))
@@ -646,7 +725,7 @@ void ModelSolver::run()
         foreach (JointLoad *load, mJointLoadsList)
         {
             Joint *joint = load->loadJoint();
-            int indexA   = mJointsList.indexOf(joint);
+            int indexA   = modelIndex.jointIndex(joint);
             qreal H      = load->horizontalComponent() * loadConversionFactor;
             qreal V      = load->verticalComponent() * loadConversionFactor;
 
@@ -712,7 +791,38 @@ void ModelSolver::run()
         gsl_vector_memcpy(loadsColumnVector, loadsColumnVectorK);
         gsl_vector *deflectionsColumnVector = gsl_vector_calloc(loadsColumnVector->size);
 
-        if (substituteBarsList.isEmpty())
+        QElapsedTimer solveTimer;
+        solveTimer.start();
+
+        QString solveMethod;
+        size_t solveIterations = 0;
+
+        if (symmetrySolver && symmetrySolver->isActive())
+        {
+            solveMethod = tr("Mirror symmetry");
+            status      = symmetrySolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+        else if (substructureSolver && substructureSolver->isActive())
+        {
+            solveMethod = tr("Substructures");
+            status      = substructureSolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+
+        if (status == GSL_SUCCESS)
+        {
+            size_t count = deflectionsColumnVector->size;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                qreal value = gsl_vector_get(deflectionsColumnVectorU, i);
+                value += gsl_vector_get(deflectionsColumnVector, i);
+                gsl_vector_set(deflectionsColumnVectorU, i, value);
+            }
+
+            mSolutionsCount.append(true);
+        }
+
+        if ((mSolutionMethods & GMRES_METHOD) && substituteBarsList.isEmpty() && status != GSL_SUCCESS)
         {
             size_t nZMax      = gsl_spmatrix_nnz(k11CompressedColumnFormat);
             size_t nRow       = k11CompressedColumnFormat->size1;
@@ -738,9 +848,11 @@ void ModelSolver::run()
                                                         work);
             } while (status == GSL_CONTINUE && ++count < kMaxIterations);
 
+            solveMethod     = tr("GMRES");
+            solveIterations = count;
+
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -757,8 +869,11 @@ void ModelSolver::run()
             gsl_splinalg_itersolve_free(work);
         }
 
-        if (!substituteBarsList.isEmpty() || status != GSL_SUCCESS)
+        if ((mSolutionMethods & PIVOTED_CHOLESKY_METHOD) && status != GSL_SUCCESS)
         {
+            solveMethod = tr("Pivoted Cholesky");
+            mStatistics.setFactorNonZeros(qint64(order) * (order + 1) / 2);
+
             gsl_matrix *k11Dense = gsl_matrix_calloc(k11TripletFormat->size1, k11TripletFormat->size2);
             gsl_spmatrix_sp2d(k11Dense, k11TripletFormat);
             gsl_permutation *p = gsl_permutation_alloc(k11Dense->size1);
@@ -770,7 +885,6 @@ void ModelSolver::run()
 
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 size_t count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -785,12 +899,22 @@ void ModelSolver::run()
             else
             {
                 mSolutionsCount.append(false);
-                //fprintf(stderr, "\nAnalysis for joint loads: failed to converge!\n");
             }
 
             gsl_matrix_free(k11Dense);
             gsl_permutation_free(p);
         }
+        else if (status != GSL_SUCCESS)
+        {
+            mSolutionsCount.append(false);
+        }
+
+        mStatistics.addSolve(tr("Joint loads"),
+                             solveMethod,
+                             solveIterations,
+                             residualNorm(k11CompressedColumnFormat, loadsColumnVector, deflectionsColumnVector),
+                             solveTimer.nsecsElapsed(),
+                             status == GSL_SUCCESS);
 
         gsl_vector_free(loadsColumnVector);
         gsl_vector_free(deflectionsColumnVector);
@@ -800,6 +924,8 @@ void ModelSolver::run()
     // Analysis for support settlements
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Support settlements"));
+
     gsl_vector *deflectionsColumnVectorK = gsl_vector_calloc(fixedDegreesOfFreedom.size());
 
     if (!mSupportSettlementsList.isEmpty())
@@ -807,7 +933,7 @@ void ModelSolver::run()
         foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
         {
             qreal settlement = supportSettlement->settlement() * supportSettlementConversionFactor;
-            int index        = mJointsList.indexOf(supportSettlement->settlementSupport()->supportJoint());
+            int index        = modelIndex.jointIndex(supportSettlement->settlementSupport()->supportJoint());
             gsl_vector_set(deflectionsColumnVectorK,
                            fixedDegreesOfFreedom.indexOf(2 * index + 1),
                            -settlement);
@@ -836,7 +962,38 @@ void ModelSolver::run()
 
         status = GSL_FAILURE;
 
-        if (substituteBarsList.isEmpty())
+        QElapsedTimer solveTimer;
+        solveTimer.start();
+
+        QString solveMethod;
+        size_t solveIterations = 0;
+
+        if (symmetrySolver && symmetrySolver->isActive())
+        {
+            solveMethod = tr("Mirror symmetry");
+            status      = symmetrySolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+        else if (substructureSolver && substructureSolver->isActive())
+        {
+            solveMethod = tr("Substructures");
+            status      = substructureSolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+
+        if (status == GSL_SUCCESS)
+        {
+            size_t count = deflectionsColumnVector->size;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                qreal value = gsl_vector_get(deflectionsColumnVectorU, i);
+                value += gsl_vector_get(deflectionsColumnVector, i);
+                gsl_vector_set(deflectionsColumnVectorU, i, value);
+            }
+
+            mSolutionsCount.append(true);
+        }
+
+        if ((mSolutionMethods & GMRES_METHOD) && substituteBarsList.isEmpty() && status != GSL_SUCCESS)
         {
             nZMax             = gsl_spmatrix_nnz(k11CompressedColumnFormat);
             nRow              = k11CompressedColumnFormat->size1;
@@ -862,9 +1019,11 @@ void ModelSolver::run()
                                                         work);
             } while (status == GSL_CONTINUE && ++count < kMaxIterations);
 
+            solveMethod     = tr("GMRES");
+            solveIterations = count;
+
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -881,8 +1040,11 @@ void ModelSolver::run()
             gsl_splinalg_itersolve_free(work);
         }
 
-        if (!substituteBarsList.isEmpty() || status != GSL_SUCCESS)
+        if ((mSolutionMethods & PIVOTED_CHOLESKY_METHOD) && status != GSL_SUCCESS)
         {
+            solveMethod = tr("Pivoted Cholesky");
+            mStatistics.setFactorNonZeros(qint64(order) * (order + 1) / 2);
+
             gsl_matrix *k11Dense = gsl_matrix_calloc(k11TripletFormat->size1, k11TripletFormat->size2);
             gsl_spmatrix_sp2d(k11Dense, k11TripletFormat);
             gsl_permutation *p = gsl_permutation_alloc(k11Dense->size1);
@@ -894,7 +1056,6 @@ void ModelSolver::run()
 
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 size_t count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -909,12 +1070,22 @@ void ModelSolver::run()
             else
             {
                 mSolutionsCount.append(false);
-                //fprintf(stderr, "\nAnalysis for support settlements: failed to converge!\n");
             }
 
             gsl_matrix_free(k11Dense);
             gsl_permutation_free(p);
         }
+        else if (status != GSL_SUCCESS)
+        {
+            mSolutionsCount.append(false);
+        }
+
+        mStatistics.addSolve(tr("Support settlements"),
+                             solveMethod,
+                             solveIterations,
+                             residualNorm(k11CompressedColumnFormat, loadsColumnVector, deflectionsColumnVector),
+                             solveTimer.nsecsElapsed(),
+                             status == GSL_SUCCESS);
 
         gsl_spmatrix_free(k12);
         gsl_vector_free(loadsColumnVector);
@@ -925,6 +1096,8 @@ void ModelSolver::run()
     // Analysis for thermal effects
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Thermal effects"));
+
     if (!mThermalEffectsList.isEmpty())
     {
         gsl_vector *deflectionsColumnVector = gsl_vector_calloc(order);
@@ -943,8 +1116,8 @@ void ModelSolver::run()
             qreal C      = deltaX / length;
             qreal S      = deltaY / length;
 
-            int firstJointIndex  = mJointsList.indexOf(bar->firstJoint());
-            int secondJointIndex = mJointsList.indexOf(bar->secondJoint());
+            int firstJointIndex  = modelIndex.jointIndex(bar->firstJoint());
+            int secondJointIndex = modelIndex.jointIndex(bar->secondJoint());
 
             qreal thermalEffectLoad = bar->area() * areaConversionFactor
                     * bar->modulus() * modulusConversionFactor
@@ -987,7 +1160,38 @@ void ModelSolver::run()
 
         status = GSL_FAILURE;
 
-        if (substituteBarsList.isEmpty())
+        QElapsedTimer solveTimer;
+        solveTimer.start();
+
+        QString solveMethod;
+        size_t solveIterations = 0;
+
+        if (symmetrySolver && symmetrySolver->isActive())
+        {
+            solveMethod = tr("Mirror symmetry");
+            status      = symmetrySolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+        else if (substructureSolver && substructureSolver->isActive())
+        {
+            solveMethod = tr("Substructures");
+            status      = substructureSolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+
+        if (status == GSL_SUCCESS)
+        {
+            size_t count = deflectionsColumnVector->size;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                qreal value = gsl_vector_get(deflectionsColumnVectorU, i);
+                value += gsl_vector_get(deflectionsColumnVector, i);
+                gsl_vector_set(deflectionsColumnVectorU, i, value);
+            }
+
+            mSolutionsCount.append(true);
+        }
+
+        if ((mSolutionMethods & GMRES_METHOD) && substituteBarsList.isEmpty() && status != GSL_SUCCESS)
         {
             size_t nZMax      = gsl_spmatrix_nnz(k11CompressedColumnFormat);
             size_t nRow       = k11CompressedColumnFormat->size1;
@@ -1013,9 +1217,11 @@ void ModelSolver::run()
                                                         work);
             } while (status == GSL_CONTINUE && ++count < kMaxIterations);
 
+            solveMethod     = tr("GMRES");
+            solveIterations = count;
+
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -1032,8 +1238,11 @@ void ModelSolver::run()
             gsl_splinalg_itersolve_free(work);
         }
 
-        if (!substituteBarsList.isEmpty() || status != GSL_SUCCESS)
+        if ((mSolutionMethods & PIVOTED_CHOLESKY_METHOD) && status != GSL_SUCCESS)
         {
+            solveMethod = tr("Pivoted Cholesky");
+            mStatistics.setFactorNonZeros(qint64(order) * (order + 1) / 2);
+
             gsl_matrix *k11Dense = gsl_matrix_calloc(k11TripletFormat->size1, k11TripletFormat->size2);
             gsl_spmatrix_sp2d(k11Dense, k11TripletFormat);
             gsl_permutation *p = gsl_permutation_alloc(k11Dense->size1);
@@ -1045,7 +1254,6 @@ void ModelSolver::run()
 
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 size_t count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -1060,12 +1268,22 @@ void ModelSolver::run()
             else
             {
                 mSolutionsCount.append(false);
-                //fprintf(stderr, "\nAnalysis for thermal effects: failed to converge!\n");
             }
 
             gsl_matrix_free(k11Dense);
             gsl_permutation_free(p);
         }
+        else if (status != GSL_SUCCESS)
+        {
+            mSolutionsCount.append(false);
+        }
+
+        mStatistics.addSolve(tr("Thermal effects"),
+                             solveMethod,
+                             solveIterations,
+                             residualNorm(k11CompressedColumnFormat, loadsColumnVector, deflectionsColumnVector),
+                             solveTimer.nsecsElapsed(),
+                             status == GSL_SUCCESS);
 
         gsl_vector_free(loadsColumnVector);
         gsl_vector_free(deflectionsColumnVector);
@@ -1076,6 +1294,8 @@ void ModelSolver::run()
     // Analysis for fabrication errors
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Fabrication errors"));
+
     if (!mFabricationErrorsList.isEmpty())
     {
         gsl_vector *deflectionsColumnVector = gsl_vector_calloc(order);
@@ -1094,8 +1314,8 @@ void ModelSolver::run()
             qreal C      = deltaX / length;
             qreal S      = deltaY / length;
 
-            int firstJointIndex  = mJointsList.indexOf(bar->firstJoint());
-            int secondJointIndex = mJointsList.indexOf(bar->secondJoint());
+            int firstJointIndex  = modelIndex.jointIndex(bar->firstJoint());
+            int secondJointIndex = modelIndex.jointIndex(bar->secondJoint());
 
             qreal fabricationErrorLoad = bar->area() * areaConversionFactor
                     * bar->modulus() * modulusConversionFactor
@@ -1138,7 +1358,38 @@ void ModelSolver::run()
 
         status = GSL_FAILURE;
 
-        if (substituteBarsList.isEmpty())
+        QElapsedTimer solveTimer;
+        solveTimer.start();
+
+        QString solveMethod;
+        size_t solveIterations = 0;
+
+        if (symmetrySolver && symmetrySolver->isActive())
+        {
+            solveMethod = tr("Mirror symmetry");
+            status      = symmetrySolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+        else if (substructureSolver && substructureSolver->isActive())
+        {
+            solveMethod = tr("Substructures");
+            status      = substructureSolver->solve(loadsColumnVector, deflectionsColumnVector);
+        }
+
+        if (status == GSL_SUCCESS)
+        {
+            size_t count = deflectionsColumnVector->size;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                qreal value = gsl_vector_get(deflectionsColumnVectorU, i);
+                value += gsl_vector_get(deflectionsColumnVector, i);
+                gsl_vector_set(deflectionsColumnVectorU, i, value);
+            }
+
+            mSolutionsCount.append(true);
+        }
+
+        if ((mSolutionMethods & GMRES_METHOD) && substituteBarsList.isEmpty() && status != GSL_SUCCESS)
         {
             size_t nZMax      = gsl_spmatrix_nnz(k11CompressedColumnFormat);
             size_t nRow       = k11CompressedColumnFormat->size1;
@@ -1164,9 +1415,11 @@ void ModelSolver::run()
                                                         work);
             } while (status == GSL_CONTINUE && ++count < kMaxIterations);
 
+            solveMethod     = tr("GMRES");
+            solveIterations = count;
+
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -1183,8 +1436,11 @@ void ModelSolver::run()
             gsl_splinalg_itersolve_free(work);
         }
 
-        if (!substituteBarsList.isEmpty() || status != GSL_SUCCESS)
+        if ((mSolutionMethods & PIVOTED_CHOLESKY_METHOD) && status != GSL_SUCCESS)
         {
+            solveMethod = tr("Pivoted Cholesky");
+            mStatistics.setFactorNonZeros(qint64(order) * (order + 1) / 2);
+
             gsl_matrix *k11Dense = gsl_matrix_calloc(k11TripletFormat->size1, k11TripletFormat->size2);
             gsl_spmatrix_sp2d(k11Dense, k11TripletFormat);
             gsl_permutation *p = gsl_permutation_alloc(k11Dense->size1);
@@ -1196,7 +1452,6 @@ void ModelSolver::run()
 
             if (status == GSL_SUCCESS)
             {
-                //fprintf(stderr, "\nConverged\n");
                 size_t count = deflectionsColumnVector->size;
 
                 for (size_t i = 0; i < count; ++i)
@@ -1211,12 +1466,22 @@ void ModelSolver::run()
             else
             {
                 mSolutionsCount.append(false);
-                //fprintf(stderr, "\nAnalysis for fabrication errors: failed to converge!\n");
             }
 
             gsl_matrix_free(k11Dense);
             gsl_permutation_free(p);
         }
+        else if (status != GSL_SUCCESS)
+        {
+            mSolutionsCount.append(false);
+        }
+
+        mStatistics.addSolve(tr("Fabrication errors"),
+                             solveMethod,
+                             solveIterations,
+                             residualNorm(k11CompressedColumnFormat, loadsColumnVector, deflectionsColumnVector),
+                             solveTimer.nsecsElapsed(),
+                             status == GSL_SUCCESS);
 
         gsl_vector_free(loadsColumnVector);
         gsl_vector_free(deflectionsColumnVector);
@@ -1226,6 +1491,8 @@ void ModelSolver::run()
     // Analysis for influence loads
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Influence loads"));
+
     qreal loadLimitNewton = 1.0e-2;
     qreal loadLimitPound  = 2.0e-3;
 
@@ -1242,13 +1509,25 @@ void ModelSolver::run()
             }
         }
 
-        mInfluenceLoadResult->setParameters(mBarsList.size(), influenceLoad->path().size());
+        InfluenceLoadResult::Precision precision = InfluenceLoadResult::DOUBLE_PRECISION;
+
+        if (qint64(mBarsList.size()) * influenceLoad->path().size() > kMaxDoublePrecisionOrdinates)
+        {
+            precision = InfluenceLoadResult::SINGLE_PRECISION;
+        }
+
+        mInfluenceLoadResult->setParameters(mBarsList.size(), influenceLoad->path().size(), precision);
 
         gsl_vector *deflectionsColumnVector = gsl_vector_calloc(order);
         gsl_vector *loadsColumnVector       = gsl_vector_calloc(order);
 
+        int ordinateIndex        = -1;
+        int solvedOrdinatesCount = 0;
+
         foreach (int jointNumber, influenceLoad->path())
         {
+            ++ordinateIndex;
+
             int jointIndex = jointNumber - 1;
             Joint *joint   = mJointsList.at(jointIndex);
 
@@ -1291,7 +1570,29 @@ void ModelSolver::run()
 
             status = GSL_FAILURE;
 
-            if (substituteBarsList.isEmpty())
+            QElapsedTimer solveTimer;
+            solveTimer.start();
+
+            QString solveMethod;
+            size_t solveIterations = 0;
+
+            if (symmetrySolver && symmetrySolver->isActive())
+            {
+                solveMethod = tr("Mirror symmetry");
+                status      = symmetrySolver->solve(loadsColumnVector, deflectionsColumnVector);
+            }
+            else if (substructureSolver && substructureSolver->isActive())
+            {
+                solveMethod = tr("Substructures");
+                status      = substructureSolver->solve(loadsColumnVector, deflectionsColumnVector);
+            }
+
+            if (status == GSL_SUCCESS)
+            {
+                mSolutionsCount.append(true);
+            }
+
+            if ((mSolutionMethods & GMRES_METHOD) && substituteBarsList.isEmpty() && status != GSL_SUCCESS)
             {
                 size_t nZMax      = gsl_spmatrix_nnz(k11CompressedColumnFormat);
                 size_t nRow       = k11CompressedColumnFormat->size1;
@@ -1317,9 +1618,11 @@ void ModelSolver::run()
                                                             work);
                 } while (status == GSL_CONTINUE && ++count < kMaxIterations);
 
+                solveMethod     = tr("GMRES");
+                solveIterations = count;
+
                 if (status == GSL_SUCCESS)
                 {
-                    //fprintf(stderr, "\nConverged\n");
                     mSolutionsCount.append(true);
                 }
 
@@ -1327,8 +1630,11 @@ void ModelSolver::run()
                 gsl_splinalg_itersolve_free(work);
             }
 
-            if (!substituteBarsList.isEmpty() || status != GSL_SUCCESS)
+            if ((mSolutionMethods & PIVOTED_CHOLESKY_METHOD) && status != GSL_SUCCESS)
             {
+                solveMethod = tr("Pivoted Cholesky");
+                mStatistics.setFactorNonZeros(qint64(order) * (order + 1) / 2);
+
                 gsl_matrix *k11Dense = gsl_matrix_calloc(k11TripletFormat->size1, k11TripletFormat->size2);
                 gsl_spmatrix_sp2d(k11Dense, k11TripletFormat);
                 gsl_permutation *p = gsl_permutation_alloc(k11Dense->size1);
@@ -1340,18 +1646,34 @@ void ModelSolver::run()
 
                 if (status == GSL_SUCCESS)
                 {
-                    //fprintf(stderr, "\nConverged\n");
                     mSolutionsCount.append(true);
                 }
                 else
                 {
                     mSolutionsCount.append(false);
-                    //fprintf(stderr, "\nAnalysis for influence loads: failed to converge!\n");
                 }
 
                 gsl_matrix_free(k11Dense);
                 gsl_permutation_free(p);
             }
+            else if (status != GSL_SUCCESS)
+            {
+                mSolutionsCount.append(false);
+            }
+
+            qreal solveResidualNorm = -1.0;
+
+            if (ordinateIndex % kResidualSampleInterval == 0)
+            {
+                solveResidualNorm = residualNorm(k11CompressedColumnFormat, loadsColumnVector, deflectionsColumnVector);
+            }
+
+            mStatistics.addSolve(tr("Influence loads"),
+                                 solveMethod,
+                                 solveIterations,
+                                 solveResidualNorm,
+                                 solveTimer.nsecsElapsed(),
+                                 status == GSL_SUCCESS);
 
             if (status != GSL_SUCCESS)
             {
@@ -1389,8 +1711,8 @@ void ModelSolver::run()
                 gsl_matrix_set(rowMatrix, 0, 2,  C);
                 gsl_matrix_set(rowMatrix, 0, 3,  S);
 
-                int firstJointIndex  = mJointsList.indexOf(bar->firstJoint());
-                int secondJointIndex = mJointsList.indexOf(bar->secondJoint());
+                int firstJointIndex  = modelIndex.jointIndex(bar->firstJoint());
+                int secondJointIndex = modelIndex.jointIndex(bar->secondJoint());
                 int indexA           = 2 * firstJointIndex;
                 int indexB           = indexA + 1;
                 int indexC           = 2 * secondJointIndex;
@@ -1452,14 +1774,16 @@ void ModelSolver::run()
                     barLoad = 0.0;
                 }
 
-                int barIndex = mBarsList.indexOf(bar);
-                mInfluenceLoadResult->appendInfluenceLoadOrdinatesListValue(barIndex, barLoad);
+                int barIndex = modelIndex.barIndex(bar);
+                mInfluenceLoadResult->setOrdinate(barIndex, ordinateIndex, barLoad);
             }
 
             gsl_matrix_free(rowMatrix);
             gsl_vector_free(columnVector);
             gsl_vector_free(product);
 
+            mInfluenceLoadResult->setSolvedOrdinatesCount(++solvedOrdinatesCount);
+
             gsl_vector_set_zero(deflectionsColumnVector);
             gsl_vector_set_zero(loadsColumnVector);
         }
@@ -1467,18 +1791,18 @@ void ModelSolver::run()
         gsl_vector_free(deflectionsColumnVector);
         gsl_vector_free(loadsColumnVector);
 
-        if (mInfluenceLoadResult->influenceLoadOrdinatesList(0).size() == influenceLoad->path().size())
+        if (mInfluenceLoadResult->isComplete())
         {
             foreach (Bar *bar, mBarsList)
             {
-                int barIndex               = mBarsList.indexOf(bar);
+                int barIndex               = modelIndex.barIndex(bar);
                 int maxOrdinateJointNumber = 1;
                 int minOrdinateJointNumber = 1;
                 qreal maxOrdinate          = 0.0;
                 qreal minOrdinate          = 0.0;
 
-                QList<qreal> ordinatesList = mInfluenceLoadResult->influenceLoadOrdinatesList(barIndex);
-                int count                  = ordinatesList.size();
+                InfluenceLoadOrdinatesSpan ordinatesList = mInfluenceLoadResult->barOrdinates(barIndex);
+                int count                                = ordinatesList.size();
 
                 for (int i = 0; i < count; ++i)
                 {
@@ -1666,8 +1990,12 @@ void ModelSolver::run()
     // Deflections
     // -----------------------------------------------------------------------------------------------------------------
 
-    QList<qreal> horizontalDeflectionComponentsList;
-    QList<qreal> verticalDeflectionComponentsList;
+    mStatistics.beginPhase(tr("Deflections recovery"));
+
+    QVector<qreal> horizontalDeflectionComponentsList;
+    QVector<qreal> verticalDeflectionComponentsList;
+    horizontalDeflectionComponentsList.reserve(mJointsList.size());
+    verticalDeflectionComponentsList.reserve(mJointsList.size());
 
     foreach (Joint *joint, mJointsList)
     {
@@ -1676,7 +2004,7 @@ void ModelSolver::run()
             continue;
         }
 
-        int index = mJointsList.indexOf(joint);
+        int index = modelIndex.jointIndex(joint);
 
         qreal horizontalDeflection = 0.0;
         qreal verticalDeflection   = 0.0;
@@ -1708,7 +2036,10 @@ void ModelSolver::run()
     // Bar loads
     // -----------------------------------------------------------------------------------------------------------------
 
-    QList<qreal> barLoadsList;
+    mStatistics.beginPhase(tr("Bar forces recovery"));
+
+    QVector<qreal> barLoadsList;
+    barLoadsList.reserve(mBarsList.size());
 
     foreach (Bar *bar, mBarsList)
     {
@@ -1785,8 +2116,8 @@ void ModelSolver::run()
         gsl_matrix_set(rowMatrix, 0, 3,  S);
 
         gsl_vector *columnVector = gsl_vector_calloc(4);
-        int firstJointIndex      = mJointsList.indexOf(bar->firstJoint());
-        int secondJointIndex     = mJointsList.indexOf(bar->secondJoint());
+        int firstJointIndex      = modelIndex.jointIndex(bar->firstJoint());
+        int secondJointIndex     = modelIndex.jointIndex(bar->secondJoint());
         int indexA               = 2 * firstJointIndex;
         int indexB               = indexA + 1;
         int indexC               = 2 * secondJointIndex;
@@ -1808,7 +2139,7 @@ void ModelSolver::run()
             foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
             {
                 Joint *joint = supportSettlement->settlementSupport()->supportJoint();
-                int index    = 2 * mJointsList.indexOf(joint) + 1;
+                int index    = 2 * modelIndex.jointIndex(joint) + 1;
 
                 if (index == indexB)
                 {
@@ -1835,7 +2166,7 @@ void ModelSolver::run()
             foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
             {
                 Joint *joint = supportSettlement->settlementSupport()->supportJoint();
-                int index    = 2 * mJointsList.indexOf(joint) + 1;
+                int index    = 2 * modelIndex.jointIndex(joint) + 1;
 
                 if (index == indexD)
                 {
@@ -1905,6 +2236,8 @@ void ModelSolver::run()
     // Support reactions
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Support reactions recovery"));
+
     gsl_vector *loadsColumnVectorU = gsl_vector_calloc(fixedDegreesOfFreedom.size());
 
     size_t nZMax      = gsl_spmatrix_nnz(k21CompressedColumnFormat);
@@ -1985,8 +2318,8 @@ void ModelSolver::run()
             qreal C      = deltaX / length;
             qreal S      = deltaY / length;
 
-            int firstJointIndex  = mJointsList.indexOf(bar->firstJoint());
-            int secondJointIndex = mJointsList.indexOf(bar->secondJoint());
+            int firstJointIndex  = modelIndex.jointIndex(bar->firstJoint());
+            int secondJointIndex = modelIndex.jointIndex(bar->secondJoint());
 
             qreal thermalEffectLoad = bar->area() * areaConversionFactor
                     * bar->modulus() * modulusConversionFactor
@@ -2047,8 +2380,8 @@ void ModelSolver::run()
             qreal C      = deltaX / length;
             qreal S      = deltaY / length;
 
-            int firstJointIndex  = mJointsList.indexOf(bar->firstJoint());
-            int secondJointIndex = mJointsList.indexOf(bar->secondJoint());
+            int firstJointIndex  = modelIndex.jointIndex(bar->firstJoint());
+            int secondJointIndex = modelIndex.jointIndex(bar->secondJoint());
 
             qreal fabricationErrorLoad = bar->area() * areaConversionFactor
                     * bar->modulus() * modulusConversionFactor
@@ -2110,7 +2443,7 @@ void ModelSolver::run()
             }
 
             Joint *joint = supportSubstituteBar->secondJoint();
-            indexA       = mJointsList.indexOf(joint);
+            indexA       = modelIndex.jointIndex(joint);
             indexB       = supportJointsList.indexOf(joint);
 
             if (fixedDegreesOfFreedom.contains(2 * indexA))
@@ -2128,7 +2461,7 @@ void ModelSolver::run()
         else
         {
             Joint *joint = support->supportJoint();
-            indexA       = mJointsList.indexOf(joint);
+            indexA       = modelIndex.jointIndex(joint);
             indexB       = supportJointsList.indexOf(joint);
 
             if (fixedDegreesOfFreedom.contains(2 * indexA))
@@ -2149,6 +2482,8 @@ void ModelSolver::run()
     // Statical checks
     // -----------------------------------------------------------------------------------------------------------------
 
+    mStatistics.beginPhase(tr("Statics checks"));
+
     qreal horizontalComponentsSum = 0.0;
     qreal verticalComponentsSum   = 0.0;
     qreal momentsSum              = 0.0;
@@ -2217,8 +2552,8 @@ void ModelSolver::run()
             .arg(QString::number(verticalComponentsSum, 'g', 6))
             .arg(QString::number(momentsSum, 'g', 6));
 
-    QList<qreal> horizontalComponentsList;
-    QList<qreal> verticalComponentsList;
+    QVector<qreal> horizontalComponentsList;
+    QVector<qreal> verticalComponentsList;
 
     count = reactionHorizontalComponentsList.size();
 
@@ -2275,15 +2610,43 @@ void ModelSolver::run()
 
     if (!mSolutionsCount.contains(false))
     {
+        QSharedPointer<const SolutionResult> solutionResult;
+
         if (check)
         {
-            emit jointHorizontalDeflectionsSignal(horizontalDeflectionComponentsList);
-            emit jointVerticalDeflectionsSignal(verticalDeflectionComponentsList);
-            emit barLoadsSignal(barLoadsList);
-            emit reactionHorizontalComponentsSignal(reactionHorizontalComponentsList);
-            emit reactionVerticalComponentsSignal(reactionVerticalComponentsList);
+            QVector<int> reactionJointNumbers;
+            reactionJointNumbers.reserve(mSupportsList.size());
+
+            foreach (Support *support, mSupportsList)
+            {
+                reactionJointNumbers.append(modelIndex.jointIndex(support->supportJoint()) + 1);
+            }
+
+            solutionResult = QSharedPointer<const SolutionResult>(new SolutionResult(horizontalDeflectionComponentsList,
+                                                                                     verticalDeflectionComponentsList,
+                                                                                     barLoadsList,
+                                                                                     reactionHorizontalComponentsList,
+                                                                                     reactionVerticalComponentsList,
+                                                                                     reactionJointNumbers,
+                                                                                     mInfluenceLoadName,
+                                                                                     mAreaModulusOption,
+                                                                                     note));
+        }
+        else
+        {
+            solutionResult = QSharedPointer<const SolutionResult>(new SolutionResult(QVector<qreal>(),
+                                                                                     QVector<qreal>(),
+                                                                                     QVector<qreal>(),
+                                                                                     QVector<qreal>(),
+                                                                                     QVector<qreal>(),
+                                                                                     QVector<int>(),
+                                                                                     mInfluenceLoadName,
+                                                                                     mAreaModulusOption,
+                                                                                     note));
         }
 
+        //All result arrays are published together in a single hand-off
+        emit solutionSignal(solutionResult);
         emit notesSignal(note);
         emit hasSolution();
     }
@@ -2294,6 +2657,10 @@ void ModelSolver::run()
         emit notesSignal(note);
     }
 
+    mStatistics.endPhase();
+    mStatistics.setPeakMemory(SolverStatistics::peakResidentMemory());
+    emit statisticsSignal(mStatistics);
+
     // -----------------------------------------------------------------------------------------------------------------
     // Free resources
     // -----------------------------------------------------------------------------------------------------------------
@@ -2313,6 +2680,9 @@ void ModelSolver::run()
         delete load;
     }
 
+    delete symmetrySolver;
+    delete substructureSolver;
+
     gsl_spmatrix_free(k11CompressedColumnFormat);
     gsl_spmatrix_free(k12CompressedColumnFormat);
     gsl_spmatrix_free(k21CompressedColumnFormat);
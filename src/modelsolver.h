@@ -21,8 +21,11 @@
 
 #include <cmath>
 
+#include <QElapsedTimer>
 #include <QMessageBox>
+#include <QSharedPointer>
 #include <QThread>
+#include <QVector>
 #include <QtMath>
 
 #include <gsl/gsl_blas.h>
@@ -39,8 +42,13 @@
 #include "influenceloadresult.h"
 #include "joint.h"
 #include "jointload.h"
+#include "modelindex.h"
+#include "solutionresult.h"
+#include "solverstatistics.h"
+#include "substructuresolver.h"
 #include "support.h"
 #include "supportsettlement.h"
+#include "symmetrysolver.h"
 #include "thermaleffect.h"
 #include "unitsandlimits.h"
 
@@ -66,10 +74,28 @@ class ModelSolver : public QThread
 
         ~ModelSolver();
 
+        //Solution paths tried in this order for each load case, all enabled by default
+        enum SolutionMethod
+        {
+            MIRROR_SYMMETRY_METHOD   = 0x1,
+            SUBSTRUCTURE_METHOD      = 0x2,
+            GMRES_METHOD             = 0x4,
+            PIVOTED_CHOLESKY_METHOD  = 0x8,
+            ALL_METHODS              = 0xF
+        };
+
+        void setSolutionMethods(int solutionMethods);
+
         static const qreal kBigFactor      = 1.0e+5;
         static const qreal kTolerance      = 1.0e-14;
         static const size_t kMaxIterations = 1000;
 
+        //Influence ordinates beyond this count (bars x path joints) are stored in single precision
+        static const qint64 kMaxDoublePrecisionOrdinates = 4000000;
+
+        //Only every this many influence ordinates has its residual computed, one sparse product per sample
+        static const int kResidualSampleInterval = 64;
+
 //        void printVector(const char *caption, gsl_vector *vector);
 
     protected:
@@ -77,14 +103,16 @@ class ModelSolver : public QThread
 
     signals:
         void hasSolution();
-        void jointHorizontalDeflectionsSignal(QList<qreal> horizontalDeflectionComponentsList);
-        void jointVerticalDeflectionsSignal(QList<qreal> verticalDeflectionComponentsList);
-        void barLoadsSignal(QList<qreal> barLoadsList);
-        void reactionHorizontalComponentsSignal(QList<qreal> reactionHorizontalComponentsList);
-        void reactionVerticalComponentsSignal(QList<qreal> reactionVerticalComponentsList);
+        void solutionSignal(QSharedPointer<const SolutionResult> solutionResult);
         void notesSignal(QString note);
+        void statisticsSignal(SolverStatistics statistics);
 
     private:
+        //Euclidean norm of K11 u - f for one solved load vector
+        qreal residualNorm(const gsl_spmatrix *k11CompressedColumnFormat,
+                           const gsl_vector   *loadsColumnVector,
+                           const gsl_vector   *deflectionsColumnVector) const;
+
         QList<Joint *>             mJointsList;
         QList<Bar *>               mBarsList;
         QList<Support *>           mSupportsList;
@@ -99,6 +127,8 @@ class ModelSolver : public QThread
         InfluenceLoadResult        *mInfluenceLoadResult;
         UnitsAndLimits             mUnitsAndLimits;
         QList<bool>                mSolutionsCount;
+        SolverStatistics           mStatistics;
+        int                        mSolutionMethods;
 };
 
 #endif // MODELSOLVER_H
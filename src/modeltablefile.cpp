@@ -0,0 +1,1382 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeltablefile.cpp */
+
+#include "modeltablefile.h"
+
+bool ModelTableFile::isInputTable(Table table)
+{
+    return (table < JOINT_DEFLECTIONS);
+}
+
+QString ModelTableFile::tableName(Table table)
+{
+    switch (table)
+    {
+        case JOINTS:
+            return QString("joints");
+        case BARS:
+            return QString("bars");
+        case SUPPORTS:
+            return QString("supports");
+        case JOINT_LOADS:
+            return QString("jointloads");
+        case SUPPORT_SETTLEMENTS:
+            return QString("supportsettlements");
+        case THERMAL_EFFECTS:
+            return QString("thermaleffects");
+        case FABRICATION_ERRORS:
+            return QString("fabricationerrors");
+        case INFLUENCE_LOADS:
+            return QString("influenceloads");
+        case JOINT_DEFLECTIONS:
+            return QString("jointdeflections");
+        case BAR_LOADS:
+            return QString("barloads");
+        case SUPPORT_REACTIONS:
+            return QString("supportreactions");
+        default:
+            return QString();
+    }
+}
+
+QString ModelTableFile::fileSuffix(Format format)
+{
+    if (format == JSON_LINES)
+    {
+        return QString("jsonl");
+    }
+    else
+    {
+        return QString("csv");
+    }
+}
+
+int ModelTableFile::rowsCount(const ModelFile &modelFile, Table table)
+{
+    foreach (const Column &column, columns(table))
+    {
+        if ((column.type == REAL_LIST_COLUMN) || (column.type == INTEGER_LIST_COLUMN))
+        {
+            return modelFile.count(column.sizesSection);
+        }
+        else if (column.type != ROW_NUMBER_COLUMN)
+        {
+            return modelFile.count(column.section);
+        }
+    }
+
+    return 0;
+}
+
+bool ModelTableFile::write(const ModelFile &modelFile, Table table, Format format, QIODevice *device)
+{
+    QVector<Column> tableColumns = columns(table);
+    int columnsCount             = tableColumns.size();
+    int rowsCount                = ModelTableFile::rowsCount(modelFile, table);
+
+    //Columns decoded once, with the start of the next list of each list column
+
+    QVector<QVector<qreal> > reals(columnsCount);
+    QVector<QVector<qint32> > integers(columnsCount);
+    QVector<QStringList> texts(columnsCount);
+    QVector<QVector<qint32> > sizes(columnsCount);
+    QVector<int> offsets(columnsCount, 0);
+
+    for (int i = 0; i < columnsCount; ++i)
+    {
+        const Column &column = tableColumns.at(i);
+
+        switch (column.type)
+        {
+            case REAL_COLUMN:
+                reals[i] = modelFile.reals(column.section);
+                reals[i].resize(rowsCount);
+                break;
+            case INTEGER_COLUMN:
+                integers[i] = modelFile.integers(column.section);
+                integers[i].resize(rowsCount);
+                break;
+            case TEXT_COLUMN:
+                texts[i] = modelFile.texts(column.section);
+
+                while (texts.at(i).size() < rowsCount)
+                {
+                    texts[i].append(QString());
+                }
+
+                break;
+            case REAL_LIST_COLUMN:
+                reals[i] = modelFile.reals(column.section);
+                sizes[i] = modelFile.integers(column.sizesSection);
+                break;
+            case INTEGER_LIST_COLUMN:
+                integers[i] = modelFile.integers(column.section);
+                sizes[i]    = modelFile.integers(column.sizesSection);
+                break;
+            default:
+                break;
+        }
+    }
+
+    QByteArray chunk;
+    chunk.reserve(kBufferSize + 1024);
+
+    if (format == CSV)
+    {
+        for (int i = 0; i < columnsCount; ++i)
+        {
+            if (i > 0)
+            {
+                chunk.append(',');
+            }
+
+            chunk.append(tableColumns.at(i).name);
+        }
+
+        chunk.append('\n');
+    }
+
+    for (int row = 0; row < rowsCount; ++row)
+    {
+        if (format == JSON_LINES)
+        {
+            chunk.append('{');
+        }
+
+        for (int i = 0; i < columnsCount; ++i)
+        {
+            const Column &column = tableColumns.at(i);
+
+            if (i > 0)
+            {
+                chunk.append(',');
+            }
+
+            if (format == JSON_LINES)
+            {
+                chunk.append('"');
+                chunk.append(column.name);
+                chunk.append("\":");
+            }
+
+            switch (column.type)
+            {
+                case REAL_COLUMN:
+                    appendReal(chunk, reals.at(i).at(row));
+                    break;
+                case INTEGER_COLUMN:
+                    appendInteger(chunk, integers.at(i).at(row));
+                    break;
+                case TEXT_COLUMN:
+                    appendText(chunk, texts.at(i).at(row), format);
+                    break;
+                case REAL_LIST_COLUMN:
+                case INTEGER_LIST_COLUMN:
+                {
+                    int size       = qMax(0, sizes.at(i).value(row));
+                    char separator = (format == CSV) ? ';' : ',';
+
+                    if (format == JSON_LINES)
+                    {
+                        chunk.append('[');
+                    }
+
+                    for (int j = 0; j < size; ++j)
+                    {
+                        if (j > 0)
+                        {
+                            chunk.append(separator);
+                        }
+
+                        if (column.type == REAL_LIST_COLUMN)
+                        {
+                            appendReal(chunk, reals.at(i).value(offsets.at(i) + j));
+                        }
+                        else
+                        {
+                            appendInteger(chunk, integers.at(i).value(offsets.at(i) + j));
+                        }
+                    }
+
+                    if (format == JSON_LINES)
+                    {
+                        chunk.append(']');
+                    }
+
+                    offsets[i] += size;
+                    break;
+                }
+                case ROW_NUMBER_COLUMN:
+                    appendInteger(chunk, row + 1);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        if (format == JSON_LINES)
+        {
+            chunk.append('}');
+        }
+
+        chunk.append('\n');
+
+        if (chunk.size() >= kBufferSize)
+        {
+            if (device->write(chunk) != chunk.size())
+            {
+                return false;
+            }
+
+            chunk.resize(0);
+        }
+    }
+
+    return (device->write(chunk) == chunk.size());
+}
+
+bool ModelTableFile::read(QIODevice  *device,
+                          Format     format,
+                          ModelFile  *modelFile,
+                          Table      *table,
+                          QString    *errorMessage)
+{
+    LineReader reader(device);
+    const char *begin = 0;
+    const char *end   = 0;
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // The header of a CSV file, or the first row of a JSON Lines file, names the columns and tells the table
+    // -----------------------------------------------------------------------------------------------------------------
+
+    bool hasLine = false;
+
+    while (!hasLine && reader.readLine(&begin, &end))
+    {
+        if ((reader.lineNumber() == 1) && (end - begin >= 3) && (std::memcmp(begin, "\xEF\xBB\xBF", 3) == 0))
+        {
+            begin += 3;
+        }
+
+        hasLine = (trimmedBegin(begin, end) < end);
+    }
+
+    if (!hasLine)
+    {
+        *errorMessage = QString("The file has no table.");
+        return false;
+    }
+
+    QList<QByteArray> names;
+    QVector<Field> fields;
+    fields.reserve(64);
+
+    if (format == CSV)
+    {
+        if (!splitCsvLine(begin, end, fields))
+        {
+            *errorMessage = QString("Line %1: the header is not valid CSV.").arg(reader.lineNumber());
+            return false;
+        }
+
+        foreach (const Field &field, fields)
+        {
+            names.append(decodeText(field, format).toUtf8());
+        }
+    }
+    else
+    {
+        if (!splitJsonLine(begin, end, QVector<Column>(), fields, &names))
+        {
+            *errorMessage = QString("Line %1: the row is not a flat JSON object.").arg(reader.lineNumber());
+            return false;
+        }
+    }
+
+    int tableIndex = -1;
+
+    for (int i = 0; (i < JOINT_DEFLECTIONS) && (tableIndex < 0); ++i)
+    {
+        bool hasRequiredColumns = true;
+
+        foreach (const Column &column, columns(Table(i)))
+        {
+            if (column.isRequired && !names.contains(QByteArray(column.name)))
+            {
+                hasRequiredColumns = false;
+            }
+        }
+
+        if (hasRequiredColumns)
+        {
+            tableIndex = i;
+        }
+    }
+
+    if (tableIndex < 0)
+    {
+        *errorMessage = QString("Line %1: the columns are not those of a model table.").arg(reader.lineNumber());
+        return false;
+    }
+
+    *table = Table(tableIndex);
+
+    QVector<Column> tableColumns = columns(*table);
+    int columnsCount             = tableColumns.size();
+
+    QVector<int> positions(columnsCount, -1);
+
+    for (int i = 0; i < columnsCount; ++i)
+    {
+        positions[i] = names.indexOf(QByteArray(tableColumns.at(i).name));
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Rows, with missing optional columns read as zero
+    // -----------------------------------------------------------------------------------------------------------------
+
+    QVector<QVector<qreal> > reals(columnsCount);
+    QVector<QVector<qint32> > integers(columnsCount);
+    QVector<QStringList> texts(columnsCount);
+    QVector<QVector<qint32> > sizes(columnsCount);
+
+    bool isFirstRow = (format == JSON_LINES);
+
+    forever
+    {
+        if (!isFirstRow)
+        {
+            if (!reader.readLine(&begin, &end))
+            {
+                break;
+            }
+
+            if (trimmedBegin(begin, end) == end)
+            {
+                continue;
+            }
+
+            bool isSplit;
+
+            if (format == CSV)
+            {
+                isSplit = splitCsvLine(begin, end, fields);
+            }
+            else
+            {
+                isSplit = splitJsonLine(begin, end, tableColumns, fields);
+            }
+
+            if (!isSplit)
+            {
+                *errorMessage = QString("Line %1: the row is not valid.").arg(reader.lineNumber());
+                return false;
+            }
+        }
+        else
+        {
+            splitJsonLine(begin, end, tableColumns, fields);
+            isFirstRow = false;
+        }
+
+        for (int i = 0; i < columnsCount; ++i)
+        {
+            const Column &column = tableColumns.at(i);
+            const Field *field   = 0;
+
+            if (format == CSV)
+            {
+                if ((positions.at(i) >= 0) && (positions.at(i) < fields.size()))
+                {
+                    field = &fields.at(positions.at(i));
+                }
+
+                //An empty unquoted field is a missing value
+
+                if ((field != 0) && !field->isQuoted && (trimmedBegin(field->begin, field->end) == field->end))
+                {
+                    field = 0;
+                }
+            }
+            else if (fields.at(i).isPresent)
+            {
+                field = &fields.at(i);
+            }
+
+            if ((field == 0) && column.isRequired)
+            {
+                *errorMessage = QString("Line %1: %2 is missing.").arg(reader.lineNumber()).arg(column.name);
+                return false;
+            }
+
+            bool isValid = true;
+
+            switch (column.type)
+            {
+                case REAL_COLUMN:
+                {
+                    qreal value = 0.0;
+
+                    if (field != 0)
+                    {
+                        isValid = parseReal(field->begin, field->end, &value);
+                    }
+
+                    reals[i].append(value);
+                    break;
+                }
+                case INTEGER_COLUMN:
+                {
+                    qint32 value = 0;
+
+                    if (field != 0)
+                    {
+                        isValid = parseInteger(field->begin, field->end, &value);
+                    }
+
+                    integers[i].append(value);
+                    break;
+                }
+                case TEXT_COLUMN:
+                    texts[i].append((field != 0) ? decodeText(*field, format) : QString());
+                    break;
+                case REAL_LIST_COLUMN:
+                case INTEGER_LIST_COLUMN:
+                {
+                    qint32 size = 0;
+
+                    if ((field != 0) && (trimmedBegin(field->begin, field->end) < field->end))
+                    {
+                        char separator      = (format == CSV) ? ';' : ',';
+                        const char *element = field->begin;
+
+                        while (isValid)
+                        {
+                            const char *next = static_cast<const char *>(std::memchr(element,
+                                                                                      separator,
+                                                                                      field->end - element));
+                            const char *elementEnd = (next != 0) ? next : field->end;
+
+                            if (column.type == REAL_LIST_COLUMN)
+                            {
+                                qreal value;
+                                isValid = parseReal(element, elementEnd, &value);
+                                reals[i].append(value);
+                            }
+                            else
+                            {
+                                qint32 value;
+                                isValid = parseInteger(element, elementEnd, &value);
+                                integers[i].append(value);
+                            }
+
+                            ++size;
+
+                            if (next == 0)
+                            {
+                                break;
+                            }
+
+                            element = next + 1;
+                        }
+                    }
+
+                    sizes[i].append(size);
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            if (!isValid)
+            {
+                *errorMessage = QString("Line %1: %2 is not a number.").arg(reader.lineNumber()).arg(column.name);
+                return false;
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Sections, with list columns that share a sizes section checked to agree row by row
+    // -----------------------------------------------------------------------------------------------------------------
+
+    QHash<int, int> sizesColumns;
+
+    for (int i = 0; i < columnsCount; ++i)
+    {
+        const Column &column = tableColumns.at(i);
+
+        switch (column.type)
+        {
+            case REAL_COLUMN:
+            case REAL_LIST_COLUMN:
+                modelFile->setReals(column.section, reals.at(i));
+                break;
+            case INTEGER_COLUMN:
+            case INTEGER_LIST_COLUMN:
+                modelFile->setIntegers(column.section, integers.at(i));
+                break;
+            case TEXT_COLUMN:
+                modelFile->setTexts(column.section, texts.at(i));
+                break;
+            default:
+                break;
+        }
+
+        if ((column.type != REAL_LIST_COLUMN) && (column.type != INTEGER_LIST_COLUMN))
+        {
+            continue;
+        }
+
+        if (sizesColumns.contains(column.sizesSection))
+        {
+            const QVector<qint32> &otherSizes = sizes.at(sizesColumns.value(column.sizesSection));
+
+            for (int row = 0; row < otherSizes.size(); ++row)
+            {
+                if (otherSizes.at(row) != sizes.at(i).at(row))
+                {
+                    QString s1 = tableColumns.at(sizesColumns.value(column.sizesSection)).name;
+                    QString s2 = column.name;
+                    *errorMessage = QString("Row %1: %2 and %3 differ in length.").arg(row + 1).arg(s1).arg(s2);
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            sizesColumns.insert(column.sizesSection, i);
+            modelFile->setIntegers(column.sizesSection, sizes.at(i));
+        }
+    }
+
+    return true;
+}
+
+ModelTableFile::LineReader::LineReader(QIODevice *device)
+{
+    mDevice     = device;
+    mStart      = 0;
+    mEnd        = 0;
+    mLineNumber = 0;
+    mIsAtEnd    = false;
+
+    mBuffer.resize(kBufferSize);
+}
+
+bool ModelTableFile::LineReader::readLine(const char **begin, const char **end)
+{
+    forever
+    {
+        const char *data    = mBuffer.constData();
+        const char *newline = static_cast<const char *>(std::memchr(data + mStart, '\n', mEnd - mStart));
+
+        if ((newline != 0) || (mIsAtEnd && (mStart < mEnd)))
+        {
+            *begin = data + mStart;
+            *end   = (newline != 0) ? newline : data + mEnd;
+            mStart = int(*end - data) + ((newline != 0) ? 1 : 0);
+
+            if ((*end > *begin) && (*(*end - 1) == '\r'))
+            {
+                --*end;
+            }
+
+            ++mLineNumber;
+            return true;
+        }
+
+        if (mIsAtEnd)
+        {
+            return false;
+        }
+
+        //The start of a line that runs past the read is moved to the front, and a line longer than the buffer
+        //grows it
+
+        int remainder = mEnd - mStart;
+
+        if (mStart > 0)
+        {
+            std::memmove(mBuffer.data(), data + mStart, remainder);
+        }
+
+        mStart = 0;
+        mEnd   = remainder;
+
+        if (mEnd == mBuffer.size())
+        {
+            mBuffer.resize(2 * mBuffer.size());
+        }
+
+        qint64 count = mDevice->read(mBuffer.data() + mEnd, mBuffer.size() - mEnd);
+
+        if (count > 0)
+        {
+            mEnd += int(count);
+        }
+        else
+        {
+            mIsAtEnd = true;
+        }
+    }
+}
+
+qint64 ModelTableFile::LineReader::lineNumber() const
+{
+    return mLineNumber;
+}
+
+QVector<ModelTableFile::Column> ModelTableFile::columns(Table table)
+{
+    const ModelFile::Section none = ModelFile::Section(0);
+
+    QVector<Column> columns;
+
+    switch (table)
+    {
+        case JOINTS:
+        {
+            Column x = {"x", REAL_COLUMN, ModelFile::JOINT_X_COORDINATES, none, true};
+            Column y = {"y", REAL_COLUMN, ModelFile::JOINT_Y_COORDINATES, none, true};
+            columns << x << y;
+            break;
+        }
+        case BARS:
+        {
+            Column first      = {"first", INTEGER_COLUMN, ModelFile::BAR_FIRST_JOINTS, none, true};
+            Column second     = {"second", INTEGER_COLUMN, ModelFile::BAR_SECOND_JOINTS, none, true};
+            Column area       = {"area", REAL_COLUMN, ModelFile::BAR_AREAS, none, false};
+            Column modulus    = {"modulus", REAL_COLUMN, ModelFile::BAR_MODULI, none, false};
+            Column factor     = {"factor", REAL_COLUMN, ModelFile::BAR_FACTORS, none, false};
+            Column unitWeight = {"unitWeight", REAL_COLUMN, ModelFile::BAR_UNIT_WEIGHTS, none, false};
+            columns << first << second << area << modulus << factor << unitWeight;
+            break;
+        }
+        case SUPPORTS:
+        {
+            Column joint = {"joint", INTEGER_COLUMN, ModelFile::SUPPORT_JOINTS, none, true};
+            Column type  = {"type", INTEGER_COLUMN, ModelFile::SUPPORT_TYPES, none, true};
+            Column angle = {"angle", REAL_COLUMN, ModelFile::SUPPORT_ANGLES, none, false};
+            columns << joint << type << angle;
+            break;
+        }
+        case JOINT_LOADS:
+        {
+            Column joint      = {"joint", INTEGER_COLUMN, ModelFile::JOINT_LOAD_JOINTS, none, true};
+            Column horizontal = {"horizontal", REAL_COLUMN, ModelFile::JOINT_LOAD_HORIZONTAL_COMPONENTS, none, true};
+            Column vertical   = {"vertical", REAL_COLUMN, ModelFile::JOINT_LOAD_VERTICAL_COMPONENTS, none, true};
+            Column position   = {"position", TEXT_COLUMN, ModelFile::JOINT_LOAD_POSITIONS, none, true};
+            columns << joint << horizontal << vertical << position;
+            break;
+        }
+        case SUPPORT_SETTLEMENTS:
+        {
+            Column support    = {"support", INTEGER_COLUMN, ModelFile::SETTLEMENT_SUPPORTS, none, true};
+            Column settlement = {"settlement", REAL_COLUMN, ModelFile::SETTLEMENTS, none, true};
+            columns << support << settlement;
+            break;
+        }
+        case THERMAL_EFFECTS:
+        {
+            Column bar         = {"bar", INTEGER_COLUMN, ModelFile::THERMAL_EFFECT_BARS, none, true};
+            Column change      = {"temperatureChange", REAL_COLUMN, ModelFile::TEMPERATURE_CHANGES, none, true};
+            Column coefficient = {"thermalCoefficient", REAL_COLUMN, ModelFile::THERMAL_COEFFICIENTS, none, true};
+            columns << bar << change << coefficient;
+            break;
+        }
+        case FABRICATION_ERRORS:
+        {
+            Column bar         = {"bar", INTEGER_COLUMN, ModelFile::FABRICATION_ERROR_BARS, none, true};
+            Column lengthError = {"lengthError", REAL_COLUMN, ModelFile::LENGTH_ERRORS, none, true};
+            columns << bar << lengthError;
+            break;
+        }
+        case INFLUENCE_LOADS:
+        {
+            const ModelFile::Section counts = ModelFile::INFLUENCE_LOAD_POINT_LOAD_COUNTS;
+
+            Column name       = {"name", TEXT_COLUMN, ModelFile::INFLUENCE_LOAD_NAMES, none, true};
+            Column direction  = {"direction", TEXT_COLUMN, ModelFile::INFLUENCE_LOAD_DIRECTIONS, none, true};
+            Column path       = {"path",
+                                 INTEGER_LIST_COLUMN,
+                                 ModelFile::INFLUENCE_LOAD_PATHS,
+                                 ModelFile::INFLUENCE_LOAD_PATH_SIZES,
+                                 true};
+            Column pointLoads = {"pointLoads", REAL_LIST_COLUMN, ModelFile::INFLUENCE_LOAD_POINT_LOADS, counts, true};
+            Column positions  = {"pointLoadPositions",
+                                 REAL_LIST_COLUMN,
+                                 ModelFile::INFLUENCE_LOAD_POINT_LOAD_POSITIONS,
+                                 counts,
+                                 true};
+            columns << name << direction << path << pointLoads << positions;
+            break;
+        }
+        case JOINT_DEFLECTIONS:
+        {
+            Column joint      = {"joint", ROW_NUMBER_COLUMN, none, none, false};
+            Column horizontal = {"horizontal", REAL_COLUMN, ModelFile::JOINT_HORIZONTAL_DEFLECTIONS, none, false};
+            Column vertical   = {"vertical", REAL_COLUMN, ModelFile::JOINT_VERTICAL_DEFLECTIONS, none, false};
+            columns << joint << horizontal << vertical;
+            break;
+        }
+        case BAR_LOADS:
+        {
+            Column bar  = {"bar", ROW_NUMBER_COLUMN, none, none, false};
+            Column load = {"load", REAL_COLUMN, ModelFile::BAR_LOADS, none, false};
+            columns << bar << load;
+            break;
+        }
+        case SUPPORT_REACTIONS:
+        {
+            Column support    = {"support", ROW_NUMBER_COLUMN, none, none, false};
+            Column joint      = {"joint", INTEGER_COLUMN, ModelFile::REACTION_JOINTS, none, false};
+            Column horizontal = {"horizontal", REAL_COLUMN, ModelFile::REACTION_HORIZONTAL_COMPONENTS, none, false};
+            Column vertical   = {"vertical", REAL_COLUMN, ModelFile::REACTION_VERTICAL_COMPONENTS, none, false};
+            columns << support << joint << horizontal << vertical;
+            break;
+        }
+        default:
+            break;
+    }
+
+    return columns;
+}
+
+bool ModelTableFile::splitCsvLine(const char *begin, const char *end, QVector<Field> &fields)
+{
+    fields.resize(0);
+
+    const char *p = begin;
+
+    forever
+    {
+        Field field;
+        field.isPresent = true;
+        field.isQuoted  = false;
+
+        const char *q = trimmedBegin(p, end);
+
+        if ((q < end) && (*q == '"'))
+        {
+            //Quotes inside a quoted field are doubled, and the field ends at a quote that is not
+
+            field.isQuoted = true;
+            field.begin    = ++q;
+
+            forever
+            {
+                q = static_cast<const char *>(std::memchr(q, '"', end - q));
+
+                if (q == 0)
+                {
+                    return false;
+                }
+
+                if ((q + 1 < end) && (q[1] == '"'))
+                {
+                    q += 2;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            field.end = q;
+            p         = trimmedBegin(q + 1, end);
+
+            if ((p < end) && (*p != ','))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            const char *comma = static_cast<const char *>(std::memchr(p, ',', end - p));
+
+            field.begin = p;
+            field.end   = (comma != 0) ? comma : end;
+            p           = field.end;
+        }
+
+        fields.append(field);
+
+        if (p >= end)
+        {
+            return true;
+        }
+
+        ++p;
+    }
+}
+
+bool ModelTableFile::splitJsonLine(const char            *begin,
+                                   const char            *end,
+                                   const QVector<Column> &columns,
+                                   QVector<Field>        &fields,
+                                   QList<QByteArray>     *keys)
+{
+    fields.resize(columns.size());
+
+    for (int i = 0; i < fields.size(); ++i)
+    {
+        fields[i].isPresent = false;
+    }
+
+    const char *p = trimmedBegin(begin, end);
+
+    if ((p >= end) || (*p != '{'))
+    {
+        return false;
+    }
+
+    p = trimmedBegin(p + 1, end);
+
+    if ((p < end) && (*p == '}'))
+    {
+        return (trimmedBegin(p + 1, end) == end);
+    }
+
+    forever
+    {
+        // -------------------------------------------------------------------------------------------------------------
+        // Key
+        // -------------------------------------------------------------------------------------------------------------
+
+        p = trimmedBegin(p, end);
+
+        if ((p >= end) || (*p != '"'))
+        {
+            return false;
+        }
+
+        const char *keyBegin = ++p;
+
+        while ((p < end) && (*p != '"'))
+        {
+            p += (*p == '\\') ? 2 : 1;
+        }
+
+        if (p >= end)
+        {
+            return false;
+        }
+
+        const char *keyEnd = p;
+        p = trimmedBegin(p + 1, end);
+
+        if ((p >= end) || (*p != ':'))
+        {
+            return false;
+        }
+
+        p = trimmedBegin(p + 1, end);
+
+        if (p >= end)
+        {
+            return false;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------
+        // Value: a string, an array of numbers, a number or null
+        // -------------------------------------------------------------------------------------------------------------
+
+        Field field;
+        field.isPresent = true;
+        field.isQuoted  = false;
+
+        if (*p == '"')
+        {
+            field.isQuoted = true;
+            field.begin    = ++p;
+
+            while ((p < end) && (*p != '"'))
+            {
+                p += (*p == '\\') ? 2 : 1;
+            }
+
+            if (p >= end)
+            {
+                return false;
+            }
+
+            field.end = p++;
+        }
+        else if (*p == '[')
+        {
+            field.begin = ++p;
+
+            while ((p < end) && (*p != ']'))
+            {
+                if ((*p == '[') || (*p == '{') || (*p == '"'))
+                {
+                    return false;
+                }
+
+                ++p;
+            }
+
+            if (p >= end)
+            {
+                return false;
+            }
+
+            field.end = p++;
+        }
+        else if (*p == '{')
+        {
+            return false;
+        }
+        else
+        {
+            field.begin = p;
+
+            while ((p < end) && (*p != ',') && (*p != '}') && (*p != ' ') && (*p != '\t'))
+            {
+                ++p;
+            }
+
+            field.end       = p;
+            field.isPresent = !((field.end - field.begin == 4) && (std::memcmp(field.begin, "null", 4) == 0));
+        }
+
+        int keyLength = int(keyEnd - keyBegin);
+
+        if (keys != 0)
+        {
+            keys->append(QByteArray(keyBegin, keyLength));
+        }
+
+        for (int i = 0; i < columns.size(); ++i)
+        {
+            const char *name = columns.at(i).name;
+
+            if ((int(qstrlen(name)) == keyLength) && (std::memcmp(name, keyBegin, keyLength) == 0))
+            {
+                fields[i] = field;
+                break;
+            }
+        }
+
+        p = trimmedBegin(p, end);
+
+        if (p >= end)
+        {
+            return false;
+        }
+
+        if (*p == ',')
+        {
+            ++p;
+        }
+        else if (*p == '}')
+        {
+            return (trimmedBegin(p + 1, end) == end);
+        }
+        else
+        {
+            return false;
+        }
+    }
+}
+
+bool ModelTableFile::parseReal(const char *begin, const char *end, qreal *value)
+{
+    //Up to 19 significant digits are gathered into an integer. When it and the power of ten are both exact doubles,
+    //one multiplication or division rounds as the exact value would round. Other numbers go through QByteArray.
+
+    static const double kPowersOfTen[] = {1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,
+                                          1.0e8,  1.0e9,  1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+                                          1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+    begin = trimmedBegin(begin, end);
+    end   = trimmedEnd(begin, end);
+
+    const char *p   = begin;
+    bool isNegative = false;
+
+    if ((p < end) && ((*p == '+') || (*p == '-')))
+    {
+        isNegative = (*p == '-');
+        ++p;
+    }
+
+    quint64 mantissa      = 0;
+    int significantDigits = 0;
+    int exponent          = 0;
+    bool hasDigits        = false;
+    bool isExact          = true;
+
+    for (; (p < end) && (*p >= '0') && (*p <= '9'); ++p)
+    {
+        hasDigits = true;
+
+        if (significantDigits < 19)
+        {
+            mantissa = 10 * mantissa + quint64(*p - '0');
+            significantDigits += (mantissa != 0) ? 1 : 0;
+        }
+        else
+        {
+            ++exponent;
+            isExact = isExact && (*p == '0');
+        }
+    }
+
+    if ((p < end) && (*p == '.'))
+    {
+        for (++p; (p < end) && (*p >= '0') && (*p <= '9'); ++p)
+        {
+            hasDigits = true;
+
+            if (significantDigits < 19)
+            {
+                mantissa = 10 * mantissa + quint64(*p - '0');
+                significantDigits += (mantissa != 0) ? 1 : 0;
+                --exponent;
+            }
+            else
+            {
+                isExact = isExact && (*p == '0');
+            }
+        }
+    }
+
+    if (!hasDigits)
+    {
+        return false;
+    }
+
+    if ((p < end) && ((*p == 'e') || (*p == 'E')))
+    {
+        ++p;
+
+        bool isNegativeExponent = false;
+
+        if ((p < end) && ((*p == '+') || (*p == '-')))
+        {
+            isNegativeExponent = (*p == '-');
+            ++p;
+        }
+
+        const char *digits = p;
+        int e              = 0;
+
+        for (; (p < end) && (*p >= '0') && (*p <= '9'); ++p)
+        {
+            e = qMin(10 * e + (*p - '0'), 100000);
+        }
+
+        if (p == digits)
+        {
+            return false;
+        }
+
+        exponent += isNegativeExponent ? -e : e;
+    }
+
+    if (p != end)
+    {
+        return false;
+    }
+
+    if (isExact && (mantissa <= (Q_UINT64_C(1) << 53)) && (exponent >= -22) && (exponent <= 22))
+    {
+        double result = double(mantissa);
+
+        if (exponent < 0)
+        {
+            result /= kPowersOfTen[-exponent];
+        }
+        else
+        {
+            result *= kPowersOfTen[exponent];
+        }
+
+        *value = isNegative ? -result : result;
+        return true;
+    }
+
+    bool ok       = false;
+    double result = QByteArray::fromRawData(begin, int(end - begin)).toDouble(&ok);
+
+    if (!ok || !qIsFinite(result))
+    {
+        return false;
+    }
+
+    *value = result;
+    return true;
+}
+
+bool ModelTableFile::parseInteger(const char *begin, const char *end, qint32 *value)
+{
+    begin = trimmedBegin(begin, end);
+    end   = trimmedEnd(begin, end);
+
+    const char *p   = begin;
+    bool isNegative = false;
+
+    if ((p < end) && ((*p == '+') || (*p == '-')))
+    {
+        isNegative = (*p == '-');
+        ++p;
+    }
+
+    if (p == end)
+    {
+        return false;
+    }
+
+    qint64 result = 0;
+
+    for (; p < end; ++p)
+    {
+        if ((*p < '0') || (*p > '9'))
+        {
+            return false;
+        }
+
+        result = 10 * result + (*p - '0');
+
+        if (result > qint64(INT_MAX) + 1)
+        {
+            return false;
+        }
+    }
+
+    result = isNegative ? -result : result;
+
+    if (result > INT_MAX)
+    {
+        return false;
+    }
+
+    *value = qint32(result);
+    return true;
+}
+
+QString ModelTableFile::decodeText(const Field &field, Format format)
+{
+    if (!field.isQuoted)
+    {
+        const char *begin = trimmedBegin(field.begin, field.end);
+        return QString::fromUtf8(begin, int(trimmedEnd(begin, field.end) - begin));
+    }
+
+    if (format == CSV)
+    {
+        QByteArray text(field.begin, int(field.end - field.begin));
+        text.replace("\"\"", "\"");
+        return QString::fromUtf8(text);
+    }
+
+    //Escapes of JSON strings, with the text between them taken as it is
+
+    QString text;
+    const char *run = field.begin;
+    const char *p   = field.begin;
+
+    while (p < field.end)
+    {
+        if (*p != '\\')
+        {
+            ++p;
+            continue;
+        }
+
+        text.append(QString::fromUtf8(run, int(p - run)));
+
+        if (p + 1 >= field.end)
+        {
+            break;
+        }
+
+        char escape = p[1];
+        p += 2;
+
+        switch (escape)
+        {
+            case 'b':
+                text.append(QChar('\b'));
+                break;
+            case 'f':
+                text.append(QChar('\f'));
+                break;
+            case 'n':
+                text.append(QChar('\n'));
+                break;
+            case 'r':
+                text.append(QChar('\r'));
+                break;
+            case 't':
+                text.append(QChar('\t'));
+                break;
+            case 'u':
+            {
+                bool ok     = false;
+                ushort code = 0;
+
+                if (field.end - p >= 4)
+                {
+                    code = QByteArray(p, 4).toUShort(&ok, 16);
+                    p += 4;
+                }
+
+                if (ok)
+                {
+                    text.append(QChar(code));
+                }
+
+                break;
+            }
+            default:
+                text.append(QChar::fromLatin1(escape));
+                break;
+        }
+
+        run = p;
+    }
+
+    text.append(QString::fromUtf8(run, int(field.end - run)));
+    return text;
+}
+
+const char *ModelTableFile::trimmedBegin(const char *begin, const char *end)
+{
+    while ((begin < end) && ((*begin == ' ') || (*begin == '\t')))
+    {
+        ++begin;
+    }
+
+    return begin;
+}
+
+const char *ModelTableFile::trimmedEnd(const char *begin, const char *end)
+{
+    while ((end > begin) && ((*(end - 1) == ' ') || (*(end - 1) == '\t')))
+    {
+        --end;
+    }
+
+    return end;
+}
+
+void ModelTableFile::appendText(QByteArray &line, const QString &text, Format format)
+{
+    QByteArray utf8 = text.toUtf8();
+
+    if (format == CSV)
+    {
+        bool isQuoted = false;
+
+        for (int i = 0; (i < utf8.size()) && !isQuoted; ++i)
+        {
+            char c   = utf8.at(i);
+            isQuoted = (c == ',') || (c == '"') || (c == '\n') || (c == '\r');
+        }
+
+        if (isQuoted || (utf8 != utf8.trimmed()))
+        {
+            utf8.replace("\"", "\"\"");
+            line.append('"');
+            line.append(utf8);
+            line.append('"');
+        }
+        else
+        {
+            line.append(utf8);
+        }
+
+        return;
+    }
+
+    line.append('"');
+
+    for (int i = 0; i < utf8.size(); ++i)
+    {
+        char c = utf8.at(i);
+
+        switch (c)
+        {
+            case '"':
+                line.append("\\\"");
+                break;
+            case '\\':
+                line.append("\\\\");
+                break;
+            case '\n':
+                line.append("\\n");
+                break;
+            case '\r':
+                line.append("\\r");
+                break;
+            case '\t':
+                line.append("\\t");
+                break;
+            default:
+                if ((c >= 0) && (c < 0x20))
+                {
+                    char escape[8];
+                    qsnprintf(escape, sizeof(escape), "\\u%04x", int(c));
+                    line.append(escape);
+                }
+                else
+                {
+                    line.append(c);
+                }
+
+                break;
+        }
+    }
+
+    line.append('"');
+}
+
+void ModelTableFile::appendReal(QByteArray &line, qreal value)
+{
+    //The shortest text that reads back to the same double, which parseReal reads without the fallback where it can
+
+    line.append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+}
+
+void ModelTableFile::appendInteger(QByteArray &line, qint32 value)
+{
+    char digits[12];
+    int count     = 0;
+    qint64 number = value;
+
+    if (number < 0)
+    {
+        line.append('-');
+        number = -number;
+    }
+
+    do
+    {
+        digits[count++] = char('0' + number % 10);
+        number /= 10;
+    }
+    while (number > 0);
+
+    while (count > 0)
+    {
+        line.append(digits[--count]);
+    }
+}
@@ -0,0 +1,164 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeltablefile.h */
+
+#ifndef MODELTABLEFILE_H
+#define MODELTABLEFILE_H
+
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#include <QByteArray>
+#include <QHash>
+#include <QIODevice>
+#include <QList>
+#include <QLocale>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QtGlobal>
+#include <QtNumeric>
+
+#include "modelfile.h"
+
+//Model lists and solution arrays as CSV or JSON Lines tables, one table to a file and one row to a line, with each
+//column a section of a ModelFile. CSV files start with a header row of column names, and JSON Lines rows are flat
+//objects keyed by them. Lists, such as an influence load path, are written separated by semicolons in CSV and as
+//arrays in JSON Lines. Columns may come in any order, columns a table does not have are skipped, and a table is told
+//from the required columns it has.
+//
+//Files are read through one buffer, and numbers are parsed in place without allocating.
+class ModelTableFile
+{
+    public:
+        enum Format
+        {
+            CSV,
+            JSON_LINES
+        };
+
+        enum Table
+        {
+            JOINTS,
+            BARS,
+            SUPPORTS,
+            JOINT_LOADS,
+            SUPPORT_SETTLEMENTS,
+            THERMAL_EFFECTS,
+            FABRICATION_ERRORS,
+            INFLUENCE_LOADS,
+            JOINT_DEFLECTIONS,
+            BAR_LOADS,
+            SUPPORT_REACTIONS,
+            TABLES_COUNT
+        };
+
+        //Tables from JOINT_DEFLECTIONS on hold solution arrays, which are written but not read
+        static bool isInputTable(Table table);
+
+        static QString tableName(Table table);
+
+        static QString fileSuffix(Format format);
+
+        //Rows of a table in a model file
+        static int rowsCount(const ModelFile &modelFile, Table table);
+
+        static bool write(const ModelFile &modelFile, Table table, Format format, QIODevice *device);
+
+        //Read an input table into its sections of the model file, reporting the line of the first error
+        static bool read(QIODevice  *device,
+                         Format     format,
+                         ModelFile  *modelFile,
+                         Table      *table,
+                         QString    *errorMessage);
+
+        //Bytes read from the device at a time
+        static const int kBufferSize = 1 << 16;
+
+    private:
+        enum ColumnType
+        {
+            REAL_COLUMN,
+            INTEGER_COLUMN,
+            TEXT_COLUMN,
+            REAL_LIST_COLUMN,
+            INTEGER_LIST_COLUMN,
+            ROW_NUMBER_COLUMN
+        };
+
+        //Sizes section is the section with the list sizes of a list column
+        struct Column
+        {
+            const char         *name;
+            ColumnType         type;
+            ModelFile::Section section;
+            ModelFile::Section sizesSection;
+            bool               isRequired;
+        };
+
+        //Part of the line buffer holding a field, with quoted text still escaped
+        struct Field
+        {
+            const char *begin;
+            const char *end;
+            bool       isPresent;
+            bool       isQuoted;
+        };
+
+        //Lines of a device through one buffer, copied only when a line runs past the end of a read
+        class LineReader
+        {
+            public:
+                explicit LineReader(QIODevice *device);
+
+                bool readLine(const char **begin, const char **end);
+
+                qint64 lineNumber() const;
+
+            private:
+                QIODevice  *mDevice;
+                QByteArray mBuffer;
+                int        mStart;
+                int        mEnd;
+                qint64     mLineNumber;
+                bool       mIsAtEnd;
+        };
+
+        static QVector<Column> columns(Table table);
+
+        static bool splitCsvLine(const char *begin, const char *end, QVector<Field> &fields);
+        static bool splitJsonLine(const char            *begin,
+                                  const char            *end,
+                                  const QVector<Column> &columns,
+                                  QVector<Field>        &fields,
+                                  QList<QByteArray>     *keys = 0);
+
+        static bool parseReal(const char *begin, const char *end, qreal *value);
+        static bool parseInteger(const char *begin, const char *end, qint32 *value);
+        static QString decodeText(const Field &field, Format format);
+
+        //Spaces and tabs skipped from either end of a field
+        static const char *trimmedBegin(const char *begin, const char *end);
+        static const char *trimmedEnd(const char *begin, const char *end);
+
+        static void appendText(QByteArray &line, const QString &text, Format format);
+        static void appendReal(QByteArray &line, qreal value);
+        static void appendInteger(QByteArray &line, qint32 value);
+};
+
+#endif // MODELTABLEFILE_H
@@ -0,0 +1,350 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeltablemodel.cpp */
+
+#include "modeltablemodel.h"
+
+ModelTableModel::ModelTableModel(ModelTable       table,
+                                 UnitsAndLimits   *unitsAndLimits,
+                                 QList<Joint *>   *jointsList,
+                                 QList<Bar *>     *barsList,
+                                 QList<Support *> *supportsList,
+                                 QObject          *parent) : QAbstractTableModel(parent)
+{
+    mTable             = table;
+    mUnitsAndLimits    = unitsAndLimits;
+    mJointsList        = jointsList;
+    mBarsList          = barsList;
+    mSupportsList      = supportsList;
+    mRowCount          = 0;
+    mIsJointIndexValid = false;
+
+    int count = (mTable == JOINTS) ? 2 : 3;
+
+    for (int i = 0; i < count; ++i)
+    {
+        mHeaderLabels.append(QString());
+    }
+}
+
+ModelTableModel::~ModelTableModel()
+{
+
+}
+
+int ModelTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return mRowCount;
+}
+
+int ModelTableModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return mHeaderLabels.size();
+}
+
+QVariant ModelTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= listSize())
+    {
+        return QVariant();
+    }
+
+    if (role == Qt::TextAlignmentRole)
+    {
+        return int(Qt::AlignCenter);
+    }
+
+    if (role != Qt::DisplayRole)
+    {
+        return QVariant();
+    }
+
+    //Values are formatted only when a view asks for a visible cell
+    int row    = index.row();
+    int column = index.column();
+
+    switch (mTable)
+    {
+        case JOINTS:
+        {
+            Joint *joint = mJointsList->at(row);
+
+            if (column == 0)
+            {
+                return QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits->deltaXDecimals());
+            }
+            else
+            {
+                return QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits->deltaYDecimals());
+            }
+        }
+        case BARS:
+        {
+            Bar *bar = mBarsList->at(row);
+
+            if (column == 0)
+            {
+                return QString::number(jointNumber(bar->firstJoint()));
+            }
+            else if (column == 1)
+            {
+                return QString::number(jointNumber(bar->secondJoint()));
+            }
+            else if (mHeaderLabels.size() == 3)
+            {
+                return QString::number(bar->factor(), 'f', mUnitsAndLimits->factorDecimals());
+            }
+            else if (column == 2)
+            {
+                return QString::number(bar->area(), 'f', mUnitsAndLimits->areaDecimals());
+            }
+            else if (column == 3)
+            {
+                return QString::number(bar->modulus(), 'f', mUnitsAndLimits->modulusDecimals());
+            }
+            else
+            {
+                return QString::number(bar->unitWeight(), 'f', mUnitsAndLimits->unitWeightDecimals());
+            }
+        }
+        case SUPPORTS:
+        {
+            Support *support = mSupportsList->at(row);
+
+            if (column == 0)
+            {
+                return QString::number(jointNumber(support->supportJoint()));
+            }
+            else if (column == 1)
+            {
+                switch (support->type())
+                {
+                    case UnitsAndLimits::FIXED_LEFT:
+                    case UnitsAndLimits::FIXED_TOP:
+                    case UnitsAndLimits::FIXED_RIGHT:
+                    case UnitsAndLimits::FIXED_BOTTOM:
+                        return tr("fixed");
+                    case UnitsAndLimits::ROLLER:
+                        return tr("inclined roller");
+                    case UnitsAndLimits::ROLLER_LEFT:
+                    case UnitsAndLimits::ROLLER_TOP:
+                    case UnitsAndLimits::ROLLER_RIGHT:
+                    case UnitsAndLimits::ROLLER_BOTTOM:
+                        return tr("roller");
+                    default:
+                        return QString();
+                }
+            }
+            else
+            {
+                return QString::number(support->angle(), 'f', mUnitsAndLimits->supportAngleDecimals());
+            }
+        }
+        default:
+            return QVariant();
+    }
+}
+
+QVariant ModelTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && section >= 0 && section < mHeaderLabels.size())
+    {
+        if (role == Qt::DisplayRole)
+        {
+            return mHeaderLabels.at(section);
+        }
+
+        if (role == Qt::TextAlignmentRole)
+        {
+            return int(Qt::AlignCenter);
+        }
+    }
+
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool ModelTableModel::setHeaderData(int             section,
+                                    Qt::Orientation orientation,
+                                    const QVariant  &value,
+                                    int             role)
+{
+    if (orientation != Qt::Horizontal || section < 0 || section >= mHeaderLabels.size())
+    {
+        return false;
+    }
+
+    if (role != Qt::EditRole && role != Qt::DisplayRole)
+    {
+        return false;
+    }
+
+    mHeaderLabels[section] = value.toString();
+    emit headerDataChanged(orientation, section, section);
+    return true;
+}
+
+Qt::ItemFlags ModelTableModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid())
+    {
+        return Qt::NoItemFlags;
+    }
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void ModelTableModel::setColumnCount(int count)
+{
+    beginResetModel();
+
+    mHeaderLabels.clear();
+
+    for (int i = 0; i < count; ++i)
+    {
+        mHeaderLabels.append(QString());
+    }
+
+    mRowCount = listSize();
+    invalidateJointIndex();
+    endResetModel();
+}
+
+void ModelTableModel::resetRows()
+{
+    beginResetModel();
+    mRowCount = listSize();
+    invalidateJointIndex();
+    endResetModel();
+}
+
+void ModelTableModel::appendRows()
+{
+    int count = listSize();
+
+    invalidateJointIndex();
+
+    if (count > mRowCount)
+    {
+        beginInsertRows(QModelIndex(), mRowCount, count - 1);
+        mRowCount = count;
+        endInsertRows();
+    }
+    else if (count < mRowCount)
+    {
+        resetRows();
+    }
+}
+
+void ModelTableModel::removeModelRows(int row, int count)
+{
+    if (count <= 0 || row < 0 || row + count > mRowCount)
+    {
+        return;
+    }
+
+    invalidateJointIndex();
+    beginRemoveRows(QModelIndex(), row, row + count - 1);
+    mRowCount -= count;
+    endRemoveRows();
+}
+
+void ModelTableModel::removeFlaggedRows(const QVector<bool> &isRemoved)
+{
+    //Runs are removed from the bottom up so that the rows above keep their numbers
+    int row = qMin(isRemoved.size(), mRowCount) - 1;
+
+    while (row >= 0)
+    {
+        if (!isRemoved.at(row))
+        {
+            --row;
+            continue;
+        }
+
+        int lastRow = row;
+
+        while (row >= 0 && isRemoved.at(row))
+        {
+            --row;
+        }
+
+        removeModelRows(row + 1, lastRow - row);
+    }
+}
+
+void ModelTableModel::updateRows(int firstRow, int lastRow)
+{
+    invalidateJointIndex();
+
+    if (firstRow < 0 || lastRow >= mRowCount || firstRow > lastRow)
+    {
+        return;
+    }
+
+    emit dataChanged(index(firstRow, 0), index(lastRow, mHeaderLabels.size() - 1));
+}
+
+void ModelTableModel::updateAllRows()
+{
+    updateRows(0, mRowCount - 1);
+}
+
+int ModelTableModel::listSize() const
+{
+    switch (mTable)
+    {
+        case JOINTS:
+            return mJointsList->size();
+        case BARS:
+            return mBarsList->size();
+        case SUPPORTS:
+            return mSupportsList->size();
+        default:
+            return 0;
+    }
+}
+
+int ModelTableModel::jointNumber(const Joint *joint) const
+{
+    //Joint numbers come from an index rebuilt after the joints list changes
+    //instead of a linear indexOf per visible cell
+    int index = mIsJointIndexValid ? mJointIndex.jointIndex(joint) : -1;
+
+    if (index < 0)
+    {
+        mJointIndex.rebuild(*mJointsList);
+        mIsJointIndexValid = true;
+        index              = mJointIndex.jointIndex(joint);
+    }
+
+    return index + 1;
+}
+
+void ModelTableModel::invalidateJointIndex()
+{
+    mIsJointIndexValid = false;
+}
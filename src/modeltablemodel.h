@@ -0,0 +1,111 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* modeltablemodel.h */
+
+#ifndef MODELTABLEMODEL_H
+#define MODELTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QStringList>
+#include <QVector>
+
+#include "bar.h"
+#include "joint.h"
+#include "modelindex.h"
+#include "support.h"
+#include "unitsandlimits.h"
+
+//Table model reading joints, bars or supports straight from the solver's model lists
+//Rows are formatted in data() only when a view asks for them; the solver notifies the
+//model after it changes a list so the row count seen by the views stays consistent
+class ModelTableModel : public QAbstractTableModel
+{
+        Q_OBJECT
+
+    public:
+        enum ModelTable
+        {
+            JOINTS,
+            BARS,
+            SUPPORTS
+        };
+
+        explicit ModelTableModel(ModelTable       table,
+                                 UnitsAndLimits   *unitsAndLimits,
+                                 QList<Joint *>   *jointsList,
+                                 QList<Bar *>     *barsList,
+                                 QList<Support *> *supportsList,
+                                 QObject          *parent = 0);
+
+        ~ModelTableModel();
+
+        int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+        int columnCount(const QModelIndex &parent = QModelIndex()) const;
+
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+        QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+
+        bool setHeaderData(int             section,
+                           Qt::Orientation orientation,
+                           const QVariant  &value,
+                           int             role = Qt::EditRole);
+
+        Qt::ItemFlags flags(const QModelIndex &index) const;
+
+        //Changes the number of columns (bars table: 5 for area/modulus/unit weight, 3 for factor)
+        void setColumnCount(int count);
+
+        //Resynchronizes the whole table with its list
+        void resetRows();
+
+        //Announces rows appended to the end of the list since the last notification
+        void appendRows();
+
+        //Announces rows already taken out of the list
+        void removeModelRows(int row, int count);
+
+        //Announces the removal of the rows flagged in isRemoved, one contiguous run at a time
+        void removeFlaggedRows(const QVector<bool> &isRemoved);
+
+        //Announces changed values in rows firstRow to lastRow
+        void updateRows(int firstRow, int lastRow);
+
+        //Announces changed values in every row, e.g. after joints are renumbered
+        void updateAllRows();
+
+        //One-based number of a joint, as shown in the bars and supports tables
+        int jointNumber(const Joint *joint) const;
+
+    private:
+        int listSize() const;
+
+        void invalidateJointIndex();
+
+        ModelTable                           mTable;
+        UnitsAndLimits                       *mUnitsAndLimits;
+        QList<Joint *>                       *mJointsList;
+        QList<Bar *>                         *mBarsList;
+        QList<Support *>                     *mSupportsList;
+        int                                  mRowCount;
+        QStringList                          mHeaderLabels;
+        mutable ModelIndex                   mJointIndex;
+        mutable bool                         mIsJointIndexValid;
+};
+
+#endif // MODELTABLEMODEL_H
@@ -27,12 +27,8 @@ ModelViewer::ModelViewer(UnitsAndLimits             *unitsAndLimits,
                          QList<ThermalEffect *>     *thermalEffectsList,
                          QList<FabricationError *>  *fabricationErrorsList,
                          QList<InfluenceLoad *>     *influenceLoadsList,
-                         QStandardItemModel         *barsStandardItemModel,
-                         QList<qreal>               *horizontalDeflectionComponentsList,
-                         QList<qreal>               *verticalDeflectionComponentsList,
-                         QList<qreal>               *barLoadsList,
-                         QList<qreal>               *reactionHorizontalComponentsList,
-                         QList<qreal>               *reactionVerticalComponentsList,
+                         ModelTableModel            *barsTableModel,
+                         QSharedPointer<const SolutionResult> *solutionResult,
                          QString                    *solutionInfluenceLoadName,
                          InfluenceLoadResult        *influenceLoadResult,
                          QWidget                    *parent) : QWidget(parent)
@@ -46,12 +42,8 @@ ModelViewer::ModelViewer(UnitsAndLimits             *unitsAndLimits,
     mThermalEffectsList                 = thermalEffectsList;
     mFabricationErrorsList              = fabricationErrorsList;
     mInfluenceLoadsList                 = influenceLoadsList;
-    mBarsStandardItemModel              = barsStandardItemModel;
-    mHorizontalDeflectionComponentsList = horizontalDeflectionComponentsList;
-    mVerticalDeflectionComponentsList   = verticalDeflectionComponentsList;
-    mBarLoadsList                       = barLoadsList;
-    mReactionHorizontalComponentsList   = reactionHorizontalComponentsList;
-    mReactionVerticalComponentsList     = reactionVerticalComponentsList;
+    mBarsTableModel                     = barsTableModel;
+    mSolutionResult                     = solutionResult;
     mSolutionInfluenceLoadName          = solutionInfluenceLoadName;
     mInfluenceLoadResult                = influenceLoadResult;
     mDrawCoordinateAxes                 = true;
@@ -68,15 +60,12 @@ ModelViewer::ModelViewer(UnitsAndLimits             *unitsAndLimits,
     mSolutionDisplayOption = NO_SOLUTION;
     mInfluenceLoadBarIndex = 0;
     mForceScaleFactor      = 0.2;
-    mDeflectionScaleFactor = 10000.0;
-    mModelPixmap           = new QPixmap(width(), height());
+    mDeflectionScaleFactor = kDefaultDeflectionScaleFactor;
+    mDisplaySignature      = 0;
 
-    updateModelPixmap();
-}
+    mTileCache.setMaxCost(kMaxCachedTiles);
 
-ModelViewer::~ModelViewer()
-{
-    delete mModelPixmap;
+    updateModelTiles();
 }
 
 QSize ModelViewer::sizeHint() const
@@ -94,54 +83,38 @@ QPointF ModelViewer::point(qreal x, qreal y) const
     return QPointF(x, -y);
 }
 
-void ModelViewer::updateModelPixmap()
+void ModelViewer::updateModelTiles()
 {
-    mModelPixmap->fill();
-    QPainter painter(mModelPixmap);
-    painter.setRenderHint(QPainter::Antialiasing);
-    painter.setRenderHint(QPainter::TextAntialiasing);
-    QFont painterFont(painter.font());
-    painterFont.setPointSize(10);
-    painter.setFont(painterFont);
-
-    QPen linePen(QColor(Qt::black));
-    linePen.setWidth(1);
-    painter.setPen(linePen);
-
-    painter.drawRect(kBorderOffset,
-                     kBorderOffset,
-                     width() - 2 * kBorderOffset,
-                     height() - 2 * kBorderOffset);
-
-    painter.setClipRegion(QRegion(kBorderOffset,
-                                  kBorderOffset,
-                                  width() - 2 * kBorderOffset,
-                                  height() - 2 * kBorderOffset));
-
-    painter.translate(mMarginOffset, height() - mMarginOffset);
-
-    linePen.setColor(QColor(Qt::blue));
-    linePen.setWidth(2);
-    painter.setPen(linePen);
+    updateCoordinateScaleFactor();
 
-    qreal w, h;
-    QFontMetricsF fontMetrics(painter.font());
+    quint64 signature = displaySignature();
 
-    if (mDrawCoordinateAxes)
+    if ((signature != mDisplaySignature) || !hasTileSignatures())
     {
-        //Draw coordinate axes
+        mTileCache.clear();
+        mDisplaySignature = signature;
+    }
+    else
+    {
+        //Drop only the cached tiles whose joints, bars or supports changed
 
-        painter.drawRect(QRectF(point(-5.0, 5.0), point(5.0, -5.0)));
-        painter.drawLine(point( 0.0,  0.0), point( 0.0, 50.0));
-        painter.drawLine(point( 0.0, 50.0), point(-5.0, 45.0));
-        painter.drawLine(point( 0.0, 50.0), point( 5.0, 45.0));
-        painter.drawLine(point( 0.0,  0.0), point(50.0,  0.0));
-        painter.drawLine(point(50.0,  0.0), point(45.0,  5.0));
-        painter.drawLine(point(50.0,  0.0), point(45.0, -5.0));
+        QList<quint64> keys                = mTileCache.keys();
+        QHash<quint64, quint64> signatures = tileSignatures(keys);
+
+        foreach (quint64 key, keys)
+        {
+            if (mTileCache.object(key)->signature != signatures.value(key))
+            {
+                mTileCache.remove(key);
+            }
+        }
     }
 
-    //Draw Joints
+    update();
+}
 
+void ModelViewer::updateCoordinateScaleFactor()
+{
     qreal xMax = 0.0;
     qreal yMax = 0.0;
 
@@ -191,12 +164,69 @@ void ModelViewer::updateModelPixmap()
             mCoordinateScaleFactor = widthScaleFactor;
         }
     }
+}
 
-    foreach (Joint *joint, *mJointsList)
+void ModelViewer::drawModel(QPainter &painter, const QRect &region) const
+{
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+    QFont painterFont(painter.font());
+    painterFont.setPointSize(10);
+    painter.setFont(painterFont);
+
+    QPen linePen(QColor(Qt::black));
+    linePen.setWidth(1);
+    painter.setPen(linePen);
+
+    painter.drawRect(kBorderOffset,
+                     kBorderOffset,
+                     width() - 2 * kBorderOffset,
+                     height() - 2 * kBorderOffset);
+
+    painter.setClipRegion(QRegion(kBorderOffset,
+                                  kBorderOffset,
+                                  width() - 2 * kBorderOffset,
+                                  height() - 2 * kBorderOffset));
+
+    painter.translate(mMarginOffset, height() - mMarginOffset);
+
+    //Region in model drawing coordinates, outside which joints, bars, supports, loads and their labels are skipped
+    QRectF visibleRect(QRectF(region).translated(-mMarginOffset, mMarginOffset - height()));
+
+    linePen.setColor(QColor(Qt::blue));
+    linePen.setWidth(2);
+    painter.setPen(linePen);
+
+    qreal w, h;
+    QFontMetricsF fontMetrics(painter.font());
+
+    if (mDrawCoordinateAxes)
     {
+        //Draw coordinate axes
+
+        painter.drawRect(QRectF(point(-5.0, 5.0), point(5.0, -5.0)));
+        painter.drawLine(point( 0.0,  0.0), point( 0.0, 50.0));
+        painter.drawLine(point( 0.0, 50.0), point(-5.0, 45.0));
+        painter.drawLine(point( 0.0, 50.0), point( 5.0, 45.0));
+        painter.drawLine(point( 0.0,  0.0), point(50.0,  0.0));
+        painter.drawLine(point(50.0,  0.0), point(45.0,  5.0));
+        painter.drawLine(point(50.0,  0.0), point(45.0, -5.0));
+    }
+
+    //Draw Joints
+
+    for (int jointIndex = 0; jointIndex < mJointsList->size(); ++jointIndex)
+    {
+        Joint *joint = mJointsList->at(jointIndex);
+
         qreal x = mCoordinateScaleFactor * joint->xCoordinate();
         qreal y = mCoordinateScaleFactor * joint->yCoordinate();
 
+        if (!isVisible(visibleRect, point(x, y), point(x, y), kCullingMargin))
+        {
+            continue;
+        }
+
         painter.setPen(QColor(Qt::magenta));
 
         if (joint->connectedJoints()->isEmpty())
@@ -214,7 +244,7 @@ void ModelViewer::updateModelPixmap()
 
         if (mDrawJointNumber)
         {
-            int number = 1 + mJointsList->indexOf(joint);
+            int number = 1 + jointIndex;
             w          = 1.1 * fontMetrics.boundingRect(QString::number(number)).width();
             h          = fontMetrics.boundingRect(QString::number(number)).height();
 
@@ -233,37 +263,51 @@ void ModelViewer::updateModelPixmap()
     painter.setPen(QColor(Qt::black));
     painter.setBrush(QBrush(QColor(Qt::white)));
 
-    foreach (Bar *bar, *mBarsList)
+    bool drawBarNumber = mDrawBarNumber && !(mSolutionDisplayOption == BAR_LOAD && hasBarLoads());
+
+    for (int barIndex = 0; barIndex < mBarsList->size(); ++barIndex)
     {
+        Bar *bar = mBarsList->at(barIndex);
+
         qreal x1 = mCoordinateScaleFactor * bar->firstJoint()->xCoordinate();
         qreal y1 = mCoordinateScaleFactor * bar->firstJoint()->yCoordinate();
         qreal x2 = mCoordinateScaleFactor * bar->secondJoint()->xCoordinate();
         qreal y2 = mCoordinateScaleFactor * bar->secondJoint()->yCoordinate();
 
+        if (!isVisible(visibleRect, point(x1, y1), point(x2, y2), kCullingMargin))
+        {
+            continue;
+        }
+
         painter.drawLine(point(x1, y1), point(x2, y2));
 
-        if (mDrawBarNumber)
+        if (drawBarNumber)
         {
-            if (!(mSolutionDisplayOption == BAR_LOAD && !mBarLoadsList->isEmpty()))
-            {
-                int number = 1 + mBarsList->indexOf(bar);
-                w          = fontMetrics.boundingRect(QString::number(number)).width();
-                h          = fontMetrics.boundingRect(QString::number(number)).height();
-                radius     = qMax(w, h) / 1.5;
+            int number = 1 + barIndex;
+            w          = fontMetrics.boundingRect(QString::number(number)).width();
+            h          = fontMetrics.boundingRect(QString::number(number)).height();
+            radius     = qMax(w, h) / 1.5;
 
-                qreal xp = x1 / 3.0 + 2.0 * x2 / 3.0;
-                qreal yp = y1 / 3.0 + 2.0 * y2 / 3.0;
+            qreal xp = x1 / 3.0 + 2.0 * x2 / 3.0;
+            qreal yp = y1 / 3.0 + 2.0 * y2 / 3.0;
 
-                painter.drawEllipse(point(xp, yp), radius, radius);
+            painter.drawEllipse(point(xp, yp), radius, radius);
 
-                painter.drawText(QRectF(point(xp - w / 2.0, yp + h / 2.0), point(xp + w / 2.0, yp - h / 2.0)),
-                                 Qt::AlignHCenter | Qt::AlignVCenter,
-                                 QString::number(number));
-            }
+            painter.drawText(QRectF(point(xp - w / 2.0, yp + h / 2.0), point(xp + w / 2.0, yp - h / 2.0)),
+                             Qt::AlignHCenter | Qt::AlignVCenter,
+                             QString::number(number));
         }
     }
 
-    if (!(mSolutionDisplayOption == SUPPORT_REACTION && !mReactionHorizontalComponentsList->isEmpty()))
+    if (drawBarNumber && !mBarsList->isEmpty())
+    {
+        //Thermal effect and fabrication error labels stand off by the number circle of the last bar, drawn or not
+
+        QString number(QString::number(mBarsList->size()));
+        radius = qMax(fontMetrics.boundingRect(number).width(), fontMetrics.boundingRect(number).height()) / 1.5;
+    }
+
+    if (!(mSolutionDisplayOption == SUPPORT_REACTION && hasSupportReactions()))
     {
         //Draw Supports
 
@@ -272,10 +316,16 @@ void ModelViewer::updateModelPixmap()
             UnitsAndLimits::SupportType type = support->type();
             qreal angle                      = support->angle();
             Joint *joint                     = support->supportJoint();
+            QPointF supportPoint(point(mCoordinateScaleFactor * joint->xCoordinate(),
+                                       mCoordinateScaleFactor * joint->yCoordinate()));
+
+            if (!isVisible(visibleRect, supportPoint, supportPoint, kCullingMargin))
+            {
+                continue;
+            }
 
             painter.save();
-            painter.translate(point(mCoordinateScaleFactor * joint->xCoordinate(),
-                                    mCoordinateScaleFactor * joint->yCoordinate()));
+            painter.translate(supportPoint);
 
             switch (type)
             {
@@ -422,7 +472,7 @@ void ModelViewer::updateModelPixmap()
             {
                 if (!mBarsList->isEmpty())
                 {
-                    if (mBarsStandardItemModel->columnCount() == 5)
+                    if (mBarsTableModel->columnCount() == 5)
                     {
                         checkA = true;
                     }
@@ -522,15 +572,6 @@ void ModelViewer::updateModelPixmap()
                     }
                 }
 
-                painter.save();
-
-                painter.translate(point(mCoordinateScaleFactor * joint->xCoordinate(),
-                                        mCoordinateScaleFactor * joint->yCoordinate()));
-
-                painter.save();
-
-                painter.rotate(qRadiansToDegrees(angle));
-
                 qreal scaledMagnitude = 0.0;
                 magnitude /= loadConversionFactor;
 
@@ -555,10 +596,26 @@ void ModelViewer::updateModelPixmap()
                     scaledMagnitude       = magnitude * kipToKiloNewton * mForceScaleFactor;
                 }
 
+                QPointF jointPoint(point(mCoordinateScaleFactor * joint->xCoordinate(),
+                                         mCoordinateScaleFactor * joint->yCoordinate()));
+
+                if (!isVisible(visibleRect, jointPoint, jointPoint, std::fabs(scaledMagnitude) + kCullingMargin))
+                {
+                    continue;
+                }
+
                 QString string(tr("%1 %2")
                                .arg(QString::number(magnitude, 'f', mUnitsAndLimits->jointLoadDecimals()))
                                .arg(mUnitsAndLimits->loadUnit()));
 
+                painter.save();
+
+                painter.translate(jointPoint);
+
+                painter.save();
+
+                painter.rotate(qRadiansToDegrees(angle));
+
                 if (position == 't')
                 {
                     painter.setPen(linePen);
@@ -687,6 +744,11 @@ void ModelViewer::updateModelPixmap()
                 qreal xp = x1 / 3.0 + 2.0 * x2 / 3.0;
                 qreal yp = y1 / 3.0 + 2.0 * y2 / 3.0;
 
+                if (!isVisible(visibleRect, point(xp, yp), point(xp, yp), kCullingMargin))
+                {
+                    continue;
+                }
+
                 painter.save();
 
                 painter.translate(point(xp, yp));
@@ -753,6 +815,11 @@ void ModelViewer::updateModelPixmap()
                 qreal xp = x1 / 3.0 + 2.0 * x2 / 3.0;
                 qreal yp = y1 / 3.0 + 2.0 * y2 / 3.0;
 
+                if (!isVisible(visibleRect, point(xp, yp), point(xp, yp), kCullingMargin))
+                {
+                    continue;
+                }
+
                 painter.save();
 
                 painter.translate(point(xp, yp));
@@ -788,7 +855,10 @@ void ModelViewer::updateModelPixmap()
                 qreal x2 = mCoordinateScaleFactor * jointB->xCoordinate();
                 qreal y2 = mCoordinateScaleFactor * jointB->yCoordinate();
 
-                painter.drawLine(point(x1, y1), point(x2, y2));
+                if (isVisible(visibleRect, point(x1, y1), point(x2, y2), kCullingMargin))
+                {
+                    painter.drawLine(point(x1, y1), point(x2, y2));
+                }
             }
         }
     }
@@ -797,7 +867,7 @@ void ModelViewer::updateModelPixmap()
     {
         if (mSolutionDisplayOption == JOINT_DEFLECTION)
         {
-            if (mBarsStandardItemModel->columnCount() == 5 && !mHorizontalDeflectionComponentsList->isEmpty())
+            if (mBarsTableModel->columnCount() == 5 && hasJointDeflections())
             {
                 //Draw joint deflections
 
@@ -805,42 +875,31 @@ void ModelViewer::updateModelPixmap()
                 linePen.setWidth(1);
                 painter.setPen(linePen);
 
-                foreach (Bar *bar, *mBarsList)
-                {
-                    Joint *jointA = bar->firstJoint();
-                    Joint *jointB = bar->secondJoint();
-
-                    int jointIndexA = mJointsList->indexOf(jointA);
-                    int jointIndexB = mJointsList->indexOf(jointB);
-
-                    qreal deflectionX1 = mHorizontalDeflectionComponentsList->at(jointIndexA);
-                    qreal deflectionY1 = mVerticalDeflectionComponentsList->at(jointIndexA);
-                    qreal deflectionX2 = mHorizontalDeflectionComponentsList->at(jointIndexB);
-                    qreal deflectionY2 = mVerticalDeflectionComponentsList->at(jointIndexB);
-
-                    qreal factor = 1.0;
-
-                    if (mUnitsAndLimits->system() == tr("metric"))
-                    {
-                        factor = mDeflectionScaleFactor;
-                    }
-                    else
-                    {
-                        qreal footToMeter = 0.3048;
-                        factor            = mDeflectionScaleFactor * footToMeter;
-                    }
-
-                    qreal x1 = mCoordinateScaleFactor * jointA->xCoordinate() + factor * deflectionX1;
-                    qreal y1 = mCoordinateScaleFactor * jointA->yCoordinate() + factor * deflectionY1;
-                    qreal x2 = mCoordinateScaleFactor * jointB->xCoordinate() + factor * deflectionX2;
-                    qreal y2 = mCoordinateScaleFactor * jointB->yCoordinate() + factor * deflectionY2;
+                qreal factor = 1.0;
 
-                    painter.drawLine(point(x1, y1), point(x2, y2));
+                if (mUnitsAndLimits->system() == tr("metric"))
+                {
+                    factor = mDeflectionScaleFactor;
                 }
+                else
+                {
+                    qreal footToMeter = 0.3048;
+                    factor            = mDeflectionScaleFactor * footToMeter;
+                }
+
+                drawDeflectedShape(painter,
+                                   (*mSolutionResult)->horizontalDeflectionComponents(),
+                                   (*mSolutionResult)->verticalDeflectionComponents(),
+                                   factor);
             }
         }
 
-        if (mSolutionDisplayOption == BAR_LOAD && !mBarLoadsList->isEmpty())
+        if (mSolutionDisplayOption == MECHANISM_MODE)
+        {
+            drawMechanismMode(painter, mInfluenceLoadBarIndex);
+        }
+
+        if (mSolutionDisplayOption == BAR_LOAD && hasBarLoads())
         {
             //Draw Bar Loads
 
@@ -848,8 +907,10 @@ void ModelViewer::updateModelPixmap()
 
             qreal epsilonMagnitudeSmall = 1.0e-12;
 
-            foreach (Bar *bar, *mBarsList)
+            for (int barIndex = 0; barIndex < mBarsList->size(); ++barIndex)
             {
+                Bar *bar = mBarsList->at(barIndex);
+
                 qreal xA = bar->firstJoint()->xCoordinate();
                 qreal yA = bar->firstJoint()->yCoordinate();
                 qreal xB = bar->secondJoint()->xCoordinate();
@@ -885,6 +946,15 @@ void ModelViewer::updateModelPixmap()
                 qreal x2 = bar->secondJoint()->xCoordinate() * mCoordinateScaleFactor;
                 qreal y2 = bar->secondJoint()->yCoordinate() * mCoordinateScaleFactor;
 
+                //Load bands are at most as wide as for loads in pounds
+
+                qreal bandWidth = 4.448e-3 * std::fabs((*mSolutionResult)->barLoad(barIndex) * mForceScaleFactor);
+
+                if (!isVisible(visibleRect, point(x1, y1), point(x2, y2), bandWidth / 2.0 + kCullingMargin))
+                {
+                    continue;
+                }
+
                 qreal xp = x1 / 3.0 + 2.0 * x2 / 3.0;
                 qreal yp = y1 / 3.0 + 2.0 * y2 / 3.0;
 
@@ -904,8 +974,7 @@ void ModelViewer::updateModelPixmap()
                     unitString = tr("lb");
                 }
 
-                int index     = mBarsList->indexOf(bar);
-                qreal barLoad = mBarLoadsList->at(index);
+                qreal barLoad = (*mSolutionResult)->barLoad(barIndex);
 
                 QString string(tr("%1 %2")
                                .arg(QString::number(barLoad, 'f', 1))
@@ -965,23 +1034,22 @@ void ModelViewer::updateModelPixmap()
             }
         }
 
-        if (mSolutionDisplayOption == SUPPORT_REACTION && !mReactionHorizontalComponentsList->isEmpty())
+        if (mSolutionDisplayOption == SUPPORT_REACTION && hasSupportReactions())
         {
             //Draw Support Reactions
 
-            foreach (Support *support, *mSupportsList)
+            for (int supportIndex = 0; supportIndex < mSupportsList->size(); ++supportIndex)
             {
-                Joint *joint = support->supportJoint();
+                Support *support = mSupportsList->at(supportIndex);
+                Joint *joint     = support->supportJoint();
 
                 painter.save();
                 qreal x = mCoordinateScaleFactor * joint->xCoordinate();
                 qreal y = mCoordinateScaleFactor * joint->yCoordinate();
                 painter.translate(point(x, y));
 
-                int index = mSupportsList->indexOf(support);
-
-                qreal horizontalComponent = mReactionHorizontalComponentsList->at(index);
-                qreal verticalComponent   = mReactionVerticalComponentsList->at(index);
+                qreal horizontalComponent = (*mSolutionResult)->reactionHorizontalComponent(supportIndex);
+                qreal verticalComponent   = (*mSolutionResult)->reactionVerticalComponent(supportIndex);
 
                 qreal scaledMagnitude       = 0.0;
                 qreal epsilonMagnitudeSmall = 1.0e-12;
@@ -1124,7 +1192,7 @@ void ModelViewer::updateModelPixmap()
 
                 int count = influenceLoad->path().size();
 
-                if (mInfluenceLoadResult->influenceLoadOrdinatesList(0).size() == count)
+                if (mInfluenceLoadResult->isComplete() && mInfluenceLoadResult->ordinatesCount() == count)
                 {
                     linePen.setColor(QColor(Qt::blue));
                     linePen.setWidth(1);
@@ -1133,17 +1201,9 @@ void ModelViewer::updateModelPixmap()
 
                     QPointF firstPoint;
 
-                    QList<qreal> ordinatesList;
-                    ordinatesList = mInfluenceLoadResult->influenceLoadOrdinatesList(mInfluenceLoadBarIndex);
-                    qreal maxOrdinateMagnitude = 1.0;
-
-                    foreach (qreal ordinate, ordinatesList)
-                    {
-                        if (std::fabs(ordinate) > maxOrdinateMagnitude)
-                        {
-                            maxOrdinateMagnitude = std::fabs(ordinate);
-                        }
-                    }
+                    InfluenceLoadOrdinatesSpan ordinatesList;
+                    ordinatesList              = mInfluenceLoadResult->barOrdinates(mInfluenceLoadBarIndex);
+                    qreal maxOrdinateMagnitude = qMax(1.0, ordinatesList.maxMagnitude());
 
                     qreal ordinateFactor = 0.75 * ((height() - 2.0 * mMarginOffset) / (2.0)) / maxOrdinateMagnitude;
 
@@ -1156,8 +1216,8 @@ void ModelViewer::updateModelPixmap()
                         qreal xA = jointA->xCoordinate() * mCoordinateScaleFactor;
                         qreal xB = jointB->xCoordinate() * mCoordinateScaleFactor;
                         qreal yo = (height() - 2.0 * mMarginOffset) / 2.0;
-                        qreal iA = mInfluenceLoadResult->influenceLoadOrdinatesList(mInfluenceLoadBarIndex).at(i);
-                        qreal iB = mInfluenceLoadResult->influenceLoadOrdinatesList(mInfluenceLoadBarIndex).at(i + 1);
+                        qreal iA = ordinatesList.at(i);
+                        qreal iB = ordinatesList.at(i + 1);
                         qreal yA = yo + iA * ordinateFactor;
                         qreal yB = yo + iB * ordinateFactor;
 
@@ -1206,22 +1266,251 @@ void ModelViewer::updateModelPixmap()
         }
     }
 
-    update();
 }
 
-QPixmap *ModelViewer::modelPixmap()
+QPixmap ModelViewer::modelPixmap() const
+{
+    QPixmap pixmap(width(), height());
+    pixmap.fill();
+
+    QPainter painter(&pixmap);
+    drawModel(painter, rect());
+
+    return pixmap;
+}
+
+QPixmap ModelViewer::tilePixmap(int column, int row) const
+{
+    QRect tileRect(column * kTileSize, row * kTileSize, kTileSize, kTileSize);
+
+    QPixmap pixmap(kTileSize, kTileSize);
+    pixmap.fill();
+
+    QPainter painter(&pixmap);
+    painter.translate(-tileRect.topLeft());
+    drawModel(painter, tileRect);
+
+    return pixmap;
+}
+
+quint64 ModelViewer::tileKey(int column, int row)
+{
+    return (quint64(quint32(column)) << 32) | quint32(row);
+}
+
+quint64 ModelViewer::combinedSignature(quint64 signature, quint64 value)
+{
+    return signature ^ (value + Q_UINT64_C(0x9E3779B97F4A7C15) + (signature << 6) + (signature >> 2));
+}
+
+quint64 ModelViewer::realSignature(qreal value)
+{
+    quint64 bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}
+
+bool ModelViewer::isVisible(const QRectF &rect, const QPointF &pointA, const QPointF &pointB, qreal margin)
+{
+    return (qMin(pointA.x(), pointB.x()) - margin <= rect.right())
+            && (qMax(pointA.x(), pointB.x()) + margin >= rect.left())
+            && (qMin(pointA.y(), pointB.y()) - margin <= rect.bottom())
+            && (qMax(pointA.y(), pointB.y()) + margin >= rect.top());
+}
+
+quint64 ModelViewer::displaySignature() const
+{
+    quint64 signature = 0;
+
+    signature = combinedSignature(signature, quint64(width()));
+    signature = combinedSignature(signature, quint64(height()));
+    signature = combinedSignature(signature, quint64(mMarginOffset));
+    signature = combinedSignature(signature, realSignature(mCoordinateScaleFactor));
+    signature = combinedSignature(signature, quint64(mDrawCoordinateAxes));
+    signature = combinedSignature(signature, quint64(mDrawJointNumber));
+    signature = combinedSignature(signature, quint64(mDrawBarNumber));
+    signature = combinedSignature(signature, quint64(mLoadDisplayOption));
+    signature = combinedSignature(signature, quint64(mSolutionDisplayOption));
+    signature = combinedSignature(signature, quint64(mInfluenceLoadBarIndex));
+    signature = combinedSignature(signature, realSignature(mForceScaleFactor));
+    signature = combinedSignature(signature, realSignature(mDeflectionScaleFactor));
+
+    return signature;
+}
+
+bool ModelViewer::hasTileSignatures() const
+{
+    return (mLoadDisplayOption == NO_LOAD) && (mSolutionDisplayOption == NO_SOLUTION);
+}
+
+QHash<quint64, quint64> ModelViewer::tileSignatures(const QList<quint64> &keys) const
+{
+    QHash<quint64, quint64> signatures;
+
+    if (!hasTileSignatures())
+    {
+        return signatures;
+    }
+
+    QRect tileRange;
+
+    foreach (quint64 key, keys)
+    {
+        signatures.insert(key, 0);
+        tileRange |= QRect(int(key >> 32), int(key & 0xFFFFFFFF), 1, 1);
+    }
+
+    if (signatures.isEmpty())
+    {
+        return signatures;
+    }
+
+    for (int jointIndex = 0; jointIndex < mJointsList->size(); ++jointIndex)
+    {
+        Joint *joint = mJointsList->at(jointIndex);
+
+        qreal x = mCoordinateScaleFactor * joint->xCoordinate();
+        qreal y = mCoordinateScaleFactor * joint->yCoordinate();
+
+        quint64 signature = combinedSignature(0, quint64(jointIndex));
+        signature         = combinedSignature(signature, realSignature(x));
+        signature         = combinedSignature(signature, realSignature(y));
+        signature         = combinedSignature(signature, quint64(joint->connectedJoints()->isEmpty()));
+
+        addTileSignature(signatures, tileRange, point(x, y), point(x, y), signature);
+    }
+
+    for (int barIndex = 0; barIndex < mBarsList->size(); ++barIndex)
+    {
+        Bar *bar = mBarsList->at(barIndex);
+
+        qreal x1 = mCoordinateScaleFactor * bar->firstJoint()->xCoordinate();
+        qreal y1 = mCoordinateScaleFactor * bar->firstJoint()->yCoordinate();
+        qreal x2 = mCoordinateScaleFactor * bar->secondJoint()->xCoordinate();
+        qreal y2 = mCoordinateScaleFactor * bar->secondJoint()->yCoordinate();
+
+        quint64 signature = combinedSignature(0, quint64(barIndex));
+        signature         = combinedSignature(signature, realSignature(x1));
+        signature         = combinedSignature(signature, realSignature(y1));
+        signature         = combinedSignature(signature, realSignature(x2));
+        signature         = combinedSignature(signature, realSignature(y2));
+
+        addTileSignature(signatures, tileRange, point(x1, y1), point(x2, y2), signature);
+    }
+
+    foreach (Support *support, *mSupportsList)
+    {
+        Joint *joint = support->supportJoint();
+
+        qreal x = mCoordinateScaleFactor * joint->xCoordinate();
+        qreal y = mCoordinateScaleFactor * joint->yCoordinate();
+
+        quint64 signature = combinedSignature(0, quint64(support->type()));
+        signature         = combinedSignature(signature, realSignature(support->angle()));
+        signature         = combinedSignature(signature, realSignature(x));
+        signature         = combinedSignature(signature, realSignature(y));
+
+        addTileSignature(signatures, tileRange, point(x, y), point(x, y), signature);
+    }
+
+    return signatures;
+}
+
+void ModelViewer::addTileSignature(QHash<quint64, quint64> &signatures,
+                                   const QRect             &tileRange,
+                                   const QPointF           &pointA,
+                                   const QPointF           &pointB,
+                                   quint64                 signature) const
 {
-    return mModelPixmap;
+    //Tiles reached by the item, in widget coordinates, limited to the tiles asked for
+
+    qreal left   = qMin(pointA.x(), pointB.x()) - kCullingMargin + mMarginOffset;
+    qreal right  = qMax(pointA.x(), pointB.x()) + kCullingMargin + mMarginOffset;
+    qreal top    = qMin(pointA.y(), pointB.y()) - kCullingMargin + height() - mMarginOffset;
+    qreal bottom = qMax(pointA.y(), pointB.y()) + kCullingMargin + height() - mMarginOffset;
+
+    qreal firstColumn = qMax(qreal(tileRange.left()), std::floor(left / kTileSize));
+    qreal lastColumn  = qMin(qreal(tileRange.right()), std::floor(right / kTileSize));
+    qreal firstRow    = qMax(qreal(tileRange.top()), std::floor(top / kTileSize));
+    qreal lastRow     = qMin(qreal(tileRange.bottom()), std::floor(bottom / kTileSize));
+
+    if ((firstColumn > lastColumn) || (firstRow > lastRow))
+    {
+        return;
+    }
+
+    for (int row = int(firstRow); row <= int(lastRow); ++row)
+    {
+        for (int column = int(firstColumn); column <= int(lastColumn); ++column)
+        {
+            QHash<quint64, quint64>::iterator i = signatures.find(tileKey(column, row));
+
+            if (i != signatures.end())
+            {
+                i.value() = combinedSignature(i.value(), signature);
+            }
+        }
+    }
 }
 
-void ModelViewer::paintEvent(QPaintEvent *)
+void ModelViewer::paintEvent(QPaintEvent *event)
 {
+    QRect exposedRect(event->rect() & rect());
+
+    if (exposedRect.isEmpty())
+    {
+        return;
+    }
+
+    int firstColumn = exposedRect.left() / kTileSize;
+    int lastColumn  = exposedRect.right() / kTileSize;
+    int firstRow    = exposedRect.top() / kTileSize;
+    int lastRow     = exposedRect.bottom() / kTileSize;
+
+    //Tiles not cached yet get their signatures in one pass over the model before they are drawn
+
+    QList<quint64> missingKeys;
+
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        for (int column = firstColumn; column <= lastColumn; ++column)
+        {
+            if (!mTileCache.contains(tileKey(column, row)))
+            {
+                missingKeys.append(tileKey(column, row));
+            }
+        }
+    }
+
+    QHash<quint64, quint64> signatures = tileSignatures(missingKeys);
+
     QPainter painter(this);
-    painter.drawPixmap(0,
-                       0,
-                       width(),
-                       height(),
-                       *mModelPixmap);
+
+    for (int row = firstRow; row <= lastRow; ++row)
+    {
+        for (int column = firstColumn; column <= lastColumn; ++column)
+        {
+            quint64 key = tileKey(column, row);
+            Tile *tile  = mTileCache.object(key);
+            QPixmap pixmap;
+
+            if (tile)
+            {
+                pixmap = tile->pixmap;
+            }
+            else
+            {
+                pixmap          = tilePixmap(column, row);
+                tile            = new Tile;
+                tile->pixmap    = pixmap;
+                tile->signature = signatures.value(key);
+                mTileCache.insert(key, tile);
+            }
+
+            painter.drawPixmap(column * kTileSize, row * kTileSize, pixmap);
+        }
+    }
 }
 
 void ModelViewer::mouseMoveEvent(QMouseEvent *event)
@@ -1247,57 +1536,55 @@ void ModelViewer::updateSize(int width,
 {
     resize(width, height);
     mMarginOffset = marginOffset;
-    delete mModelPixmap;
-    mModelPixmap = new QPixmap(width, height);
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::updateModel()
 {
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::showHideAxes(bool show)
 {
     mDrawCoordinateAxes = show;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::showHideJointNumber(bool show)
 {
     mDrawJointNumber = show;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::showHideBarNumber(bool show)
 {
     mDrawBarNumber = show;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::updateLoadDisplayOption(ModelViewer::LoadDisplayOption option)
 {
     mLoadDisplayOption = option;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::updateForceScaleFactor(qreal factor)
 {
     mForceScaleFactor = factor;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::updateSolutionDisplayOption(ModelViewer::SolutionDisplayOption option, int influenceLoadBarIndex)
 {
     mSolutionDisplayOption = option;
     mInfluenceLoadBarIndex = influenceLoadBarIndex;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 void ModelViewer::updateDeflectionScaleFactor(qreal factor)
 {
     mDeflectionScaleFactor = factor;
-    updateModelPixmap();
+    updateModelTiles();
 }
 
 QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
@@ -1394,8 +1681,10 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
         painter.setBrush(QBrush(QColor(Qt::white)));
 
-        foreach (Joint *joint, *mJointsList)
+        for (int jointIndex = 0; jointIndex < mJointsList->size(); ++jointIndex)
         {
+            Joint *joint = mJointsList->at(jointIndex);
+
             qreal x = mCoordinateScaleFactor * joint->xCoordinate();
             qreal y = mCoordinateScaleFactor * joint->yCoordinate();
 
@@ -1407,7 +1696,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
             if (mDrawJointNumber)
             {
-                int number = 1 + mJointsList->indexOf(joint);
+                int number = 1 + jointIndex;
                 w          = fontMetrics.boundingRect(QString::number(number)).width();
                 h          = fontMetrics.boundingRect(QString::number(number)).height();
 
@@ -1423,8 +1712,10 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
         painter.setPen(QColor(Qt::black));
 
-        foreach (Bar *bar, *mBarsList)
+        for (int barIndex = 0; barIndex < mBarsList->size(); ++barIndex)
         {
+            Bar *bar = mBarsList->at(barIndex);
+
             qreal x1 = mCoordinateScaleFactor * bar->firstJoint()->xCoordinate();
             qreal y1 = mCoordinateScaleFactor * bar->firstJoint()->yCoordinate();
             qreal x2 = mCoordinateScaleFactor * bar->secondJoint()->xCoordinate();
@@ -1436,7 +1727,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
             {
                 if (solutionDisplayOption != BAR_LOAD)
                 {
-                    int number = 1 + mBarsList->indexOf(bar);
+                    int number = 1 + barIndex;
                     w          = fontMetrics.boundingRect(QString::number(number)).width();
                     h          = fontMetrics.boundingRect(QString::number(number)).height();
                     radius     = qMax(w, h) / 1.5;
@@ -1611,7 +1902,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
         if ((loadDisplayOption == JOINT_LOAD_WITH_SELF_WEIGHT) || (loadDisplayOption == SELF_WEIGHT))
         {
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 checkA = true;
             }
@@ -1989,7 +2280,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
     if (solutionDisplayOption == JOINT_DEFLECTION)
     {
-        if (mBarsStandardItemModel->columnCount() == 5)
+        if (mBarsTableModel->columnCount() == 5)
         {
             //Draw joint deflections
 
@@ -1997,41 +2288,30 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
             linePen.setWidth(1);
             painter.setPen(linePen);
 
-            foreach (Bar *bar, *mBarsList)
-            {
-                Joint *jointA = bar->firstJoint();
-                Joint *jointB = bar->secondJoint();
-
-                int jointIndexA = mJointsList->indexOf(jointA);
-                int jointIndexB = mJointsList->indexOf(jointB);
-
-                qreal deflectionX1 = mHorizontalDeflectionComponentsList->at(jointIndexA);
-                qreal deflectionY1 = mVerticalDeflectionComponentsList->at(jointIndexA);
-                qreal deflectionX2 = mHorizontalDeflectionComponentsList->at(jointIndexB);
-                qreal deflectionY2 = mVerticalDeflectionComponentsList->at(jointIndexB);
-
-                qreal factor = 1.0;
-
-                if (mUnitsAndLimits->system() == tr("metric"))
-                {
-                    factor = mDeflectionScaleFactor;
-                }
-                else
-                {
-                    qreal footToMeter = 0.3048;
-                    factor            = mDeflectionScaleFactor * footToMeter;
-                }
-
-                qreal x1 = mCoordinateScaleFactor * jointA->xCoordinate() + factor * deflectionX1;
-                qreal y1 = mCoordinateScaleFactor * jointA->yCoordinate() + factor * deflectionY1;
-                qreal x2 = mCoordinateScaleFactor * jointB->xCoordinate() + factor * deflectionX2;
-                qreal y2 = mCoordinateScaleFactor * jointB->yCoordinate() + factor * deflectionY2;
+            qreal factor = 1.0;
 
-                painter.drawLine(point(x1, y1), point(x2, y2));
+            if (mUnitsAndLimits->system() == tr("metric"))
+            {
+                factor = mDeflectionScaleFactor;
+            }
+            else
+            {
+                qreal footToMeter = 0.3048;
+                factor            = mDeflectionScaleFactor * footToMeter;
             }
+
+            drawDeflectedShape(painter,
+                               (*mSolutionResult)->horizontalDeflectionComponents(),
+                               (*mSolutionResult)->verticalDeflectionComponents(),
+                               factor);
         }
     }
 
+    if (solutionDisplayOption == MECHANISM_MODE)
+    {
+        drawMechanismMode(painter, influenceLoadBarIndex);
+    }
+
     if (solutionDisplayOption == BAR_LOAD)
     {
         //Draw Bar Loads
@@ -2040,8 +2320,10 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
         qreal epsilonMagnitudeSmall = 1.0e-12;
 
-        foreach (Bar *bar, *mBarsList)
+        for (int barIndex = 0; barIndex < mBarsList->size(); ++barIndex)
         {
+            Bar *bar = mBarsList->at(barIndex);
+
             qreal xA = bar->firstJoint()->xCoordinate();
             qreal yA = bar->firstJoint()->yCoordinate();
             qreal xB = bar->secondJoint()->xCoordinate();
@@ -2096,8 +2378,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
                 unitString = tr("lb");
             }
 
-            int index     = mBarsList->indexOf(bar);
-            qreal barLoad = mBarLoadsList->at(index);
+            qreal barLoad = (*mSolutionResult)->barLoad(barIndex);
 
             QString string(tr("%1 %2")
                            .arg(QString::number(barLoad, 'f', 1))
@@ -2161,19 +2442,18 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
     {
         //Draw Support Reactions
 
-        foreach (Support *support, *mSupportsList)
+        for (int supportIndex = 0; supportIndex < mSupportsList->size(); ++supportIndex)
         {
-            Joint *joint = support->supportJoint();
+            Support *support = mSupportsList->at(supportIndex);
+            Joint *joint     = support->supportJoint();
 
             painter.save();
             qreal x = mCoordinateScaleFactor * joint->xCoordinate();
             qreal y = mCoordinateScaleFactor * joint->yCoordinate();
             painter.translate(point(x, y));
 
-            int index = mSupportsList->indexOf(support);
-
-            qreal horizontalComponent = mReactionHorizontalComponentsList->at(index);
-            qreal verticalComponent   = mReactionVerticalComponentsList->at(index);
+            qreal horizontalComponent = (*mSolutionResult)->reactionHorizontalComponent(supportIndex);
+            qreal verticalComponent   = (*mSolutionResult)->reactionVerticalComponent(supportIndex);
 
             qreal scaledMagnitude       = 0.0;
             qreal epsilonMagnitudeSmall = 1.0e-12;
@@ -2315,7 +2595,7 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
             int count = influenceLoad->path().size();
 
-            if (mInfluenceLoadResult->influenceLoadOrdinatesList(0).size() == count)
+            if (mInfluenceLoadResult->isComplete() && mInfluenceLoadResult->ordinatesCount() == count)
             {
                 QString s = tr("Bar # %1 influence line").arg(QString::number(influenceLoadBarIndex + 1));
                 w         = fontMetrics.boundingRect(s).width();
@@ -2334,17 +2614,9 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
 
                 QPointF firstPoint;
 
-                QList<qreal> ordinatesList;
-                ordinatesList              = mInfluenceLoadResult->influenceLoadOrdinatesList(influenceLoadBarIndex);
-                qreal maxOrdinateMagnitude = 1.0;
-
-                foreach (qreal ordinate, ordinatesList)
-                {
-                    if (std::fabs(ordinate) > maxOrdinateMagnitude)
-                    {
-                        maxOrdinateMagnitude = std::fabs(ordinate);
-                    }
-                }
+                InfluenceLoadOrdinatesSpan ordinatesList;
+                ordinatesList              = mInfluenceLoadResult->barOrdinates(influenceLoadBarIndex);
+                qreal maxOrdinateMagnitude = qMax(1.0, ordinatesList.maxMagnitude());
 
                 qreal ordinateFactor = 0.75 * ((height() - 2.0 * mMarginOffset) / (2.0)) / maxOrdinateMagnitude;
 
@@ -2357,8 +2629,8 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
                     qreal xA        = jointA->xCoordinate() * mCoordinateScaleFactor;
                     qreal xB        = jointB->xCoordinate() * mCoordinateScaleFactor;
                     qreal yo        = (height() - 2.0 * mMarginOffset) / 2.0;
-                    qreal iA        = mInfluenceLoadResult->influenceLoadOrdinatesList(influenceLoadBarIndex).at(i);
-                    qreal iB        = mInfluenceLoadResult->influenceLoadOrdinatesList(influenceLoadBarIndex).at(i + 1);
+                    qreal iA        = ordinatesList.at(i);
+                    qreal iB        = ordinatesList.at(i + 1);
                     qreal yA        = yo + iA * ordinateFactor;
                     qreal yB        = yo + iB * ordinateFactor;
 
@@ -2409,3 +2681,112 @@ QImage ModelViewer::modelImage(LoadDisplayOption loadDisplayOption,
     return image;
 }
 
+void ModelViewer::setMechanismModes(QList<QVector<qreal> > modesList)
+{
+    mMechanismModesList = modesList;
+
+    if (mSolutionDisplayOption == MECHANISM_MODE)
+    {
+        updateModelTiles();
+    }
+}
+
+int ModelViewer::mechanismModesCount() const
+{
+    return mMechanismModesList.size();
+}
+
+void ModelViewer::drawDeflectedShape(QPainter             &painter,
+                                     const QVector<qreal> &horizontalDeflections,
+                                     const QVector<qreal> &verticalDeflections,
+                                     qreal                factor) const
+{
+    //Draw the bars between their joints moved by the deflections times the factor
+
+    ModelIndex modelIndex(*mJointsList);
+
+    foreach (Bar *bar, *mBarsList)
+    {
+        Joint *jointA = bar->firstJoint();
+        Joint *jointB = bar->secondJoint();
+
+        int jointIndexA = modelIndex.jointIndex(jointA);
+        int jointIndexB = modelIndex.jointIndex(jointB);
+
+        qreal deflectionX1 = horizontalDeflections.at(jointIndexA);
+        qreal deflectionY1 = verticalDeflections.at(jointIndexA);
+        qreal deflectionX2 = horizontalDeflections.at(jointIndexB);
+        qreal deflectionY2 = verticalDeflections.at(jointIndexB);
+
+        qreal x1 = mCoordinateScaleFactor * jointA->xCoordinate() + factor * deflectionX1;
+        qreal y1 = mCoordinateScaleFactor * jointA->yCoordinate() + factor * deflectionY1;
+        qreal x2 = mCoordinateScaleFactor * jointB->xCoordinate() + factor * deflectionX2;
+        qreal y2 = mCoordinateScaleFactor * jointB->yCoordinate() + factor * deflectionY2;
+
+        painter.drawLine(point(x1, y1), point(x2, y2));
+    }
+}
+
+void ModelViewer::drawMechanismMode(QPainter &painter, int modeIndex) const
+{
+    //Draw a zero-energy mode as a deflected shape. Its largest joint movement is a fixed share of the model size,
+    //scaled further by the deflection scale factor relative to the default one.
+
+    if (modeIndex < 0 || modeIndex >= mMechanismModesList.size() || mJointsList->isEmpty())
+    {
+        return;
+    }
+
+    const QVector<qreal> &mode = mMechanismModesList.at(modeIndex);
+    int jointsCount            = mJointsList->size();
+
+    if (mode.size() != 2 * jointsCount)
+    {
+        return;
+    }
+
+    QVector<qreal> horizontalDeflections(jointsCount);
+    QVector<qreal> verticalDeflections(jointsCount);
+
+    qreal minX = mJointsList->first()->xCoordinate();
+    qreal maxX = minX;
+    qreal minY = mJointsList->first()->yCoordinate();
+    qreal maxY = minY;
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        horizontalDeflections[i] = mode.at(2 * i);
+        verticalDeflections[i]   = mode.at(2 * i + 1);
+
+        minX = qMin(minX, mJointsList->at(i)->xCoordinate());
+        maxX = qMax(maxX, mJointsList->at(i)->xCoordinate());
+        minY = qMin(minY, mJointsList->at(i)->yCoordinate());
+        maxY = qMax(maxY, mJointsList->at(i)->yCoordinate());
+    }
+
+    qreal modelSize = qMax(maxX - minX, maxY - minY);
+    qreal factor    = kMechanismModeAmplitude * modelSize * mCoordinateScaleFactor *
+            (mDeflectionScaleFactor / kDefaultDeflectionScaleFactor);
+
+    QPen linePen(QColor(Qt::red));
+    linePen.setWidth(1);
+    linePen.setStyle(Qt::DashLine);
+    painter.setPen(linePen);
+
+    drawDeflectedShape(painter, horizontalDeflections, verticalDeflections, factor);
+}
+
+bool ModelViewer::hasJointDeflections() const
+{
+    return mSolutionResult && !mSolutionResult->isNull() && (*mSolutionResult)->hasJointDeflections();
+}
+
+bool ModelViewer::hasBarLoads() const
+{
+    return mSolutionResult && !mSolutionResult->isNull() && (*mSolutionResult)->hasBarLoads();
+}
+
+bool ModelViewer::hasSupportReactions() const
+{
+    return mSolutionResult && !mSolutionResult->isNull() && (*mSolutionResult)->hasSupportReactions();
+}
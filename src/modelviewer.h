@@ -20,14 +20,22 @@
 #define MODELVIEWER_H
 
 #include <cmath>
+#include <cstring>
 
 #include <QApplication>
+#include <QCache>
 #include <QFontMetricsF>
+#include <QHash>
 #include <QImage>
+#include <QList>
 #include <QMouseEvent>
+#include <QPaintEvent>
 #include <QPainter>
-#include <QStandardItemModel>
+#include <QPixmap>
+#include <QRect>
+#include <QSharedPointer>
 #include <QtMath>
+#include <QVector>
 #include <QWidget>
 
 #include "bar.h"
@@ -36,6 +44,9 @@
 #include "influenceloadresult.h"
 #include "joint.h"
 #include "jointload.h"
+#include "modelindex.h"
+#include "modeltablemodel.h"
+#include "solutionresult.h"
 #include "support.h"
 #include "supportsettlement.h"
 #include "thermaleffect.h"
@@ -55,18 +66,12 @@ class ModelViewer : public QWidget
                     QList<ThermalEffect *>     *thermalEffectsList                 = 0,
                     QList<FabricationError *>  *fabricationErrorsList              = 0,
                     QList<InfluenceLoad *>     *influenceLoadsList                 = 0,
-                    QStandardItemModel         *barsStandardItemModel              = 0,
-                    QList<qreal>               *horizontalDeflectionComponentsList = 0,
-                    QList<qreal>               *verticalDeflectionComponentsList   = 0,
-                    QList<qreal>               *barLoadsList                       = 0,
-                    QList<qreal>               *reactionHorizontalComponentsList   = 0,
-                    QList<qreal>               *reactionVerticalComponentsList     = 0,
+                    ModelTableModel            *barsTableModel                     = 0,
+                    QSharedPointer<const SolutionResult> *solutionResult           = 0,
                     QString                    *solutionInfluenceLoadName          = 0,
                     InfluenceLoadResult        *influenceLoadResult                = 0,
                     QWidget                    *parent                             = 0);
 
-        ~ModelViewer();
-
         enum LoadDisplayOption
         {
             JOINT_LOAD,
@@ -85,6 +90,7 @@ class ModelViewer : public QWidget
             BAR_LOAD,
             SUPPORT_REACTION,
             INFLUENCE_LOAD_SOLUTION,
+            MECHANISM_MODE,
             NO_SOLUTION
         };
 
@@ -95,18 +101,38 @@ class ModelViewer : public QWidget
         static const int   kDefaultHeight = 400;
         static const qreal kRadius        = 2.5;
 
+        static const qreal kDefaultDeflectionScaleFactor = 10000.0;
+
+        //Largest joint movement of a drawn mechanism mode as a share of the model size
+        static const qreal kMechanismModeAmplitude = 0.1;
+
+        //Side in pixels of the square tiles the model is drawn and cached in
+        static const int kTileSize = 256;
+
+        //Tiles kept drawn, 64 MB at 32 bits a pixel
+        static const int kMaxCachedTiles = 256;
+
+        //Pixels beyond the joints of an item that its symbols, labels and load arrows may reach
+        static const qreal kCullingMargin = 150.0;
+
+        int mechanismModesCount() const;
+
         QPoint point(int x, int y) const;
 
         QPointF point(qreal x, qreal y) const;
 
-        void updateModelPixmap();
-        QPixmap *modelPixmap();
+        //Scale the model to the viewer and drop the cached tiles that no longer match it
+        void updateModelTiles();
+
+        //Whole model drawn at the viewer size
+        QPixmap modelPixmap() const;
+
         QImage modelImage(LoadDisplayOption     loadDisplayOption,
                           SolutionDisplayOption solutionDisplayOption,
                           int                   influenceLoadBarIndex);
 
     protected:
-        void paintEvent(QPaintEvent *);
+        void paintEvent(QPaintEvent *event);
         void mouseMoveEvent(QMouseEvent *event);
 
     signals:
@@ -124,9 +150,18 @@ class ModelViewer : public QWidget
         void updateForceScaleFactor(qreal factor);
         void updateSolutionDisplayOption(ModelViewer::SolutionDisplayOption option, int influenceLoadBarIndex);
         void updateDeflectionScaleFactor(qreal factor);
+        void setMechanismModes(QList<QVector<qreal> > modesList);
 
     private:
-        QPixmap                    *mModelPixmap;
+        //Drawn tile and the signature of the joints, bars and supports that reach it
+        struct Tile
+        {
+            QPixmap pixmap;
+            quint64 signature;
+        };
+
+        QCache<quint64, Tile>      mTileCache;
+        quint64                    mDisplaySignature;
         QList<Joint *>             *mJointsList;
         QList<Bar *>               *mBarsList;
         QList<Support *>           *mSupportsList;
@@ -135,12 +170,8 @@ class ModelViewer : public QWidget
         QList<ThermalEffect *>     *mThermalEffectsList;
         QList<FabricationError *>  *mFabricationErrorsList;
         QList<InfluenceLoad *>     *mInfluenceLoadsList;
-        QStandardItemModel         *mBarsStandardItemModel;
-        QList<qreal>               *mHorizontalDeflectionComponentsList;
-        QList<qreal>               *mVerticalDeflectionComponentsList;
-        QList<qreal>               *mBarLoadsList;
-        QList<qreal>               *mReactionHorizontalComponentsList;
-        QList<qreal>               *mReactionVerticalComponentsList;
+        ModelTableModel            *mBarsTableModel;
+        QSharedPointer<const SolutionResult> *mSolutionResult;
         QString                    *mSolutionInfluenceLoadName;
         InfluenceLoadResult        *mInfluenceLoadResult;
         qreal                      mCoordinateScaleFactor;
@@ -154,6 +185,45 @@ class ModelViewer : public QWidget
         int                        mInfluenceLoadBarIndex;
         qreal                      mForceScaleFactor;
         qreal                      mDeflectionScaleFactor;
+        QList<QVector<qreal> >     mMechanismModesList;
+
+        void updateCoordinateScaleFactor();
+
+        //Draw the parts of the model reaching the region, given in viewer coordinates
+        void drawModel(QPainter &painter, const QRect &region) const;
+
+        QPixmap tilePixmap(int column, int row) const;
+
+        static quint64 tileKey(int column, int row);
+        static quint64 combinedSignature(quint64 signature, quint64 value);
+        static quint64 realSignature(qreal value);
+
+        //Check if the box around two points, widened by the margin, meets the rectangle
+        static bool isVisible(const QRectF &rect, const QPointF &pointA, const QPointF &pointB, qreal margin);
+
+        //Signature of the display options and scale, which every tile depends on
+        quint64 displaySignature() const;
+
+        //Tiles are told apart by their joints, bars and supports only while no loads or solution are shown, and are
+        //all dropped on every update otherwise
+        bool hasTileSignatures() const;
+        QHash<quint64, quint64> tileSignatures(const QList<quint64> &keys) const;
+        void addTileSignature(QHash<quint64, quint64> &signatures,
+                              const QRect             &tileRange,
+                              const QPointF           &pointA,
+                              const QPointF           &pointB,
+                              quint64                 signature) const;
+
+        void drawDeflectedShape(QPainter             &painter,
+                                const QVector<qreal> &horizontalDeflections,
+                                const QVector<qreal> &verticalDeflections,
+                                qreal                factor) const;
+
+        void drawMechanismMode(QPainter &painter, int modeIndex) const;
+
+        bool hasJointDeflections() const;
+        bool hasBarLoads() const;
+        bool hasSupportReactions() const;
 };
 
 #endif // MODELVIEWER_H
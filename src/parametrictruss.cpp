@@ -0,0 +1,586 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* parametrictruss.cpp */
+
+#include "parametrictruss.h"
+
+ParametricTruss::ParametricTruss(Topology topology,
+                                 int      panelsCount,
+                                 qreal    panelLength,
+                                 qreal    depth,
+                                 qreal    camber,
+                                 int      rowsCount)
+{
+    mTopology    = topology;
+    mPanelsCount = qMax(minPanelsCount(topology), panelsCount);
+    mPanelLength = panelLength;
+    mDepth       = depth;
+    mCamber      = camber;
+    mRowsCount   = hasRows(topology) ? qMax(1, rowsCount) : 1;
+    mPinnedJoint = 0;
+    mRollerJoint = mPanelsCount;
+
+    if ((topology == K_TRUSS || topology == FAN_TRUSS) && mPanelsCount % 2 != 0)
+    {
+        ++mPanelsCount;
+        mRollerJoint = mPanelsCount;
+    }
+
+    mAreas.fill(1.0, kMemberGroupsCount);
+    mModuli.fill(1.0, kMemberGroupsCount);
+    mFactors.fill(1.0, kMemberGroupsCount);
+    mUnitWeights.fill(0.0, kMemberGroupsCount);
+
+    generateBottomChord();
+
+    switch (topology)
+    {
+        case PRATT_TRUSS:
+            generatePrattTruss(false);
+            break;
+        case HOWE_TRUSS:
+            generatePrattTruss(true);
+            break;
+        case WARREN_TRUSS:
+            generateWarrenTruss();
+            break;
+        case K_TRUSS:
+            generateKTruss();
+            break;
+        case BOWSTRING_TRUSS:
+            generateBowstringTruss();
+            break;
+        case FAN_TRUSS:
+            generateFanTruss();
+            break;
+        case GRID:
+            generateGrid();
+            break;
+        case TRIANGULATED_GRID:
+            generateTriangulatedGrid();
+            break;
+        default:
+            break;
+    }
+}
+
+ParametricTruss::~ParametricTruss()
+{
+
+}
+
+int ParametricTruss::minPanelsCount(Topology topology)
+{
+    switch (topology)
+    {
+        case PRATT_TRUSS:
+        case HOWE_TRUSS:
+        case K_TRUSS:
+        case BOWSTRING_TRUSS:
+            return 2;
+        case FAN_TRUSS:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+bool ParametricTruss::hasRows(Topology topology)
+{
+    return (topology == GRID || topology == TRIANGULATED_GRID);
+}
+
+ParametricTruss::Topology ParametricTruss::topology() const
+{
+    return mTopology;
+}
+
+int ParametricTruss::panelsCount() const
+{
+    return mPanelsCount;
+}
+
+qreal ParametricTruss::panelLength() const
+{
+    return mPanelLength;
+}
+
+qreal ParametricTruss::depth() const
+{
+    return mDepth;
+}
+
+qreal ParametricTruss::camber() const
+{
+    return mCamber;
+}
+
+int ParametricTruss::rowsCount() const
+{
+    return mRowsCount;
+}
+
+qreal ParametricTruss::width() const
+{
+    return mPanelsCount * mPanelLength;
+}
+
+qreal ParametricTruss::height() const
+{
+    qreal yMax = 0.0;
+
+    foreach (const Point &point, mJoints)
+    {
+        yMax = qMax(yMax, qreal(point.yCoordinate()));
+    }
+
+    return yMax;
+}
+
+const QVector<Point> &ParametricTruss::joints() const
+{
+    return mJoints;
+}
+
+const QVector<ParametricTruss::Member> &ParametricTruss::members() const
+{
+    return mMembers;
+}
+
+int ParametricTruss::pinnedJoint() const
+{
+    return mPinnedJoint;
+}
+
+int ParametricTruss::rollerJoint() const
+{
+    return mRollerJoint;
+}
+
+qreal ParametricTruss::minMemberLength() const
+{
+    qreal minLength = 0.0;
+
+    for (int i = 0; i < mMembers.size(); ++i)
+    {
+        const Point &firstPoint  = mJoints.at(mMembers.at(i).firstJoint);
+        const Point &secondPoint = mJoints.at(mMembers.at(i).secondJoint);
+
+        qreal length = std::sqrt(std::pow(secondPoint.xCoordinate() - firstPoint.xCoordinate(), 2.0)
+                                 + std::pow(secondPoint.yCoordinate() - firstPoint.yCoordinate(), 2.0));
+
+        if (i == 0 || length < minLength)
+        {
+            minLength = length;
+        }
+    }
+
+    return minLength;
+}
+
+qreal ParametricTruss::maxMemberLength() const
+{
+    qreal maxLength = 0.0;
+
+    foreach (const Member &member, mMembers)
+    {
+        const Point &firstPoint  = mJoints.at(member.firstJoint);
+        const Point &secondPoint = mJoints.at(member.secondJoint);
+
+        qreal length = std::sqrt(std::pow(secondPoint.xCoordinate() - firstPoint.xCoordinate(), 2.0)
+                                 + std::pow(secondPoint.yCoordinate() - firstPoint.yCoordinate(), 2.0));
+
+        maxLength = qMax(maxLength, length);
+    }
+
+    return maxLength;
+}
+
+qreal ParametricTruss::xOffset(const QList<Joint *> &jointsList) const
+{
+    if (jointsList.isEmpty())
+    {
+        return 0.0;
+    }
+
+    qreal xMax = jointsList.first()->xCoordinate();
+
+    foreach (Joint *joint, jointsList)
+    {
+        xMax = qMax(xMax, joint->xCoordinate());
+    }
+
+    return xMax + mPanelLength;
+}
+
+void ParametricTruss::setSection(MemberGroup group,
+                                 qreal       area,
+                                 qreal       modulus,
+                                 qreal       factor,
+                                 qreal       unitWeight)
+{
+    mAreas[group]       = area;
+    mModuli[group]      = modulus;
+    mFactors[group]     = factor;
+    mUnitWeights[group] = unitWeight;
+}
+
+qreal ParametricTruss::area(MemberGroup group) const
+{
+    return mAreas.at(group);
+}
+
+qreal ParametricTruss::modulus(MemberGroup group) const
+{
+    return mModuli.at(group);
+}
+
+qreal ParametricTruss::factor(MemberGroup group) const
+{
+    return mFactors.at(group);
+}
+
+qreal ParametricTruss::unitWeight(MemberGroup group) const
+{
+    return mUnitWeights.at(group);
+}
+
+qreal ParametricTruss::camberRise(qreal x) const
+{
+    qreal span = width();
+
+    return 4.0 * mCamber * x * (span - x) / (span * span);
+}
+
+int ParametricTruss::addJoint(qreal x, qreal y)
+{
+    mJoints.append(Point(x, y));
+
+    return mJoints.size() - 1;
+}
+
+void ParametricTruss::addMember(int firstJoint, int secondJoint, MemberGroup group)
+{
+    Member member;
+    member.firstJoint  = firstJoint;
+    member.secondJoint = secondJoint;
+    member.group       = group;
+
+    mMembers.append(member);
+}
+
+void ParametricTruss::generateBottomChord()
+{
+    int n = mPanelsCount;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        qreal x = i * mPanelLength;
+        addJoint(x, camberRise(x));
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addMember(i, i + 1, BOTTOM_CHORD);
+    }
+}
+
+void ParametricTruss::generatePrattTruss(bool howe)
+{
+    //Top chord joints n + 1 to 2n - 1 above bottom joints 1 to n - 1, with inclined end posts in the top chord
+
+    int n = mPanelsCount;
+
+    for (int i = 1; i < n; ++i)
+    {
+        qreal x = i * mPanelLength;
+        addJoint(x, camberRise(x) + mDepth);
+    }
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        addMember(n + i, n + i + 1, TOP_CHORD);
+    }
+
+    addMember(0, n + 1, TOP_CHORD);
+    addMember(n, 2 * n - 1, TOP_CHORD);
+
+    for (int i = 1; i < n; ++i)
+    {
+        addMember(i, n + i, VERTICAL);
+    }
+
+    //Pratt diagonals slope down towards midspan, Howe diagonals slope up towards midspan
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        bool descending = (2 * i < n);
+
+        if (howe)
+        {
+            descending = !descending;
+        }
+
+        if (descending)
+        {
+            addMember(n + i, i + 1, DIAGONAL);
+        }
+        else
+        {
+            addMember(i, n + i + 1, DIAGONAL);
+        }
+    }
+}
+
+void ParametricTruss::generateWarrenTruss()
+{
+    //Top chord joints n + 1 to 2n above the panel midpoints
+
+    int n = mPanelsCount;
+
+    for (int i = 0; i < n; ++i)
+    {
+        qreal x = (i + 0.5) * mPanelLength;
+        addJoint(x, camberRise(x) + mDepth);
+    }
+
+    for (int i = 0; i < n - 1; ++i)
+    {
+        addMember(n + 1 + i, n + 2 + i, TOP_CHORD);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addMember(i, n + 1 + i, DIAGONAL);
+        addMember(n + 1 + i, i + 1, DIAGONAL);
+    }
+}
+
+void ParametricTruss::generateKTruss()
+{
+    //Top chord joints n + 1 to 2n + 1 and mid-height joints 2n + 2 to 3n on the interior verticals, each braced by
+    //a pair of diagonals to the vertical on its side of midspan
+
+    int n = mPanelsCount;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        qreal x = i * mPanelLength;
+        addJoint(x, camberRise(x) + mDepth);
+    }
+
+    for (int i = 1; i < n; ++i)
+    {
+        qreal x = i * mPanelLength;
+        addJoint(x, camberRise(x) + 0.5 * mDepth);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        addMember(n + 1 + i, n + 2 + i, TOP_CHORD);
+    }
+
+    addMember(0, n + 1, VERTICAL);
+    addMember(n, 2 * n + 1, VERTICAL);
+
+    for (int i = 1; i < n; ++i)
+    {
+        int midJoint = 2 * n + 1 + i;
+
+        addMember(i, midJoint, VERTICAL);
+        addMember(midJoint, n + 1 + i, VERTICAL);
+
+        if (2 * i <= n)
+        {
+            addMember(midJoint, i - 1, DIAGONAL);
+            addMember(midJoint, n + i, DIAGONAL);
+        }
+
+        if (2 * i >= n)
+        {
+            addMember(midJoint, i + 1, DIAGONAL);
+            addMember(midJoint, n + 2 + i, DIAGONAL);
+        }
+    }
+}
+
+void ParametricTruss::generateBowstringTruss()
+{
+    //Top chord joints n + 1 to 2n - 1 on a parabolic arch of rise equal to the depth, springing from the end joints
+    //of the bottom chord
+
+    int n      = mPanelsCount;
+    qreal span = width();
+
+    for (int i = 1; i < n; ++i)
+    {
+        qreal x = i * mPanelLength;
+        addJoint(x, camberRise(x) + 4.0 * mDepth * x * (span - x) / (span * span));
+    }
+
+    addMember(0, n + 1, TOP_CHORD);
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        addMember(n + i, n + i + 1, TOP_CHORD);
+    }
+
+    addMember(2 * n - 1, n, TOP_CHORD);
+
+    for (int i = 1; i < n; ++i)
+    {
+        addMember(i, n + i, VERTICAL);
+    }
+
+    for (int i = 1; i < n - 1; ++i)
+    {
+        if (2 * i < n)
+        {
+            addMember(n + i, i + 1, DIAGONAL);
+        }
+        else
+        {
+            addMember(i, n + i + 1, DIAGONAL);
+        }
+    }
+}
+
+void ParametricTruss::generateFanTruss()
+{
+    //Pitched top chord with joints n + 1 to n + m - 1 above every second bottom joint, m = n / 2, each fanning out
+    //to the bottom joint below it and the bottom joints on either side
+
+    int n      = mPanelsCount;
+    int m      = n / 2;
+    qreal span = width();
+
+    for (int k = 1; k < m; ++k)
+    {
+        qreal x = 2 * k * mPanelLength;
+        addJoint(x, camberRise(x) + mDepth * (1.0 - std::fabs(2.0 * x / span - 1.0)));
+    }
+
+    addMember(0, n + 1, TOP_CHORD);
+
+    for (int k = 1; k < m - 1; ++k)
+    {
+        addMember(n + k, n + k + 1, TOP_CHORD);
+    }
+
+    addMember(n + m - 1, n, TOP_CHORD);
+
+    for (int k = 1; k < m; ++k)
+    {
+        addMember(2 * k, n + k, VERTICAL);
+        addMember(2 * k - 1, n + k, DIAGONAL);
+        addMember(2 * k + 1, n + k, DIAGONAL);
+    }
+}
+
+void ParametricTruss::generateGrid()
+{
+    //Rows of n + 1 joints above the bottom chord, each cell braced by one diagonal mirrored about the middle column
+
+    int n              = mPanelsCount;
+    int rowJointsCount = n + 1;
+    qreal rowHeight    = mDepth / mRowsCount;
+
+    for (int r = 1; r <= mRowsCount; ++r)
+    {
+        for (int c = 0; c <= n; ++c)
+        {
+            qreal x = c * mPanelLength;
+            addJoint(x, camberRise(x) + r * rowHeight);
+        }
+
+        for (int c = 0; c < n; ++c)
+        {
+            addMember(r * rowJointsCount + c, r * rowJointsCount + c + 1, TOP_CHORD);
+        }
+    }
+
+    for (int r = 0; r < mRowsCount; ++r)
+    {
+        for (int c = 0; c <= n; ++c)
+        {
+            addMember(r * rowJointsCount + c, (r + 1) * rowJointsCount + c, VERTICAL);
+        }
+
+        for (int c = 0; c < n; ++c)
+        {
+            if (2 * c < n)
+            {
+                addMember(r * rowJointsCount + c, (r + 1) * rowJointsCount + c + 1, DIAGONAL);
+            }
+            else
+            {
+                addMember(r * rowJointsCount + c + 1, (r + 1) * rowJointsCount + c, DIAGONAL);
+            }
+        }
+    }
+}
+
+void ParametricTruss::generateTriangulatedGrid()
+{
+    //Rows of joints alternately at the panel points and at the panel midpoints, every joint braced to the two
+    //nearest joints of the rows above and below, as in the side view of a double layer space frame
+
+    int n           = mPanelsCount;
+    qreal rowHeight = mDepth / mRowsCount;
+
+    QVector<int> rowStarts;
+    rowStarts.append(0);
+
+    for (int r = 1; r <= mRowsCount; ++r)
+    {
+        rowStarts.append(mJoints.size());
+
+        int rowJointsCount = (r % 2 == 0) ? n + 1 : n;
+        qreal xStart       = (r % 2 == 0) ? 0.0 : 0.5 * mPanelLength;
+
+        for (int c = 0; c < rowJointsCount; ++c)
+        {
+            qreal x = xStart + c * mPanelLength;
+            addJoint(x, camberRise(x) + r * rowHeight);
+        }
+
+        for (int c = 0; c < rowJointsCount - 1; ++c)
+        {
+            addMember(rowStarts.at(r) + c, rowStarts.at(r) + c + 1, TOP_CHORD);
+        }
+    }
+
+    for (int r = 0; r < mRowsCount; ++r)
+    {
+        int lowerStart = rowStarts.at(r);
+        int upperStart = rowStarts.at(r + 1);
+
+        for (int c = 0; c < n; ++c)
+        {
+            if (r % 2 == 0)
+            {
+                addMember(lowerStart + c, upperStart + c, DIAGONAL);
+                addMember(upperStart + c, lowerStart + c + 1, DIAGONAL);
+            }
+            else
+            {
+                addMember(lowerStart + c, upperStart + c, DIAGONAL);
+                addMember(lowerStart + c, upperStart + c + 1, DIAGONAL);
+            }
+        }
+    }
+}
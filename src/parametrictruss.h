@@ -0,0 +1,163 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* parametrictruss.h */
+
+#ifndef PARAMETRICTRUSS_H
+#define PARAMETRICTRUSS_H
+
+#include <cmath>
+
+#include <QList>
+#include <QVector>
+#include <QtGlobal>
+
+#include "joint.h"
+#include "point.h"
+
+//Joints, members and supports of a standard plane truss laid out from its panel count, panel length, depth and
+//camber. The layout places joints apart and lets members meet only at their end joints, so that a model can take
+//the whole truss in bulk without checking each joint and bar against the others. Joints and members are numbered
+//from 0 in the order they are generated, bottom chord first.
+class ParametricTruss
+{
+    public:
+        enum Topology
+        {
+            PRATT_TRUSS,
+            HOWE_TRUSS,
+            WARREN_TRUSS,
+            K_TRUSS,
+            BOWSTRING_TRUSS,
+            FAN_TRUSS,
+            GRID,
+            TRIANGULATED_GRID
+        };
+
+        //Grids put the horizontals of the bottom row in the bottom chord group and all other horizontals in the
+        //top chord group
+        enum MemberGroup
+        {
+            TOP_CHORD,
+            BOTTOM_CHORD,
+            VERTICAL,
+            DIAGONAL
+        };
+
+        struct Member
+        {
+            int         firstJoint;
+            int         secondJoint;
+            MemberGroup group;
+        };
+
+        //Panel counts below the minimum of the topology are raised to it, and K and fan trusses take an even count
+        ParametricTruss(Topology topology    = PRATT_TRUSS,
+                        int      panelsCount = 4,
+                        qreal    panelLength = 1.0,
+                        qreal    depth       = 1.0,
+                        qreal    camber      = 0.0,
+                        int      rowsCount   = 1);
+
+        ~ParametricTruss();
+
+        static const int kMemberGroupsCount = 4;
+
+        static int minPanelsCount(Topology topology);
+
+        static bool hasRows(Topology topology);
+
+        Topology topology() const;
+
+        int panelsCount() const;
+
+        qreal panelLength() const;
+
+        qreal depth() const;
+
+        qreal camber() const;
+
+        int rowsCount() const;
+
+        qreal width() const;
+
+        qreal height() const;
+
+        const QVector<Point> &joints() const;
+
+        const QVector<Member> &members() const;
+
+        //Pinned joint at the left end and roller joint at the right end of the bottom chord
+        int pinnedJoint() const;
+
+        int rollerJoint() const;
+
+        qreal minMemberLength() const;
+
+        qreal maxMemberLength() const;
+
+        //Offset along x that places the truss one panel to the right of the rightmost joint of a model
+        qreal xOffset(const QList<Joint *> &jointsList) const;
+
+        void setSection(MemberGroup group,
+                        qreal       area,
+                        qreal       modulus,
+                        qreal       factor,
+                        qreal       unitWeight);
+
+        qreal area(MemberGroup group) const;
+
+        qreal modulus(MemberGroup group) const;
+
+        qreal factor(MemberGroup group) const;
+
+        qreal unitWeight(MemberGroup group) const;
+
+    private:
+        Topology        mTopology;
+        int             mPanelsCount;
+        qreal           mPanelLength;
+        qreal           mDepth;
+        qreal           mCamber;
+        int             mRowsCount;
+        QVector<Point>  mJoints;
+        QVector<Member> mMembers;
+        int             mPinnedJoint;
+        int             mRollerJoint;
+        QVector<qreal>  mAreas;
+        QVector<qreal>  mModuli;
+        QVector<qreal>  mFactors;
+        QVector<qreal>  mUnitWeights;
+
+        //Rise of the cambered bottom chord, parabolic over the span and largest at midspan
+        qreal camberRise(qreal x) const;
+
+        int addJoint(qreal x, qreal y);
+        void addMember(int firstJoint, int secondJoint, MemberGroup group);
+
+        //Bottom chord joints 0 to n along the cambered chord
+        void generateBottomChord();
+
+        void generatePrattTruss(bool howe);
+        void generateWarrenTruss();
+        void generateKTruss();
+        void generateBowstringTruss();
+        void generateFanTruss();
+        void generateGrid();
+        void generateTriangulatedGrid();
+};
+
+#endif // PARAMETRICTRUSS_H
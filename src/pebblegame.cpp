@@ -0,0 +1,164 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* pebblegame.cpp */
+
+#include "pebblegame.h"
+
+PebbleGame::PebbleGame(int verticesCount)
+{
+    mVerticesCount = verticesCount;
+    mFreePebbles   = 2 * verticesCount;
+    mStamp         = 0;
+
+    //Each vertex covers at most two edges, held in two out edge slots
+
+    mPebbles      = QVector<int>(verticesCount, 2);
+    mOutEdges     = QVector<int>(2 * verticesCount, -1);
+    mVisited      = QVector<int>(verticesCount, 0);
+    mPredecessors = QVector<int>(verticesCount, -1);
+    mStack.reserve(verticesCount);
+}
+
+PebbleGame::~PebbleGame()
+{
+
+}
+
+bool PebbleGame::addEdge(int first, int second)
+{
+    if (first == second)
+    {
+        return false;
+    }
+
+    while (mPebbles.at(first) < 2 && collectPebble(first, second))
+    {
+
+    }
+
+    while (mPebbles.at(second) < 2 && collectPebble(second, first))
+    {
+
+    }
+
+    if (mPebbles.at(first) + mPebbles.at(second) < 4)
+    {
+        return false;
+    }
+
+    --mPebbles[first];
+    --mFreePebbles;
+
+    int slot = (mOutEdges.at(2 * first) == -1) ? 2 * first : 2 * first + 1;
+    mOutEdges[slot] = second;
+
+    return true;
+}
+
+int PebbleGame::freePebbles() const
+{
+    return mFreePebbles;
+}
+
+int PebbleGame::degreesOfFreedom() const
+{
+    return qMax(0, mFreePebbles - 3);
+}
+
+QList<int> PebbleGame::flexibleVertices(int first, int second)
+{
+    while (mPebbles.at(first) < 2 && collectPebble(first, second))
+    {
+
+    }
+
+    while (mPebbles.at(second) < 1 && collectPebble(second, first))
+    {
+
+    }
+
+    QList<int> verticesList;
+
+    for (int i = 0; i < mVerticesCount; ++i)
+    {
+        if (i != first && i != second && mPebbles.at(i) > 0)
+        {
+            verticesList.append(i);
+        }
+    }
+
+    return verticesList;
+}
+
+bool PebbleGame::collectPebble(int vertex, int blocked)
+{
+    ++mStamp;
+
+    mVisited[vertex]      = mStamp;
+    mVisited[blocked]     = mStamp;
+    mPredecessors[vertex] = -1;
+
+    mStack.clear();
+    mStack.append(vertex);
+
+    while (!mStack.isEmpty())
+    {
+        int current = mStack.last();
+        mStack.removeLast();
+
+        for (int k = 0; k < 2; ++k)
+        {
+            int next = mOutEdges.at(2 * current + k);
+
+            if (next < 0 || mVisited.at(next) == mStamp)
+            {
+                continue;
+            }
+
+            mVisited[next]      = mStamp;
+            mPredecessors[next] = current;
+
+            if (mPebbles.at(next) > 0)
+            {
+                //Reverse the path from its far end, where a slot is free, so that every vertex keeps two slots
+
+                int target = next;
+
+                while (target != vertex)
+                {
+                    int source = mPredecessors.at(target);
+                    int slot   = (mOutEdges.at(2 * source) == target) ? 2 * source : 2 * source + 1;
+
+                    mOutEdges[slot] = -1;
+                    slot            = (mOutEdges.at(2 * target) == -1) ? 2 * target : 2 * target + 1;
+                    mOutEdges[slot] = source;
+
+                    target = source;
+                }
+
+                --mPebbles[next];
+                ++mPebbles[vertex];
+
+                return true;
+            }
+
+            mStack.append(next);
+        }
+    }
+
+    return false;
+}
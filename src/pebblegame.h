@@ -0,0 +1,62 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* pebblegame.h */
+
+#ifndef PEBBLEGAME_H
+#define PEBBLEGAME_H
+
+#include <QList>
+#include <QVector>
+
+//Two dimensional (2, 3) pebble game on a graph whose vertices are numbered from zero. Every vertex starts with two
+//pebbles and an edge is independent when four pebbles can be gathered on its ends, one of which then covers it. A
+//graph is generically rigid (Laman) when three pebbles are left after all its edges have been played, every extra
+//pebble being a degree of freedom of a generic mechanism.
+class PebbleGame
+{
+    public:
+        explicit PebbleGame(int verticesCount);
+
+        ~PebbleGame();
+
+        //Returns false for an edge redundant within a region that is already rigid
+        bool addEdge(int first, int second);
+
+        int freePebbles() const;
+
+        int degreesOfFreedom() const;
+
+        //Gather the three rigid body pebbles on the ends of an independent edge and return the other vertices still
+        //holding pebbles, which lie in the flexible regions
+        QList<int> flexibleVertices(int first, int second);
+
+    private:
+        //Move a pebble to the vertex along a path of covered edges, reversing the path, without passing the blocked
+        //vertex
+        bool collectPebble(int vertex, int blocked);
+
+        int          mVerticesCount;
+        int          mFreePebbles;
+        int          mStamp;
+        QVector<int> mPebbles;
+        QVector<int> mOutEdges;
+        QVector<int> mVisited;
+        QVector<int> mPredecessors;
+        QVector<int> mStack;
+};
+
+#endif // PEBBLEGAME_H
@@ -0,0 +1,142 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* scriptengine.cpp */
+
+#include "scriptengine.h"
+
+ScriptEngine::ScriptEngine(Solver *solver, QObject *parent) : QObject(parent)
+{
+    mIsHeadless = (solver == 0);
+
+    if (mIsHeadless)
+    {
+        mModelScript = new ModelScript(this);
+    }
+    else
+    {
+        mModelScript = new ModelScript(solver, this);
+    }
+
+    //The engine is kept from deleting this object, which need not have a parent
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+
+    mEngine = new QJSEngine(this);
+
+    QJSValue globalObject = mEngine->globalObject();
+    globalObject.setProperty(QString("model"), mEngine->newQObject(mModelScript));
+
+    QJSValue install = mEngine->evaluate(QString(
+        "(function (api) {"
+        "    this.print = function () {"
+        "        var texts = [];"
+        "        for (var i = 0; i < arguments.length; ++i) {"
+        "            var argument = arguments[i];"
+        "            texts.push((argument !== null && typeof argument === 'object') ? JSON.stringify(argument)"
+        "                                                                           : String(argument));"
+        "        }"
+        "        api.print(texts.join(' '));"
+        "    };"
+        "    this.newModel = function () { return api.newModel(); };"
+        "    this.openModel = function (fileName) { return api.openModel(fileName); };"
+        "})"));
+
+    install.callWithInstance(globalObject, QJSValueList() << mEngine->newQObject(this));
+}
+
+ScriptEngine::~ScriptEngine()
+{
+    qDeleteAll(mOpenedModels);
+}
+
+bool ScriptEngine::evaluate(const QString &program, const QString &fileName)
+{
+    QJSValue result = mEngine->evaluate(program, fileName);
+
+    //Publish the edits of the script to the model and close the models it opened
+    mModelScript->commit();
+    qDeleteAll(mOpenedModels);
+    mOpenedModels.clear();
+
+    if (result.isError())
+    {
+        write(tr("%1:%2: %3")
+              .arg(fileName.isEmpty() ? tr("console") : fileName)
+              .arg(result.property(QString("lineNumber")).toInt())
+              .arg(result.toString()), true);
+        return false;
+    }
+
+    if (fileName.isEmpty() && !result.isUndefined())
+    {
+        write(result.toString(), false);
+    }
+
+    return true;
+}
+
+bool ScriptEngine::evaluateFile(const QString &fileName)
+{
+    QFile file(fileName);
+
+    if (!file.open(QFile::ReadOnly | QFile::Text))
+    {
+        write(tr("Cannot read file %1:\n%2.").arg(fileName).arg(file.errorString()), true);
+        return false;
+    }
+
+    QTextStream in(&file);
+    in.setCodec("UTF-8");
+
+    return evaluate(in.readAll(), fileName);
+}
+
+void ScriptEngine::print(const QString &text)
+{
+    write(text, false);
+}
+
+QObject *ScriptEngine::newModel()
+{
+    ModelScript *modelScript = new ModelScript(this);
+    mOpenedModels.append(modelScript);
+    return modelScript;
+}
+
+QObject *ScriptEngine::openModel(const QString &fileName)
+{
+    ModelScript *modelScript = new ModelScript(this);
+
+    if (!modelScript->open(fileName))
+    {
+        delete modelScript;
+        return 0;
+    }
+
+    mOpenedModels.append(modelScript);
+    return modelScript;
+}
+
+void ScriptEngine::write(const QString &text, bool isError)
+{
+    if (mIsHeadless)
+    {
+        QTextStream out(isError ? stderr : stdout);
+        out << text << endl;
+    }
+
+    emit outputSignal(text);
+}
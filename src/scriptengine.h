@@ -0,0 +1,68 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* scriptengine.h */
+
+#ifndef SCRIPTENGINE_H
+#define SCRIPTENGINE_H
+
+#include <QFile>
+#include <QJSEngine>
+#include <QJSValue>
+#include <QList>
+#include <QObject>
+#include <QQmlEngine>
+#include <QTextStream>
+
+#include "modelscript.h"
+
+//Runs JavaScript against a model, the same script in the console of a window or from the command line. Scripts
+//find the model as model, open hidden models with newModel() and openModel(fileName) and write lines with print().
+//Hidden models opened by a script are closed when it ends. Without a window the model is hidden too and printed
+//lines go to the standard output.
+class ScriptEngine : public QObject
+{
+        Q_OBJECT
+
+    public:
+        explicit ScriptEngine(Solver *solver = 0, QObject *parent = 0);
+
+        ~ScriptEngine();
+
+        //Script variables are kept from one evaluation to the next, as in a console
+        bool evaluate(const QString &program, const QString &fileName = QString());
+
+        bool evaluateFile(const QString &fileName);
+
+        Q_INVOKABLE void print(const QString &text);
+
+        Q_INVOKABLE QObject *newModel();
+
+        Q_INVOKABLE QObject *openModel(const QString &fileName);
+
+    signals:
+        void outputSignal(QString text);
+
+    private:
+        void write(const QString &text, bool isError);
+
+        QJSEngine           *mEngine;
+        ModelScript         *mModelScript;
+        QList<ModelScript *> mOpenedModels;
+        bool                 mIsHeadless;
+};
+
+#endif // SCRIPTENGINE_H
@@ -0,0 +1,146 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solutionresult.cpp */
+
+#include "solutionresult.h"
+
+SolutionResult::SolutionResult(const QVector<qreal> &horizontalDeflectionComponents,
+                               const QVector<qreal> &verticalDeflectionComponents,
+                               const QVector<qreal> &barLoads,
+                               const QVector<qreal> &reactionHorizontalComponents,
+                               const QVector<qreal> &reactionVerticalComponents,
+                               const QVector<int>   &reactionJointNumbers,
+                               const QString        &influenceLoadName,
+                               bool                 areaModulusOption,
+                               const QString        &note)
+{
+    //QVector is implicitly shared, the arrays built by the solver are not copied here
+    mHorizontalDeflectionComponents = horizontalDeflectionComponents;
+    mVerticalDeflectionComponents   = verticalDeflectionComponents;
+    mBarLoads                       = barLoads;
+    mReactionHorizontalComponents   = reactionHorizontalComponents;
+    mReactionVerticalComponents     = reactionVerticalComponents;
+    mReactionJointNumbers           = reactionJointNumbers;
+    mInfluenceLoadName              = influenceLoadName;
+    mAreaModulusOption              = areaModulusOption;
+    mNote                           = note;
+}
+
+SolutionResult::~SolutionResult()
+{
+
+}
+
+int SolutionResult::jointsCount() const
+{
+    return mHorizontalDeflectionComponents.size();
+}
+
+int SolutionResult::barsCount() const
+{
+    return mBarLoads.size();
+}
+
+int SolutionResult::reactionsCount() const
+{
+    return mReactionHorizontalComponents.size();
+}
+
+bool SolutionResult::hasJointDeflections() const
+{
+    return !mHorizontalDeflectionComponents.isEmpty();
+}
+
+bool SolutionResult::hasBarLoads() const
+{
+    return !mBarLoads.isEmpty();
+}
+
+bool SolutionResult::hasSupportReactions() const
+{
+    return !mReactionHorizontalComponents.isEmpty();
+}
+
+qreal SolutionResult::horizontalDeflection(int jointIndex) const
+{
+    return mHorizontalDeflectionComponents.at(jointIndex);
+}
+
+qreal SolutionResult::verticalDeflection(int jointIndex) const
+{
+    return mVerticalDeflectionComponents.at(jointIndex);
+}
+
+qreal SolutionResult::barLoad(int barIndex) const
+{
+    return mBarLoads.at(barIndex);
+}
+
+qreal SolutionResult::reactionHorizontalComponent(int supportIndex) const
+{
+    return mReactionHorizontalComponents.at(supportIndex);
+}
+
+qreal SolutionResult::reactionVerticalComponent(int supportIndex) const
+{
+    return mReactionVerticalComponents.at(supportIndex);
+}
+
+int SolutionResult::reactionJointNumber(int supportIndex) const
+{
+    return mReactionJointNumbers.at(supportIndex);
+}
+
+const QVector<qreal> &SolutionResult::horizontalDeflectionComponents() const
+{
+    return mHorizontalDeflectionComponents;
+}
+
+const QVector<qreal> &SolutionResult::verticalDeflectionComponents() const
+{
+    return mVerticalDeflectionComponents;
+}
+
+const QVector<qreal> &SolutionResult::barLoads() const
+{
+    return mBarLoads;
+}
+
+const QVector<qreal> &SolutionResult::reactionHorizontalComponents() const
+{
+    return mReactionHorizontalComponents;
+}
+
+const QVector<qreal> &SolutionResult::reactionVerticalComponents() const
+{
+    return mReactionVerticalComponents;
+}
+
+const QString &SolutionResult::influenceLoadName() const
+{
+    return mInfluenceLoadName;
+}
+
+bool SolutionResult::areaModulusOption() const
+{
+    return mAreaModulusOption;
+}
+
+const QString &SolutionResult::note() const
+{
+    return mNote;
+}
@@ -0,0 +1,97 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solutionresult.h */
+
+#ifndef SOLUTIONRESULT_H
+#define SOLUTIONRESULT_H
+
+#include <QMetaType>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+//Immutable result of one ModelSolver run, shared by the GUI, the viewer and the exporters
+class SolutionResult
+{
+    public:
+        SolutionResult(const QVector<qreal> &horizontalDeflectionComponents = QVector<qreal>(),
+                       const QVector<qreal> &verticalDeflectionComponents   = QVector<qreal>(),
+                       const QVector<qreal> &barLoads                       = QVector<qreal>(),
+                       const QVector<qreal> &reactionHorizontalComponents   = QVector<qreal>(),
+                       const QVector<qreal> &reactionVerticalComponents     = QVector<qreal>(),
+                       const QVector<int>   &reactionJointNumbers           = QVector<int>(),
+                       const QString        &influenceLoadName              = QString(),
+                       bool                 areaModulusOption               = false,
+                       const QString        &note                           = QString());
+
+        ~SolutionResult();
+
+        int jointsCount() const;
+
+        int barsCount() const;
+
+        int reactionsCount() const;
+
+        bool hasJointDeflections() const;
+
+        bool hasBarLoads() const;
+
+        bool hasSupportReactions() const;
+
+        qreal horizontalDeflection(int jointIndex) const;
+
+        qreal verticalDeflection(int jointIndex) const;
+
+        qreal barLoad(int barIndex) const;
+
+        qreal reactionHorizontalComponent(int supportIndex) const;
+
+        qreal reactionVerticalComponent(int supportIndex) const;
+
+        int reactionJointNumber(int supportIndex) const;
+
+        const QVector<qreal> &horizontalDeflectionComponents() const;
+
+        const QVector<qreal> &verticalDeflectionComponents() const;
+
+        const QVector<qreal> &barLoads() const;
+
+        const QVector<qreal> &reactionHorizontalComponents() const;
+
+        const QVector<qreal> &reactionVerticalComponents() const;
+
+        const QString &influenceLoadName() const;
+
+        bool areaModulusOption() const;
+
+        const QString &note() const;
+
+    private:
+        QVector<qreal> mHorizontalDeflectionComponents;
+        QVector<qreal> mVerticalDeflectionComponents;
+        QVector<qreal> mBarLoads;
+        QVector<qreal> mReactionHorizontalComponents;
+        QVector<qreal> mReactionVerticalComponents;
+        QVector<int>   mReactionJointNumbers;
+        QString        mInfluenceLoadName;
+        bool           mAreaModulusOption;
+        QString        mNote;
+};
+
+Q_DECLARE_METATYPE(QSharedPointer<const SolutionResult>)
+
+#endif // SOLUTIONRESULT_H
@@ -0,0 +1,186 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solutiontablemodel.cpp */
+
+#include "solutiontablemodel.h"
+
+SolutionTableModel::SolutionTableModel(SolutionTable table, QObject *parent) : QAbstractTableModel(parent)
+{
+    mTable = table;
+
+    int count = (mTable == BAR_LOADS) ? 2 : 3;
+
+    for (int i = 0; i < count; ++i)
+    {
+        mHeaderLabels.append(QString());
+    }
+}
+
+SolutionTableModel::~SolutionTableModel()
+{
+
+}
+
+int SolutionTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || mSolutionResult.isNull())
+    {
+        return 0;
+    }
+
+    switch (mTable)
+    {
+        case JOINT_DEFLECTIONS:
+            return mSolutionResult->jointsCount();
+        case BAR_LOADS:
+            return mSolutionResult->barsCount();
+        case SUPPORT_REACTIONS:
+            return mSolutionResult->reactionsCount();
+        default:
+            return 0;
+    }
+}
+
+int SolutionTableModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+    {
+        return 0;
+    }
+
+    return mHeaderLabels.size();
+}
+
+QVariant SolutionTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || mSolutionResult.isNull())
+    {
+        return QVariant();
+    }
+
+    if (role == Qt::TextAlignmentRole)
+    {
+        return int(Qt::AlignCenter);
+    }
+
+    if (role != Qt::DisplayRole)
+    {
+        return QVariant();
+    }
+
+    //Values are formatted only when a view asks for a visible cell
+    int row    = index.row();
+    int column = index.column();
+
+    switch (mTable)
+    {
+        case JOINT_DEFLECTIONS:
+            if (column == 0)
+            {
+                return QString::number(row + 1);
+            }
+            else if (column == 1)
+            {
+                return QString::number(mSolutionResult->horizontalDeflection(row), 'g', 6);
+            }
+            else
+            {
+                return QString::number(mSolutionResult->verticalDeflection(row), 'g', 6);
+            }
+        case BAR_LOADS:
+            if (column == 0)
+            {
+                return QString::number(row + 1);
+            }
+            else
+            {
+                return QString::number(mSolutionResult->barLoad(row), 'g', 6);
+            }
+        case SUPPORT_REACTIONS:
+            if (column == 0)
+            {
+                return tr("%1 @ joint %2")
+                        .arg(QString::number(row + 1))
+                        .arg(QString::number(mSolutionResult->reactionJointNumber(row)));
+            }
+            else if (column == 1)
+            {
+                return QString::number(mSolutionResult->reactionHorizontalComponent(row), 'g', 6);
+            }
+            else
+            {
+                return QString::number(mSolutionResult->reactionVerticalComponent(row), 'g', 6);
+            }
+        default:
+            return QVariant();
+    }
+}
+
+QVariant SolutionTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && section >= 0 && section < mHeaderLabels.size())
+    {
+        if (role == Qt::DisplayRole)
+        {
+            return mHeaderLabels.at(section);
+        }
+
+        if (role == Qt::TextAlignmentRole)
+        {
+            return int(Qt::AlignCenter);
+        }
+    }
+
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool SolutionTableModel::setHeaderData(int             section,
+                                       Qt::Orientation orientation,
+                                       const QVariant  &value,
+                                       int             role)
+{
+    if (orientation != Qt::Horizontal || section < 0 || section >= mHeaderLabels.size())
+    {
+        return false;
+    }
+
+    if (role != Qt::EditRole && role != Qt::DisplayRole)
+    {
+        return false;
+    }
+
+    mHeaderLabels[section] = value.toString();
+    emit headerDataChanged(orientation, section, section);
+    return true;
+}
+
+Qt::ItemFlags SolutionTableModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid())
+    {
+        return Qt::NoItemFlags;
+    }
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void SolutionTableModel::setSolutionResult(const QSharedPointer<const SolutionResult> &solutionResult)
+{
+    beginResetModel();
+    mSolutionResult = solutionResult;
+    endResetModel();
+}
@@ -0,0 +1,68 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solutiontablemodel.h */
+
+#ifndef SOLUTIONTABLEMODEL_H
+#define SOLUTIONTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QSharedPointer>
+#include <QStringList>
+
+#include "solutionresult.h"
+
+//Table model reading joint deflections, bar loads or support reactions straight from a SolutionResult
+class SolutionTableModel : public QAbstractTableModel
+{
+        Q_OBJECT
+
+    public:
+        enum SolutionTable
+        {
+            JOINT_DEFLECTIONS,
+            BAR_LOADS,
+            SUPPORT_REACTIONS
+        };
+
+        explicit SolutionTableModel(SolutionTable table, QObject *parent = 0);
+
+        ~SolutionTableModel();
+
+        int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+        int columnCount(const QModelIndex &parent = QModelIndex()) const;
+
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+        QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+
+        bool setHeaderData(int             section,
+                           Qt::Orientation orientation,
+                           const QVariant  &value,
+                           int             role = Qt::EditRole);
+
+        Qt::ItemFlags flags(const QModelIndex &index) const;
+
+        void setSolutionResult(const QSharedPointer<const SolutionResult> &solutionResult);
+
+    private:
+        SolutionTable                        mTable;
+        QSharedPointer<const SolutionResult> mSolutionResult;
+        QStringList                          mHeaderLabels;
+};
+
+#endif // SOLUTIONTABLEMODEL_H
@@ -23,8 +23,11 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
     initializeUiComponents();
 
     mNotesDialog = new NotesDialog(this);
+    mSolverDiagnosticsDialog = new SolverDiagnosticsDialog(&mLastReportLocation, this);
+    mSolverDiagnosticsDialog->setStatistics(mSolverStatistics);
     mModelAreaDialog = new ModelAreaDialog(this);
-    mExportModelImageDialog = new ExportModelImageDialog(mModelViewer->modelPixmap(),
+    mScriptConsoleDialog = new ScriptConsoleDialog(this, &mLastOpenLocation, this);
+    mExportModelImageDialog = new ExportModelImageDialog(mModelViewer,
                                                          &mLastExportModelImageLocation,
                                                          this);
 
@@ -39,6 +42,28 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
     mDeleteJointsDialog = new DeleteJointsDialog(mJointsTableView, this);
 
     mModelCheckRequired            = false;
+    mIsSpatialIndexValid           = false;
+    mEditTransactionDepth          = 0;
+    mIsNormalizationPending        = false;
+    mIsJointOptionsUpdatePending   = false;
+    mIsModelCheckPending           = false;
+    mIsViewerUpdatePending         = false;
+    mIsJointsExtentValid           = false;
+    mJointsXMin                    = 0.0;
+    mJointsXMax                    = 0.0;
+    mJointsYMin                    = 0.0;
+    mJointsYMax                    = 0.0;
+    mModelRevision                 = 1;
+    mBackgroundCheckRevision       = 0;
+    mCheckedRevision               = 0;
+    mIsBackgroundCheckRunning      = false;
+    mCheckedStability              = false;
+
+    mBackgroundCheckTimer = new QTimer(this);
+    mBackgroundCheckTimer->setSingleShot(true);
+    mBackgroundCheckTimer->setInterval(kBackgroundCheckDelay);
+
+    connect(mBackgroundCheckTimer, SIGNAL(timeout()), this, SLOT(startBackgroundCheck()));
     mUpdateJointLoadOption         = false;
     mUpdateSelfWeightOption        = false;
     mUpdateSupportSettlementOption = false;
@@ -46,12 +71,25 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
     mUpdateFabricationErrorOption  = false;
     mUpdateInfluenceLoadOption     = false;
     mIsStable                      = false;
+    mMechanismModeIndex            = 0;
     mHasSolution                   = false;
     mSolutionInfluenceLoadName     = QString();
+    mIsModelCheckRunning           = false;
+    mIsSolutionRunning             = false;
+    mPendingSolutionRevision       = 0;
     mLastOpenLocation              = QDir::toNativeSeparators(QDir::homePath());
     mLastSaveLocation              = QDir::toNativeSeparators(QDir::homePath());
     mLastExportModelImageLocation  = QDir::toNativeSeparators(QDir::homePath());
     mLastReportLocation            = QDir::toNativeSeparators(QDir::homePath());
+    mJournalLock                   = 0;
+    mIsWriterRunning               = false;
+    mIsSaved                       = false;
+
+    mAutosaveTimer = new QTimer(this);
+    mAutosaveTimer->setInterval(kAutosaveInterval);
+
+    connect(mAutosaveTimer, SIGNAL(timeout()), this, SLOT(autosave()));
+    mAutosaveTimer->start();
 
     mAddBarsDialog  = new AddBarsDialog(&mUnitsAndLimits,
                                        &mJointsList,
@@ -66,6 +104,11 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
                                          this);
     mDeleteBarsDialog = new DeleteBarsDialog(mBarsTableView, this);
 
+    mGenerateTrussDialog = new GenerateTrussDialog(&mUnitsAndLimits,
+                                                   &mJointsList,
+                                                   mBarsTableView,
+                                                   this);
+
     mAddSupportsDialog = new AddSupportsDialog(&mJointsList,
                                                mJointsTableView,
                                                this);
@@ -174,7 +217,11 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
     connect(mAboutQtAction, SIGNAL(triggered()), this, SLOT(showAboutQtDialog()));
     connect(mSelectionPanelAction, SIGNAL(triggered()), this, SLOT(showSelectionPanel()));
     connect(mShowNotesAction, SIGNAL(triggered()), this, SLOT(showNotes()));
+    connect(mShowSolverDiagnosticsAction, SIGNAL(triggered()), this, SLOT(showSolverDiagnostics()));
     connect(mSetModelAreaAction, SIGNAL(triggered()), this, SLOT(showModelAreaDialog()));
+    connect(mGenerateTrussAction, SIGNAL(triggered()), this, SLOT(showGenerateTrussDialog()));
+    connect(mGenerateTrussDialog, SIGNAL(inputsSignal(ParametricTruss)), this, SLOT(generateTruss(ParametricTruss)));
+    connect(mScriptConsoleAction, SIGNAL(triggered()), this, SLOT(showScriptConsole()));
     connect(mExportModelImageAction, SIGNAL(triggered()), this, SLOT(showExportModelImageDialog()));
     connect(mShowHideAxesAction, SIGNAL(toggled(bool)), mModelViewer, SLOT(showHideAxes(bool)));
     connect(mShowHideJointNumberAction, SIGNAL(toggled(bool)), mModelViewer, SLOT(showHideJointNumber(bool)));
@@ -247,6 +294,7 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
 
     connect(mSelectionTabWidget, SIGNAL(tabBarClicked(int)), this, SLOT(onTabIndexChanged(int)));
     connect(mCheckModelAction, SIGNAL(triggered()), this, SLOT(onActionCheckModelTriggered()));
+    connect(mShowNextMechanismModeAction, SIGNAL(triggered()), this, SLOT(showNextMechanismMode()));
     connect(mLoadTypeListWidget, SIGNAL(currentRowChanged(int)), this, SLOT(setLoadsTableView(int)));
     connect(mLoadTypeListWidget, SIGNAL(currentRowChanged(int)), this, SLOT(setLoadDisplayOption(int)));
     connect(mYesRadioButton, SIGNAL(toggled(bool)), this, SLOT(setLoadDisplayOption(bool)));
@@ -306,6 +354,8 @@ Solver::Solver(QWidget *parent) : QMainWindow(parent)
     connect(mClearMenuAction, SIGNAL(triggered()), this, SLOT(clearRecentFileActions()));
     connect(mSaveAction, SIGNAL(triggered()), this, SLOT(save()));
     connect(mSaveAsAction, SIGNAL(triggered()), this, SLOT(saveAs()));
+    connect(mImportDataAction, SIGNAL(triggered()), this, SLOT(importData()));
+    connect(mExportDataAction, SIGNAL(triggered()), this, SLOT(exportData()));
     connect(mExitAction, SIGNAL(triggered()), this, SLOT(close()));
 
     readSettings();
@@ -320,62 +370,49 @@ Solver::~Solver()
 
 bool Solver::loadFile(const QString &fileName)
 {
-    QFile openFile(fileName);
+    ModelFile modelFile;
 
-    if (!openFile.open(QFile::ReadOnly))
+    if (!modelFile.open(fileName) || !modelFile.isConsistent())
     {
-        QMessageBox messageBox;
-        messageBox.setText(tr("File not found."));
-        messageBox.exec();
-        return false;
-    }
-
-    QDataStream in(&openFile);
-    in.setVersion(QDataStream::Qt_5_4);
-
-    quint32 magic;
-    in >> magic;
-    QString version;
-    in >> version;
+        if (modelFile.error() == ModelFile::OPEN_ERROR)
+        {
+            QMessageBox messageBox;
+            messageBox.setText(tr("File not found."));
+            messageBox.exec();
+        }
+        else
+        {
+            QString s1 = tr("TrussTables");
+            QString s2 = tr("The file is not a valid TrussTables model file.");
+            QMessageBox::warning(this, s1, s2);
+        }
 
-    if (magic != quint32(0x25438F7BEA4))
-    {
-        QString s1 = tr("TrussTables");
-        QString s2 = tr("The file is not a valid TrussTables model file.");
-        QMessageBox::warning(this, s1, s2);
-        openFile.close();
         return false;
     }
 
+    loadModelFile(modelFile);
+    setCurrentFile(fileName);
+    return true;
+}
+
+void Solver::loadModelFile(const ModelFile &modelFile)
+{
     int tabIndex = -1;
 
     //Description and Units
 
     {
-        QString s;
-
-        in >> s;
-        mDescriptionText = s;
-        in >> s;
-        mUnitsAndLimits.setSystem(s);
-        in >> s;
-        mUnitsAndLimits.setCoordinateUnit(s);
-        in >> s;
-        mUnitsAndLimits.setAreaUnit(s);
-        in >> s;
-        mUnitsAndLimits.setModulusUnit(s);
-        in >> s;
-        mUnitsAndLimits.setUnitWeightUnit(s);
-        in >> s;
-        mUnitsAndLimits.setLoadUnit(s);
-        in >> s;
-        mUnitsAndLimits.setSupportSettlementUnit(s);
-        in >> s;
-        mUnitsAndLimits.setTemperatureChangeUnit(s);
-        in >> s;
-        mUnitsAndLimits.setThermalCoefficientUnit(s);
-        in >> s;
-        mUnitsAndLimits.setLengthErrorUnit(s);
+        mDescriptionText = modelFile.property(ModelFile::DESCRIPTION);
+        mUnitsAndLimits.setSystem(modelFile.property(ModelFile::SYSTEM));
+        mUnitsAndLimits.setCoordinateUnit(modelFile.property(ModelFile::COORDINATE_UNIT));
+        mUnitsAndLimits.setAreaUnit(modelFile.property(ModelFile::AREA_UNIT));
+        mUnitsAndLimits.setModulusUnit(modelFile.property(ModelFile::MODULUS_UNIT));
+        mUnitsAndLimits.setUnitWeightUnit(modelFile.property(ModelFile::UNIT_WEIGHT_UNIT));
+        mUnitsAndLimits.setLoadUnit(modelFile.property(ModelFile::LOAD_UNIT));
+        mUnitsAndLimits.setSupportSettlementUnit(modelFile.property(ModelFile::SUPPORT_SETTLEMENT_UNIT));
+        mUnitsAndLimits.setTemperatureChangeUnit(modelFile.property(ModelFile::TEMPERATURE_CHANGE_UNIT));
+        mUnitsAndLimits.setThermalCoefficientUnit(modelFile.property(ModelFile::THERMAL_COEFFICIENT_UNIT));
+        mUnitsAndLimits.setLengthErrorUnit(modelFile.property(ModelFile::LENGTH_ERROR_UNIT));
 
         updateUnits();
     }
@@ -383,52 +420,31 @@ bool Solver::loadFile(const QString &fileName)
     //Joint Coordinates
 
     {
-        QList<qreal> xCoordinateList;
-        QList<qreal> yCoordinateList;
+        QVector<qreal> xCoordinateList = modelFile.reals(ModelFile::JOINT_X_COORDINATES);
+        QVector<qreal> yCoordinateList = modelFile.reals(ModelFile::JOINT_Y_COORDINATES);
 
-        in >> xCoordinateList;
-        in >> yCoordinateList;
-
-        if (!xCoordinateList.isEmpty())
+        if (!xCoordinateList.isEmpty() && (yCoordinateList.size() == xCoordinateList.size()))
         {
             tabIndex += 1;
 
             int count = xCoordinateList.size();
             mJointsList.clear();
+            mJointsList.reserve(count);
+            invalidateSpatialIndex();
             emit enableJointsInput();
             mUnitsAction->setEnabled(false);
 
             mJointsTableView->clearSelection();
-            mJointsStandardItemModel->clear();
-            mJointsStandardItemModel->setRowCount(0);
-            mJointsStandardItemModel->setColumnCount(2);
             createJointsModelHeader();
 
             for (int i = 0; i < count; ++i)
             {
                 Joint *joint = new Joint(xCoordinateList.at(i), yCoordinateList.at(i), this);
                 mJointsList.append(joint);
-
-                QList<QStandardItem *> standardItemsList;
-                QStandardItem *standardItem;
-
-                QString s;
-
-                s = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-                standardItem = new QStandardItem(s);
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                s = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-                standardItem = new QStandardItem(s);
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                mJointsStandardItemModel->appendRow(standardItemsList);
             }
 
+            mJointsTableModel->resetRows();
+
             if (mJointsSingleRadioButton->isChecked())
             {
                 mJointsTableView->clearSelection();
@@ -440,13 +456,8 @@ bool Solver::loadFile(const QString &fileName)
                 mJointsTableView->setSelectionMode(QAbstractItemView::ExtendedSelection);
             }
 
-            mAddJointsDialog->updateJoints();
-            mAddBarsDialog->updateFirstJointOptions();
-            mEditBarsDialog->updateFirstJointOptions();
-            mAddSupportsDialog->updateJoints();
-            mAddJointLoadsDialog->updateJoints();
-            mEditJointLoadsDialog->updateJoints();
-            mModelCheckRequired = true;
+            updateJointOptions();
+            invalidateModelCheck();
         }
     }
 
@@ -455,22 +466,14 @@ bool Solver::loadFile(const QString &fileName)
     {
         //Axial Rigidity Option
 
-        QString axialRigidityOption;
-        in >> axialRigidityOption;
+        QString axialRigidityOption = modelFile.property(ModelFile::AXIAL_RIGIDITY_OPTION);
 
-        QList<qint32> firstJointList;
-        QList<qint32> secondJointList;
-        QList<qreal> areaList;
-        QList<qreal> modulusList;
-        QList<qreal> factorList;
-        QList<qreal> unitWeightList;
-
-        in >> firstJointList;
-        in >> secondJointList;
-        in >> areaList;
-        in >> modulusList;
-        in >> factorList;
-        in >> unitWeightList;
+        QVector<qint32> firstJointList  = modelFile.integers(ModelFile::BAR_FIRST_JOINTS);
+        QVector<qint32> secondJointList = modelFile.integers(ModelFile::BAR_SECOND_JOINTS);
+        QVector<qreal> areaList         = modelFile.reals(ModelFile::BAR_AREAS);
+        QVector<qreal> modulusList      = modelFile.reals(ModelFile::BAR_MODULI);
+        QVector<qreal> factorList       = modelFile.reals(ModelFile::BAR_FACTORS);
+        QVector<qreal> unitWeightList   = modelFile.reals(ModelFile::BAR_UNIT_WEIGHTS);
 
         if (!firstJointList.isEmpty())
         {
@@ -489,18 +492,17 @@ bool Solver::loadFile(const QString &fileName)
 
             int count = firstJointList.size();
             mBarsList.clear();
+            mBarsList.reserve(count);
 
             mBarsTableView->clearSelection();
-            mBarsStandardItemModel->clear();
-            mBarsStandardItemModel->setRowCount(0);
 
             if (axialRigidityOption == tr("value"))
             {
-                mBarsStandardItemModel->setColumnCount(5);
+                mBarsTableModel->setColumnCount(5);
             }
             else
             {
-                mBarsStandardItemModel->setColumnCount(3);
+                mBarsTableModel->setColumnCount(3);
             }
 
             createBarsModelHeader();
@@ -530,56 +532,10 @@ bool Solver::loadFile(const QString &fileName)
 
                 jointA->attachedBars()->append(bar);
                 jointB->attachedBars()->append(bar);
-
-                QList<QStandardItem *> standardItemsList;
-                QStandardItem *standardItem;
-
-                standardItem = new QStandardItem(QString::number(mJointsList.indexOf(jointA) + 1));
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                standardItem = new QStandardItem(QString::number(mJointsList.indexOf(jointB) + 1));
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                if (mBarsStandardItemModel->columnCount() == 5)
-                {
-                    QString s;
-
-                    s = QString::number(bar->area(), 'f', mUnitsAndLimits.areaDecimals());
-                    standardItem = new QStandardItem(s);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-
-                    s = QString::number(bar->modulus(), 'f', mUnitsAndLimits.modulusDecimals());
-                    standardItem = new QStandardItem(s);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-
-                    s = QString::number(bar->unitWeight(), 'f', mUnitsAndLimits.unitWeightDecimals());
-                    standardItem = new QStandardItem(s);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-                }
-                else
-                {
-                    QString s;
-
-                    s = QString::number(bar->factor(), 'f', mUnitsAndLimits.factorDecimals());
-                    standardItem = new QStandardItem(s);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-                }
-
-                mBarsStandardItemModel->appendRow(standardItemsList);
             }
 
+            mBarsTableModel->resetRows();
+
             if (mBarsSingleRadioButton->isChecked())
             {
                 mBarsTableView->clearSelection();
@@ -591,20 +547,16 @@ bool Solver::loadFile(const QString &fileName)
                 mBarsTableView->setSelectionMode(QAbstractItemView::ExtendedSelection);
             }
 
-            mModelCheckRequired = true;
+            invalidateModelCheck();
         }
     }
 
     //Supports
 
     {
-        QList<qint32> supportJointList;
-        QList<qint32> supportTypeList;
-        QList<qreal> supportAngleList;
-
-        in >> supportJointList;
-        in >> supportTypeList;
-        in >> supportAngleList;
+        QVector<qint32> supportJointList = modelFile.integers(ModelFile::SUPPORT_JOINTS);
+        QVector<qint32> supportTypeList  = modelFile.integers(ModelFile::SUPPORT_TYPES);
+        QVector<qreal> supportAngleList  = modelFile.reals(ModelFile::SUPPORT_ANGLES);
 
         if (!supportJointList.isEmpty())
         {
@@ -614,9 +566,6 @@ bool Solver::loadFile(const QString &fileName)
             mSupportsList.clear();
 
             mSupportsTableView->clearSelection();
-            mSupportsStandardItemModel->clear();
-            mSupportsStandardItemModel->setRowCount(0);
-            mSupportsStandardItemModel->setColumnCount(3);
             createSupportsModelHeader();
 
             for (int i = 0; i < count; ++i)
@@ -627,45 +576,35 @@ bool Solver::loadFile(const QString &fileName)
                 qreal angle     = supportAngleList.at(i);
 
                 UnitsAndLimits::SupportType supportType = UnitsAndLimits::FIXED_BOTTOM;
-                QString supportTypeName;
 
                 switch (type)
                 {
                     case 0:
-                        supportType     = UnitsAndLimits::FIXED_LEFT;
-                        supportTypeName = tr("fixed");
+                        supportType = UnitsAndLimits::FIXED_LEFT;
                         break;
                     case 1:
-                        supportType     = UnitsAndLimits::FIXED_TOP;
-                        supportTypeName = tr("fixed");
+                        supportType = UnitsAndLimits::FIXED_TOP;
                         break;
                     case 2:
-                        supportType     = UnitsAndLimits::FIXED_RIGHT;
-                        supportTypeName = tr("fixed");
+                        supportType = UnitsAndLimits::FIXED_RIGHT;
                         break;
                     case 3:
-                        supportType     = UnitsAndLimits::FIXED_BOTTOM;
-                        supportTypeName = tr("fixed");
+                        supportType = UnitsAndLimits::FIXED_BOTTOM;
                         break;
                     case 4:
-                        supportType     = UnitsAndLimits::ROLLER;
-                        supportTypeName = tr("inclined roller");
+                        supportType = UnitsAndLimits::ROLLER;
                         break;
                     case 5:
-                        supportType     = UnitsAndLimits::ROLLER_LEFT;
-                        supportTypeName = tr("roller");
+                        supportType = UnitsAndLimits::ROLLER_LEFT;
                         break;
                     case 6:
-                        supportType     = UnitsAndLimits::ROLLER_TOP;
-                        supportTypeName = tr("roller");
+                        supportType = UnitsAndLimits::ROLLER_TOP;
                         break;
                     case 7:
-                        supportType     = UnitsAndLimits::ROLLER_RIGHT;
-                        supportTypeName = tr("roller");
+                        supportType = UnitsAndLimits::ROLLER_RIGHT;
                         break;
                     case 8:
-                        supportType     = UnitsAndLimits::ROLLER_BOTTOM;
-                        supportTypeName = tr("roller");
+                        supportType = UnitsAndLimits::ROLLER_BOTTOM;
                         break;
                     default:
                         break;
@@ -676,28 +615,10 @@ bool Solver::loadFile(const QString &fileName)
                 joint->setSupported(true);
 
                 mSupportsList.append(support);
-
-                QList<QStandardItem *> standardItemsList;
-                QStandardItem *standardItem;
-
-                standardItem = new QStandardItem(QString::number(jointNumber));
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                standardItem = new QStandardItem(supportTypeName);
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                standardItem = new QStandardItem(QString::number(angle, 'f', mUnitsAndLimits.supportAngleDecimals()));
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                mSupportsStandardItemModel->appendRow(standardItemsList);
             }
 
+            mSupportsTableModel->resetRows();
+
             if (mSupportsSingleRadioButton->isChecked())
             {
                 mSupportsTableView->clearSelection();
@@ -709,7 +630,7 @@ bool Solver::loadFile(const QString &fileName)
                 mSupportsTableView->setSelectionMode(QAbstractItemView::ExtendedSelection);
             }
 
-            mModelCheckRequired = true;
+            invalidateModelCheck();
         }
     }
 
@@ -719,8 +640,13 @@ bool Solver::loadFile(const QString &fileName)
         updateModelViewer();
     }
 
-    bool checkHasLoads;
-    in >> checkHasLoads;
+    bool checkA = (modelFile.count(ModelFile::JOINT_LOAD_JOINTS) > 0);
+    bool checkB = (modelFile.count(ModelFile::SETTLEMENT_SUPPORTS) > 0);
+    bool checkC = (modelFile.count(ModelFile::THERMAL_EFFECT_BARS) > 0);
+    bool checkD = (modelFile.count(ModelFile::FABRICATION_ERROR_BARS) > 0);
+    bool checkE = (modelFile.count(ModelFile::INFLUENCE_LOAD_NAMES) > 0);
+
+    bool checkHasLoads = (checkA || checkB || checkC || checkD || checkE);
 
     if (checkHasLoads)
     {
@@ -731,15 +657,10 @@ bool Solver::loadFile(const QString &fileName)
     //Joint Loads
 
     {
-        QList<qint32> loadJointList;
-        QList<qreal> loadHorizontalComponentList;
-        QList<qreal> loadVerticalComponentList;
-        QList<QString> loadPositionList;
-
-        in >> loadJointList;
-        in >> loadHorizontalComponentList;
-        in >> loadVerticalComponentList;
-        in >> loadPositionList;
+        QVector<qint32> loadJointList             = modelFile.integers(ModelFile::JOINT_LOAD_JOINTS);
+        QVector<qreal> loadHorizontalComponentList = modelFile.reals(ModelFile::JOINT_LOAD_HORIZONTAL_COMPONENTS);
+        QVector<qreal> loadVerticalComponentList   = modelFile.reals(ModelFile::JOINT_LOAD_VERTICAL_COMPONENTS);
+        QStringList loadPositionList               = modelFile.texts(ModelFile::JOINT_LOAD_POSITIONS);
 
         if (!loadJointList.isEmpty())
         {
@@ -811,11 +732,8 @@ bool Solver::loadFile(const QString &fileName)
     //Support Settlements
 
     {
-        QList<qint32> settlementSupportList;
-        QList<qreal> settlementList;
-
-        in >> settlementSupportList;
-        in >> settlementList;
+        QVector<qint32> settlementSupportList = modelFile.integers(ModelFile::SETTLEMENT_SUPPORTS);
+        QVector<qreal> settlementList         = modelFile.reals(ModelFile::SETTLEMENTS);
 
         if (!settlementSupportList.isEmpty())
         {
@@ -827,6 +745,8 @@ bool Solver::loadFile(const QString &fileName)
             mSupportSettlementsStandardItemModel->setColumnCount(2);
             createSupportSettlementsModelHeader();
 
+            ModelIndex modelIndex(mJointsList);
+
             for (int i = 0; i < count; ++i)
             {
                 int supportNumber = int(settlementSupportList.at(i));
@@ -843,7 +763,7 @@ bool Solver::loadFile(const QString &fileName)
                 mSupportSettlementsList.append(supportSettlement);
 
                 Joint *joint    = support->supportJoint();
-                int jointNumber = mJointsList.indexOf(joint) + 1;
+                int jointNumber = modelIndex.jointIndex(joint) + 1;
 
                 QList<QStandardItem *> standardItemsList;
                 QStandardItem *standardItem;
@@ -881,13 +801,9 @@ bool Solver::loadFile(const QString &fileName)
     //Thermal Effects
 
     {
-        QList<qint32> thermalEffectBarList;
-        QList<qreal> temperatureChangeList;
-        QList<qreal> thermalCoefficientList;
-
-        in >> thermalEffectBarList;
-        in >> temperatureChangeList;
-        in >> thermalCoefficientList;
+        QVector<qint32> thermalEffectBarList  = modelFile.integers(ModelFile::THERMAL_EFFECT_BARS);
+        QVector<qreal> temperatureChangeList  = modelFile.reals(ModelFile::TEMPERATURE_CHANGES);
+        QVector<qreal> thermalCoefficientList = modelFile.reals(ModelFile::THERMAL_COEFFICIENTS);
 
         if (!thermalEffectBarList.isEmpty())
         {
@@ -957,11 +873,8 @@ bool Solver::loadFile(const QString &fileName)
     //Assembly/Fabrication Errors
 
     {
-        QList<qint32> fabricationErrorBarList;
-        QList<qreal> lengthErrorList;
-
-        in >> fabricationErrorBarList;
-        in >> lengthErrorList;
+        QVector<qint32> fabricationErrorBarList = modelFile.integers(ModelFile::FABRICATION_ERROR_BARS);
+        QVector<qreal> lengthErrorList          = modelFile.reals(ModelFile::LENGTH_ERRORS);
 
         if (!fabricationErrorBarList.isEmpty())
         {
@@ -1024,8 +937,19 @@ bool Solver::loadFile(const QString &fileName)
     //Influence Loads
 
     {
-        int influenceLoadCount;
-        in >> influenceLoadCount;
+        //Paths and point loads of all influence loads follow one another, with the sizes of each kept apart
+
+        QStringList names                    = modelFile.texts(ModelFile::INFLUENCE_LOAD_NAMES);
+        QStringList directions               = modelFile.texts(ModelFile::INFLUENCE_LOAD_DIRECTIONS);
+        QVector<qint32> pathSizes            = modelFile.integers(ModelFile::INFLUENCE_LOAD_PATH_SIZES);
+        QVector<qint32> paths                = modelFile.integers(ModelFile::INFLUENCE_LOAD_PATHS);
+        QVector<qint32> pointLoadCounts      = modelFile.integers(ModelFile::INFLUENCE_LOAD_POINT_LOAD_COUNTS);
+        QVector<qreal> allPointLoads         = modelFile.reals(ModelFile::INFLUENCE_LOAD_POINT_LOADS);
+        QVector<qreal> allPointLoadPositions = modelFile.reals(ModelFile::INFLUENCE_LOAD_POINT_LOAD_POSITIONS);
+
+        int influenceLoadCount = names.size();
+        int pathStart          = 0;
+        int pointLoadStart     = 0;
 
         if (influenceLoadCount > 0)
         {
@@ -1037,17 +961,15 @@ bool Solver::loadFile(const QString &fileName)
 
             for (int i = 0; i < influenceLoadCount; ++i)
             {
-                QString name;
-                QString direction;
-                QList<qint32> pathList;
-                QList<qreal> pointLoads;
-                QList<qreal> pointLoadPositions;
+                QString name                    = names.at(i);
+                QString direction               = directions.value(i);
+                QList<qint32> pathList          = paths.mid(pathStart, pathSizes.value(i)).toList();
+                QList<qreal> pointLoads         = allPointLoads.mid(pointLoadStart, pointLoadCounts.value(i)).toList();
+                QList<qreal> pointLoadPositions = allPointLoadPositions.mid(pointLoadStart,
+                                                                           pointLoadCounts.value(i)).toList();
 
-                in >> name;
-                in >> direction;
-                in >> pathList;
-                in >> pointLoads;
-                in >> pointLoadPositions;
+                pathStart      += pathSizes.value(i);
+                pointLoadStart += pointLoadCounts.value(i);
 
                 InfluenceLoad *influenceLoad = new InfluenceLoad(name,
                                                                  direction,
@@ -1134,15 +1056,23 @@ bool Solver::loadFile(const QString &fileName)
         }
     }
 
-    openFile.close();
-    setCurrentFile(fileName);
-    return true;
+    //Solution, shown at the end of the model check started above, or now if the check has already finished
+
+    if (checkHasLoads && modelFile.hasSection(ModelFile::SOLUTION_FINGERPRINT) && readSolution(modelFile))
+    {
+        if (!mIsModelCheckRunning)
+        {
+            restoreSolution();
+        }
+    }
 }
 
 void Solver::closeEvent(QCloseEvent *event)
 {
     if (promptForSave())
     {
+        waitForWriter();
+        closeJournal();
         writeSettings();
         event->accept();
     }
@@ -1161,9 +1091,12 @@ void Solver::initializeUiComponents()
 
     mScrollArea = new ScrollArea;
 
-    mBarsStandardItemModel = new QStandardItemModel(this);
-    mBarsStandardItemModel->setRowCount(0);
-    mBarsStandardItemModel->setColumnCount(3);
+    mBarsTableModel = new ModelTableModel(ModelTableModel::BARS,
+                                          &mUnitsAndLimits,
+                                          &mJointsList,
+                                          &mBarsList,
+                                          &mSupportsList,
+                                          this);
 
     mInfluenceLoadResult = new InfluenceLoadResult(0, 0, this);
 
@@ -1176,12 +1109,8 @@ void Solver::initializeUiComponents()
                                    &mThermalEffectsList,
                                    &mFabricationErrorsList,
                                    &mInfluenceLoadsList,
-                                   mBarsStandardItemModel,
-                                   &mHorizontalDeflectionComponentsList,
-                                   &mVerticalDeflectionComponentsList,
-                                   &mBarLoadsList,
-                                   &mReactionHorizontalComponentsList,
-                                   &mReactionVerticalComponentsList,
+                                   mBarsTableModel,
+                                   &mSolutionResult,
                                    &mSolutionInfluenceLoadName,
                                    mInfluenceLoadResult);
 
@@ -1201,13 +1130,19 @@ void Solver::initializeUiComponents()
 
     connect(mScrollArea, SIGNAL(sizeSignal(int,int,int)), mModelViewer, SLOT(updateSize(int,int,int)));
 
-    mJointsStandardItemModel = new QStandardItemModel(this);
-    mJointsStandardItemModel->setRowCount(0);
-    mJointsStandardItemModel->setColumnCount(2);
+    mJointsTableModel = new ModelTableModel(ModelTableModel::JOINTS,
+                                            &mUnitsAndLimits,
+                                            &mJointsList,
+                                            &mBarsList,
+                                            &mSupportsList,
+                                            this);
 
-    mSupportsStandardItemModel = new QStandardItemModel(this);
-    mSupportsStandardItemModel->setRowCount(0);
-    mSupportsStandardItemModel->setColumnCount(3);
+    mSupportsTableModel = new ModelTableModel(ModelTableModel::SUPPORTS,
+                                              &mUnitsAndLimits,
+                                              &mJointsList,
+                                              &mBarsList,
+                                              &mSupportsList,
+                                              this);
 
     mJointLoadsStandardItemModel = new QStandardItemModel(this);
     mJointLoadsStandardItemModel->setRowCount(0);
@@ -1229,17 +1164,11 @@ void Solver::initializeUiComponents()
     mInfluenceLoadsStandardItemModel->setRowCount(0);
     mInfluenceLoadsStandardItemModel->setColumnCount(4);
 
-    mJointDeflectionsStandardItemModel = new QStandardItemModel(this);
-    mJointDeflectionsStandardItemModel->setRowCount(0);
-    mJointDeflectionsStandardItemModel->setColumnCount(3);
+    mJointDeflectionsTableModel = new SolutionTableModel(SolutionTableModel::JOINT_DEFLECTIONS, this);
 
-    mBarLoadsStandardItemModel = new QStandardItemModel(this);
-    mBarLoadsStandardItemModel->setRowCount(0);
-    mBarLoadsStandardItemModel->setColumnCount(2);
+    mBarLoadsTableModel = new SolutionTableModel(SolutionTableModel::BAR_LOADS, this);
 
-    mSupportReactionsStandardItemModel = new QStandardItemModel(this);
-    mSupportReactionsStandardItemModel->setRowCount(0);
-    mSupportReactionsStandardItemModel->setColumnCount(3);
+    mSupportReactionsTableModel = new SolutionTableModel(SolutionTableModel::SUPPORT_REACTIONS, this);
 
     mInfluenceLoadResultsStandardItemModel = new QStandardItemModel(this);
     mInfluenceLoadResultsStandardItemModel->setRowCount(0);
@@ -1524,7 +1453,7 @@ void Solver::initializeUiComponents()
     verticalBoxLayoutE1->addWidget(mSolutionsTableView);
     mSelectionTabWidget->addTab(solutionPageWidget, tr("Solution"));
 
-    mSolutionsTableView->setModel(mJointDeflectionsStandardItemModel);
+    mSolutionsTableView->setModel(mJointDeflectionsTableModel);
     mSolutionsTableView->setCornerButtonEnabled(false);
     mSolutionsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
     mSolutionsTableView->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -1566,6 +1495,22 @@ void Solver::initializeUiComponents()
     mSaveAsAction->setStatusTip(tr("Save model to file under a different name"));
     mSaveAsAction->setIcon(QIcon(tr(":/icons/document-save-as.png")));
 
+    mSaveSolutionAction = new QAction(tr("Save Solution With Model"), this);
+    mSaveSolutionAction->setStatusTip(tr("Keep the solution in the model file, to be shown again when it is opened"));
+    mSaveSolutionAction->setCheckable(true);
+    mSaveSolutionAction->setChecked(true);
+
+    mCompressModelFilesAction = new QAction(tr("Compress Model Files"), this);
+    mCompressModelFilesAction->setStatusTip(tr("Save models compressed, which earlier versions cannot open"));
+    mCompressModelFilesAction->setCheckable(true);
+    mCompressModelFilesAction->setChecked(false);
+
+    mImportDataAction = new QAction(tr("Import Data..."), this);
+    mImportDataAction->setStatusTip(tr("Import model tables from CSV or JSON Lines files"));
+
+    mExportDataAction = new QAction(tr("Export Data..."), this);
+    mExportDataAction->setStatusTip(tr("Export model and solution tables to CSV or JSON Lines files"));
+
     mExportModelImageAction = new QAction(tr("Export Model Image..."), this);
     mExportModelImageAction->setStatusTip(tr("Export model image to file"));
 
@@ -1580,6 +1525,9 @@ void Solver::initializeUiComponents()
     mShowNotesAction = new QAction(tr("Notes"), this);
     mShowNotesAction->setStatusTip(tr("Show notes dialog"));
 
+    mShowSolverDiagnosticsAction = new QAction(tr("Solver Diagnostics"), this);
+    mShowSolverDiagnosticsAction->setStatusTip(tr("Show solver timing and statistics of the last solution"));
+
     mUnitsAction = new QAction(tr("Units..."), this);
     mUnitsAction->setStatusTip(tr("Set model units"));
     mUnitsAction->setIcon(QIcon(tr(":/icons/measure.png")));
@@ -1587,6 +1535,12 @@ void Solver::initializeUiComponents()
     mSetModelAreaAction = new QAction(tr("Model Area..."), this);
     mSetModelAreaAction->setStatusTip(tr("Set model area size"));
 
+    mGenerateTrussAction = new QAction(tr("Generate Truss..."), this);
+    mGenerateTrussAction->setStatusTip(tr("Generate a standard truss from its panels, depth and member groups"));
+
+    mScriptConsoleAction = new QAction(tr("Script Console..."), this);
+    mScriptConsoleAction->setStatusTip(tr("Build, check and solve the model from a script"));
+
     mShowHideAxesAction = new QAction(tr("Show/Hide Axes"), this);
     mShowHideAxesAction->setStatusTip(tr("Show or hide coordinate axes"));
     mShowHideAxesAction->setCheckable(true);
@@ -1612,6 +1566,10 @@ void Solver::initializeUiComponents()
     mCheckModelAction->setStatusTip(tr("Check model for validity for analysis"));
     mCheckModelAction->setIcon(QIcon(tr(":/icons/games-solve.png")));
 
+    mShowNextMechanismModeAction = new QAction(tr("Show Next Mechanism Mode"), this);
+    mShowNextMechanismModeAction->setStatusTip(tr("Draw the next zero-energy mode of the unstable model"));
+    mShowNextMechanismModeAction->setEnabled(false);
+
     mHelpAction = new QAction(tr("Help"), this);
     mHelpAction->setShortcut(QKeySequence::HelpContents);
     mHelpAction->setStatusTip(tr("Display help contents for TrussTables"));
@@ -1632,22 +1590,30 @@ void Solver::initializeUiComponents()
     mFileMenu->addMenu(mOpenRecentMenu);
     mFileMenu->addAction(mSaveAction);
     mFileMenu->addAction(mSaveAsAction);
+    mFileMenu->addAction(mSaveSolutionAction);
+    mFileMenu->addAction(mCompressModelFilesAction);
+    mFileMenu->addAction(mImportDataAction);
+    mFileMenu->addAction(mExportDataAction);
     mFileMenu->addAction(mExportModelImageAction);
     mFileMenu->addAction(mExitAction);
 
     mViewMenu = menuBar()->addMenu(tr("&View"));
     mViewMenu->addAction(mSelectionPanelAction);
     mViewMenu->addAction(mShowNotesAction);
+    mViewMenu->addAction(mShowSolverDiagnosticsAction);
 
     mModelMenu = menuBar()->addMenu(tr("&Model"));
     mModelMenu->addAction(mUnitsAction);
     mModelMenu->addAction(mSetModelAreaAction);
+    mModelMenu->addAction(mGenerateTrussAction);
+    mModelMenu->addAction(mScriptConsoleAction);
     mModelMenu->addAction(mShowHideAxesAction);
     mModelMenu->addAction(mShowHideJointNumberAction);
     mModelMenu->addAction(mShowHideBarNumberAction);
     mModelMenu->addAction(mScaleForcesAction);
     mModelMenu->addAction(mScaleDeflectionsAction);
     mModelMenu->addAction(mCheckModelAction);
+    mModelMenu->addAction(mShowNextMechanismModeAction);
 
     mHelpMenu = menuBar()->addMenu(tr("&Help"));
     mHelpMenu->addAction(mHelpAction);
@@ -1683,16 +1649,10 @@ void Solver::initializeUiComponents()
 
 void Solver::createJointsModelHeader()
 {
-    QStandardItem *xHeaderItem = new QStandardItem(tr("x (%1)").arg(mUnitsAndLimits.coordinateUnit()));
-    QStandardItem *yHeaderItem = new QStandardItem(tr("y (%1)").arg(mUnitsAndLimits.coordinateUnit()));
-
-    xHeaderItem->setTextAlignment(Qt::AlignCenter);
-    yHeaderItem->setTextAlignment(Qt::AlignCenter);
+    mJointsTableModel->setHeaderData(0, Qt::Horizontal, tr("x (%1)").arg(mUnitsAndLimits.coordinateUnit()));
+    mJointsTableModel->setHeaderData(1, Qt::Horizontal, tr("y (%1)").arg(mUnitsAndLimits.coordinateUnit()));
 
-    mJointsStandardItemModel->setHorizontalHeaderItem(0, xHeaderItem);
-    mJointsStandardItemModel->setHorizontalHeaderItem(1, yHeaderItem);
-
-    mJointsTableView->setModel(mJointsStandardItemModel);
+    mJointsTableView->setModel(mJointsTableModel);
     mJointsTableView->setCornerButtonEnabled(true);
     mJointsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
     mJointsTableView->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -1702,46 +1662,21 @@ void Solver::createJointsModelHeader()
 
 void Solver::createBarsModelHeader()
 {
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        QStandardItem *columnA = new QStandardItem(tr("First Joint"));
-        columnA->setTextAlignment(Qt::AlignCenter);
-
-        QStandardItem *columnB = new QStandardItem(tr("Second Joint"));
-        columnB->setTextAlignment(Qt::AlignCenter);
-
-        QStandardItem *columnC = new QStandardItem(tr("A (%1)").arg(mUnitsAndLimits.areaUnit()));
-        columnC->setTextAlignment(Qt::AlignCenter);
+    mBarsTableModel->setHeaderData(0, Qt::Horizontal, tr("First Joint"));
+    mBarsTableModel->setHeaderData(1, Qt::Horizontal, tr("Second Joint"));
 
-        QStandardItem *columnD = new QStandardItem(tr("E (%1)").arg(mUnitsAndLimits.modulusUnit()));
-        columnD->setTextAlignment(Qt::AlignCenter);
-
-        QStandardItem *columnE = new QStandardItem(tr("W (%1)").arg(mUnitsAndLimits.unitWeightUnit()));
-        columnE->setTextAlignment(Qt::AlignCenter);
-
-        mBarsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-        mBarsStandardItemModel->setHorizontalHeaderItem(1, columnB);
-        mBarsStandardItemModel->setHorizontalHeaderItem(2, columnC);
-        mBarsStandardItemModel->setHorizontalHeaderItem(3, columnD);
-        mBarsStandardItemModel->setHorizontalHeaderItem(4, columnE);
+    if (mBarsTableModel->columnCount() == 5)
+    {
+        mBarsTableModel->setHeaderData(2, Qt::Horizontal, tr("A (%1)").arg(mUnitsAndLimits.areaUnit()));
+        mBarsTableModel->setHeaderData(3, Qt::Horizontal, tr("E (%1)").arg(mUnitsAndLimits.modulusUnit()));
+        mBarsTableModel->setHeaderData(4, Qt::Horizontal, tr("W (%1)").arg(mUnitsAndLimits.unitWeightUnit()));
     }
     else
     {
-        QStandardItem *columnA = new QStandardItem(tr("First Joint"));
-        columnA->setTextAlignment(Qt::AlignCenter);
-
-        QStandardItem *columnB = new QStandardItem(tr("Second Joint"));
-        columnB->setTextAlignment(Qt::AlignCenter);
-
-        QStandardItem *columnC = new QStandardItem(tr("Factor"));
-        columnC->setTextAlignment(Qt::AlignCenter);
-
-        mBarsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-        mBarsStandardItemModel->setHorizontalHeaderItem(1, columnB);
-        mBarsStandardItemModel->setHorizontalHeaderItem(2, columnC);
+        mBarsTableModel->setHeaderData(2, Qt::Horizontal, tr("Factor"));
     }
 
-    mBarsTableView->setModel(mBarsStandardItemModel);
+    mBarsTableView->setModel(mBarsTableModel);
     mBarsTableView->setCornerButtonEnabled(false);
     mBarsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
     mBarsTableView->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -1753,16 +1688,10 @@ void Solver::createBarsModelHeader()
 
 void Solver::createSupportsModelHeader()
 {
-    QStandardItem *columnA = new QStandardItem(tr("Joint"));
-    columnA->setTextAlignment(Qt::AlignCenter);
-    QStandardItem *columnB = new QStandardItem(tr("Type"));
-    columnB->setTextAlignment(Qt::AlignCenter);
-    QStandardItem *columnC = new QStandardItem(tr("Angle (%1)").arg(QString::fromUtf8("\u00B0")));
-    columnC->setTextAlignment(Qt::AlignCenter);
-    mSupportsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-    mSupportsStandardItemModel->setHorizontalHeaderItem(1, columnB);
-    mSupportsStandardItemModel->setHorizontalHeaderItem(2, columnC);
-    mSupportsTableView->setModel(mSupportsStandardItemModel);
+    mSupportsTableModel->setHeaderData(0, Qt::Horizontal, tr("Joint"));
+    mSupportsTableModel->setHeaderData(1, Qt::Horizontal, tr("Type"));
+    mSupportsTableModel->setHeaderData(2, Qt::Horizontal, tr("Angle (%1)").arg(QString::fromUtf8("\u00B0")));
+    mSupportsTableView->setModel(mSupportsTableModel);
     mSupportsTableView->setCornerButtonEnabled(false);
     mSupportsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
     mSupportsTableView->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -1853,11 +1782,6 @@ void Solver::createInfluenceLoadsModelHeader()
 
 void Solver::createJointDeflectionsModelHeader()
 {
-    QStandardItem *columnA = new QStandardItem(tr("Joint"));
-    columnA->setTextAlignment(Qt::AlignCenter);
-
-    QStandardItem *columnB;
-
     QString string;
 
     if (mUnitsAndLimits.system() == tr("metric"))
@@ -1869,50 +1793,37 @@ void Solver::createJointDeflectionsModelHeader()
         string = tr("ft");
     }
 
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        columnB = new QStandardItem(tr("%1x (%2)")
-                                    .arg(QString::fromUtf8("\u0394"))
-                                    .arg(string));
-    }
-    else
-    {
-        columnB = new QStandardItem(tr("%1x%2AE (%3)")
-                                    .arg(QString::fromUtf8("\u0394"))
-                                    .arg(QString::fromUtf8("\u00D7"))
-                                    .arg(string));
-    }
-
-    columnB->setTextAlignment(Qt::AlignCenter);
-
-    QStandardItem *columnC;
+    QString columnB;
+    QString columnC;
 
-    if (mBarsStandardItemModel->columnCount() == 5)
+    if (mBarsTableModel->columnCount() == 5)
     {
-        columnC = new QStandardItem(tr("%1y (%2)")
-                                    .arg(QString::fromUtf8("\u0394"))
-                                    .arg(string));
+        columnB = tr("%1x (%2)")
+                .arg(QString::fromUtf8("\u0394"))
+                .arg(string);
+        columnC = tr("%1y (%2)")
+                .arg(QString::fromUtf8("\u0394"))
+                .arg(string);
     }
     else
     {
-        columnC = new QStandardItem(tr("%1y%2AE (%3)")
-                                    .arg(QString::fromUtf8("\u0394"))
-                                    .arg(QString::fromUtf8("\u00D7"))
-                                    .arg(string));
+        columnB = tr("%1x%2AE (%3)")
+                .arg(QString::fromUtf8("\u0394"))
+                .arg(QString::fromUtf8("\u00D7"))
+                .arg(string);
+        columnC = tr("%1y%2AE (%3)")
+                .arg(QString::fromUtf8("\u0394"))
+                .arg(QString::fromUtf8("\u00D7"))
+                .arg(string);
     }
 
-    columnC->setTextAlignment(Qt::AlignCenter);
-
-    mJointDeflectionsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-    mJointDeflectionsStandardItemModel->setHorizontalHeaderItem(1, columnB);
-    mJointDeflectionsStandardItemModel->setHorizontalHeaderItem(2, columnC);
+    mJointDeflectionsTableModel->setHeaderData(0, Qt::Horizontal, tr("Joint"));
+    mJointDeflectionsTableModel->setHeaderData(1, Qt::Horizontal, columnB);
+    mJointDeflectionsTableModel->setHeaderData(2, Qt::Horizontal, columnC);
 }
 
 void Solver::createBarLoadsModelHeader()
 {
-    QStandardItem *columnA = new QStandardItem(tr("Bar"));
-    columnA->setTextAlignment(Qt::AlignCenter);
-
     QString string;
 
     if (mUnitsAndLimits.system() == tr("metric"))
@@ -1924,17 +1835,12 @@ void Solver::createBarLoadsModelHeader()
         string = tr("lb");
     }
 
-    QStandardItem *columnB = new QStandardItem(tr("Load (%1)").arg(string));
-    columnB->setTextAlignment(Qt::AlignCenter);
-    mBarLoadsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-    mBarLoadsStandardItemModel->setHorizontalHeaderItem(1, columnB);
+    mBarLoadsTableModel->setHeaderData(0, Qt::Horizontal, tr("Bar"));
+    mBarLoadsTableModel->setHeaderData(1, Qt::Horizontal, tr("Load (%1)").arg(string));
 }
 
 void Solver::createSupportReactionsModelHeader()
 {
-    QStandardItem *columnA = new QStandardItem(tr("Support"));
-    columnA->setTextAlignment(Qt::AlignCenter);
-
     QString string;
 
     if (mUnitsAndLimits.system() == tr("metric"))
@@ -1946,13 +1852,9 @@ void Solver::createSupportReactionsModelHeader()
         string = tr("lb");
     }
 
-    QStandardItem *columnB = new QStandardItem(tr("H (%1)").arg(string));
-    columnB->setTextAlignment(Qt::AlignCenter);
-    QStandardItem *columnC = new QStandardItem(tr("V (%1)").arg(string));
-    columnC->setTextAlignment(Qt::AlignCenter);
-    mSupportReactionsStandardItemModel->setHorizontalHeaderItem(0, columnA);
-    mSupportReactionsStandardItemModel->setHorizontalHeaderItem(1, columnB);
-    mSupportReactionsStandardItemModel->setHorizontalHeaderItem(2, columnC);
+    mSupportReactionsTableModel->setHeaderData(0, Qt::Horizontal, tr("Support"));
+    mSupportReactionsTableModel->setHeaderData(1, Qt::Horizontal, tr("H (%1)").arg(string));
+    mSupportReactionsTableModel->setHeaderData(2, Qt::Horizontal, tr("V (%1)").arg(string));
 }
 
 void Solver::createInfluenceLoadResultsModelHeader()
@@ -2086,6 +1988,9 @@ void Solver::readSettings()
         mLoadsMultipleRadioButton->setChecked(true);
     }
 
+    mSaveSolutionAction->setChecked(settings.value(tr("saveSolution"), true).toBool());
+    mCompressModelFilesAction->setChecked(settings.value(tr("compressModelFiles"), false).toBool());
+
     bool showSelfWeight = settings.value(tr("showSelfWeight"), true).toBool();
 
     if (showSelfWeight)
@@ -2153,6 +2058,8 @@ void Solver::writeSettings()
     settings.setValue(tr("supportsSelectionMode"), mSupportsSingleRadioButton->isChecked());
     settings.setValue(tr("loadsSelectionMode"), mLoadsSingleRadioButton->isChecked());
     settings.setValue(tr("showSelfWeight"), mYesRadioButton->isChecked());
+    settings.setValue(tr("saveSolution"), mSaveSolutionAction->isChecked());
+    settings.setValue(tr("compressModelFiles"), mCompressModelFilesAction->isChecked());
     settings.setValue(tr("lastOpenLocation"), mLastOpenLocation);
     settings.setValue(tr("lastSaveLocation"), mLastSaveLocation);
     settings.setValue(tr("lastExportModelImageLocation"), mLastExportModelImageLocation);
@@ -2172,7 +2079,7 @@ bool Solver::promptForSave()
 
         if (result == QMessageBox::Yes)
         {
-            return save();
+            return save() && waitForSave();
         }
         else if (result == QMessageBox::Cancel)
         {
@@ -2185,136 +2092,453 @@ bool Solver::promptForSave()
 
 bool Solver::saveFile(const QString &fileName)
 {
+    startSave(fileName);
+    return waitForSave();
+}
 
-    QSaveFile saveFile(fileName);
-    saveFile.setDirectWriteFallback(true);
+void Solver::recoverAutosaves()
+{
+    QDir().mkpath(ModelJournal::directory());
 
-    if (!saveFile.open(QSaveFile::WriteOnly))
+    foreach (const QString &journalFileName, ModelJournal::journalFileNames())
     {
+        //A journal whose lock is held belongs to a window that is still open
+
+        QLockFile *lock = new QLockFile(journalFileName + tr(".lock"));
+        lock->setStaleLockTime(0);
+
+        if (!lock->tryLock(0))
+        {
+            delete lock;
+            continue;
+        }
+
+        ModelFile modelFile;
+        bool isReplayed = ModelJournal::replay(journalFileName, &modelFile) && modelFile.isConsistent();
+
+        QString modelFileName = modelFile.texts(ModelFile::JOURNAL_MODEL_FILE_NAME).value(0);
+        QString shownName     = modelFileName.isEmpty() ? tr("untitled") : strippedName(modelFileName);
+        QString time          = QLocale().toString(QFileInfo(journalFileName).lastModified(), QLocale::ShortFormat);
+
         QString s1, s2;
         s1 = tr("TrussTables");
-        s2 = tr("Cannot write file %1:\n%2.").arg(saveFile.fileName().arg(saveFile.errorString()));
-        QMessageBox::warning(this, s1, s2);
-        return false;
+
+        if (!isReplayed)
+        {
+            s2 = tr("An autosaved model of %1 from %2 could not be read and is discarded.").arg(shownName).arg(time);
+            QMessageBox::warning(this, s1, s2);
+        }
+        else
+        {
+            s2 = tr("An autosaved model of %1 from %2 was found.\n"
+                    "Do you want to recover it?").arg(shownName).arg(time);
+            QMessageBox::StandardButton result = QMessageBox::question(this, s1, s2);
+
+            if (result == QMessageBox::Yes)
+            {
+                //The recovered window carries on with the journal, so that a second crash loses nothing either
+
+                Solver *solver = this;
+
+                if (isWindowModified() || !mCurrentFile.isEmpty() || !mJointsList.isEmpty())
+                {
+                    solver = new Solver;
+                    solver->resize(this->size());
+                }
+
+                solver->loadModelFile(modelFile);
+                solver->setCurrentFile(modelFileName);
+                solver->setWindowModified(true);
+                solver->mJournal.setFileName(journalFileName);
+                solver->mJournalLock = lock;
+                solver->show();
+                continue;
+            }
+        }
+
+        QFile::remove(journalFileName);
+        delete lock;
     }
+}
 
-    QDataStream out(&saveFile);
-    out.setVersion(QDataStream::Qt_5_4);
-    out << quint32(0x25438F7BEA4);
+void Solver::startSave(const QString &fileName)
+{
+    waitForWriter();
 
-    QString majorVersion(tr("0"));
-    QString minorVersion(tr("0"));
-    QString patchVersion(tr("0"));
+    ModelFile *snapshot = new ModelFile;
+    fillModelFile(*snapshot);
 
-#ifdef TRUSSTABLES_VERSION_MAJOR
-    majorVersion = QString::number(TRUSSTABLES_VERSION_MAJOR);
-#endif
+    if (mHasSolution && !mSolutionResult.isNull() && mSaveSolutionAction->isChecked())
+    {
+        writeSolution(*snapshot);
+    }
 
-#ifdef TRUSSTABLES_VERSION_MINOR
-    minorVersion = QString::number(TRUSSTABLES_VERSION_MINOR);
-#endif
+    snapshot->setCompressed(mCompressModelFilesAction->isChecked());
 
-#ifdef TRUSSTABLES_VERSION_PATCH
-    patchVersion = QString::number(TRUSSTABLES_VERSION_PATCH);
-#endif
+    //Edits made while the snapshot is written mark the model modified again
 
-    out << tr("%1.%2.%3").arg(majorVersion).arg(minorVersion).arg(patchVersion);
+    setWindowModified(false);
 
-    //Description and Units
+    ModelFileWriter *modelFileWriter = new ModelFileWriter(snapshot, fileName);
 
-    out << mDescriptionText;
-    out << mUnitsAndLimits.system();
-    out << mUnitsAndLimits.coordinateUnit();
-    out << mUnitsAndLimits.areaUnit();
-    out << mUnitsAndLimits.modulusUnit();
-    out << mUnitsAndLimits.unitWeightUnit();
-    out << mUnitsAndLimits.loadUnit();
-    out << mUnitsAndLimits.supportSettlementUnit();
-    out << mUnitsAndLimits.temperatureChangeUnit();
-    out << mUnitsAndLimits.thermalCoefficientUnit();
-    out << mUnitsAndLimits.lengthErrorUnit();
+    connect(modelFileWriter, SIGNAL(writtenSignal(QString,bool,QString)),
+            this, SLOT(storeSaveResult(QString,bool,QString)));
+    connect(modelFileWriter, SIGNAL(finished()), this, SLOT(finishWrite()));
 
-    //Joint Coordinates
+    mIsWriterRunning = true;
+    mIsSaved         = false;
+    modelFileWriter->start();
+}
 
-    QList<qreal> xCoordinateList;
-    QList<qreal> yCoordinateList;
+bool Solver::waitForSave()
+{
+    waitForWriter();
+    return mIsSaved;
+}
 
-    foreach (Joint *joint, mJointsList)
+void Solver::waitForWriter()
+{
+    if (mIsWriterRunning)
     {
-        xCoordinateList.append(joint->xCoordinate());
-        yCoordinateList.append(joint->yCoordinate());
+        QEventLoop eventLoop;
+        connect(this, SIGNAL(modelWrittenSignal()), &eventLoop, SLOT(quit()));
+        eventLoop.exec();
     }
+}
 
-    out << xCoordinateList;
-    out << yCoordinateList;
-
-    //Bars
+void Solver::storeSaveResult(QString fileName, bool isWritten, QString errorString)
+{
+    mIsSaved = isWritten;
 
-    //Axial Rigidity Option
+    if (isWritten)
+    {
+        bool isModified = isWindowModified();
+        setCurrentFile(fileName);
+        setWindowModified(isModified);
 
-    QString axialRigidityOption;
+        //The model file now holds what the journal was kept for
 
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        axialRigidityOption = tr("value");
+        if (!isModified)
+        {
+            mJournal.clear();
+        }
     }
     else
     {
-        axialRigidityOption = tr("factor");
+        setWindowModified(true);
+
+        QString s1, s2;
+        s1 = tr("TrussTables");
+        s2 = tr("Cannot write file %1:\n%2.").arg(fileName).arg(errorString);
+        QMessageBox::warning(this, s1, s2);
     }
+}
 
-    QList<qint32> firstJointList;
-    QList<qint32> secondJointList;
-    QList<qreal> areaList;
-    QList<qreal> modulusList;
-    QList<qreal> factorList;
-    QList<qreal> unitWeightList;
+void Solver::finishWrite()
+{
+    mIsWriterRunning = false;
+    emit modelWrittenSignal();
+}
 
-    foreach (Bar *bar, mBarsList)
+void Solver::autosave()
+{
+    //Hidden windows run scripts and benchmarks, which have nothing to recover
+
+    if (!isWindowModified() || !isVisible() || mIsWriterRunning || mJointsList.isEmpty())
     {
-        Joint *jointA    = bar->firstJoint();
-        Joint *jointB    = bar->secondJoint();
-        int jointNumberA = mJointsList.indexOf(jointA) + 1;
-        int jointNumberB = mJointsList.indexOf(jointB) + 1;
-        firstJointList.append(qint32(jointNumberA));
-        secondJointList.append(qint32(jointNumberB));
-        areaList.append(bar->area());
-        modulusList.append(bar->modulus());
-        factorList.append(bar->factor());
-        unitWeightList.append(bar->unitWeight());
+        return;
     }
 
-    out << axialRigidityOption;
-    out << firstJointList;
-    out << secondJointList;
-    out << areaList;
-    out << modulusList;
-    out << factorList;
-    out << unitWeightList;
+    if (mJournal.fileName().isEmpty())
+    {
+        QDir().mkpath(ModelJournal::directory());
+
+        QString name            = QUuid::createUuid().toString().mid(1, 36) + tr(".ttjnl");
+        QString journalFileName = QDir(ModelJournal::directory()).filePath(name);
 
-    //Supports
+        mJournalLock = new QLockFile(journalFileName + tr(".lock"));
+        mJournalLock->setStaleLockTime(0);
+        mJournalLock->tryLock(0);
+        mJournal.setFileName(journalFileName);
+    }
 
-    QList<qint32> supportJointList;
-    QList<qint32> supportTypeList;
-    QList<qreal> supportAngleList;
+    ModelFile *snapshot = new ModelFile;
+    fillModelFile(*snapshot);
+    snapshot->setTexts(ModelFile::JOURNAL_MODEL_FILE_NAME, QStringList(mCurrentFile));
 
-    foreach (Support *support, mSupportsList)
+    ModelFileWriter *modelFileWriter = new ModelFileWriter(snapshot, &mJournal);
+    connect(modelFileWriter, SIGNAL(finished()), this, SLOT(finishWrite()));
+
+    mIsWriterRunning = true;
+    modelFileWriter->setPriority(QThread::LowPriority);
+    modelFileWriter->start();
+}
+
+void Solver::closeJournal()
+{
+    mJournal.clear();
+    mJournal.setFileName(QString());
+
+    delete mJournalLock;
+    mJournalLock = 0;
+}
+
+bool Solver::importTables(const QStringList &fileNames)
+{
+    QString s1 = tr("TrussTables");
+
+    if (!mJointsList.isEmpty())
     {
-        Joint *supportJoint              = support->supportJoint();
-        int jointNumber                  = mJointsList.indexOf(supportJoint) + 1;
-        UnitsAndLimits::SupportType type = support->type();
+        QMessageBox::warning(this, s1, tr("Tables can only be imported into an empty model."));
+        return false;
+    }
 
-        qint32 supportType;
+    //Sections of the tables read, over the properties of this window and empty lists
 
-        switch (type)
+    ModelFile modelFile;
+    fillModelFile(modelFile);
+
+    foreach (const QString &fileName, fileNames)
+    {
+        QFile file(fileName);
+
+        if (!file.open(QFile::ReadOnly))
         {
-            case UnitsAndLimits::FIXED_LEFT:
-                supportType = 0;
-                break;
-            case UnitsAndLimits::FIXED_TOP:
-                supportType = 1;
-                break;
-            case UnitsAndLimits::FIXED_RIGHT:
+            QString s2 = tr("Cannot read file %1:\n%2.").arg(fileName).arg(file.errorString());
+            QMessageBox::warning(this, s1, s2);
+            return false;
+        }
+
+        ModelTableFile::Format format = ModelTableFile::CSV;
+
+        if (QFileInfo(fileName).suffix().toLower() == ModelTableFile::fileSuffix(ModelTableFile::JSON_LINES))
+        {
+            format = ModelTableFile::JSON_LINES;
+        }
+
+        ModelTableFile::Table table;
+        QString errorMessage;
+
+        if (!ModelTableFile::read(&file, format, &modelFile, &table, &errorMessage))
+        {
+            QString s2 = tr("Cannot import file %1:\n%2").arg(strippedName(fileName)).arg(errorMessage);
+            QMessageBox::warning(this, s1, s2);
+            return false;
+        }
+    }
+
+    //Bar areas given in a bars table mean area and modulus values rather than factors
+
+    QVector<qreal> areaList = modelFile.reals(ModelFile::BAR_AREAS);
+    bool hasAreas           = false;
+
+    for (int i = 0; (i < areaList.size()) && !hasAreas; ++i)
+    {
+        hasAreas = (areaList.at(i) > 0.0);
+    }
+
+    if (hasAreas)
+    {
+        modelFile.setProperty(ModelFile::AXIAL_RIGIDITY_OPTION, tr("value"));
+    }
+    else if (!areaList.isEmpty())
+    {
+        //A bar with no factor given stiffens as one with the default factor of one
+
+        QVector<qreal> factorList = modelFile.reals(ModelFile::BAR_FACTORS);
+
+        for (int i = 0; i < factorList.size(); ++i)
+        {
+            if (factorList.at(i) == 0.0)
+            {
+                factorList[i] = 1.0;
+            }
+        }
+
+        modelFile.setReals(ModelFile::BAR_FACTORS, factorList);
+        modelFile.setProperty(ModelFile::AXIAL_RIGIDITY_OPTION, tr("factor"));
+    }
+
+    if ((modelFile.count(ModelFile::JOINT_X_COORDINATES) == 0) || !modelFile.isConsistent())
+    {
+        QString s2 = tr("The tables do not make up a model: a table is missing or refers to items not in the others.");
+        QMessageBox::warning(this, s1, s2);
+        return false;
+    }
+
+    loadModelFile(modelFile);
+    setWindowModified(true);
+    return true;
+}
+
+bool Solver::exportTables(const QString &directory, ModelTableFile::Format format)
+{
+    ModelFile modelFile;
+    fillModelFile(modelFile);
+
+    if (mHasSolution && !mSolutionResult.isNull())
+    {
+        writeSolution(modelFile);
+    }
+
+    QDir dir(directory);
+
+    for (int i = 0; i < ModelTableFile::TABLES_COUNT; ++i)
+    {
+        ModelTableFile::Table table = ModelTableFile::Table(i);
+
+        if (ModelTableFile::rowsCount(modelFile, table) == 0)
+        {
+            continue;
+        }
+
+        QString fileName = ModelTableFile::tableName(table) + tr(".") + ModelTableFile::fileSuffix(format);
+        QSaveFile saveFile(dir.filePath(fileName));
+        saveFile.setDirectWriteFallback(true);
+
+        if (!saveFile.open(QSaveFile::WriteOnly) || !ModelTableFile::write(modelFile, table, format, &saveFile) ||
+            !saveFile.commit())
+        {
+            saveFile.cancelWriting();
+
+            QString s1, s2;
+            s1 = tr("TrussTables");
+            s2 = tr("Cannot write file %1:\n%2.").arg(saveFile.fileName()).arg(saveFile.errorString());
+            QMessageBox::warning(this, s1, s2);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void Solver::fillModelFile(ModelFile &modelFile) const
+{
+    QString majorVersion(tr("0"));
+    QString minorVersion(tr("0"));
+    QString patchVersion(tr("0"));
+
+#ifdef TRUSSTABLES_VERSION_MAJOR
+    majorVersion = QString::number(TRUSSTABLES_VERSION_MAJOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_MINOR
+    minorVersion = QString::number(TRUSSTABLES_VERSION_MINOR);
+#endif
+
+#ifdef TRUSSTABLES_VERSION_PATCH
+    patchVersion = QString::number(TRUSSTABLES_VERSION_PATCH);
+#endif
+
+    modelFile.setProperty(ModelFile::VERSION, tr("%1.%2.%3").arg(majorVersion).arg(minorVersion).arg(patchVersion));
+
+    //Description and Units
+
+    modelFile.setProperty(ModelFile::DESCRIPTION, mDescriptionText);
+    modelFile.setProperty(ModelFile::SYSTEM, mUnitsAndLimits.system());
+    modelFile.setProperty(ModelFile::COORDINATE_UNIT, mUnitsAndLimits.coordinateUnit());
+    modelFile.setProperty(ModelFile::AREA_UNIT, mUnitsAndLimits.areaUnit());
+    modelFile.setProperty(ModelFile::MODULUS_UNIT, mUnitsAndLimits.modulusUnit());
+    modelFile.setProperty(ModelFile::UNIT_WEIGHT_UNIT, mUnitsAndLimits.unitWeightUnit());
+    modelFile.setProperty(ModelFile::LOAD_UNIT, mUnitsAndLimits.loadUnit());
+    modelFile.setProperty(ModelFile::SUPPORT_SETTLEMENT_UNIT, mUnitsAndLimits.supportSettlementUnit());
+    modelFile.setProperty(ModelFile::TEMPERATURE_CHANGE_UNIT, mUnitsAndLimits.temperatureChangeUnit());
+    modelFile.setProperty(ModelFile::THERMAL_COEFFICIENT_UNIT, mUnitsAndLimits.thermalCoefficientUnit());
+    modelFile.setProperty(ModelFile::LENGTH_ERROR_UNIT, mUnitsAndLimits.lengthErrorUnit());
+
+    //Joint, bar and support numbers written below are looked up once instead of searched per item
+
+    ModelIndex modelIndex(mJointsList, mBarsList, mSupportsList);
+
+    //Joint Coordinates
+
+    QVector<qreal> xCoordinateList;
+    QVector<qreal> yCoordinateList;
+
+    xCoordinateList.reserve(mJointsList.size());
+    yCoordinateList.reserve(mJointsList.size());
+
+    foreach (Joint *joint, mJointsList)
+    {
+        xCoordinateList.append(joint->xCoordinate());
+        yCoordinateList.append(joint->yCoordinate());
+    }
+
+    modelFile.setReals(ModelFile::JOINT_X_COORDINATES, xCoordinateList);
+    modelFile.setReals(ModelFile::JOINT_Y_COORDINATES, yCoordinateList);
+
+    //Bars
+
+    //Axial Rigidity Option
+
+    if (mBarsTableModel->columnCount() == 5)
+    {
+        modelFile.setProperty(ModelFile::AXIAL_RIGIDITY_OPTION, tr("value"));
+    }
+    else
+    {
+        modelFile.setProperty(ModelFile::AXIAL_RIGIDITY_OPTION, tr("factor"));
+    }
+
+    QVector<qint32> firstJointList;
+    QVector<qint32> secondJointList;
+    QVector<qreal> areaList;
+    QVector<qreal> modulusList;
+    QVector<qreal> factorList;
+    QVector<qreal> unitWeightList;
+
+    firstJointList.reserve(mBarsList.size());
+    secondJointList.reserve(mBarsList.size());
+    areaList.reserve(mBarsList.size());
+    modulusList.reserve(mBarsList.size());
+    factorList.reserve(mBarsList.size());
+    unitWeightList.reserve(mBarsList.size());
+
+    foreach (Bar *bar, mBarsList)
+    {
+        Joint *jointA    = bar->firstJoint();
+        Joint *jointB    = bar->secondJoint();
+        int jointNumberA = modelIndex.jointIndex(jointA) + 1;
+        int jointNumberB = modelIndex.jointIndex(jointB) + 1;
+        firstJointList.append(qint32(jointNumberA));
+        secondJointList.append(qint32(jointNumberB));
+        areaList.append(bar->area());
+        modulusList.append(bar->modulus());
+        factorList.append(bar->factor());
+        unitWeightList.append(bar->unitWeight());
+    }
+
+    modelFile.setIntegers(ModelFile::BAR_FIRST_JOINTS, firstJointList);
+    modelFile.setIntegers(ModelFile::BAR_SECOND_JOINTS, secondJointList);
+    modelFile.setReals(ModelFile::BAR_AREAS, areaList);
+    modelFile.setReals(ModelFile::BAR_MODULI, modulusList);
+    modelFile.setReals(ModelFile::BAR_FACTORS, factorList);
+    modelFile.setReals(ModelFile::BAR_UNIT_WEIGHTS, unitWeightList);
+
+    //Supports
+
+    QVector<qint32> supportJointList;
+    QVector<qint32> supportTypeList;
+    QVector<qreal> supportAngleList;
+
+    foreach (Support *support, mSupportsList)
+    {
+        Joint *supportJoint              = support->supportJoint();
+        int jointNumber                  = modelIndex.jointIndex(supportJoint) + 1;
+        UnitsAndLimits::SupportType type = support->type();
+
+        //Every support type is listed, so a new one is reported by -Wswitch rather than written as a fixed left
+        qint32 supportType = 0;
+
+        switch (type)
+        {
+            case UnitsAndLimits::FIXED_LEFT:
+                supportType = 0;
+                break;
+            case UnitsAndLimits::FIXED_TOP:
+                supportType = 1;
+                break;
+            case UnitsAndLimits::FIXED_RIGHT:
                 supportType = 2;
                 break;
             case UnitsAndLimits::FIXED_BOTTOM:
@@ -2335,8 +2559,6 @@ bool Solver::saveFile(const QString &fileName)
             case UnitsAndLimits::ROLLER_BOTTOM:
                 supportType = 8;
                 break;
-            default:
-                break;
         }
 
         supportJointList.append(qint32(jointNumber));
@@ -2344,134 +2566,115 @@ bool Solver::saveFile(const QString &fileName)
         supportAngleList.append(support->angle());
     }
 
-    out << supportJointList;
-    out << supportTypeList;
-    out << supportAngleList;
+    modelFile.setIntegers(ModelFile::SUPPORT_JOINTS, supportJointList);
+    modelFile.setIntegers(ModelFile::SUPPORT_TYPES, supportTypeList);
+    modelFile.setReals(ModelFile::SUPPORT_ANGLES, supportAngleList);
 
-    //Loads
+    //Joint Loads
 
-    bool checkA = !mJointLoadsList.isEmpty();
-    bool checkB = !mSupportSettlementsList.isEmpty();
-    bool checkC = !mThermalEffectsList.isEmpty();
-    bool checkD = !mFabricationErrorsList.isEmpty();
-    bool checkE = !mInfluenceLoadsList.isEmpty();
+    QVector<qint32> loadJointList;
+    QVector<qreal> loadHorizontalComponentList;
+    QVector<qreal> loadVerticalComponentList;
+    QStringList loadPositionList;
 
-    if (checkA || checkB || checkC || checkD || checkE)
+    foreach (JointLoad *load, mJointLoadsList)
     {
-        out << true;
-
-        //Joint Loads
-
-        QList<qint32> loadJointList;
-        QList<qreal> loadHorizontalComponentList;
-        QList<qreal> loadVerticalComponentList;
-        QList<QString> loadPositionList;
-
-        foreach (JointLoad *load, mJointLoadsList)
-        {
-            Joint *loadJoint = load->loadJoint();
-            int jointNumber  = mJointsList.indexOf(loadJoint) + 1;
-
-            loadJointList.append(qint32(jointNumber));
-            loadHorizontalComponentList.append(load->horizontalComponent());
-            loadVerticalComponentList.append(load->verticalComponent());
-            loadPositionList.append(load->position());
-        }
-
-        out << loadJointList;
-        out << loadHorizontalComponentList;
-        out << loadVerticalComponentList;
-        out << loadPositionList;
-
-        //Support Settlements
-
-        QList<qint32> settlementSupportList;
-        QList<qreal> settlementList;
-
-        foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
-        {
-            Support *support  = supportSettlement->settlementSupport();
-            int supportNumber = mSupportsList.indexOf(support) + 1;
-
-            settlementSupportList.append(qint32(supportNumber));
-            settlementList.append(supportSettlement->settlement());
-        }
-
-        out << settlementSupportList;
-        out << settlementList;
+        Joint *loadJoint = load->loadJoint();
+        int jointNumber  = modelIndex.jointIndex(loadJoint) + 1;
 
-        //Thermal Effects
-
-        QList<qint32> thermalEffectBarList;
-        QList<qreal> temperatureChangeList;
-        QList<qreal> thermalCoefficientList;
+        loadJointList.append(qint32(jointNumber));
+        loadHorizontalComponentList.append(load->horizontalComponent());
+        loadVerticalComponentList.append(load->verticalComponent());
+        loadPositionList.append(load->position());
+    }
 
-        foreach (ThermalEffect *thermalEffect, mThermalEffectsList)
-        {
-            Bar *bar      = thermalEffect->thermalEffectBar();
-            int barNumber = mBarsList.indexOf(bar) + 1;
+    modelFile.setIntegers(ModelFile::JOINT_LOAD_JOINTS, loadJointList);
+    modelFile.setReals(ModelFile::JOINT_LOAD_HORIZONTAL_COMPONENTS, loadHorizontalComponentList);
+    modelFile.setReals(ModelFile::JOINT_LOAD_VERTICAL_COMPONENTS, loadVerticalComponentList);
+    modelFile.setTexts(ModelFile::JOINT_LOAD_POSITIONS, loadPositionList);
 
-            thermalEffectBarList.append(qint32(barNumber));
-            temperatureChangeList.append(thermalEffect->temperatureChange());
-            thermalCoefficientList.append(thermalEffect->thermalCoefficient());
-        }
+    //Support Settlements
 
-        out << thermalEffectBarList;
-        out << temperatureChangeList;
-        out << thermalCoefficientList;
+    QVector<qint32> settlementSupportList;
+    QVector<qreal> settlementList;
 
-        //Assembly/Fabrication Errors
+    foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
+    {
+        Support *support  = supportSettlement->settlementSupport();
+        int supportNumber = modelIndex.supportIndex(support) + 1;
 
-        QList<qint32> fabricationErrorBarList;
-        QList<qreal> lengthErrorList;
+        settlementSupportList.append(qint32(supportNumber));
+        settlementList.append(supportSettlement->settlement());
+    }
 
-        foreach (FabricationError *fabricationError, mFabricationErrorsList)
-        {
-            Bar *bar      = fabricationError->fabricationErrorBar();
-            int barNumber = mBarsList.indexOf(bar) + 1;
+    modelFile.setIntegers(ModelFile::SETTLEMENT_SUPPORTS, settlementSupportList);
+    modelFile.setReals(ModelFile::SETTLEMENTS, settlementList);
 
-            fabricationErrorBarList.append(qint32(barNumber));
-            lengthErrorList.append(fabricationError->lengthError());
-        }
+    //Thermal Effects
 
-        out << fabricationErrorBarList;
-        out << lengthErrorList;
+    QVector<qint32> thermalEffectBarList;
+    QVector<qreal> temperatureChangeList;
+    QVector<qreal> thermalCoefficientList;
 
-        //Influence Loads
+    foreach (ThermalEffect *thermalEffect, mThermalEffectsList)
+    {
+        Bar *bar      = thermalEffect->thermalEffectBar();
+        int barNumber = modelIndex.barIndex(bar) + 1;
 
-        int count = mInfluenceLoadsList.size();
-        out << count;
+        thermalEffectBarList.append(qint32(barNumber));
+        temperatureChangeList.append(thermalEffect->temperatureChange());
+        thermalCoefficientList.append(thermalEffect->thermalCoefficient());
+    }
 
-        for (int i = 0; i < count; ++i)
-        {
-            out << mInfluenceLoadsList.at(i)->name();
-            out << mInfluenceLoadsList.at(i)->direction();
+    modelFile.setIntegers(ModelFile::THERMAL_EFFECT_BARS, thermalEffectBarList);
+    modelFile.setReals(ModelFile::TEMPERATURE_CHANGES, temperatureChangeList);
+    modelFile.setReals(ModelFile::THERMAL_COEFFICIENTS, thermalCoefficientList);
 
-            QList<qint32> pathList;
+    //Assembly/Fabrication Errors
 
-            foreach (int jointNumber, mInfluenceLoadsList.at(i)->path())
-            {
-                pathList.append(qint32(jointNumber));
-            }
+    QVector<qint32> fabricationErrorBarList;
+    QVector<qreal> lengthErrorList;
 
-            out << pathList;
-            out << mInfluenceLoadsList.at(i)->pointLoads();
-            out << mInfluenceLoadsList.at(i)->pointLoadPositions();
-        }
-    }
-    else
+    foreach (FabricationError *fabricationError, mFabricationErrorsList)
     {
-        out << false;
+        Bar *bar      = fabricationError->fabricationErrorBar();
+        int barNumber = modelIndex.barIndex(bar) + 1;
+
+        fabricationErrorBarList.append(qint32(barNumber));
+        lengthErrorList.append(fabricationError->lengthError());
     }
 
-    bool check = saveFile.commit();
+    modelFile.setIntegers(ModelFile::FABRICATION_ERROR_BARS, fabricationErrorBarList);
+    modelFile.setReals(ModelFile::LENGTH_ERRORS, lengthErrorList);
 
-    if (check)
-    {
-        setCurrentFile(fileName);
-    }
+    //Influence Loads
 
-    return check;
+    QStringList names;
+    QStringList directions;
+    QVector<qint32> pathSizes;
+    QVector<qint32> paths;
+    QVector<qint32> pointLoadCounts;
+    QVector<qreal> pointLoads;
+    QVector<qreal> pointLoadPositions;
+
+    foreach (InfluenceLoad *influenceLoad, mInfluenceLoadsList)
+    {
+        names.append(influenceLoad->name());
+        directions.append(influenceLoad->direction());
+        pathSizes.append(qint32(influenceLoad->path().size()));
+        paths += influenceLoad->path().toVector();
+        pointLoadCounts.append(qint32(influenceLoad->pointLoads().size()));
+        pointLoads += influenceLoad->pointLoads().toVector();
+        pointLoadPositions += influenceLoad->pointLoadPositions().toVector();
+    }
+
+    modelFile.setTexts(ModelFile::INFLUENCE_LOAD_NAMES, names);
+    modelFile.setTexts(ModelFile::INFLUENCE_LOAD_DIRECTIONS, directions);
+    modelFile.setIntegers(ModelFile::INFLUENCE_LOAD_PATH_SIZES, pathSizes);
+    modelFile.setIntegers(ModelFile::INFLUENCE_LOAD_PATHS, paths);
+    modelFile.setIntegers(ModelFile::INFLUENCE_LOAD_POINT_LOAD_COUNTS, pointLoadCounts);
+    modelFile.setReals(ModelFile::INFLUENCE_LOAD_POINT_LOADS, pointLoads);
+    modelFile.setReals(ModelFile::INFLUENCE_LOAD_POINT_LOAD_POSITIONS, pointLoadPositions);
 }
 
 void Solver::setCurrentFile(const QString &fileName)
@@ -2535,99 +2738,676 @@ QString Solver::strippedName(const QString &fullFileName)
 
 void Solver::updateModelViewer()
 {
+    if (mEditTransactionDepth > 0)
+    {
+        mIsViewerUpdatePending = true;
+        return;
+    }
+
     emit updateModelSignal();
 }
 
-void Solver::newFile()
+void Solver::updateJointOptions()
 {
-    writeSettings();
-    Solver *newSolver = new Solver;
-    newSolver->resize(this->size());
-    newSolver->show();
+    //Refresh the joint numbers offered by the dialogs
+
+    if (mEditTransactionDepth > 0)
+    {
+        mIsJointOptionsUpdatePending = true;
+        return;
+    }
+
+    mAddJointsDialog->updateJoints();
+    mAddBarsDialog->updateFirstJointOptions();
+    mEditBarsDialog->updateFirstJointOptions();
+    mAddSupportsDialog->updateJoints();
+    mAddJointLoadsDialog->updateJoints();
+    mEditJointLoadsDialog->updateJoints();
 }
 
-void Solver::open()
+void Solver::beginEditTransaction()
 {
-    if (isWindowModified() || !mCurrentFile.isEmpty())
+    if (mEditTransactionDepth == 0)
     {
-        writeSettings();
-        Solver *newSolver = new Solver;
+        mJointsTableView->setUpdatesEnabled(false);
+        mBarsTableView->setUpdatesEnabled(false);
+        mSupportsTableView->setUpdatesEnabled(false);
+        mModelViewer->setUpdatesEnabled(false);
+    }
 
-        if (newSolver->promptForOpenFileName())
-        {
-            newSolver->show();
-        }
-        else
-        {
-            newSolver->destroy();
-        }
+    ++mEditTransactionDepth;
+}
+
+void Solver::commitEditTransaction()
+{
+    --mEditTransactionDepth;
+
+    if (mEditTransactionDepth > 0)
+    {
+        return;
     }
-    else
+
+    mIsJointsExtentValid = false;
+
+    //Publish what the edits of the transaction left pending, renumbering the joints first
+
+    if (mIsNormalizationPending)
     {
-        promptForOpenFileName();
+        mIsNormalizationPending = false;
+        normalizeJointCoordinates();
     }
-}
 
-bool Solver::promptForOpenFileName()
-{
-    QString s1, s2, s3, openFileName;
-    s1           = tr("Open TrussTables Model");
-    s2           = mLastOpenLocation;
-    s3           = tr("TrussTables model files (*.ttmdl)");
-    openFileName = QFileDialog::getOpenFileName(this, s1, s2, s3);
+    if (mIsJointOptionsUpdatePending)
+    {
+        mIsJointOptionsUpdatePending = false;
+        updateJointOptions();
+    }
 
-    if (openFileName.isEmpty())
+    if (mIsModelCheckPending)
     {
-        return false;
+        mIsModelCheckPending = false;
+        invalidateModelCheck();
     }
-    else
+
+    mJointsTableView->setUpdatesEnabled(true);
+    mBarsTableView->setUpdatesEnabled(true);
+    mSupportsTableView->setUpdatesEnabled(true);
+    mModelViewer->setUpdatesEnabled(true);
+
+    if (mIsViewerUpdatePending)
     {
-        QFileInfo fileInfo(openFileName);
-        mLastOpenLocation = fileInfo.dir().path();
-        return loadFile(openFileName);
+        mIsViewerUpdatePending = false;
+        updateModelViewer();
+    }
+}
+
+Solver::EditTransaction::EditTransaction(Solver *solver)
+{
+    mSolver = solver;
+    mSolver->beginEditTransaction();
+}
+
+Solver::EditTransaction::~EditTransaction()
+{
+    mSolver->commitEditTransaction();
+}
+
+const QList<Joint *> &Solver::jointsList() const
+{
+    return mJointsList;
+}
+
+const QList<Bar *> &Solver::barsList() const
+{
+    return mBarsList;
+}
+
+const QList<Support *> &Solver::supportsList() const
+{
+    return mSupportsList;
+}
+
+QSharedPointer<const SolutionResult> Solver::solutionResult() const
+{
+    return mSolutionResult;
+}
+
+const SolverStatistics &Solver::solverStatistics() const
+{
+    return mSolverStatistics;
+}
+
+bool Solver::areaModulusOption() const
+{
+    return (mBarsTableModel->columnCount() == 5);
+}
+
+bool Solver::setAxialRigidityOption(bool areaModulusOption)
+{
+    if (!mBarsList.isEmpty())
+    {
+        return (areaModulusOption == this->areaModulusOption());
+    }
+
+    if (areaModulusOption)
+    {
+        mValueRadioButton->setChecked(true);
+    }
+    else
+    {
+        mFactorRadioButton->setChecked(true);
+    }
+
+    return true;
+}
+
+int Solver::appendJoint(qreal xCoordinate, qreal yCoordinate)
+{
+    if (hasLoads())
+    {
+        return 0;
+    }
+
+    //Extent of the model with the new joint, which is moved clear of the negative axes on normalization. The joints
+    //are scanned once per transaction, as the joints appended in it are not normalized until it commits.
+
+    if (!mIsJointsExtentValid && !mJointsList.isEmpty())
+    {
+        mJointsXMin = mJointsList.first()->xCoordinate();
+        mJointsXMax = mJointsXMin;
+        mJointsYMin = mJointsList.first()->yCoordinate();
+        mJointsYMax = mJointsYMin;
+
+        foreach (Joint *joint, mJointsList)
+        {
+            mJointsXMin = qMin(mJointsXMin, joint->xCoordinate());
+            mJointsXMax = qMax(mJointsXMax, joint->xCoordinate());
+            mJointsYMin = qMin(mJointsYMin, joint->yCoordinate());
+            mJointsYMax = qMax(mJointsYMax, joint->yCoordinate());
+        }
+    }
+    else if (mJointsList.isEmpty())
+    {
+        mJointsXMin = xCoordinate;
+        mJointsXMax = xCoordinate;
+        mJointsYMin = yCoordinate;
+        mJointsYMax = yCoordinate;
+    }
+
+    mIsJointsExtentValid = (mEditTransactionDepth > 0);
+
+    qreal xMin = qMin(mJointsXMin, xCoordinate);
+    qreal xMax = qMax(mJointsXMax, xCoordinate);
+    qreal yMin = qMin(mJointsYMin, yCoordinate);
+    qreal yMax = qMax(mJointsYMax, yCoordinate);
+
+    if (!(xMax - xMin < mUnitsAndLimits.maxXCoordinate()) || !(yMax - yMin < mUnitsAndLimits.maxYCoordinate()))
+    {
+        return 0;
+    }
+
+    EditTransaction transaction(this);
+
+    bool isFirstJoint = mJointsList.isEmpty();
+
+    if (addJoint(xCoordinate, yCoordinate) < 0)
+    {
+        return 0;
+    }
+
+    mJointsXMin = xMin;
+    mJointsXMax = xMax;
+    mJointsYMin = yMin;
+    mJointsYMax = yMax;
+
+    if (isFirstJoint)
+    {
+        emit enableJointsInput();
+        mUnitsAction->setEnabled(false);
+    }
+
+    normalizeJointCoordinates();
+    invalidateModelCheck();
+    setWindowModified(true);
+    updateModelViewer();
+    return mJointsList.size();
+}
+
+int Solver::appendBar(int   firstJointNumber,
+                      int   secondJointNumber,
+                      qreal area,
+                      qreal modulus,
+                      qreal factor,
+                      qreal unitWeight)
+{
+    if (hasLoads())
+    {
+        return 0;
+    }
+
+    bool checkA = (firstJointNumber > 0) && (firstJointNumber <= mJointsList.size());
+    bool checkB = (secondJointNumber > 0) && (secondJointNumber <= mJointsList.size());
+
+    if (!checkA || !checkB || (firstJointNumber == secondJointNumber))
+    {
+        return 0;
+    }
+
+    if (areaModulusOption())
+    {
+        if (!(area > 0.0) || !(modulus > 0.0) || (unitWeight < 0.0))
+        {
+            return 0;
+        }
+
+        factor = 0.0;
+    }
+    else
+    {
+        if (!(factor > 0.0))
+        {
+            return 0;
+        }
+
+        area       = 0.0;
+        modulus    = 0.0;
+        unitWeight = 0.0;
+    }
+
+    Joint *firstJoint  = mJointsList.at(firstJointNumber - 1);
+    Joint *secondJoint = mJointsList.at(secondJointNumber - 1);
+
+    qreal xComponent = secondJoint->xCoordinate() - firstJoint->xCoordinate();
+    qreal yComponent = secondJoint->yCoordinate() - firstJoint->yCoordinate();
+    qreal length     = std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0));
+
+    if (!((mUnitsAndLimits.minBarLength() < length) && (mUnitsAndLimits.maxBarLength() > length)))
+    {
+        return 0;
+    }
+
+    EditTransaction transaction(this);
+
+    int barsCount = mBarsList.size();
+
+    addBar(firstJoint->xCoordinate(),
+           firstJoint->yCoordinate(),
+           secondJoint->xCoordinate(),
+           secondJoint->yCoordinate(),
+           area,
+           modulus,
+           factor,
+           unitWeight);
+
+    if (mBarsList.size() == barsCount)
+    {
+        return 0;
+    }
+
+    invalidateModelCheck();
+    setWindowModified(true);
+    updateModelViewer();
+    return mBarsList.size();
+}
+
+bool Solver::appendSupport(int                         jointNumber,
+                           UnitsAndLimits::SupportType type,
+                           qreal                       angle)
+{
+    if ((jointNumber < 1) || (jointNumber > mJointsList.size()))
+    {
+        return false;
+    }
+
+    int supportsCount = mSupportsList.size();
+
+    //Supports go on the selected joints before the joint number
+    mJointsTableView->clearSelection();
+    addSupports(jointNumber, type, angle);
+
+    return (mSupportsList.size() > supportsCount);
+}
+
+bool Solver::appendJointLoad(int            jointNumber,
+                             qreal          horizontalComponent,
+                             qreal          verticalComponent,
+                             const QString &position)
+{
+    if ((jointNumber < 1) || (jointNumber > mJointsList.size()))
+    {
+        return false;
+    }
+
+    if ((horizontalComponent == 0.0) && (verticalComponent == 0.0))
+    {
+        return false;
+    }
+
+    if ((position != tr("head")) && (position != tr("tail")))
+    {
+        return false;
+    }
+
+    if (!checkModelAndWait())
+    {
+        return false;
+    }
+
+    int loadsCount = mJointLoadsList.size();
+
+    mJointsTableView->clearSelection();
+    addJointLoad(jointNumber, horizontalComponent, verticalComponent, position);
+
+    return (mJointLoadsList.size() > loadsCount);
+}
+
+int Solver::appendTruss(const ParametricTruss &truss)
+{
+    //The limits checked by the generate truss dialog
+
+    qreal xRange = truss.xOffset(mJointsList) + truss.width();
+    qreal yRange = truss.height();
+
+    foreach (Joint *joint, mJointsList)
+    {
+        yRange = qMax(yRange, joint->yCoordinate());
+    }
+
+    if (!(xRange < mUnitsAndLimits.maxXCoordinate()) || !(yRange < mUnitsAndLimits.maxYCoordinate()))
+    {
+        return 0;
+    }
+
+    qreal minLength = qMin(truss.minMemberLength(), truss.depth() / truss.rowsCount());
+    qreal maxLength = truss.maxMemberLength();
+
+    if (!(mUnitsAndLimits.minBarLength() < minLength) || !(maxLength < mUnitsAndLimits.maxBarLength()))
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < ParametricTruss::kMemberGroupsCount; ++i)
+    {
+        ParametricTruss::MemberGroup group = ParametricTruss::MemberGroup(i);
+
+        if (areaModulusOption())
+        {
+            if (!(truss.area(group) > 0.0) || !(truss.modulus(group) > 0.0) || (truss.unitWeight(group) < 0.0))
+            {
+                return 0;
+            }
+        }
+        else if (!(truss.factor(group) > 0.0))
+        {
+            return 0;
+        }
+    }
+
+    int jointsCount = mJointsList.size();
+
+    generateTruss(truss);
+
+    if (mJointsList.size() == jointsCount)
+    {
+        return 0;
+    }
+
+    return jointsCount + 1;
+}
+
+bool Solver::checkModelAndWait()
+{
+    if (mBarsList.isEmpty() || mSupportsList.isEmpty())
+    {
+        return false;
+    }
+
+    if (mModelCheckRequired)
+    {
+        QEventLoop eventLoop;
+        connect(this, SIGNAL(modelCheckedSignal()), &eventLoop, SLOT(quit()));
+
+        checkModel();
+
+        if (mIsModelCheckRunning)
+        {
+            eventLoop.exec();
+        }
+    }
+
+    return mIsStable;
+}
+
+bool Solver::solveModelAndWait(bool           jointLoads,
+                               bool           selfWeight,
+                               bool           supportSettlements,
+                               bool           thermalEffects,
+                               bool           fabricationErrors,
+                               const QString &influenceLoadName)
+{
+    if (!checkModelAndWait())
+    {
+        return false;
+    }
+
+    if (mHasSolution)
+    {
+        resetSolution();
+    }
+
+    setSolutionOptions();
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Select the loads as solveModel reads them, refusing loads the model does not have so that no message shows
+    // -----------------------------------------------------------------------------------------------------------------
+
+    bool influenceLoads = !influenceLoadName.isEmpty();
+
+    QList<QPair<QCheckBox *, bool> > selections;
+    selections.append(qMakePair(mJointLoadsCheckBox, jointLoads));
+    selections.append(qMakePair(mSelfWeightCheckBox, selfWeight));
+    selections.append(qMakePair(mSupportSettlementsCheckBox, supportSettlements));
+    selections.append(qMakePair(mThermalEffectsCheckBox, thermalEffects));
+    selections.append(qMakePair(mFabricationErrorsCheckBox, fabricationErrors));
+    selections.append(qMakePair(mInfluenceLoadsCheckBox, influenceLoads));
+
+    int count = 0;
+
+    for (int i = 0; i < selections.size(); ++i)
+    {
+        QCheckBox *checkBox = selections.at(i).first;
+        bool isSelected     = selections.at(i).second;
+
+        if (isSelected && !checkBox->isEnabled())
+        {
+            return false;
+        }
+
+        if (isSelected)
+        {
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return false;
+    }
+
+    if (influenceLoads)
+    {
+        int index = mInfluenceLoadsComboBox->findText(influenceLoadName);
+
+        if (index < 0)
+        {
+            return false;
+        }
+
+        mInfluenceLoadsComboBox->setCurrentIndex(index);
+    }
+
+    for (int i = 0; i < selections.size(); ++i)
+    {
+        if (selections.at(i).first->isEnabled())
+        {
+            selections.at(i).first->setChecked(selections.at(i).second);
+        }
+    }
+
+    QEventLoop eventLoop;
+    connect(this, SIGNAL(modelSolvedSignal()), &eventLoop, SLOT(quit()));
+
+    solveModel();
+
+    if (mIsSolutionRunning)
+    {
+        eventLoop.exec();
+    }
+
+    return mHasSolution;
+}
+
+void Solver::newFile()
+{
+    writeSettings();
+    Solver *newSolver = new Solver;
+    newSolver->resize(this->size());
+    newSolver->show();
+}
+
+void Solver::open()
+{
+    if (isWindowModified() || !mCurrentFile.isEmpty())
+    {
+        writeSettings();
+        Solver *newSolver = new Solver;
+
+        if (newSolver->promptForOpenFileName())
+        {
+            newSolver->show();
+        }
+        else
+        {
+            newSolver->destroy();
+        }
+    }
+    else
+    {
+        promptForOpenFileName();
+    }
+}
+
+bool Solver::promptForOpenFileName()
+{
+    QString s1, s2, s3, openFileName;
+    s1           = tr("Open TrussTables Model");
+    s2           = mLastOpenLocation;
+    s3           = tr("TrussTables model files (*.ttmdl)");
+    openFileName = QFileDialog::getOpenFileName(this, s1, s2, s3);
+
+    if (openFileName.isEmpty())
+    {
+        return false;
+    }
+    else
+    {
+        QFileInfo fileInfo(openFileName);
+        mLastOpenLocation = fileInfo.dir().path();
+        return loadFile(openFileName);
+    }
+}
+
+bool Solver::save()
+{
+    if (mCurrentFile.isEmpty())
+    {
+        return saveAs();
+    }
+    else
+    {
+        QFileInfo fileInfo(mCurrentFile);
+        mLastSaveLocation = fileInfo.dir().path();
+        startSave(mCurrentFile);
+        return true;
+    }
+}
+
+bool Solver::saveAs()
+{
+    QString s1, s2, s3;
+    s1 = tr("Save TrussTables Model");
+    s2 = mLastSaveLocation;
+    s3 = tr("TrussTables model files (*.ttmdl)");
+    QFileDialog fileDialog(this, s1, s2, s3);
+    fileDialog.setWindowModality(Qt::WindowModal);
+    fileDialog.setAcceptMode(QFileDialog::AcceptSave);
+    fileDialog.setDefaultSuffix(tr("ttmdl"));
+    fileDialog.setFileMode(QFileDialog::AnyFile);
+
+    QStringList fileNames;
+
+    if (fileDialog.exec())
+    {
+        fileNames = fileDialog.selectedFiles();
+    }
+    else
+    {
+        return false;
+    }
+
+    QFileInfo fileInfo(fileNames.at(0));
+    mLastSaveLocation = fileInfo.dir().path();
+    startSave(fileNames.at(0));
+    return true;
+}
+
+void Solver::importData()
+{
+    QString s1, s2, s3;
+    s1 = tr("Import Model Tables");
+    s2 = mLastOpenLocation;
+    s3 = tr("Model tables (*.csv *.jsonl)");
+    QStringList fileNames = QFileDialog::getOpenFileNames(this, s1, s2, s3);
+
+    if (fileNames.isEmpty())
+    {
+        return;
+    }
+
+    mLastOpenLocation = QFileInfo(fileNames.first()).dir().path();
+
+    if (isWindowModified() || !mCurrentFile.isEmpty() || !mJointsList.isEmpty())
+    {
+        writeSettings();
+        Solver *newSolver = new Solver;
+        newSolver->resize(this->size());
+
+        if (newSolver->importTables(fileNames))
+        {
+            newSolver->show();
+        }
+        else
+        {
+            newSolver->destroy();
+        }
+    }
+    else
+    {
+        importTables(fileNames);
     }
 }
 
-bool Solver::save()
+void Solver::exportData()
 {
-    if (mCurrentFile.isEmpty())
+    QString s1        = tr("Export Model Tables");
+    QString directory = QFileDialog::getExistingDirectory(this, s1, mLastSaveLocation);
+
+    if (directory.isEmpty())
     {
-        return saveAs();
+        return;
     }
-    else
+
+    QStringList formats;
+    formats << tr("CSV") << tr("JSON Lines");
+
+    bool ok;
+    QString format = QInputDialog::getItem(this, s1, tr("Format:"), formats, 0, false, &ok);
+
+    if (!ok)
     {
-        QFileInfo fileInfo(mCurrentFile);
-        mLastSaveLocation = fileInfo.dir().path();
-        return saveFile(mCurrentFile);
+        return;
     }
-}
-
-bool Solver::saveAs()
-{
-    QString s1, s2, s3;
-    s1 = tr("Save TrussTables Model");
-    s2 = mLastSaveLocation;
-    s3 = tr("TrussTables model files (*.ttmdl)");
-    QFileDialog fileDialog(this, s1, s2, s3);
-    fileDialog.setWindowModality(Qt::WindowModal);
-    fileDialog.setAcceptMode(QFileDialog::AcceptSave);
-    fileDialog.setDefaultSuffix(tr("ttmdl"));
-    fileDialog.setFileMode(QFileDialog::AnyFile);
 
-    QStringList fileNames;
+    mLastSaveLocation = directory;
 
-    if (fileDialog.exec())
+    if (format == formats.at(1))
     {
-        fileNames = fileDialog.selectedFiles();
+        exportTables(directory, ModelTableFile::JSON_LINES);
     }
     else
     {
-        return false;
+        exportTables(directory, ModelTableFile::CSV);
     }
-
-    QFileInfo fileInfo(fileNames.at(0));
-    mLastSaveLocation = fileInfo.dir().path();
-    return saveFile(fileNames.at(0));
 }
 
 void Solver::openRecentFile()
@@ -2687,6 +3467,7 @@ void Solver::updateUnits()
     mEditJointsDialog->updateUnits();
     mAddBarsDialog->updateUnits();
     mEditBarsDialog->updateUnits();
+    mGenerateTrussDialog->updateUnits();
     mAddJointLoadsDialog->updateUnits();
     mEditJointLoadsDialog->updateUnits();
     mAddSupportSettlementsDialog->updateUnits();
@@ -2698,27 +3479,17 @@ void Solver::updateUnits()
     mAddInfluenceLoadsDialog->updateUnits();
     mEditInfluenceLoadsDialog->updateUnits();
 
-    QStandardItem *item = mJointsStandardItemModel->horizontalHeaderItem(0);
-    item->setText(tr("x (%1)").arg(mUnitsAndLimits.coordinateUnit()));
-    item->setTextAlignment(Qt::AlignCenter);
-
-    item = mJointsStandardItemModel->horizontalHeaderItem(1);
-    item->setText(tr("y (%1)").arg(mUnitsAndLimits.coordinateUnit()));
-    item->setTextAlignment(Qt::AlignCenter);
+    mJointsTableModel->setHeaderData(0, Qt::Horizontal, tr("x (%1)").arg(mUnitsAndLimits.coordinateUnit()));
+    mJointsTableModel->setHeaderData(1, Qt::Horizontal, tr("y (%1)").arg(mUnitsAndLimits.coordinateUnit()));
 
-    if (mBarsStandardItemModel->columnCount() == 5)
+    if (mBarsTableModel->columnCount() == 5)
     {
-        item = mBarsStandardItemModel->horizontalHeaderItem(2);
-        item->setText(tr("A (%1)").arg(mUnitsAndLimits.areaUnit()));
-
-        item = mBarsStandardItemModel->horizontalHeaderItem(3);
-        item->setText(tr("E (%1)").arg(mUnitsAndLimits.modulusUnit()));
-
-        item = mBarsStandardItemModel->horizontalHeaderItem(4);
-        item->setText(tr("W (%1)").arg(mUnitsAndLimits.unitWeightUnit()));
+        mBarsTableModel->setHeaderData(2, Qt::Horizontal, tr("A (%1)").arg(mUnitsAndLimits.areaUnit()));
+        mBarsTableModel->setHeaderData(3, Qt::Horizontal, tr("E (%1)").arg(mUnitsAndLimits.modulusUnit()));
+        mBarsTableModel->setHeaderData(4, Qt::Horizontal, tr("W (%1)").arg(mUnitsAndLimits.unitWeightUnit()));
     }
 
-    item = mJointLoadsStandardItemModel->horizontalHeaderItem(1);
+    QStandardItem *item = mJointLoadsStandardItemModel->horizontalHeaderItem(1);
     item->setText(tr("H (%1)").arg(mUnitsAndLimits.loadUnit()));
     item->setTextAlignment(Qt::AlignCenter);
 
@@ -2754,50 +3525,12 @@ void Solver::updateUnits()
     item->setText(tr("Point Loads (%1)").arg(mUnitsAndLimits.loadUnit()));
     item->setTextAlignment(Qt::AlignCenter);
 
-    item = mJointDeflectionsStandardItemModel->horizontalHeaderItem(1);
+    createJointDeflectionsModelHeader();
+    createBarLoadsModelHeader();
+    createSupportReactionsModelHeader();
 
     QString string;
 
-    if (mUnitsAndLimits.system() == tr("metric"))
-    {
-        string = tr("m");
-    }
-    else
-    {
-        string = tr("ft");
-    }
-
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        item->setText(tr("%1x (%2)")
-                      .arg(QString::fromUtf8("\u0394"))
-                      .arg(string));
-    }
-    else
-    {
-        item->setText(tr("%1x%2AE (%3)")
-                      .arg(QString::fromUtf8("\u0394"))
-                      .arg(QString::fromUtf8("\u00D7"))
-                      .arg(string));
-    }
-    item->setTextAlignment(Qt::AlignCenter);
-
-    item = mJointDeflectionsStandardItemModel->horizontalHeaderItem(2);
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        item->setText(tr("%1y (%2)")
-                      .arg(QString::fromUtf8("\u0394"))
-                      .arg(string));
-    }
-    else
-    {
-        item->setText(tr("%1y%2AE (%3)")
-                      .arg(QString::fromUtf8("\u0394"))
-                      .arg(QString::fromUtf8("\u00D7"))
-                      .arg(string));
-    }
-    item->setTextAlignment(Qt::AlignCenter);
-
     if (mUnitsAndLimits.system() == tr("metric"))
     {
         string = tr("N");
@@ -2807,17 +3540,6 @@ void Solver::updateUnits()
         string = tr("lb");
     }
 
-    item = mBarLoadsStandardItemModel->horizontalHeaderItem(1);
-    item->setText(tr("Load (%1)").arg(string));
-    item->setTextAlignment(Qt::AlignCenter);
-
-    item = mSupportReactionsStandardItemModel->horizontalHeaderItem(1);
-    item->setText(tr("H (%1)").arg(string));
-    item->setTextAlignment(Qt::AlignCenter);
-    item = mSupportReactionsStandardItemModel->horizontalHeaderItem(2);
-    item->setText(tr("V (%1)").arg(string));
-    item->setTextAlignment(Qt::AlignCenter);
-
     item = mInfluenceLoadResultsStandardItemModel->horizontalHeaderItem(0);
     item->setText(tr("Pmin (%1)").arg(string));
     item->setTextAlignment(Qt::AlignCenter);
@@ -2861,6 +3583,18 @@ void Solver::showNotes()
     mNotesDialog->activateWindow();
 }
 
+void Solver::showSolverDiagnostics()
+{
+    if (mSolverDiagnosticsDialog->position() != QPoint(0, 0))
+    {
+        mSolverDiagnosticsDialog->move(mSolverDiagnosticsDialog->position());
+    }
+
+    mSolverDiagnosticsDialog->show();
+    mSolverDiagnosticsDialog->raise();
+    mSolverDiagnosticsDialog->activateWindow();
+}
+
 void Solver::showModelAreaDialog()
 {
     if (mModelAreaDialog->position() != QPoint(0, 0))
@@ -2873,6 +3607,30 @@ void Solver::showModelAreaDialog()
     mModelAreaDialog->activateWindow();
 }
 
+void Solver::showGenerateTrussDialog()
+{
+    if (mGenerateTrussDialog->position() != QPoint(0, 0))
+    {
+        mGenerateTrussDialog->move(mGenerateTrussDialog->position());
+    }
+
+    mGenerateTrussDialog->show();
+    mGenerateTrussDialog->raise();
+    mGenerateTrussDialog->activateWindow();
+}
+
+void Solver::showScriptConsole()
+{
+    if (mScriptConsoleDialog->position() != QPoint(0, 0))
+    {
+        mScriptConsoleDialog->move(mScriptConsoleDialog->position());
+    }
+
+    mScriptConsoleDialog->show();
+    mScriptConsoleDialog->raise();
+    mScriptConsoleDialog->activateWindow();
+}
+
 void Solver::showExportModelImageDialog()
 {
     if (mExportModelImageDialog->position() != QPoint(0, 0))
@@ -2885,312 +3643,621 @@ void Solver::showExportModelImageDialog()
     mExportModelImageDialog->activateWindow();
 }
 
-void Solver::showAddJointsDialog()
-{
-    if (mAddJointsDialog->position() != QPoint(0, 0))
+void Solver::showAddJointsDialog()
+{
+    if (mAddJointsDialog->position() != QPoint(0, 0))
+    {
+        mAddJointsDialog->move(mAddJointsDialog->position());
+    }
+
+    mAddJointsDialog->show();
+    mAddJointsDialog->raise();
+    mAddJointsDialog->activateWindow();
+}
+
+void Solver::showEditJointsDialog()
+{
+    if (mEditJointsDialog->position() != QPoint(0, 0))
+    {
+        mEditJointsDialog->move(mEditJointsDialog->position());
+    }
+
+    mEditJointsDialog->show();
+    mEditJointsDialog->raise();
+    mEditJointsDialog->activateWindow();
+}
+
+void Solver::showDeleteJointsDialog()
+{
+    if (mDeleteJointsDialog->position() != QPoint(0, 0))
+    {
+        mDeleteJointsDialog->move(mDeleteJointsDialog->position());
+    }
+
+    mDeleteJointsDialog->show();
+    mDeleteJointsDialog->raise();
+    mDeleteJointsDialog->activateWindow();
+}
+
+void Solver::setCoordinatesLabelText(QString &position)
+{
+    mCoordinatesLabel->setText(position);
+}
+
+void Solver::setJointsSelectionMode(bool checked)
+{
+    if (checked)
+    {
+        mJointsTableView->clearSelection();
+        mJointsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
+    }
+    else
+    {
+        mJointsTableView->clearSelection();
+        mJointsTableView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    }
+}
+
+void Solver::normalizeJointCoordinates()
+{
+    if (mEditTransactionDepth > 0)
+    {
+        mIsNormalizationPending = true;
+        return;
+    }
+
+    if (mJointsList.isEmpty())
+    {
+        return;
+    }
+
+    invalidateSpatialIndex();
+
+    int jointsCount = mJointsList.size();
+
+    qreal xMin = mJointsList.first()->xCoordinate();
+    qreal yMin = mJointsList.first()->yCoordinate();
+
+    foreach (Joint *joint, mJointsList)
+    {
+        xMin = qMin(xMin, joint->xCoordinate());
+        yMin = qMin(yMin, joint->yCoordinate());
+    }
+
+    //Sort the shifted coordinates together with the positions of the joints they came from, so that bars and
+    //supports follow the coordinates of their joints without searching the joints for them
+
+    QHash<Joint *, int> jointIndices;
+    QVector<QPair<Point, int> > pointsList;
+
+    jointIndices.reserve(jointsCount);
+    pointsList.reserve(jointsCount);
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        Joint *joint = mJointsList.at(i);
+
+        qreal xCoordinate = joint->xCoordinate() - xMin;
+        qreal yCoordinate = joint->yCoordinate() - yMin;
+
+        jointIndices.insert(joint, i);
+        pointsList.append(qMakePair(Point(xCoordinate, yCoordinate), i));
+    }
+
+    std::stable_sort(pointsList.begin(), pointsList.end());
+
+    QVector<int> sortedPositions(jointsCount);
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        sortedPositions[pointsList.at(i).second] = i;
+    }
+
+    int barsCount = mBarsList.size();
+    QVector<int> barFirstJoints(barsCount);
+    QVector<int> barSecondJoints(barsCount);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        Bar *bar           = mBarsList.at(i);
+        Joint *firstJoint  = bar->firstJoint();
+        Joint *secondJoint = bar->secondJoint();
+
+        barFirstJoints[i]  = sortedPositions.at(jointIndices.value(firstJoint));
+        barSecondJoints[i] = sortedPositions.at(jointIndices.value(secondJoint));
+
+        firstJoint->connectedJoints()->removeOne(secondJoint);
+        secondJoint->connectedJoints()->removeOne(firstJoint);
+
+        firstJoint->attachedBars()->removeOne(bar);
+        secondJoint->attachedBars()->removeOne(bar);
+    }
+
+    int supportsCount = mSupportsList.size();
+    QVector<int> supportJoints(supportsCount);
+
+    for (int i = 0; i < supportsCount; ++i)
+    {
+        supportJoints[i] = sortedPositions.at(jointIndices.value(mSupportsList.at(i)->supportJoint()));
+    }
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        Joint *joint      = mJointsList.at(i);
+        const Point point = pointsList.at(i).first;
+
+        joint->setXCoordinate(point.xCoordinate());
+        joint->setYCoordinate(point.yCoordinate());
+    }
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        Bar *bar           = mBarsList.at(i);
+        Joint *firstJoint  = mJointsList.at(barFirstJoints.at(i));
+        Joint *secondJoint = mJointsList.at(barSecondJoints.at(i));
+
+        bar->setFirstJoint(firstJoint);
+        bar->setSecondJoint(secondJoint);
+
+        firstJoint->connectedJoints()->append(secondJoint);
+        secondJoint->connectedJoints()->append(firstJoint);
+
+        firstJoint->attachedBars()->append(bar);
+        secondJoint->attachedBars()->append(bar);
+    }
+
+    if (!mSupportsList.isEmpty())
+    {
+        foreach (Joint *joint, mJointsList)
+        {
+            if (joint->isSupported())
+            {
+                joint->setSupported(false);
+            }
+        }
+
+        for (int i = 0; i < supportsCount; ++i)
+        {
+            Support *support    = mSupportsList.at(i);
+            Joint *supportJoint = mJointsList.at(supportJoints.at(i));
+
+            supportJoint->setSupported(true);
+            support->setSupportJoint(supportJoint);
+        }
+    }
+
+    mJointsTableModel->updateAllRows();
+
+    emit jointsRenumberedSignal(sortedPositions);
+    mBarsTableModel->updateAllRows();
+    mSupportsTableModel->updateAllRows();
+}
+
+bool Solver::hasLoads()
+{
+    bool checkA = !mJointLoadsList.isEmpty();
+    bool checkB = !mSupportSettlementsList.isEmpty();
+    bool checkC = !mThermalEffectsList.isEmpty();
+    bool checkD = !mFabricationErrorsList.isEmpty();
+    bool checkE = !mInfluenceLoadsList.isEmpty();
+
+    if (checkA || checkB || checkC || checkD || checkE)
+    {
+        QApplication::beep();
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void Solver::invalidateSpatialIndex()
+{
+    //Edits that move or remove joints drop the running joints extent of appendJoint as well
+    mIsSpatialIndexValid = false;
+    mIsJointsExtentValid = false;
+}
+
+void Solver::updateSpatialIndex()
+{
+    if (mIsSpatialIndexValid)
+    {
+        return;
+    }
+
+    //Cells about a bar long keep the joints and bars found around a position few
+
+    qreal cellSize = mUnitsAndLimits.minBarLength();
+
+    if (!mBarsList.isEmpty())
+    {
+        qreal totalLength = 0.0;
+
+        foreach (Bar *bar, mBarsList)
+        {
+            qreal xComponent = bar->secondJoint()->xCoordinate() - bar->firstJoint()->xCoordinate();
+            qreal yComponent = bar->secondJoint()->yCoordinate() - bar->firstJoint()->yCoordinate();
+
+            totalLength += std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0));
+        }
+
+        cellSize = qMax(cellSize, totalLength / mBarsList.size());
+    }
+    else if (mJointsList.size() > 1)
     {
-        mAddJointsDialog->move(mAddJointsDialog->position());
+        qreal xMin = mJointsList.first()->xCoordinate();
+        qreal xMax = xMin;
+        qreal yMin = mJointsList.first()->yCoordinate();
+        qreal yMax = yMin;
+
+        foreach (Joint *joint, mJointsList)
+        {
+            xMin = qMin(xMin, joint->xCoordinate());
+            xMax = qMax(xMax, joint->xCoordinate());
+            yMin = qMin(yMin, joint->yCoordinate());
+            yMax = qMax(yMax, joint->yCoordinate());
+        }
+
+        qreal spacing = qMax(xMax - xMin, yMax - yMin) / std::sqrt(qreal(mJointsList.size()));
+        cellSize      = qMax(cellSize, spacing);
     }
 
-    mAddJointsDialog->show();
-    mAddJointsDialog->raise();
-    mAddJointsDialog->activateWindow();
-}
+    mSpatialIndex.clear(cellSize);
 
-void Solver::showEditJointsDialog()
-{
-    if (mEditJointsDialog->position() != QPoint(0, 0))
+    QHash<Joint *, int> jointIndices;
+    jointIndices.reserve(mJointsList.size());
+
+    for (int i = 0; i < mJointsList.size(); ++i)
     {
-        mEditJointsDialog->move(mEditJointsDialog->position());
+        Joint *joint = mJointsList.at(i);
+        jointIndices.insert(joint, i);
+        mSpatialIndex.insertPoint(i, joint->xCoordinate(), joint->yCoordinate());
     }
 
-    mEditJointsDialog->show();
-    mEditJointsDialog->raise();
-    mEditJointsDialog->activateWindow();
-}
-
-void Solver::showDeleteJointsDialog()
-{
-    if (mDeleteJointsDialog->position() != QPoint(0, 0))
+    for (int i = 0; i < mBarsList.size(); ++i)
     {
-        mDeleteJointsDialog->move(mDeleteJointsDialog->position());
+        Joint *firstJoint  = mBarsList.at(i)->firstJoint();
+        Joint *secondJoint = mBarsList.at(i)->secondJoint();
+
+        mSpatialIndex.insertSegment(i,
+                                    firstJoint->xCoordinate(),
+                                    firstJoint->yCoordinate(),
+                                    secondJoint->xCoordinate(),
+                                    secondJoint->yCoordinate());
     }
 
-    mDeleteJointsDialog->show();
-    mDeleteJointsDialog->raise();
-    mDeleteJointsDialog->activateWindow();
+    mIsSpatialIndexValid = true;
 }
 
-void Solver::setCoordinatesLabelText(QString &position)
+void Solver::indexJoint(int jointIndex)
 {
-    mCoordinatesLabel->setText(position);
-}
+    //A joint added after the index went out of date is picked up by the rebuild
 
-void Solver::setJointsSelectionMode(bool checked)
-{
-    if (checked)
+    if (mIsSpatialIndexValid)
     {
-        mJointsTableView->clearSelection();
-        mJointsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
-    }
-    else
-    {
-        mJointsTableView->clearSelection();
-        mJointsTableView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+        Joint *joint = mJointsList.at(jointIndex);
+        mSpatialIndex.insertPoint(jointIndex, joint->xCoordinate(), joint->yCoordinate());
     }
 }
 
-void Solver::normalizeJointCoordinates()
+void Solver::indexBar(int barIndex)
 {
-    if (mJointsList.isEmpty())
+    if (mIsSpatialIndexValid)
     {
-        return;
-    }
+        Joint *firstJoint  = mBarsList.at(barIndex)->firstJoint();
+        Joint *secondJoint = mBarsList.at(barIndex)->secondJoint();
 
-    qreal xMin = 0.0;
-    qreal yMin = 0.0;
+        mSpatialIndex.insertSegment(barIndex,
+                                    firstJoint->xCoordinate(),
+                                    firstJoint->yCoordinate(),
+                                    secondJoint->xCoordinate(),
+                                    secondJoint->yCoordinate());
+    }
+}
 
-    QList<qreal> xCoordinatesList;
-    QList<qreal> yCoordinatesList;
+bool Solver::hasJointNear(qreal x, qreal y, const QVector<bool> &skippedJoints)
+{
+    //Check for minimum separation between a position and the joints of the model
 
-    foreach (Joint *joint, mJointsList)
-    {
-        xCoordinatesList.append(joint->xCoordinate());
-        yCoordinatesList.append(joint->yCoordinate());
-    }
+    updateSpatialIndex();
 
-    xMin = *std::min_element(xCoordinatesList.begin(), xCoordinatesList.end());
-    yMin = *std::min_element(yCoordinatesList.begin(), yCoordinatesList.end());
+    qreal minBarLength      = mUnitsAndLimits.minBarLength();
+    QVector<int> candidates = mSpatialIndex.pointsNear(x, y, minBarLength);
 
-    foreach (Joint *joint, mJointsList)
+    foreach (int index, candidates)
     {
-        qreal xCoordinate = joint->xCoordinate();
-        qreal yCoordinate = joint->yCoordinate();
+        if (!skippedJoints.isEmpty() && skippedJoints.at(index))
+        {
+            continue;
+        }
 
-        xCoordinate -= xMin;
-        yCoordinate -= yMin;
+        qreal xSeparation = x - mJointsList.at(index)->xCoordinate();
+        qreal ySeparation = y - mJointsList.at(index)->yCoordinate();
+        qreal separation  = std::sqrt(std::pow(xSeparation, 2.0) + std::pow(ySeparation, 2.0));
 
-        joint->setXCoordinate(xCoordinate);
-        joint->setYCoordinate(yCoordinate);
+        if (separation < minBarLength)
+        {
+            return true;
+        }
     }
 
-    QList<qreal> firstXCoordinatesList;
-    QList<qreal> firstYCoordinatesList;
-    QList<qreal> secondXCoordinatesList;
-    QList<qreal> secondYCoordinatesList;
+    return false;
+}
 
-    if (!mBarsList.isEmpty())
+bool Solver::hasBarThrough(qreal x, qreal y, const QVector<bool> &skippedBars)
+{
+    //Check for coincidence of a position with the length of a bar of the model
+
+    updateSpatialIndex();
+
+    qreal margin            = SpatialIndex::kCellMargin * mSpatialIndex.cellSize();
+    QVector<int> candidates = mSpatialIndex.segmentsNear(x, y, margin);
+
+    foreach (int index, candidates)
     {
-        foreach (Bar *bar, mBarsList)
+        if (!skippedBars.isEmpty() && skippedBars.at(index))
         {
-            Joint *firstJoint  = bar->firstJoint();
-            Joint *secondJoint = bar->secondJoint();
-
-            firstXCoordinatesList.append(firstJoint->xCoordinate());
-            firstYCoordinatesList.append(firstJoint->yCoordinate());
-            secondXCoordinatesList.append(secondJoint->xCoordinate());
-            secondYCoordinatesList.append(secondJoint->yCoordinate());
+            continue;
+        }
 
-            firstJoint->connectedJoints()->removeOne(secondJoint);
-            secondJoint->connectedJoints()->removeOne(firstJoint);
+        Bar *bar = mBarsList.at(index);
 
-            firstJoint->attachedBars()->removeOne(bar);
-            secondJoint->attachedBars()->removeOne(bar);
+        if (isPointOnBar(x,
+                         y,
+                         bar->firstJoint()->xCoordinate(),
+                         bar->firstJoint()->yCoordinate(),
+                         bar->secondJoint()->xCoordinate(),
+                         bar->secondJoint()->yCoordinate()))
+        {
+            return true;
         }
     }
 
-    QList<qreal> supportJointXCoordinatesList;
-    QList<qreal> supportJointYCoordinatesList;
+    return false;
+}
 
-    if (!mSupportsList.isEmpty())
+bool Solver::hasJointOnBar(qreal x1,
+                           qreal y1,
+                           qreal x2,
+                           qreal y2)
+{
+    //Check for a joint of the model within the length of a new bar
+
+    updateSpatialIndex();
+
+    qreal margin            = SpatialIndex::kCellMargin * mSpatialIndex.cellSize();
+    QVector<int> candidates = mSpatialIndex.pointsNear(x1, y1, x2, y2, margin);
+
+    foreach (int index, candidates)
     {
-        foreach (Support *support, mSupportsList)
+        Joint *joint = mJointsList.at(index);
+
+        if (isPointOnBar(joint->xCoordinate(), joint->yCoordinate(), x1, y1, x2, y2))
         {
-            supportJointXCoordinatesList.append(support->supportJoint()->xCoordinate());
-            supportJointYCoordinatesList.append(support->supportJoint()->yCoordinate());
+            return true;
         }
     }
 
-    QList<Point> pointsList;
-
-    foreach (Joint *joint, mJointsList)
-    {
-        qreal xCoordinate = joint->xCoordinate();
-        qreal yCoordinate = joint->yCoordinate();
+    return false;
+}
 
-        Point point(xCoordinate, yCoordinate);
+bool Solver::hasOverlappingBar(qreal               x1,
+                               qreal               y1,
+                               qreal               x2,
+                               qreal               y2,
+                               const QVector<bool> &skippedBars)
+{
+    //Check for a bar of the model whose length overlaps that of a new bar
 
-        pointsList.append(point);
-    }
+    updateSpatialIndex();
 
-    std::stable_sort(pointsList.begin(), pointsList.end());
+    qreal margin            = SpatialIndex::kCellMargin * mSpatialIndex.cellSize();
+    QVector<int> candidates = mSpatialIndex.segmentsNear(x1, y1, x2, y2, margin);
 
-    foreach (Joint *joint, mJointsList)
+    foreach (int index, candidates)
     {
-        int index   = mJointsList.indexOf(joint);
-        Point point = pointsList.at(index);
+        if (!skippedBars.isEmpty() && skippedBars.at(index))
+        {
+            continue;
+        }
 
-        qreal xCoordinate = point.xCoordinate();
-        qreal yCoordinate = point.yCoordinate();
+        Bar *bar = mBarsList.at(index);
 
-        joint->setXCoordinate(xCoordinate);
-        joint->setYCoordinate(yCoordinate);
+        if (isBarOverlap(x1,
+                         y1,
+                         x2,
+                         y2,
+                         bar->firstJoint()->xCoordinate(),
+                         bar->firstJoint()->yCoordinate(),
+                         bar->secondJoint()->xCoordinate(),
+                         bar->secondJoint()->yCoordinate()))
+        {
+            return true;
+        }
     }
 
+    return false;
+}
+
+int Solver::jointAt(qreal x, qreal y)
+{
+    //Index of the joint at a position, -1 if there is none
+
+    updateSpatialIndex();
+
     qreal epsilonMagnitudeSmall = 1.0e-12;
+    qreal margin                = SpatialIndex::kCellMargin * mSpatialIndex.cellSize();
+    QVector<int> candidates     = mSpatialIndex.pointsNear(x, y, margin);
+    int jointIndex              = -1;
 
-    if (!mBarsList.isEmpty())
+    foreach (int index, candidates)
     {
-        foreach (Bar *bar, mBarsList)
+        bool checkA = std::fabs(mJointsList.at(index)->xCoordinate() - x) < epsilonMagnitudeSmall;
+        bool checkB = std::fabs(mJointsList.at(index)->yCoordinate() - y) < epsilonMagnitudeSmall;
+
+        if (checkA && checkB && (jointIndex < 0 || index < jointIndex))
         {
-            Joint *firstJoint  = 0;
-            Joint *secondJoint = 0;
+            jointIndex = index;
+        }
+    }
 
-            int index = mBarsList.indexOf(bar);
+    return jointIndex;
+}
 
-            qreal firstXCoordinate = firstXCoordinatesList.at(index);
-            qreal firstYCoordinate = firstYCoordinatesList.at(index);
+bool Solver::isPointOnBar(qreal x,
+                          qreal y,
+                          qreal x1,
+                          qreal y1,
+                          qreal x2,
+                          qreal y2)
+{
+    qreal epsilonMagnitudeSmall = 1.0e-12;
 
-            foreach (Joint *joint, mJointsList)
-            {
-                qreal xDifference = std::fabs(firstXCoordinate - joint->xCoordinate());
-                qreal yDifference = std::fabs(firstYCoordinate - joint->yCoordinate());
+    qreal firstXComponent  = x2 - x1;
+    qreal firstYComponent  = y2 - y1;
+    qreal secondXComponent = x - x1;
+    qreal secondYComponent = y - y1;
 
-                bool checkA = xDifference < epsilonMagnitudeSmall;
-                bool checkB = yDifference < epsilonMagnitudeSmall;
+    qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
+                                            - firstYComponent * secondXComponent);
 
-                if (checkA && checkB)
-                {
-                    firstJoint = joint;
-                    break;
-                }
-            }
+    if (magnitudeCrossProduct < epsilonMagnitudeSmall)
+    {
+        qreal quotient = 0.0;
 
-            qreal secondXCoordinate = secondXCoordinatesList.at(index);
-            qreal secondYCoordinate = secondYCoordinatesList.at(index);
+        if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
+        {
+            quotient = secondYComponent / firstYComponent;
+        }
+        else
+        {
+            quotient = secondXComponent / firstXComponent;
+        }
 
-            foreach (Joint *joint, mJointsList)
-            {
-                qreal xDifference = std::fabs(secondXCoordinate - joint->xCoordinate());
-                qreal yDifference = std::fabs(secondYCoordinate - joint->yCoordinate());
+        if ((quotient > 0.0) && (quotient < 1.0))
+        {
+            return true;
+        }
+    }
 
-                bool checkA = xDifference < epsilonMagnitudeSmall;
-                bool checkB = yDifference < epsilonMagnitudeSmall;
+    return false;
+}
 
-                if (checkA && checkB)
-                {
-                    secondJoint = joint;
-                    break;
-                }
-            }
+bool Solver::isBarOverlap(qreal firstX1,
+                          qreal firstY1,
+                          qreal firstX2,
+                          qreal firstY2,
+                          qreal secondX1,
+                          qreal secondY1,
+                          qreal secondX2,
+                          qreal secondY2)
+{
+    // -----------------------------------------------------------------------------------------------------------------
+    // Determine x and y components of first and second bars
+    // -----------------------------------------------------------------------------------------------------------------
 
-            bar->setFirstJoint(firstJoint);
-            bar->setSecondJoint(secondJoint);
+    qreal firstXComponent = firstX2 - firstX1;
+    qreal firstYComponent = firstY2 - firstY1;
 
-            firstJoint->connectedJoints()->append(secondJoint);
-            secondJoint->connectedJoints()->append(firstJoint);
+    qreal secondXComponent = secondX2 - secondX1;
+    qreal secondYComponent = secondY2 - secondY1;
 
-            firstJoint->attachedBars()->append(bar);
-            secondJoint->attachedBars()->append(bar);
+    qreal epsilonMagnitudeSmall = 1.0e-12;
+    qreal epsilonMagnitudeLarge = 1.0e+12;
 
-            int firstJointNumber  = mJointsList.indexOf(firstJoint) + 1;
-            int secondJointNumber = mJointsList.indexOf(secondJoint) + 1;
+    qreal firstSlope;
+    qreal firstIntercept;
 
-            QStandardItem *standardItem;
+    qreal secondSlope;
+    qreal secondIntercept;
 
-            standardItem = new QStandardItem(QString::number(firstJointNumber));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(index, 0, standardItem);
+    // -----------------------------------------------------------------------------------------------------------------
+    // Determine slope and intercept of first and second bar
+    // -----------------------------------------------------------------------------------------------------------------
 
-            standardItem = new QStandardItem(QString::number(secondJointNumber));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(index, 1, standardItem);
-        }
+    if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
+    {
+        firstSlope     = epsilonMagnitudeLarge;
+        firstIntercept = firstX1;
+    }
+    else
+    {
+        firstSlope     = firstYComponent / firstXComponent;
+        qreal top      = (firstY2 * firstX1 - firstY1 * firstX2);
+        firstIntercept =  top / (-firstXComponent);
     }
 
-    if (!mSupportsList.isEmpty())
+    if (std::fabs(secondXComponent) < epsilonMagnitudeSmall)
     {
-        foreach (Joint *joint, mJointsList)
-        {
-            if (joint->isSupported())
-            {
-                joint->setSupported(false);
-            }
-        }
+        secondSlope     = epsilonMagnitudeLarge;
+        secondIntercept = secondX1;
+    }
+    else
+    {
+        secondSlope     = secondYComponent / secondXComponent;
+        qreal top       = (secondY2 * secondX1 - secondY1 * secondX2);
+        secondIntercept =   top / (-secondXComponent);
+    }
 
-        foreach (Support *support, mSupportsList)
-        {
-            Joint *supportJoint;
-            int index                     = mSupportsList.indexOf(support);
-            qreal supportJointXCoordinate = supportJointXCoordinatesList.at(index);
-            qreal supportJointYCoordinate = supportJointYCoordinatesList.at(index);
+    // -----------------------------------------------------------------------------------------------------------------
+    // Determine differences of slope and intercept between first and second bar
+    // -----------------------------------------------------------------------------------------------------------------
 
-            foreach (Joint *joint, mJointsList)
-            {
-                qreal xDifference = std::fabs(supportJointXCoordinate - joint->xCoordinate());
-                qreal yDifference = std::fabs(supportJointYCoordinate - joint->yCoordinate());
+    qreal magnitudeSlopeDifference     = std::fabs(firstSlope - secondSlope);
+    qreal magnitudeInterceptDifference = std::fabs(firstIntercept - secondIntercept);
 
-                bool checkA = xDifference < epsilonMagnitudeSmall;
-                bool checkB = yDifference < epsilonMagnitudeSmall;
+    bool checkA = ((magnitudeSlopeDifference < epsilonMagnitudeSmall)
+                       && (magnitudeInterceptDifference < epsilonMagnitudeSmall));
 
-                if (checkA && checkB)
-                {
-                    supportJoint = joint;
-                    break;
-                }
-            }
+    // -----------------------------------------------------------------------------------------------------------------
+    // Check for possibility of coincidence between first and second bar
+    // -----------------------------------------------------------------------------------------------------------------
 
-            supportJoint->setSupported(true);
-            support->setSupportJoint(supportJoint);
-            int supportJointNumber = mJointsList.indexOf(supportJoint) + 1;
+    if (checkA)
+    {
+        std::vector<qreal> xCoordinates;
+        std::vector<qreal> yCoordinates;
+        std::vector<qreal>::iterator position;
 
-            QStandardItem *standardItem;
-            standardItem = new QStandardItem(QString::number(supportJointNumber));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mSupportsStandardItemModel->setItem(index, 0, standardItem);
-        }
-    }
+        xCoordinates.push_back(firstX1);
+        xCoordinates.push_back(firstX2);
+        xCoordinates.push_back(secondX1);
+        xCoordinates.push_back(secondX2);
+        yCoordinates.push_back(firstY1);
+        yCoordinates.push_back(firstY2);
+        yCoordinates.push_back(secondY1);
+        yCoordinates.push_back(secondY2);
 
-    foreach (Joint *joint, mJointsList)
-    {
-        int jointIndex = mJointsList.indexOf(joint);
+        position   = std::min_element(xCoordinates.begin(), xCoordinates.end());
+        qreal minX = *position;
 
-        QStandardItem *standardItem;
+        position   = std::max_element(xCoordinates.begin(), xCoordinates.end());
+        qreal maxX = *position;
 
-        QString string = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-        standardItem   = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mJointsStandardItemModel->setItem(jointIndex, 0, standardItem);
+        position   = std::min_element(yCoordinates.begin(), yCoordinates.end());
+        qreal minY = *position;
 
-        string       = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-        standardItem = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mJointsStandardItemModel->setItem(jointIndex, 1, standardItem);
-    }
-}
+        position   = std::max_element(yCoordinates.begin(), yCoordinates.end());
+        qreal maxY = *position;
 
-bool Solver::hasLoads()
-{
-    bool checkA = !mJointLoadsList.isEmpty();
-    bool checkB = !mSupportSettlementsList.isEmpty();
-    bool checkC = !mThermalEffectsList.isEmpty();
-    bool checkD = !mFabricationErrorsList.isEmpty();
-    bool checkE = !mInfluenceLoadsList.isEmpty();
+        qreal xComponent = maxX - minX;
+        qreal yComponent = maxY - minY;
 
-    if (checkA || checkB || checkC || checkD || checkE)
-    {
-        QApplication::beep();
-        return true;
-    }
-    else
-    {
-        return false;
+        qreal length       = std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0));
+        qreal firstLength  = std::sqrt(std::pow(firstXComponent, 2.0)
+                                       + std::pow(firstYComponent, 2.0));
+        qreal secondLength = std::sqrt(std::pow(secondXComponent, 2.0)
+                                       + std::pow(secondYComponent, 2.0));
+
+        // -------------------------------------------------------------------------------------------------------------
+        // Confirm coincidence between first and second bar
+        // -------------------------------------------------------------------------------------------------------------
+
+        return ((firstLength + secondLength) - length) > epsilonMagnitudeSmall;
     }
+
+    return false;
 }
 
 void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
@@ -3200,36 +4267,19 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
         return;
     }
 
+    EditTransaction transaction(this);
+
     if (mJointsList.isEmpty())
     {
         Joint *joint = new Joint(0.0, 0.0, this);
         emit enableJointsInput();
         mJointsList.append(joint);
+        indexJoint(mJointsList.size() - 1);
 
-        QList<QStandardItem *> standardItemsList;
-        QStandardItem *standardItem = 0;
-
-        QString string = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-        standardItem   = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        string       = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-        standardItem = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        mJointsStandardItemModel->appendRow(standardItemsList);
-        mAddJointsDialog->updateJoints();
-        mAddBarsDialog->updateFirstJointOptions();
-        mEditBarsDialog->updateFirstJointOptions();
-        mAddSupportsDialog->updateJoints();
-        mAddJointLoadsDialog->updateJoints();
-        mEditJointLoadsDialog->updateJoints();
+        mJointsTableModel->appendRows();
+        updateJointOptions();
         mUnitsAction->setEnabled(false);
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
         updateModelViewer();
     }
@@ -3330,73 +4380,11 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                     }
                     else
                     {
-                        checksList.append(0);
-                        continue;
-                    }
-
-                    bool skip = false;
-
-                    int jointsCount = mJointsList.size();
-
-                    for (int i = 0; i < jointsCount; ++i)
-                    {
-                        qreal xSeparation = xCoordinate - mJointsList.at(i)->xCoordinate();
-                        qreal ySeparation = yCoordinate - mJointsList.at(i)->yCoordinate();
-
-                        qreal separation = std::sqrt(std::pow(xSeparation, 2.0) + std::pow(ySeparation, 2.0));
-
-                        if (separation < mUnitsAndLimits.minBarLength())
-                        {
-                            skip = true;
-                            break;
-                        }
-                    }
-
-                    if (skip)
-                    {
-                        continue;
-                    }
-
-                    skip                        = false;
-                    qreal epsilonMagnitudeSmall = 1.0e-12;
-
-                    foreach (Bar *bar, mBarsList)
-                    {
-                        qreal x1 = bar->firstJoint()->xCoordinate();
-                        qreal y1 = bar->firstJoint()->yCoordinate();
-                        qreal x2 = bar->secondJoint()->xCoordinate();
-                        qreal y2 = bar->secondJoint()->yCoordinate();
-
-                        qreal firstXComponent  = x2 - x1;
-                        qreal firstYComponent  = y2 - y1;
-                        qreal secondXComponent = xCoordinate - x1;
-                        qreal secondYComponent = yCoordinate - y1;
-
-                        qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                                - firstYComponent * secondXComponent);
-
-                        if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-                        {
-                            qreal quotient = 0.0;
-
-                            if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-                            {
-                                quotient = secondYComponent / firstYComponent;
-                            }
-                            else
-                            {
-                                quotient = secondXComponent / firstXComponent;
-                            }
-
-                            if ((quotient > 0.0) && (quotient < 1.0))
-                            {
-                                skip = true;
-                                break;
-                            }
-                        }
+                        checksList.append(0);
+                        continue;
                     }
 
-                    if (skip)
+                    if (hasJointNear(xCoordinate, yCoordinate) || hasBarThrough(xCoordinate, yCoordinate))
                     {
                         continue;
                     }
@@ -3404,25 +4392,11 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                     Joint *joint = new Joint(xCoordinate, yCoordinate, this);
                     ++counter;
                     mJointsList.append(joint);
-
-                    QList<QStandardItem *> standardItemsList;
-                    QStandardItem *standardItem = 0;
-
-                    QString string = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-                    standardItem   = new QStandardItem(string);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-
-                    string       = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-                    standardItem = new QStandardItem(string);
-                    standardItem->setTextAlignment(Qt::AlignCenter);
-                    standardItem->setEditable(false);
-                    standardItemsList.append(standardItem);
-
-                    mJointsStandardItemModel->appendRow(standardItemsList);
+                    indexJoint(mJointsList.size() - 1);
                 }
 
+                mJointsTableModel->appendRows();
+
                 if (!checksList.contains(1))
                 {
                     if (counter)
@@ -3430,13 +4404,8 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                         mJointsTableView->clearSelection();
                         normalizeJointCoordinates();
                         mJointsTableView->scrollToBottom();
-                        mAddJointsDialog->updateJoints();
-                        mAddBarsDialog->updateFirstJointOptions();
-                        mEditBarsDialog->updateFirstJointOptions();
-                        mAddSupportsDialog->updateJoints();
-                        mAddJointLoadsDialog->updateJoints();
-                        mEditJointLoadsDialog->updateJoints();
-                        mModelCheckRequired = true;
+                        updateJointOptions();
+                        invalidateModelCheck();
                         setWindowModified(true);
                         updateModelViewer();
                     }
@@ -3450,13 +4419,8 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                 mJointsTableView->clearSelection();
                 normalizeJointCoordinates();
                 mJointsTableView->scrollToBottom();
-                mAddJointsDialog->updateJoints();
-                mAddBarsDialog->updateFirstJointOptions();
-                mEditBarsDialog->updateFirstJointOptions();
-                mAddSupportsDialog->updateJoints();
-                mAddJointLoadsDialog->updateJoints();
-                mEditJointLoadsDialog->updateJoints();
-                mModelCheckRequired = true;
+                updateJointOptions();
+                invalidateModelCheck();
                 setWindowModified(true);
                 updateModelViewer();
             }
@@ -3538,68 +4502,7 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                     break;
                 }
 
-                bool skip = false;
-
-                int jointsCount = mJointsList.size();
-
-                for (int i = 0; i < jointsCount; ++i)
-                {
-                    qreal xSeparation = xCoordinate - mJointsList.at(i)->xCoordinate();
-                    qreal ySeparation = yCoordinate - mJointsList.at(i)->yCoordinate();
-                    qreal separation  = std::sqrt(std::pow(xSeparation, 2.0) + std::pow(ySeparation, 2.0));
-
-                    if (separation < mUnitsAndLimits.minBarLength())
-                    {
-                        skip = true;
-                        break;
-                    }
-                }
-
-                if (skip)
-                {
-                    continue;
-                }
-
-                skip = false;
-                qreal epsilonMagnitudeSmall = 1.0e-12;
-
-                foreach (Bar *bar, mBarsList)
-                {
-                    qreal x1 = bar->firstJoint()->xCoordinate();
-                    qreal y1 = bar->firstJoint()->yCoordinate();
-                    qreal x2 = bar->secondJoint()->xCoordinate();
-                    qreal y2 = bar->secondJoint()->yCoordinate();
-
-                    qreal firstXComponent  = x2 - x1;
-                    qreal firstYComponent  = y2 - y1;
-                    qreal secondXComponent = xCoordinate - x1;
-                    qreal secondYComponent = yCoordinate - y1;
-
-                    qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                            - firstYComponent * secondXComponent);
-
-                    if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-                    {
-                        qreal quotient = 0.0;
-
-                        if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-                        {
-                            quotient = secondYComponent / firstYComponent;
-                        }
-                        else
-                        {
-                            quotient = secondXComponent / firstXComponent;
-                        }
-
-                        if ((quotient > 0.0) && (quotient < 1.0))
-                        {
-                            skip = true;
-                            break;
-                        }
-                    }
-                }
-
-                if (skip)
+                if (hasJointNear(xCoordinate, yCoordinate) || hasBarThrough(xCoordinate, yCoordinate))
                 {
                     continue;
                 }
@@ -3607,37 +4510,18 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
                 Joint *joint = new Joint(xCoordinate, yCoordinate, this);
                 ++counter;
                 mJointsList.append(joint);
-
-                QList<QStandardItem *> standardItemsList;
-                QStandardItem *standardItem = 0;
-
-                QString string = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-                standardItem   = new QStandardItem(string);
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                string       = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-                standardItem = new QStandardItem(string);
-                standardItem->setTextAlignment(Qt::AlignCenter);
-                standardItem->setEditable(false);
-                standardItemsList.append(standardItem);
-
-                mJointsStandardItemModel->appendRow(standardItemsList);
+                indexJoint(mJointsList.size() - 1);
             }
 
+            mJointsTableModel->appendRows();
+
             if (counter)
             {
                 mJointsTableView->clearSelection();
                 normalizeJointCoordinates();
                 mJointsTableView->scrollToBottom();
-                mAddJointsDialog->updateJoints();
-                mAddBarsDialog->updateFirstJointOptions();
-                mEditBarsDialog->updateFirstJointOptions();
-                mAddSupportsDialog->updateJoints();
-                mAddJointLoadsDialog->updateJoints();
-                mEditJointLoadsDialog->updateJoints();
-                mModelCheckRequired = true;
+                updateJointOptions();
+                invalidateModelCheck();
                 setWindowModified(true);
                 updateModelViewer();
             }
@@ -3647,89 +4531,22 @@ void Solver::addJoints(qreal deltaX, qreal deltaY, int count)
 
 int Solver::addJoint(qreal u, qreal v)
 {
-    //Check for minimum separation between new joint and all existing joints
-    int jointsCount = mJointsList.size();
-
-    for (int i = 0; i < jointsCount; ++i)
-    {
-        qreal jointsXSeparation = u - mJointsList.at(i)->xCoordinate();
-        qreal jointsYSeparation = v - mJointsList.at(i)->yCoordinate();
-
-        qreal length = std::sqrt(std::pow(jointsXSeparation, 2.0) + std::pow(jointsYSeparation, 2.0));
-
-        if (length < mUnitsAndLimits.minBarLength())
-        {
-            return -1;
-        }
-    }
-
-    //Check for coincidence with existing bar
-
-    qreal epsilonMagnitudeSmall = 1.0e-12;
+    //Check for minimum separation between new joint and all existing joints, and for coincidence with existing bar
 
-    foreach (Bar *bar, mBarsList)
+    if (hasJointNear(u, v) || hasBarThrough(u, v))
     {
-        qreal x1 = bar->firstJoint()->xCoordinate();
-        qreal y1 = bar->firstJoint()->yCoordinate();
-        qreal x2 = bar->secondJoint()->xCoordinate();
-        qreal y2 = bar->secondJoint()->yCoordinate();
-
-        qreal firstXComponent  = x2 - x1;
-        qreal firstYComponent  = y2 - y1;
-        qreal secondXComponent = u - x1;
-        qreal secondYComponent = v - y1;
-
-        qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                - firstYComponent * secondXComponent);
-
-        if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-        {
-            qreal quotient = 0.0;
-
-            if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-            {
-                quotient = secondYComponent / firstYComponent;
-            }
-            else
-            {
-                quotient = secondXComponent / firstXComponent;
-            }
-
-            if ((quotient > 0.0) && (quotient < 1.0))
-            {
-                return -1;
-            }
-        }
+        return -1;
     }
 
     //Create new joint
     Joint *joint = new Joint(u, v, this);
     mJointsList.append(joint);
+    indexJoint(mJointsList.size() - 1);
 
-    QList<QStandardItem *> standardItemsList;
-    QStandardItem *standardItem;
-
-    QString string(QString::number(u, 'f', mUnitsAndLimits.deltaXDecimals()));
-    standardItem = new QStandardItem(string);
-    standardItem->setTextAlignment(Qt::AlignCenter);
-    standardItem->setEditable(false);
-    standardItemsList.append(standardItem);
-
-    string       = QString::number(v, 'f', mUnitsAndLimits.deltaYDecimals());
-    standardItem = new QStandardItem(string);
-    standardItem->setTextAlignment(Qt::AlignCenter);
-    standardItem->setEditable(false);
-    standardItemsList.append(standardItem);
-
-    mJointsStandardItemModel->appendRow(standardItemsList);
+    mJointsTableModel->appendRows();
     mJointsTableView->scrollToBottom();
-    mAddJointsDialog->updateJoints();
-    mAddBarsDialog->updateFirstJointOptions();
-    mEditBarsDialog->updateFirstJointOptions();
-    mAddSupportsDialog->updateJoints();
-    mAddJointLoadsDialog->updateJoints();
-    mEditJointLoadsDialog->updateJoints();
-    return mJointsList.indexOf(joint);
+    updateJointOptions();
+    return mJointsList.size() - 1;
 }
 
 void Solver::mirrorJoints(QString axis, int axisJointNumber)
@@ -3739,6 +4556,8 @@ void Solver::mirrorJoints(QString axis, int axisJointNumber)
         return;
     }
 
+    EditTransaction transaction(this);
+
     QItemSelectionModel *itemSelectionModel = mJointsTableView->selectionModel();
     QModelIndexList modelIndexList          = itemSelectionModel->selectedRows();
     QList<int> selectedJoints;
@@ -3876,69 +4695,7 @@ void Solver::mirrorJoints(QString axis, int axisJointNumber)
             continue;
         }
 
-        bool skip = false;
-
-        int jointsCount = mJointsList.size();
-
-        for (int i = 0; i < jointsCount; ++i)
-        {
-            qreal xSeparation = xCoordinate - mJointsList.at(i)->xCoordinate();
-            qreal ySeparation = yCoordinate - mJointsList.at(i)->yCoordinate();
-
-            qreal separation = std::sqrt(std::pow(xSeparation, 2.0) + std::pow(ySeparation, 2.0));
-
-            if (separation < mUnitsAndLimits.minBarLength())
-            {
-                skip = true;
-                break;
-            }
-        }
-
-        if (skip)
-        {
-            continue;
-        }
-
-        skip = false;
-        qreal epsilonMagnitudeSmall = 1.0e-12;
-
-        foreach (Bar *bar, mBarsList)
-        {
-            qreal x1 = bar->firstJoint()->xCoordinate();
-            qreal y1 = bar->firstJoint()->yCoordinate();
-            qreal x2 = bar->secondJoint()->xCoordinate();
-            qreal y2 = bar->secondJoint()->yCoordinate();
-
-            qreal firstXComponent  = x2 - x1;
-            qreal firstYComponent  = y2 - y1;
-            qreal secondXComponent = xCoordinate - x1;
-            qreal secondYComponent = yCoordinate - y1;
-
-            qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                    - firstYComponent * secondXComponent);
-
-            if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-            {
-                qreal quotient = 0.0;
-
-                if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-                {
-                    quotient = secondYComponent / firstYComponent;
-                }
-                else
-                {
-                    quotient = secondXComponent / firstXComponent;
-                }
-
-                if ((quotient > 0.0) && (quotient < 1.0))
-                {
-                    skip = true;
-                    break;
-                }
-            }
-        }
-
-        if (skip)
+        if (hasJointNear(xCoordinate, yCoordinate) || hasBarThrough(xCoordinate, yCoordinate))
         {
             continue;
         }
@@ -3946,37 +4703,18 @@ void Solver::mirrorJoints(QString axis, int axisJointNumber)
         Joint *joint = new Joint(xCoordinate, yCoordinate, this);
         ++counter;
         mJointsList.append(joint);
-
-        QList<QStandardItem *> standardItemsList;
-        QStandardItem *standardItem = 0;
-
-        QString string = QString::number(joint->xCoordinate(), 'f', mUnitsAndLimits.deltaXDecimals());
-        standardItem   = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        string       = QString::number(joint->yCoordinate(), 'f', mUnitsAndLimits.deltaYDecimals());
-        standardItem = new QStandardItem(string);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        mJointsStandardItemModel->appendRow(standardItemsList);
+        indexJoint(mJointsList.size() - 1);
     }
 
+    mJointsTableModel->appendRows();
+
     if (counter)
     {
         mJointsTableView->clearSelection();
         normalizeJointCoordinates();
         mJointsTableView->scrollToBottom();
-        mAddJointsDialog->updateJoints();
-        mAddBarsDialog->updateFirstJointOptions();
-        mEditBarsDialog->updateFirstJointOptions();
-        mAddSupportsDialog->updateJoints();
-        mAddJointLoadsDialog->updateJoints();
-        mEditJointLoadsDialog->updateJoints();
-        mModelCheckRequired = true;
+        updateJointOptions();
+        invalidateModelCheck();
         setWindowModified(true);
         updateModelViewer();
     }
@@ -4051,7 +4789,7 @@ void Solver::editJoints(qreal deltaX, qreal deltaY)
     {
         mJointsTableView->clearSelection();
         normalizeJointCoordinates();
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
         updateModelViewer();
     }
@@ -4145,18 +4883,21 @@ int Solver::editJoints(qreal deltaX,
 
     if (selectedJoints.size() != mJointsList.size())
     {
-        QList<int> otherJoints;
+        int jointsCount = mJointsList.size();
+        int barsCount   = mBarsList.size();
 
-        int count = mJointsList.size();
+        QVector<bool> isSelectedJoint(jointsCount, false);
+        QHash<Joint *, int> jointIndices;
+        jointIndices.reserve(jointsCount);
 
-        for (int i = 0; i < count; ++i)
+        foreach (int jointNumber, selectedJoints)
         {
-            if (selectedJoints.contains(i + 1))
-            {
-                continue;
-            }
+            isSelectedJoint[jointNumber - 1] = true;
+        }
 
-            otherJoints.append(i + 1);
+        for (int i = 0; i < jointsCount; ++i)
+        {
+            jointIndices.insert(mJointsList.at(i), i);
         }
 
         foreach (int firstJointNumber, selectedJoints)
@@ -4166,22 +4907,9 @@ int Solver::editJoints(qreal deltaX,
             qreal x1 = firstJoint->xCoordinate() + deltaX;
             qreal y1 = firstJoint->yCoordinate() + deltaY;
 
-            foreach (int secondJointNumber, otherJoints)
+            if (hasJointNear(x1, y1, isSelectedJoint))
             {
-                Joint *secondJoint = mJointsList.at(secondJointNumber - 1);
-
-                qreal x2 = secondJoint->xCoordinate();
-                qreal y2 = secondJoint->yCoordinate();
-
-                qreal xSeparation = x2 - x1;
-                qreal ySeparation = y2 - y1;
-
-                qreal separationDistance = std::sqrt(std::pow(xSeparation, 2.0) + std::pow(ySeparation, 2.0));
-
-                if (separationDistance < mUnitsAndLimits.minBarLength())
-                {
-                    return -2;
-                }
+                return -2;
             }
         }
 
@@ -4198,9 +4926,7 @@ int Solver::editJoints(qreal deltaX,
 
             foreach (Joint *secondJoint, *firstJoint->connectedJoints())
             {
-                int secondJointNumber = mJointsList.indexOf(secondJoint) + 1;
-
-                if (otherJoints.contains(secondJointNumber))
+                if (!isSelectedJoint.at(jointIndices.value(secondJoint)))
                 {
                     qreal x2 = secondJoint->xCoordinate();
                     qreal y2 = secondJoint->yCoordinate();
@@ -4219,275 +4945,112 @@ int Solver::editJoints(qreal deltaX,
         }
 
         // -------------------------------------------------------------------------------------------------------------
-        // Check for joint that will coincide with existing bar
+        // Bars with an end on a joint being edited, indexed at their new positions. Bars that keep their positions
+        // are checked through the spatial index of the model and only against the bars that move.
         // -------------------------------------------------------------------------------------------------------------
 
-        qreal epsilonMagnitudeSmall = 1.0e-12;
-        qreal epsilonMagnitudeLarge = 1.0e+12;
-
-        foreach (int selectedJointNumber, selectedJoints)
-        {
-            Joint *selectedJoint = mJointsList.at(selectedJointNumber - 1);
-
-            qreal xCoordinate = selectedJoint->xCoordinate() + deltaX;
-            qreal yCoordinate = selectedJoint->yCoordinate() + deltaY;
-
-            foreach (Bar *bar, mBarsList)
-            {
-                int firstJointNumber  = mJointsList.indexOf(bar->firstJoint()) + 1;
-                int secondJointNumber = mJointsList.indexOf(bar->secondJoint()) + 1;
-
-                qreal x1;
-                qreal y1;
-                qreal x2;
-                qreal y2;
-
-                if (selectedJoints.contains(firstJointNumber))
-                {
-                    x1 = bar->firstJoint()->xCoordinate() + deltaX;
-                    y1 = bar->firstJoint()->yCoordinate() + deltaY;
-                }
-                else
-                {
-                    x1 = bar->firstJoint()->xCoordinate();
-                    y1 = bar->firstJoint()->yCoordinate();
-                }
-
-                if (selectedJoints.contains(secondJointNumber))
-                {
-                    x2 = bar->secondJoint()->xCoordinate() + deltaX;
-                    y2 = bar->secondJoint()->yCoordinate() + deltaY;
-                }
-                else
-                {
-                    x2 = bar->secondJoint()->xCoordinate();
-                    y2 = bar->secondJoint()->yCoordinate();
-                }
-
-                qreal firstXComponent  = x2 - x1;
-                qreal firstYComponent  = y2 - y1;
-                qreal secondXComponent = xCoordinate - x1;
-                qreal secondYComponent = yCoordinate - y1;
-
-                qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                        - firstYComponent * secondXComponent);
-
-                if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-                {
-                    qreal quotient = 0.0;
-
-                    if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-                    {
-                        quotient = secondYComponent / firstYComponent;
-                    }
-                    else
-                    {
-                        quotient = secondXComponent / firstXComponent;
-                    }
-
-                    if ((quotient > 0.0) && (quotient < 1.0))
-                    {
-                        return -4;
-                    }
-                }
-            }
-        }
+        updateSpatialIndex();
 
-        // -------------------------------------------------------------------------------------------------------------
-        // Check for any two bars whose lengths will overlap
-        // -------------------------------------------------------------------------------------------------------------
+        QVector<bool> isMovedBar(barsCount, false);
+        QVector<qreal> movedBarCoordinates;
+        SpatialIndex movedBarsIndex(mSpatialIndex.cellSize());
+        int movedBarsCount = 0;
 
-        foreach (Bar *firstBar, mBarsList)
+        for (int i = 0; i < barsCount; ++i)
         {
-            // ---------------------------------------------------------------------------------------------------------
-            // End coordinates of first bar
-            // ---------------------------------------------------------------------------------------------------------
-
-            qreal firstX1;
-            qreal firstY1;
-            qreal firstX2;
-            qreal firstY2;
-
-            // ---------------------------------------------------------------------------------------------------------
-            // End coordinates of second bar
-            // ---------------------------------------------------------------------------------------------------------
-
-            qreal secondX1;
-            qreal secondY1;
-            qreal secondX2;
-            qreal secondY2;
-
-            // ---------------------------------------------------------------------------------------------------------
-            // Determine end coordinates of first bar
-            // ---------------------------------------------------------------------------------------------------------
-
-            int firstJointNumber  = mJointsList.indexOf(firstBar->firstJoint()) + 1;
-            int secondJointNumber = mJointsList.indexOf(firstBar->secondJoint()) + 1;
-
-            if (selectedJoints.contains(firstJointNumber))
-            {
-                firstX1 = firstBar->firstJoint()->xCoordinate() + deltaX;
-                firstY1 = firstBar->firstJoint()->yCoordinate() + deltaY;
-            }
-            else
-            {
-                firstX1 = firstBar->firstJoint()->xCoordinate();
-                firstY1 = firstBar->firstJoint()->yCoordinate();
-            }
-
-            if (selectedJoints.contains(secondJointNumber))
-            {
-                firstX2 = firstBar->secondJoint()->xCoordinate() + deltaX;
-                firstY2 = firstBar->secondJoint()->yCoordinate() + deltaY;
-            }
-            else
-            {
-                firstX2 = firstBar->secondJoint()->xCoordinate();
-                firstY2 = firstBar->secondJoint()->yCoordinate();
-            }
-
-            foreach (Bar *secondBar, mBarsList)
-            {
-                // -----------------------------------------------------------------------------------------------------
-                // Skip first bar
-                // -----------------------------------------------------------------------------------------------------
-
-                if (secondBar != firstBar)
-                {
-                    // -------------------------------------------------------------------------------------------------
-                    // Determine end coordinates of second bar
-                    // -------------------------------------------------------------------------------------------------
-
-                    firstJointNumber  = mJointsList.indexOf(secondBar->firstJoint()) + 1;
-                    secondJointNumber = mJointsList.indexOf(secondBar->secondJoint()) + 1;
-
-                    if (selectedJoints.contains(firstJointNumber))
-                    {
-                        secondX1 = secondBar->firstJoint()->xCoordinate() + deltaX;
-                        secondY1 = secondBar->firstJoint()->yCoordinate() + deltaY;
-                    }
-                    else
-                    {
-                        secondX1 = secondBar->firstJoint()->xCoordinate();
-                        secondY1 = secondBar->firstJoint()->yCoordinate();
-                    }
-
-                    if (selectedJoints.contains(secondJointNumber))
-                    {
-                        secondX2 = secondBar->secondJoint()->xCoordinate() + deltaX;
-                        secondY2 = secondBar->secondJoint()->yCoordinate() + deltaY;
-                    }
-                    else
-                    {
-                        secondX2 = secondBar->secondJoint()->xCoordinate();
-                        secondY2 = secondBar->secondJoint()->yCoordinate();
-                    }
+            Bar *bar = mBarsList.at(i);
 
-                    // -------------------------------------------------------------------------------------------------
-                    // Determine x and y components of first and second bars
-                    // -------------------------------------------------------------------------------------------------
+            bool checkA = isSelectedJoint.at(jointIndices.value(bar->firstJoint()));
+            bool checkB = isSelectedJoint.at(jointIndices.value(bar->secondJoint()));
 
-                    qreal firstXComponent = firstX2 - firstX1;
-                    qreal firstYComponent = firstY2 - firstY1;
-
-                    qreal secondXComponent = secondX2 - secondX1;
-                    qreal secondYComponent = secondY2 - secondY1;
-
-                    qreal firstSlope;
-                    qreal firstIntercept;
-
-                    qreal secondSlope;
-                    qreal secondIntercept;
-
-                    // -------------------------------------------------------------------------------------------------
-                    // Determine slope and intercept of first and second bar
-                    // -------------------------------------------------------------------------------------------------
-
-                    if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-                    {
-                        firstSlope     = epsilonMagnitudeLarge;
-                        firstIntercept = firstX1;
-                    }
-                    else
-                    {
-                        firstSlope     = firstYComponent / firstXComponent;
-                        qreal top      = (firstY2 * firstX1 - firstY1 * firstX2);
-                        firstIntercept =  top / (-firstXComponent);
-                    }
-
-                    if (std::fabs(secondXComponent) < epsilonMagnitudeSmall)
-                    {
-                        secondSlope     = epsilonMagnitudeLarge;
-                        secondIntercept = secondX1;
-                    }
-                    else
-                    {
-                        secondSlope     = secondYComponent / secondXComponent;
-                        qreal top       = (secondY2 * secondX1 - secondY1 * secondX2);
-                        secondIntercept =   top / (-secondXComponent);
-                    }
+            if (!checkA && !checkB)
+            {
+                continue;
+            }
 
-                    // -------------------------------------------------------------------------------------------------
-                    // Determine differences of slope and intercept between first and second bar
-                    // -------------------------------------------------------------------------------------------------
+            qreal x1 = bar->firstJoint()->xCoordinate() + (checkA ? deltaX : 0.0);
+            qreal y1 = bar->firstJoint()->yCoordinate() + (checkA ? deltaY : 0.0);
+            qreal x2 = bar->secondJoint()->xCoordinate() + (checkB ? deltaX : 0.0);
+            qreal y2 = bar->secondJoint()->yCoordinate() + (checkB ? deltaY : 0.0);
 
-                    qreal magnitudeSlopeDifference     = std::fabs(firstSlope - secondSlope);
-                    qreal magnitudeInterceptDifference = std::fabs(firstIntercept - secondIntercept);
+            isMovedBar[i] = true;
+            movedBarCoordinates.append(x1);
+            movedBarCoordinates.append(y1);
+            movedBarCoordinates.append(x2);
+            movedBarCoordinates.append(y2);
+            movedBarsIndex.insertSegment(movedBarsCount, x1, y1, x2, y2);
+            ++movedBarsCount;
+        }
 
-                    bool checkA = ((magnitudeSlopeDifference < epsilonMagnitudeSmall)
-                                       && (magnitudeInterceptDifference < epsilonMagnitudeSmall));
+        qreal margin = SpatialIndex::kCellMargin * mSpatialIndex.cellSize();
 
-                    // -------------------------------------------------------------------------------------------------
-                    // Check for possibility of coincidence between first and second bar
-                    // -------------------------------------------------------------------------------------------------
+        // -------------------------------------------------------------------------------------------------------------
+        // Check for joint that will coincide with existing bar
+        // -------------------------------------------------------------------------------------------------------------
 
-                    if (checkA)
-                    {
-                        std::vector<qreal> xCoordinates;
-                        std::vector<qreal> yCoordinates;
-                        std::vector<qreal>::iterator position;
+        foreach (int selectedJointNumber, selectedJoints)
+        {
+            Joint *selectedJoint = mJointsList.at(selectedJointNumber - 1);
 
-                        xCoordinates.push_back(firstX1);
-                        xCoordinates.push_back(firstX2);
-                        xCoordinates.push_back(secondX1);
-                        xCoordinates.push_back(secondX2);
-                        yCoordinates.push_back(firstY1);
-                        yCoordinates.push_back(firstY2);
-                        yCoordinates.push_back(secondY1);
-                        yCoordinates.push_back(secondY2);
+            qreal xCoordinate = selectedJoint->xCoordinate() + deltaX;
+            qreal yCoordinate = selectedJoint->yCoordinate() + deltaY;
 
-                        position   = std::min_element(xCoordinates.begin(), xCoordinates.end());
-                        qreal minX = *position;
+            if (hasBarThrough(xCoordinate, yCoordinate, isMovedBar))
+            {
+                return -4;
+            }
 
-                        position   = std::max_element(xCoordinates.begin(), xCoordinates.end());
-                        qreal maxX = *position;
+            QVector<int> candidates = movedBarsIndex.segmentsNear(xCoordinate, yCoordinate, margin);
 
-                        position   = std::min_element(yCoordinates.begin(), yCoordinates.end());
-                        qreal minY = *position;
+            foreach (int index, candidates)
+            {
+                if (isPointOnBar(xCoordinate,
+                                 yCoordinate,
+                                 movedBarCoordinates.at(4 * index),
+                                 movedBarCoordinates.at(4 * index + 1),
+                                 movedBarCoordinates.at(4 * index + 2),
+                                 movedBarCoordinates.at(4 * index + 3)))
+                {
+                    return -4;
+                }
+            }
+        }
 
-                        position   = std::max_element(yCoordinates.begin(), yCoordinates.end());
-                        qreal maxY = *position;
+        // -------------------------------------------------------------------------------------------------------------
+        // Check for any two bars whose lengths will overlap
+        // -------------------------------------------------------------------------------------------------------------
 
-                        qreal xComponent = maxX - minX;
-                        qreal yComponent = maxY - minY;
+        for (int i = 0; i < movedBarsCount; ++i)
+        {
+            qreal firstX1 = movedBarCoordinates.at(4 * i);
+            qreal firstY1 = movedBarCoordinates.at(4 * i + 1);
+            qreal firstX2 = movedBarCoordinates.at(4 * i + 2);
+            qreal firstY2 = movedBarCoordinates.at(4 * i + 3);
 
-                        qreal length       = std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0));
-                        qreal firstLength  = std::sqrt(std::pow(firstXComponent, 2.0)
-                                                       + std::pow(firstYComponent, 2.0));
-                        qreal secondLength = std::sqrt(std::pow(secondXComponent, 2.0)
-                                                       + std::pow(secondYComponent, 2.0));
+            if (hasOverlappingBar(firstX1, firstY1, firstX2, firstY2, isMovedBar))
+            {
+                return -5;
+            }
 
-                        bool checkB = ((firstLength + secondLength) - length) > epsilonMagnitudeSmall;
+            QVector<int> candidates = movedBarsIndex.segmentsNear(firstX1, firstY1, firstX2, firstY2, margin);
 
-                        // ---------------------------------------------------------------------------------------------
-                        // Confirm coincidence between first and second bar
-                        // ---------------------------------------------------------------------------------------------
+            foreach (int index, candidates)
+            {
+                if (index == i)
+                {
+                    continue;
+                }
 
-                        if (checkB)
-                        {
-                            return -5;
-                        }
-                    }
+                if (isBarOverlap(firstX1,
+                                 firstY1,
+                                 firstX2,
+                                 firstY2,
+                                 movedBarCoordinates.at(4 * index),
+                                 movedBarCoordinates.at(4 * index + 1),
+                                 movedBarCoordinates.at(4 * index + 2),
+                                 movedBarCoordinates.at(4 * index + 3)))
+                {
+                    return -5;
                 }
             }
         }
@@ -4497,6 +5060,8 @@ int Solver::editJoints(qreal deltaX,
     // Update joints positions
     // -----------------------------------------------------------------------------------------------------------------
 
+    invalidateSpatialIndex();
+
     foreach (int jointNumber, selectedJoints)
     {
         int jointIndex    = jointNumber - 1;
@@ -4526,7 +5091,8 @@ void Solver::deleteJoints()
         selectedJoints.append(index.row() + 1);
     }
 
-    QList<Joint *> jointsToDelete;
+    //Deleted joints are flagged by position and dropped in one pass, so bulk deletes stay linear
+    QVector<bool> isDeletedJoint(mJointsList.size(), false);
 
     int counter = 0;
 
@@ -4543,27 +5109,21 @@ void Solver::deleteJoints()
             continue;
         }
 
-        jointsToDelete.append(joint);
+        isDeletedJoint[jointNumber - 1] = true;
         ++counter;
     }
 
-    QList<QStandardItem *> itemsToDelete;
+    invalidateSpatialIndex();
 
-    foreach (int jointNumber, selectedJoints)
+    for (int i = 0; i < isDeletedJoint.size(); ++i)
     {
-        Joint *joint = mJointsList.at(jointNumber - 1);
-
-        if (jointsToDelete.contains(joint))
+        if (isDeletedJoint.at(i))
         {
-            itemsToDelete.append(mJointsStandardItemModel->item(jointNumber - 1, 0));
+            delete mJointsList.at(i);
         }
     }
 
-    foreach (Joint *joint, jointsToDelete)
-    {
-        delete joint;
-        mJointsList.removeOne(joint);
-    }
+    ModelIndex::removeFlagged(mJointsList, isDeletedJoint);
 
     if (mJointsList.isEmpty())
     {
@@ -4572,29 +5132,102 @@ void Solver::deleteJoints()
     }
 
     mJointsTableView->clearSelection();
-
-    foreach (QStandardItem *item, itemsToDelete)
-    {
-        int row = mJointsStandardItemModel->indexFromItem(item).row();
-        mJointsStandardItemModel->removeRow(row);
-    }
+    mJointsTableModel->removeFlaggedRows(isDeletedJoint);
 
     if (counter > 0)
     {
         mJointsTableView->clearSelection();
         normalizeJointCoordinates();
-        mAddJointsDialog->updateJoints();
-        mAddBarsDialog->updateFirstJointOptions();
-        mEditBarsDialog->updateFirstJointOptions();
-        mAddSupportsDialog->updateJoints();
-        mAddJointLoadsDialog->updateJoints();
-        mEditJointLoadsDialog->updateJoints();
-        mModelCheckRequired = true;
+        updateJointOptions();
+        invalidateModelCheck();
         setWindowModified(true);
         updateModelViewer();
     }
 }
 
+void Solver::generateTruss(const ParametricTruss &truss)
+{
+    if (hasLoads())
+    {
+        return;
+    }
+
+    EditTransaction transaction(this);
+
+    //The joints of the truss lie apart, its members meet only at their end joints and the truss is placed clear of
+    //the model, so joints, bars and supports are appended in bulk without the checks of addJoint and addBar
+
+    const QVector<Point> &points                    = truss.joints();
+    const QVector<ParametricTruss::Member> &members = truss.members();
+
+    qreal xOffset       = truss.xOffset(mJointsList);
+    int firstJointIndex = mJointsList.size();
+
+    if (mJointsList.isEmpty())
+    {
+        emit enableJointsInput();
+        mUnitsAction->setEnabled(false);
+    }
+
+    if (mBarsList.isEmpty())
+    {
+        mFactorRadioButton->setEnabled(false);
+        mValueRadioButton->setEnabled(false);
+    }
+
+    mJointsList.reserve(mJointsList.size() + points.size());
+    mBarsList.reserve(mBarsList.size() + members.size());
+
+    foreach (const Point &point, points)
+    {
+        mJointsList.append(new Joint(point.xCoordinate() + xOffset, point.yCoordinate(), this));
+    }
+
+    foreach (const ParametricTruss::Member &member, members)
+    {
+        Joint *firstJoint  = mJointsList.at(firstJointIndex + member.firstJoint);
+        Joint *secondJoint = mJointsList.at(firstJointIndex + member.secondJoint);
+
+        firstJoint->connectedJoints()->append(secondJoint);
+        secondJoint->connectedJoints()->append(firstJoint);
+
+        Bar *bar = new Bar(firstJoint,
+                           secondJoint,
+                           truss.area(member.group),
+                           truss.modulus(member.group),
+                           truss.factor(member.group),
+                           truss.unitWeight(member.group),
+                           this);
+
+        mBarsList.append(bar);
+
+        firstJoint->attachedBars()->append(bar);
+        secondJoint->attachedBars()->append(bar);
+    }
+
+    Joint *pinnedJoint = mJointsList.at(firstJointIndex + truss.pinnedJoint());
+    Joint *rollerJoint = mJointsList.at(firstJointIndex + truss.rollerJoint());
+
+    mSupportsList.append(new Support(UnitsAndLimits::FIXED_BOTTOM, 0.0, pinnedJoint, this));
+    mSupportsList.append(new Support(UnitsAndLimits::ROLLER_BOTTOM, 0.0, rollerJoint, this));
+    pinnedJoint->setSupported(true);
+    rollerJoint->setSupported(true);
+
+    invalidateSpatialIndex();
+
+    mJointsTableModel->appendRows();
+    mBarsTableModel->appendRows();
+    mSupportsTableModel->appendRows();
+
+    mJointsTableView->clearSelection();
+    normalizeJointCoordinates();
+    mJointsTableView->scrollToBottom();
+    updateJointOptions();
+    invalidateModelCheck();
+    setWindowModified(true);
+    updateModelViewer();
+}
+
 void Solver::showAddBarsDialog()
 {
     if (mAddBarsDialog->position() != QPoint(0, 0))
@@ -4649,11 +5282,10 @@ void Solver::setAreaModulusOption(bool areaModulusOption)
 {
     if (areaModulusOption)
     {
-        mBarsStandardItemModel->clear();
-        mBarsStandardItemModel->setRowCount(0);
-        mBarsStandardItemModel->setColumnCount(5);
+        mBarsTableModel->setColumnCount(5);
         createBarsModelHeader();
         mAddBarsDialog->updateAreaModulusFactorOption();
+        mGenerateTrussDialog->updateAreaModulusFactorOption();
         createJointDeflectionsModelHeader();
         mUpdateSelfWeightOption = true;
 
@@ -4674,11 +5306,10 @@ void Solver::setFactorOption(bool factorOption)
 {
     if (factorOption)
     {
-        mBarsStandardItemModel->clear();
-        mBarsStandardItemModel->setRowCount(0);
-        mBarsStandardItemModel->setColumnCount(3);
+        mBarsTableModel->setColumnCount(3);
         createBarsModelHeader();
         mAddBarsDialog->updateAreaModulusFactorOption();
+        mGenerateTrussDialog->updateAreaModulusFactorOption();
         createJointDeflectionsModelHeader();
         mUpdateSelfWeightOption = true;
 
@@ -4710,6 +5341,8 @@ void Solver::addBars(int firstJoint,
         return;
     }
 
+    EditTransaction transaction(this);
+
     if (firstJoint == 0)
     {
         QItemSelectionModel *itemSelectionModel = mBarsTableView->selectionModel();
@@ -4868,7 +5501,7 @@ void Solver::addBars(int firstJoint,
         {
             mBarsTableView->clearSelection();
             mBarsTableView->scrollToBottom();
-            mModelCheckRequired = true;
+            invalidateModelCheck();
             setWindowModified(true);
             normalizeJointCoordinates();
             updateModelViewer();
@@ -4999,7 +5632,7 @@ void Solver::addBars(int firstJoint,
         if (mBarsList.size() > initialCount)
         {
             mBarsTableView->scrollToBottom();
-            mModelCheckRequired = true;
+            invalidateModelCheck();
             setWindowModified(true);
             normalizeJointCoordinates();
             updateModelViewer();
@@ -5020,239 +5653,46 @@ void Solver::addBar(qreal xFirstJoint,
     // Check for overlap with existing bars
     // -----------------------------------------------------------------------------------------------------------------
 
-    foreach (Bar *bar, mBarsList)
+    if (hasOverlappingBar(xFirstJoint, yFirstJoint, xSecondJoint, ySecondJoint))
     {
-        // -------------------------------------------------------------------------------------------------------------
-        // End coordinates of first bar
-        // -------------------------------------------------------------------------------------------------------------
-
-        qreal firstX1 = xFirstJoint;
-        qreal firstY1 = yFirstJoint;
-        qreal firstX2 = xSecondJoint;
-        qreal firstY2 = ySecondJoint;
-
-        // -------------------------------------------------------------------------------------------------------------
-        // End coordinates of second bar
-        // -------------------------------------------------------------------------------------------------------------
-
-        qreal secondX1 = bar->firstJoint()->xCoordinate();
-        qreal secondY1 = bar->firstJoint()->yCoordinate();
-        qreal secondX2 = bar->secondJoint()->xCoordinate();
-        qreal secondY2 = bar->secondJoint()->yCoordinate();
-
-        // -------------------------------------------------------------------------------------------------------------
-        // Determine x and y components of first and second bars
-        // -------------------------------------------------------------------------------------------------------------
-
-        qreal firstXComponent = firstX2 - firstX1;
-        qreal firstYComponent = firstY2 - firstY1;
-
-        qreal secondXComponent = secondX2 - secondX1;
-        qreal secondYComponent = secondY2 - secondY1;
-
-        qreal epsilonMagnitudeSmall = 1.0e-12;
-        qreal epsilonMagnitudeLarge = 1.0e+12;
-
-        qreal firstSlope;
-        qreal firstIntercept;
-
-        qreal secondSlope;
-        qreal secondIntercept;
-
-        // -------------------------------------------------------------------------------------------------------------
-        // Determine slope and intercept of first and second bar
-        // -------------------------------------------------------------------------------------------------------------
-
-        if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-        {
-            firstSlope     = epsilonMagnitudeLarge;
-            firstIntercept = firstX1;
-        }
-        else
-        {
-            firstSlope     = firstYComponent / firstXComponent;
-            qreal top      = (firstY2 * firstX1 - firstY1 * firstX2);
-            firstIntercept =  top / (-firstXComponent);
-        }
-
-        if (std::fabs(secondXComponent) < epsilonMagnitudeSmall)
-        {
-            secondSlope     = epsilonMagnitudeLarge;
-            secondIntercept = secondX1;
-        }
-        else
-        {
-            secondSlope     = secondYComponent / secondXComponent;
-            qreal top       = (secondY2 * secondX1 - secondY1 * secondX2);
-            secondIntercept =   top / (-secondXComponent);
-        }
-
-        // -------------------------------------------------------------------------------------------------------------
-        // Determine differences of slope and intercept between first and second bar
-        // -------------------------------------------------------------------------------------------------------------
-
-        qreal magnitudeSlopeDifference     = std::fabs(firstSlope - secondSlope);
-        qreal magnitudeInterceptDifference = std::fabs(firstIntercept - secondIntercept);
-
-        bool checkA = ((magnitudeSlopeDifference < epsilonMagnitudeSmall)
-                           && (magnitudeInterceptDifference < epsilonMagnitudeSmall));
-
-        // -------------------------------------------------------------------------------------------------------------
-        // Check for possibility of coincidence between first and second bar
-        // -------------------------------------------------------------------------------------------------------------
-
-        if (checkA)
-        {
-            std::vector<qreal> xCoordinates;
-            std::vector<qreal> yCoordinates;
-            std::vector<qreal>::iterator position;
-
-            xCoordinates.push_back(firstX1);
-            xCoordinates.push_back(firstX2);
-            xCoordinates.push_back(secondX1);
-            xCoordinates.push_back(secondX2);
-            yCoordinates.push_back(firstY1);
-            yCoordinates.push_back(firstY2);
-            yCoordinates.push_back(secondY1);
-            yCoordinates.push_back(secondY2);
-
-            position   = std::min_element(xCoordinates.begin(), xCoordinates.end());
-            qreal minX = *position;
-
-            position   = std::max_element(xCoordinates.begin(), xCoordinates.end());
-            qreal maxX = *position;
-
-            position   = std::min_element(yCoordinates.begin(), yCoordinates.end());
-            qreal minY = *position;
-
-            position   = std::max_element(yCoordinates.begin(), yCoordinates.end());
-            qreal maxY = *position;
-
-            qreal xComponent = maxX - minX;
-            qreal yComponent = maxY - minY;
-
-            qreal length       = std::sqrt(std::pow(xComponent, 2.0) + std::pow(yComponent, 2.0));
-            qreal firstLength  = std::sqrt(std::pow(firstXComponent, 2.0)
-                                           + std::pow(firstYComponent, 2.0));
-            qreal secondLength = std::sqrt(std::pow(secondXComponent, 2.0)
-                                           + std::pow(secondYComponent, 2.0));
-
-            bool checkB = ((firstLength + secondLength) - length) > epsilonMagnitudeSmall;
-
-            // ---------------------------------------------------------------------------------------------------------
-            // Confirm coincidence between first and second bar
-            // ---------------------------------------------------------------------------------------------------------
-
-            if (checkB)
-            {
-                return;
-            }
-        }
+        return;
     }
 
     // -----------------------------------------------------------------------------------------------------------------
     // Check for coincidence with existing joint
     // -----------------------------------------------------------------------------------------------------------------
 
-    qreal epsilonMagnitudeSmall = 1.0e-12;
-
-    foreach (Joint *joint, mJointsList)
+    if (hasJointOnBar(xFirstJoint, yFirstJoint, xSecondJoint, ySecondJoint))
     {
-        qreal xCoordinate = joint->xCoordinate();
-        qreal yCoordinate = joint->yCoordinate();
-
-        qreal firstXComponent  = xSecondJoint - xFirstJoint;
-        qreal firstYComponent  = ySecondJoint - yFirstJoint;
-        qreal secondXComponent = xCoordinate - xFirstJoint;
-        qreal secondYComponent = yCoordinate - yFirstJoint;
-
-        qreal magnitudeCrossProduct = std::fabs(firstXComponent * secondYComponent
-                                                - firstYComponent * secondXComponent);
-
-        if (magnitudeCrossProduct < epsilonMagnitudeSmall)
-        {
-            qreal quotient = 0.0;
-
-            if (std::fabs(firstXComponent) < epsilonMagnitudeSmall)
-            {
-                quotient = secondYComponent / firstYComponent;
-            }
-            else
-            {
-                quotient = secondXComponent / firstXComponent;
-            }
-
-            if ((quotient > 0.0) && (quotient < 1.0))
-            {
-                return;
-            }
-        }
+        return;
     }
 
-    Joint *firstJoint;
-    Joint *secondJoint;
-    Bar *bar;
-
-    bool checkA = false;
-    bool checkB = false;
-
-    foreach (Joint *joint, mJointsList)
-    {
-        qreal xCoordinate = joint->xCoordinate();
-        qreal yCoordinate = joint->yCoordinate();
-
-        bool checkC = std::fabs(xCoordinate - xFirstJoint) < epsilonMagnitudeSmall;
-        bool checkD = std::fabs(yCoordinate - yFirstJoint) < epsilonMagnitudeSmall;
-
-        bool checkE = std::fabs(xCoordinate - xSecondJoint) < epsilonMagnitudeSmall;
-        bool checkF = std::fabs(yCoordinate - ySecondJoint) < epsilonMagnitudeSmall;
-
-        if (checkC && checkD)
-        {
-            checkA     = true;
-            firstJoint = joint;
-        }
-
-        if (checkE && checkF)
-        {
-            checkB      = true;
-            secondJoint = joint;
-        }
-
-        if (checkA && checkB)
-        {
-            break;
-        }
-    }
+    int firstJointIndex  = jointAt(xFirstJoint, yFirstJoint);
+    int secondJointIndex = jointAt(xSecondJoint, ySecondJoint);
 
-    if (!checkA)
+    if (firstJointIndex < 0)
     {
-        int index = addJoint(xFirstJoint, yFirstJoint);
+        firstJointIndex = addJoint(xFirstJoint, yFirstJoint);
 
-        if (index >= 0)
-        {
-            firstJoint = mJointsList.at(index);
-        }
-        else
+        if (firstJointIndex < 0)
         {
             return;
         }
     }
 
-    if (!checkB)
+    if (secondJointIndex < 0)
     {
-        int index = addJoint(xSecondJoint, ySecondJoint);
+        secondJointIndex = addJoint(xSecondJoint, ySecondJoint);
 
-        if (index >= 0)
-        {
-            secondJoint = mJointsList.at(index);
-        }
-        else
+        if (secondJointIndex < 0)
         {
             return;
         }
     }
 
+    Joint *firstJoint  = mJointsList.at(firstJointIndex);
+    Joint *secondJoint = mJointsList.at(secondJointIndex);
+
     if (firstJoint->connectedJoints()->contains(secondJoint))
     {
         return;
@@ -5267,51 +5707,14 @@ void Solver::addBar(qreal xFirstJoint,
     firstJoint->connectedJoints()->append(secondJoint);
     secondJoint->connectedJoints()->append(firstJoint);
 
-    bar = new Bar(firstJoint, secondJoint, area, modulus, factor, unitWeight, this);
+    Bar *bar = new Bar(firstJoint, secondJoint, area, modulus, factor, unitWeight, this);
     mBarsList.append(bar);
+    indexBar(mBarsList.size() - 1);
 
     firstJoint->attachedBars()->append(bar);
     secondJoint->attachedBars()->append(bar);
 
-    QList<QStandardItem *> standardItemsList;
-    QStandardItem *standardItem;
-
-    standardItem = new QStandardItem(QString::number(mJointsList.indexOf(firstJoint) + 1));
-    standardItem->setTextAlignment(Qt::AlignCenter);
-    standardItem->setEditable(false);
-    standardItemsList.append(standardItem);
-
-    standardItem = new QStandardItem(QString::number(mJointsList.indexOf(secondJoint) + 1));
-    standardItem->setTextAlignment(Qt::AlignCenter);
-    standardItem->setEditable(false);
-    standardItemsList.append(standardItem);
-
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        standardItem = new QStandardItem(QString::number(bar->area(), 'f', mUnitsAndLimits.areaDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        standardItem = new QStandardItem(QString::number(bar->modulus(), 'f', mUnitsAndLimits.modulusDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        standardItem = new QStandardItem(QString::number(bar->unitWeight(), 'f', mUnitsAndLimits.unitWeightDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-    }
-    else
-    {
-        standardItem = new QStandardItem(QString::number(bar->factor(), 'f', mUnitsAndLimits.factorDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-    }
-
-    mBarsStandardItemModel->appendRow(standardItemsList);
+    mBarsTableModel->appendRows();
 }
 
 void Solver::mirrorBars(QString axis, int axisJointNumber)
@@ -5321,6 +5724,8 @@ void Solver::mirrorBars(QString axis, int axisJointNumber)
         return;
     }
 
+    EditTransaction transaction(this);
+
     QItemSelectionModel *itemSelectionModel = mBarsTableView->selectionModel();
     QModelIndexList modelIndexList          = itemSelectionModel->selectedRows();
     QList<int> selectedBars;
@@ -5567,7 +5972,7 @@ void Solver::mirrorBars(QString axis, int axisJointNumber)
     {
         mBarsTableView->clearSelection();
         mBarsTableView->scrollToBottom();
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
         normalizeJointCoordinates();
         updateModelViewer();
@@ -5697,6 +6102,8 @@ void Solver::linkBars(qreal area,
         return;
     }
 
+    EditTransaction transaction(this);
+
     foreach (int jointNumber, selectedJoints)
     {
         Joint *firstJoint;
@@ -5768,10 +6175,11 @@ void Solver::editBar(int firstJointNumber,
         int indexD = bar->secondJoint()->connectedJoints()->indexOf(firstJoint);
         bar->firstJoint()->connectedJoints()->removeAt(indexC);
         bar->secondJoint()->connectedJoints()->removeAt(indexD);
-        int barIndex = mBarsList.indexOf(bar);
+        int barIndex = selectedBars.first() - 1;
 
         Joint *newFirstJoint  = mJointsList.at(firstJointNumber - 1);
         Joint *newSecondJoint = mJointsList.at(secondJointNumber - 1);
+        invalidateSpatialIndex();
         bar->setFirstJoint(newFirstJoint);
         bar->setSecondJoint(newSecondJoint);
         newFirstJoint->attachedBars()->append(bar);
@@ -5810,48 +6218,16 @@ void Solver::editBar(int firstJointNumber,
         }
 
         bar->setArea(area);
-        bar->setModulus(modulus);
-        bar->setFactor(factor);
-        bar->setUnitWeight(unitWeight);
-
-        //Updates Table
-        mBarsTableView->clearSelection();
-        QStandardItem *standardItem;
-
-        standardItem = new QStandardItem(QString::number(firstJointNumber));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 0, standardItem);
-        standardItem = new QStandardItem(QString::number(secondJointNumber));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 1, standardItem);
-
-        if (mBarsStandardItemModel->columnCount() == 5)
-        {
-            standardItem = new QStandardItem(QString::number(area, 'f', mUnitsAndLimits.areaDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(barIndex, 2, standardItem);
-            standardItem = new QStandardItem(QString::number(modulus, 'f', mUnitsAndLimits.modulusDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(barIndex, 3, standardItem);
-            standardItem = new QStandardItem(QString::number(unitWeight, 'f', mUnitsAndLimits.unitWeightDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(barIndex, 4,standardItem);
-        }
-        else
-        {
-            standardItem = new QStandardItem(QString::number(factor, 'f', mUnitsAndLimits.factorDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mBarsStandardItemModel->setItem(barIndex, 2, standardItem);
-        }
+        bar->setModulus(modulus);
+        bar->setFactor(factor);
+        bar->setUnitWeight(unitWeight);
+
+        //Updates Table
+        mBarsTableView->clearSelection();
+        mBarsTableModel->updateRows(barIndex, barIndex);
 
         updateModelViewer();
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
     }
     else
@@ -5862,7 +6238,7 @@ void Solver::editBar(int firstJointNumber,
         {
             int index = number - 1;
 
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 editBar(index,
                         area,
@@ -5890,7 +6266,7 @@ void Solver::editBar(int barIndex,
 {
     Bar *bar = mBarsList.at(barIndex);
 
-    if (mBarsStandardItemModel->columnCount() == 5)
+    if (mBarsTableModel->columnCount() == 5)
     {
         bar->setArea(area);
         bar->setModulus(modulus);
@@ -5901,30 +6277,7 @@ void Solver::editBar(int barIndex,
         bar->setFactor(factor);
     }
 
-    QStandardItem *standardItem;
-
-    if (mBarsStandardItemModel->columnCount() == 5)
-    {
-        standardItem = new QStandardItem(QString::number(area, 'f', mUnitsAndLimits.areaDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 2, standardItem);
-        standardItem = new QStandardItem(QString::number(modulus, 'f', mUnitsAndLimits.modulusDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 3, standardItem);
-        standardItem = new QStandardItem(QString::number(unitWeight, 'f', mUnitsAndLimits.unitWeightDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 4, standardItem);
-    }
-    else
-    {
-        standardItem = new QStandardItem(QString::number(factor, 'f', mUnitsAndLimits.factorDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mBarsStandardItemModel->setItem(barIndex, 2, standardItem);
-    }
+    mBarsTableModel->updateRows(barIndex, barIndex);
 }
 
 void Solver::deleteBar()
@@ -5943,57 +6296,34 @@ void Solver::deleteBar()
         selectedBars.append(index.row() + 1);
     }
 
-    QList<int> barsToDelete;
-    QList<Bar *> barsToRemove;
-    QList<QStandardItem *> itemsToRemove;
+    //Deleted bars are flagged by position and dropped in one pass, so bulk deletes stay linear
+    QVector<bool> isDeletedBar(mBarsList.size(), false);
 
     foreach (int barNumber, selectedBars)
     {
-        Bar *bar   = mBarsList.at(barNumber - 1);
-        bool check = false;
-
-        foreach (Support *support, mSupportsList)
-        {
-            if (support->supportJoint() == bar->firstJoint())
-            {
-                check = true;
-                break;
-            }
-
-            if (support->supportJoint() == bar->secondJoint())
-            {
-                check = true;
-                break;
-            }
-        }
+        Bar *bar = mBarsList.at(barNumber - 1);
 
-        if (check)
+        //Bars ending on a supported joint are kept
+        if (bar->firstJoint()->isSupported() || bar->secondJoint()->isSupported())
         {
             continue;
         }
 
-        barsToDelete.append(barNumber - 1);
-        barsToRemove.append(bar);
-        itemsToRemove.append(mBarsStandardItemModel->item(barNumber - 1, 0));
+        isDeletedBar[barNumber - 1] = true;
     }
 
     mBarsTableView->clearSelection();
 
-    foreach (int barIndex, barsToDelete)
+    for (int i = 0; i < isDeletedBar.size(); ++i)
     {
-        deleteBar(barIndex);
-    }
-
-    foreach (Bar *bar, barsToRemove)
-    {
-        mBarsList.removeOne(bar);
+        if (isDeletedBar.at(i))
+        {
+            deleteBar(i);
+        }
     }
 
-    foreach (QStandardItem *item, itemsToRemove)
-    {
-        int row = mBarsStandardItemModel->indexFromItem(item).row();
-        mBarsStandardItemModel->removeRow(row);
-    }
+    ModelIndex::removeFlagged(mBarsList, isDeletedBar);
+    mBarsTableModel->removeFlaggedRows(isDeletedBar);
 
     if (mBarsList.size() == 0)
     {
@@ -6001,13 +6331,15 @@ void Solver::deleteBar()
         mValueRadioButton->setEnabled(true);
     }
 
-    mModelCheckRequired = true;
+    invalidateModelCheck();
     setWindowModified(true);
     updateModelViewer();
 }
 
 void Solver::deleteBar(int barIndex)
 {
+    invalidateSpatialIndex();
+
     Bar *bar           = mBarsList.at(barIndex);
     Joint *firstJoint  = bar->firstJoint();
     Joint *secondJoint = bar->secondJoint();
@@ -6094,6 +6426,8 @@ void Solver::addSupports(int supportJointNumber,
         return;
     }
 
+    EditTransaction transaction(this);
+
     QItemSelectionModel *itemSelectionModel = mJointsTableView->selectionModel();
 
     if (itemSelectionModel->hasSelection())
@@ -6136,30 +6470,8 @@ void Solver::addSupports(int supportJointNumber,
             ++count;
 
             Support *support;
-            QString supportTypeName;
             Joint *joint = mJointsList.at(jointNumber - 1);
 
-            switch (type)
-            {
-                case UnitsAndLimits::FIXED_LEFT:
-                case UnitsAndLimits::FIXED_TOP:
-                case UnitsAndLimits::FIXED_RIGHT:
-                case UnitsAndLimits::FIXED_BOTTOM:
-                    supportTypeName = QString(tr("fixed"));
-                    break;
-                case UnitsAndLimits::ROLLER:
-                    supportTypeName = QString(tr("inclined roller"));
-                    break;
-                case UnitsAndLimits::ROLLER_LEFT:
-                case UnitsAndLimits::ROLLER_TOP:
-                case UnitsAndLimits::ROLLER_RIGHT:
-                case UnitsAndLimits::ROLLER_BOTTOM:
-                    supportTypeName = QString(tr("roller"));
-                    break;
-                default:
-                    break;
-            }
-
             support = new Support(type,
                                   angle,
                                   joint,
@@ -6169,22 +6481,7 @@ void Solver::addSupports(int supportJointNumber,
 
             mSupportsList.append(support);
 
-            QList<QStandardItem *> standardItemsList;
-            QStandardItem *standardItem;
-            standardItem = new QStandardItem(QString::number(jointNumber));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            standardItemsList.append(standardItem);
-            standardItem = new QStandardItem(supportTypeName);
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            standardItemsList.append(standardItem);
-            standardItem = new QStandardItem(QString::number(angle, 'f', mUnitsAndLimits.supportAngleDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            standardItemsList.append(standardItem);
-
-            mSupportsStandardItemModel->appendRow(standardItemsList);
+            mSupportsTableModel->appendRows();
             mSupportsTableView->scrollToBottom();
         }
 
@@ -6192,7 +6489,7 @@ void Solver::addSupports(int supportJointNumber,
         {
             mJointsTableView->clearSelection();
             updateModelViewer();
-            mModelCheckRequired = true;
+            invalidateModelCheck();
             setWindowModified(true);
         }
     }
@@ -6222,30 +6519,8 @@ void Solver::addSupports(int supportJointNumber,
         }
 
         Support *support;
-        QString supportTypeName;
         Joint *joint = mJointsList.at(supportJointNumber - 1);
 
-        switch (type)
-        {
-            case UnitsAndLimits::FIXED_LEFT:
-            case UnitsAndLimits::FIXED_TOP:
-            case UnitsAndLimits::FIXED_RIGHT:
-            case UnitsAndLimits::FIXED_BOTTOM:
-                supportTypeName = QString(tr("fixed"));
-                break;
-            case UnitsAndLimits::ROLLER:
-                supportTypeName = QString(tr("inclined roller"));
-                break;
-            case UnitsAndLimits::ROLLER_LEFT:
-            case UnitsAndLimits::ROLLER_TOP:
-            case UnitsAndLimits::ROLLER_RIGHT:
-            case UnitsAndLimits::ROLLER_BOTTOM:
-                supportTypeName = QString(tr("roller"));
-                break;
-            default:
-                break;
-        }
-
         support = new Support(type,
                               angle,
                               joint,
@@ -6255,26 +6530,11 @@ void Solver::addSupports(int supportJointNumber,
 
         mSupportsList.append(support);
 
-        QList<QStandardItem *> standardItemsList;
-        QStandardItem *standardItem;
-        standardItem = new QStandardItem(QString::number(supportJointNumber));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(supportTypeName);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(angle, 'f', mUnitsAndLimits.supportAngleDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        standardItemsList.append(standardItem);
-
-        mSupportsStandardItemModel->appendRow(standardItemsList);
+        mSupportsTableModel->appendRows();
         mSupportsTableView->scrollToBottom();
 
         updateModelViewer();
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
     }
 }
@@ -6330,46 +6590,11 @@ void Solver::editSupport(int supportJointNumber,
         support->setSupportAngle(angle);
         mJointsList.at(supportJointNumber - 1)->setSupported(true);
 
-        QString supportTypeName;
-
-        switch (type)
-        {
-            case UnitsAndLimits::FIXED_LEFT:
-            case UnitsAndLimits::FIXED_TOP:
-            case UnitsAndLimits::FIXED_RIGHT:
-            case UnitsAndLimits::FIXED_BOTTOM:
-                supportTypeName = QString(tr("fixed"));
-                break;
-            case UnitsAndLimits::ROLLER:
-                supportTypeName = QString(tr("inclined roller"));
-                break;
-            case UnitsAndLimits::ROLLER_LEFT:
-            case UnitsAndLimits::ROLLER_TOP:
-            case UnitsAndLimits::ROLLER_RIGHT:
-            case UnitsAndLimits::ROLLER_BOTTOM:
-                supportTypeName = QString(tr("roller"));
-                break;
-            default:
-                break;
-        }
-
         mSupportsTableView->clearSelection();
 
-        QStandardItem *standardItem;
-        standardItem = new QStandardItem(QString::number(supportJointNumber));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mSupportsStandardItemModel->setItem(supportNumber - 1, 0, standardItem);
-        standardItem = new QStandardItem(supportTypeName);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mSupportsStandardItemModel->setItem(supportNumber - 1, 1, standardItem);
-        standardItem = new QStandardItem(QString::number(angle, 'f', mUnitsAndLimits.supportAngleDecimals()));
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItem->setEditable(false);
-        mSupportsStandardItemModel->setItem(supportNumber - 1, 2, standardItem);
+        mSupportsTableModel->updateRows(supportNumber - 1, supportNumber - 1);
 
-        mModelCheckRequired = true;
+        invalidateModelCheck();
         setWindowModified(true);
         updateModelViewer();
     }
@@ -6397,45 +6622,14 @@ void Solver::editSupport(int supportJointNumber,
             support->setSupportType(type);
             support->setSupportAngle(angle);
 
-            QString supportTypeName;
-
-            switch (type)
-            {
-                case UnitsAndLimits::FIXED_LEFT:
-                case UnitsAndLimits::FIXED_TOP:
-                case UnitsAndLimits::FIXED_RIGHT:
-                case UnitsAndLimits::FIXED_BOTTOM:
-                    supportTypeName = QString(tr("fixed"));
-                    break;
-                case UnitsAndLimits::ROLLER:
-                    supportTypeName = QString(tr("inclined roller"));
-                    break;
-                case UnitsAndLimits::ROLLER_LEFT:
-                case UnitsAndLimits::ROLLER_TOP:
-                case UnitsAndLimits::ROLLER_RIGHT:
-                case UnitsAndLimits::ROLLER_BOTTOM:
-                    supportTypeName = QString(tr("roller"));
-                    break;
-                default:
-                    break;
-            }
-
-            QStandardItem *standardItem;
-            standardItem = new QStandardItem(supportTypeName);
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mSupportsStandardItemModel->setItem(supportNumber - 1, 1, standardItem);
-            standardItem = new QStandardItem(QString::number(angle, 'f' , mUnitsAndLimits.supportAngleDecimals()));
-            standardItem->setTextAlignment(Qt::AlignCenter);
-            standardItem->setEditable(false);
-            mSupportsStandardItemModel->setItem(supportNumber - 1, 2, standardItem);
+            mSupportsTableModel->updateRows(supportNumber - 1, supportNumber - 1);
 
             ++count;
         }
 
         if (count)
         {
-            mModelCheckRequired = true;
+            invalidateModelCheck();
             setWindowModified(true);
             updateModelViewer();
         }
@@ -6458,37 +6652,23 @@ void Solver::deleteSupport()
         selectedSupports.append(index.row() + 1);
     }
 
-    QList<Support *> supportsToRemove;
-    QList<QStandardItem *> itemsToRemove;
-
-    foreach (int supportNumber, selectedSupports)
-    {
-        supportsToRemove.append(mSupportsList.at(supportNumber - 1));
-        itemsToRemove.append(mSupportsStandardItemModel->item(supportNumber - 1, 0));
-    }
+    QVector<bool> isDeletedSupport(mSupportsList.size(), false);
 
     foreach (int supportNumber, selectedSupports)
     {
+        isDeletedSupport[supportNumber - 1] = true;
         mSupportsList.at(supportNumber - 1)->supportJoint()->setSupported(false);
         delete mSupportsList.at(supportNumber - 1);
     }
 
-    foreach (Support *support, supportsToRemove)
-    {
-        mSupportsList.removeOne(support);
-    }
+    ModelIndex::removeFlagged(mSupportsList, isDeletedSupport);
 
     updateModelViewer();
-    mModelCheckRequired = true;
+    invalidateModelCheck();
     setWindowModified(true);
 
     mSupportsTableView->clearSelection();
-
-    foreach (QStandardItem *item, itemsToRemove)
-    {
-        int row = mSupportsStandardItemModel->indexFromItem(item).row();
-        mSupportsStandardItemModel->removeRow(row);
-    }
+    mSupportsTableModel->removeFlaggedRows(isDeletedSupport);
 }
 
 void Solver::onTabIndexChanged(int option)
@@ -6641,6 +6821,37 @@ void Solver::checkModel()
     mModelCheckRequired = false;
     setModelStability(false);
 
+    if (mCheckedRevision == mModelRevision)
+    {
+        //The background check has already covered this revision of the model
+
+        QList<Bar *> redundantBarsList;
+        QList<Support *> redundantSupportsList;
+
+        foreach (int index, mCheckedRedundantBars)
+        {
+            redundantBarsList.append(mBarsList.at(index));
+        }
+
+        foreach (int index, mCheckedRedundantSupports)
+        {
+            redundantSupportsList.append(mSupportsList.at(index));
+        }
+
+        setRedundantBarsList(redundantBarsList);
+        setRedundantSupportsList(redundantSupportsList);
+        setModelStability(mCheckedStability);
+        setMechanismModes(mCheckedMechanismModes);
+
+        if (!mCheckedNote.isEmpty())
+        {
+            setNote(mCheckedNote);
+        }
+
+        enableLoadsEntry();
+        return;
+    }
+
     ModelChecker *modelChecker = new ModelChecker(mJointsList,
                                                   mBarsList,
                                                   mSupportsList,
@@ -6649,6 +6860,7 @@ void Solver::checkModel()
     qRegisterMetaType< QString >("QString");
     qRegisterMetaType< QList<Bar*> >("QList<Bar*>");
     qRegisterMetaType< QList<Support*> >("QList<Support*>");
+    qRegisterMetaType< QList<QVector<qreal> > >("QList<QVector<qreal> >");
 
     connect(modelChecker, SIGNAL(progressSignal(int)), mProgressBar, SLOT(setValue(int)));
     connect(modelChecker, SIGNAL(notesSignal(QString)), this, SLOT(setNote(QString)));
@@ -6658,12 +6870,196 @@ void Solver::checkModel()
             this, SLOT(setRedundantSupportsList(QList<Support*>)));
     connect(modelChecker, SIGNAL(modelStabilitySignal(bool)),
             this, SLOT(setModelStability(bool)));
+    connect(modelChecker, SIGNAL(mechanismModesSignal(QList<QVector<qreal> >)),
+            this, SLOT(setMechanismModes(QList<QVector<qreal> >)));
     connect(modelChecker, SIGNAL(finished()), this, SLOT(enableLoadsEntry()));
     connect(modelChecker, SIGNAL(finished()), mProgressBar, SLOT(reset()));
     connect(modelChecker, SIGNAL(finished()), mProgressBar, SLOT(hide()));
 
-    mProgressBar->setHidden(false);
-    modelChecker->start();
+    mProgressBar->setHidden(false);
+    mIsModelCheckRunning = true;
+    modelChecker->start();
+}
+
+void Solver::invalidateModelCheck()
+{
+    if (mEditTransactionDepth > 0)
+    {
+        mIsModelCheckPending = true;
+        return;
+    }
+
+    mModelCheckRequired = true;
+    ++mModelRevision;
+
+    //Edits that leave joints, bars and supports as they were, such as bar properties, keep the last check
+
+    if (!mCheckedSignature.isEmpty() && mCheckedSignature == modelCheckSignature())
+    {
+        mCheckedRevision = mModelRevision;
+        return;
+    }
+
+    if (!mMechanismModesList.isEmpty())
+    {
+        setMechanismModes(QList<QVector<qreal> >());
+    }
+
+    mBackgroundCheckTimer->start();
+}
+
+QByteArray Solver::modelCheckSignature() const
+{
+    //Everything the model checker reads: joint coordinates, bar ends and support joints, types and angles
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QHash<Joint *, qint32> jointIndices;
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_4);
+
+    out << qint32(mJointsList.size());
+
+    for (int i = 0; i < mJointsList.size(); ++i)
+    {
+        jointIndices.insert(mJointsList.at(i), i);
+        out << mJointsList.at(i)->xCoordinate() << mJointsList.at(i)->yCoordinate();
+    }
+
+    out << qint32(mBarsList.size());
+
+    foreach (Bar *bar, mBarsList)
+    {
+        out << jointIndices.value(bar->firstJoint()) << jointIndices.value(bar->secondJoint());
+    }
+
+    out << qint32(mSupportsList.size());
+
+    foreach (Support *support, mSupportsList)
+    {
+        out << jointIndices.value(support->supportJoint()) << qint32(support->type()) << support->angle();
+    }
+
+    hash.addData(data);
+
+    return hash.result();
+}
+
+void Solver::startBackgroundCheck()
+{
+    if (!mModelCheckRequired || mCheckedRevision == mModelRevision)
+    {
+        return;
+    }
+
+    //One background check at a time, a check of an outdated revision restarts the timer when it finishes
+
+    if (mIsBackgroundCheckRunning)
+    {
+        return;
+    }
+
+    mIsBackgroundCheckRunning = true;
+    mBackgroundCheckRevision  = mModelRevision;
+    mBackgroundCheckSignature = modelCheckSignature();
+    mCheckedRevision          = 0;
+    mCheckedSignature.clear();
+    mCheckedNote.clear();
+    mCheckedRedundantBars.clear();
+    mCheckedRedundantSupports.clear();
+    mCheckedStability = false;
+    mCheckedMechanismModes.clear();
+
+    ModelChecker *modelChecker = new ModelChecker(mJointsList,
+                                                  mBarsList,
+                                                  mSupportsList,
+                                                  mUnitsAndLimits);
+
+    qRegisterMetaType< QString >("QString");
+    qRegisterMetaType< QList<Bar*> >("QList<Bar*>");
+    qRegisterMetaType< QList<Support*> >("QList<Support*>");
+    qRegisterMetaType< QList<QVector<qreal> > >("QList<QVector<qreal> >");
+
+    connect(modelChecker, SIGNAL(notesSignal(QString)), this, SLOT(storeCheckNote(QString)));
+    connect(modelChecker, SIGNAL(redundantBarsListSignal(QList<Bar*>)),
+            this, SLOT(storeRedundantBarsList(QList<Bar*>)));
+    connect(modelChecker, SIGNAL(redundantSupportsListSignal(QList<Support*>)),
+            this, SLOT(storeRedundantSupportsList(QList<Support*>)));
+    connect(modelChecker, SIGNAL(modelStabilitySignal(bool)),
+            this, SLOT(storeModelStability(bool)));
+    connect(modelChecker, SIGNAL(mechanismModesSignal(QList<QVector<qreal> >)),
+            this, SLOT(storeMechanismModes(QList<QVector<qreal> >)));
+    connect(modelChecker, SIGNAL(finished()), this, SLOT(finishBackgroundCheck()));
+
+    modelChecker->setPriority(QThread::LowPriority);
+    modelChecker->start();
+}
+
+void Solver::storeCheckNote(QString note)
+{
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        mCheckedNote = note;
+    }
+}
+
+void Solver::storeRedundantBarsList(QList<Bar *> barsList)
+{
+    //Pointers of an outdated revision may be dangling and are never dereferenced
+
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        ModelIndex modelIndex(QList<Joint *>(), mBarsList);
+
+        foreach (Bar *bar, barsList)
+        {
+            mCheckedRedundantBars.append(modelIndex.barIndex(bar));
+        }
+    }
+}
+
+void Solver::storeRedundantSupportsList(QList<Support *> supportsList)
+{
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        ModelIndex modelIndex(QList<Joint *>(), QList<Bar *>(), mSupportsList);
+
+        foreach (Support *support, supportsList)
+        {
+            mCheckedRedundantSupports.append(modelIndex.supportIndex(support));
+        }
+    }
+}
+
+void Solver::storeModelStability(bool stability)
+{
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        mCheckedStability = stability;
+    }
+}
+
+void Solver::storeMechanismModes(QList<QVector<qreal> > modesList)
+{
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        mCheckedMechanismModes = modesList;
+    }
+}
+
+void Solver::finishBackgroundCheck()
+{
+    mIsBackgroundCheckRunning = false;
+
+    if (mBackgroundCheckRevision == mModelRevision)
+    {
+        mCheckedRevision  = mBackgroundCheckRevision;
+        mCheckedSignature = mBackgroundCheckSignature;
+    }
+    else if (mModelCheckRequired)
+    {
+        mBackgroundCheckTimer->start();
+    }
 }
 
 void Solver::setNote(QString note)
@@ -6699,8 +7095,33 @@ void Solver::setModelStability(bool stability)
     }
 }
 
+void Solver::setMechanismModes(QList<QVector<qreal> > modesList)
+{
+    mMechanismModesList = modesList;
+    mMechanismModeIndex = 0;
+    mModelViewer->setMechanismModes(mMechanismModesList);
+    mShowNextMechanismModeAction->setEnabled(!mMechanismModesList.isEmpty());
+
+    if (!mMechanismModesList.isEmpty())
+    {
+        emit modelSolutionSignal(ModelViewer::MECHANISM_MODE, mMechanismModeIndex);
+    }
+}
+
+void Solver::showNextMechanismMode()
+{
+    if (mMechanismModesList.isEmpty())
+    {
+        return;
+    }
+
+    mMechanismModeIndex = (mMechanismModeIndex + 1) % mMechanismModesList.size();
+    emit modelSolutionSignal(ModelViewer::MECHANISM_MODE, mMechanismModeIndex);
+}
+
 void Solver::enableLoadsEntry()
 {
+    mIsModelCheckRunning = false;
     setLoadsTableView(mLoadTypeListWidget->currentRow());
 
     int index = mSelectionTabWidget->currentIndex();
@@ -6714,6 +7135,13 @@ void Solver::enableLoadsEntry()
         setSolutionOptions();
         emit modelLoadSignal(ModelViewer::NO_LOAD);
     }
+
+    if (!mPendingSolutionResult.isNull())
+    {
+        restoreSolution();
+    }
+
+    emit modelCheckedSignal();
 }
 
 void Solver::setLoadsTableView(int index)
@@ -6822,7 +7250,7 @@ void Solver::setLoadsTableView(int index)
 
         if (mIsStable)
         {
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 mAddLoadPushButton->setEnabled(true);
                 mEditLoadPushButton->setEnabled(true);
@@ -6847,7 +7275,7 @@ void Solver::setLoadsTableView(int index)
 
         if (mIsStable)
         {
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 mAddLoadPushButton->setEnabled(true);
                 mEditLoadPushButton->setEnabled(true);
@@ -6872,7 +7300,7 @@ void Solver::setLoadsTableView(int index)
 
         if (mIsStable)
         {
-            if (mBarsStandardItemModel->columnCount() == 5)
+            if (mBarsTableModel->columnCount() == 5)
             {
                 mAddLoadPushButton->setEnabled(true);
                 mEditLoadPushButton->setEnabled(true);
@@ -6912,7 +7340,7 @@ void Solver::setLoadsTableView(int index)
 
 void Solver::setLoadDisplayOption(int index)
 {
-    bool checkA = (mBarsStandardItemModel->columnCount() == 5);
+    bool checkA = (mBarsTableModel->columnCount() == 5);
     bool checkB = (index == 0);
     bool checkC = mBarsList.isEmpty();
 
@@ -6991,7 +7419,7 @@ void Solver::setLoadDisplayOption(int index)
 
 void Solver::setLoadDisplayOption(bool checked)
 {
-    bool checkA = (mBarsStandardItemModel->columnCount() == 5);
+    bool checkA = (mBarsTableModel->columnCount() == 5);
     bool checkB = (mLoadTypeListWidget->currentRow() == 0);
     bool checkC = mBarsList.isEmpty();
 
@@ -7597,7 +8025,7 @@ void Solver::addSupportSettlement(int supportNumber, qreal settlement)
     mSupportSettlementsList.append(supportSettlement);
 
     Joint *joint    = support->supportJoint();
-    int jointNumber = mJointsList.indexOf(joint) + 1;
+    int jointNumber = mSupportsTableModel->jointNumber(joint);
 
     QList<QStandardItem *> standardItemsList;
     QStandardItem *standardItem;
@@ -7663,7 +8091,7 @@ void Solver::editSupportSettlement(int supportNumber, qreal settlement)
         currentSupportSettlement->setSettlementSupport(settlementSupport);
         currentSupportSettlement->setSettlement(settlement);
         Joint *joint    = settlementSupport->supportJoint();
-        int jointNumber = mJointsList.indexOf(joint) + 1;
+        int jointNumber = mSupportsTableModel->jointNumber(joint);
 
         int supportSettlementIndex = selectedSupportSettlements.first() - 1;
 
@@ -8679,7 +9107,7 @@ void Solver::setSolutionOptions()
     {
         mUpdateSelfWeightOption = false;
 
-        if (mBarsStandardItemModel->columnCount() == 5)
+        if (mBarsTableModel->columnCount() == 5)
         {
             if (mIsStable)
             {
@@ -8841,15 +9269,15 @@ void Solver::setSolutionTableView(int index)
 {
     if (index == 0)
     {
-        mSolutionsTableView->setModel(mJointDeflectionsStandardItemModel);
+        mSolutionsTableView->setModel(mJointDeflectionsTableModel);
     }
     else if (index == 1)
     {
-        mSolutionsTableView->setModel(mBarLoadsStandardItemModel);
+        mSolutionsTableView->setModel(mBarLoadsTableModel);
     }
     else if (index == 2)
     {
-        mSolutionsTableView->setModel(mSupportReactionsStandardItemModel);
+        mSolutionsTableView->setModel(mSupportReactionsTableModel);
     }
     else if (index == 3)
     {
@@ -8857,7 +9285,7 @@ void Solver::setSolutionTableView(int index)
     }
     else
     {
-        mSolutionsTableView->setModel(mJointDeflectionsStandardItemModel);
+        mSolutionsTableView->setModel(mJointDeflectionsTableModel);
     }
 
     mSolutionsTableView->setCornerButtonEnabled(false);
@@ -8900,7 +9328,7 @@ void Solver::solveModel()
         }
     }
 
-    if (mBarsStandardItemModel->columnCount() == 5)
+    if (mBarsTableModel->columnCount() == 5)
     {
         areaModulusOption = true;
     }
@@ -8981,20 +9409,17 @@ void Solver::solveModel()
                                                mInfluenceLoadResult,
                                                mUnitsAndLimits);
 
-    qRegisterMetaType< QList<qreal> >("QList<qreal>");
-
-    connect(modelSolver, SIGNAL(jointHorizontalDeflectionsSignal(QList<qreal>)),
-            this, SLOT(setJointHorizontalDeflectionsList(QList<qreal>)));
-    connect(modelSolver, SIGNAL(jointVerticalDeflectionsSignal(QList<qreal>)),
-            this, SLOT(setJointVerticalDeflectionsList(QList<qreal>)));
-    connect(modelSolver, SIGNAL(barLoadsSignal(QList<qreal>)), this, SLOT(setBarLoadsList(QList<qreal>)));
-    connect(modelSolver, SIGNAL(reactionHorizontalComponentsSignal(QList<qreal>)),
-            this, SLOT(setReactionHorizontalComponentsList(QList<qreal>)));
-    connect(modelSolver, SIGNAL(reactionVerticalComponentsSignal(QList<qreal>)),
-            this, SLOT(setReactionVerticalComponentsList(QList<qreal>)));
+    qRegisterMetaType< QSharedPointer<const SolutionResult> >("QSharedPointer<const SolutionResult>");
+    qRegisterMetaType< SolverStatistics >("SolverStatistics");
+
+    connect(modelSolver, SIGNAL(solutionSignal(QSharedPointer<const SolutionResult>)),
+            this, SLOT(setSolutionResult(QSharedPointer<const SolutionResult>)));
+    connect(modelSolver, SIGNAL(statisticsSignal(SolverStatistics)), this, SLOT(setSolverStatistics(SolverStatistics)));
     connect(modelSolver, SIGNAL(hasSolution()), this, SLOT(enableSolutionReset()));
     connect(modelSolver, SIGNAL(notesSignal(QString)), this, SLOT(setNote(QString)));
+    connect(modelSolver, SIGNAL(finished()), this, SLOT(finishSolution()));
 
+    mIsSolutionRunning = true;
     modelSolver->start();
 }
 
@@ -9033,9 +9458,9 @@ void Solver::setInfluenceLoadBarOptions(int index)
     {
         mInfluenceLoadBarComboBox->setEnabled(true);
 
-        foreach (Bar *bar, mBarsList)
+        for (int i = 0; i < mBarsList.size(); ++i)
         {
-            mInfluenceLoadBarComboBox->addItem(QString::number(mBarsList.indexOf(bar) + 1));
+            mInfluenceLoadBarComboBox->addItem(QString::number(i + 1));
         }
 
         mInfluenceLoadBarComboBox->setCurrentIndex(0);
@@ -9061,80 +9486,19 @@ void Solver::enableSolutionReset()
     setSolutionTableViewModels();
 }
 
-void Solver::setSolutionTableViewModels()
+void Solver::finishSolution()
 {
-    int count = mHorizontalDeflectionComponentsList.size();
-
-    mJointDeflectionsStandardItemModel->setRowCount(0);
-
-    for (int i = 0; i < count; ++i)
-    {
-        QStandardItem *standardItem;
-        QList<QStandardItem *> standardItemsList;
-        standardItem = new QStandardItem(QString::number(i + 1));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(mHorizontalDeflectionComponentsList.at(i), 'g', 6));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(mVerticalDeflectionComponentsList.at(i), 'g', 6));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        mJointDeflectionsStandardItemModel->appendRow(standardItemsList);
-    }
-
-    count = mBarLoadsList.size();
-
-    mBarLoadsStandardItemModel->setRowCount(0);
-
-    for (int i = 0; i < count; ++i)
-    {
-        QStandardItem *standardItem;
-        QList<QStandardItem *> standardItemsList;
-        standardItem = new QStandardItem(QString::number(i + 1));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(mBarLoadsList.at(i), 'g', 6));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        mBarLoadsStandardItemModel->appendRow(standardItemsList);
-    }
-
-    count = mReactionHorizontalComponentsList.size();
-
-    mSupportReactionsStandardItemModel->setRowCount(0);
+    mIsSolutionRunning = false;
+    emit modelSolvedSignal();
+}
 
-    for (int i = 0; i < count; ++i)
-    {
-        int supportNumber = i + 1;
-        Support *support  = mSupportsList.at(i);
-        Joint *joint      = support->supportJoint();
-        int jointNumber   = mJointsList.indexOf(joint) + 1;
-        QStandardItem *standardItem;
-        QList<QStandardItem *> standardItemsList;
-        standardItem = new QStandardItem(tr("%1 @ joint %2")
-                                         .arg(QString::number(supportNumber))
-                                         .arg(QString::number(jointNumber)));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(mReactionHorizontalComponentsList.at(i), 'g', 6));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        standardItem = new QStandardItem(QString::number(mReactionVerticalComponentsList.at(i), 'g', 6));
-        standardItem->setEditable(false);
-        standardItem->setTextAlignment(Qt::AlignCenter);
-        standardItemsList.append(standardItem);
-        mSupportReactionsStandardItemModel->appendRow(standardItemsList);
-    }
+void Solver::setSolutionTableViewModels()
+{
+    mJointDeflectionsTableModel->setSolutionResult(mSolutionResult);
+    mBarLoadsTableModel->setSolutionResult(mSolutionResult);
+    mSupportReactionsTableModel->setSolutionResult(mSolutionResult);
 
-    count = mInfluenceLoadResult->barsCount();
+    int count = mInfluenceLoadResult->barsCount();
 
     mInfluenceLoadResultsStandardItemModel->setRowCount(0);
 
@@ -9162,29 +9526,15 @@ void Solver::setSolutionTableViewModels()
     }
 }
 
-void Solver::setJointHorizontalDeflectionsList(QList<qreal> horizontalDeflectionComponentsList)
-{
-    mHorizontalDeflectionComponentsList = horizontalDeflectionComponentsList;
-}
-
-void Solver::setJointVerticalDeflectionsList(QList<qreal> verticalDeflectionComponentsList)
-{
-    mVerticalDeflectionComponentsList = verticalDeflectionComponentsList;
-}
-
-void Solver::setBarLoadsList(QList<qreal> barLoadsList)
-{
-    mBarLoadsList = barLoadsList;
-}
-
-void Solver::setReactionHorizontalComponentsList(QList<qreal> reactionHorizontalComponentsList)
+void Solver::setSolutionResult(QSharedPointer<const SolutionResult> solutionResult)
 {
-    mReactionHorizontalComponentsList = reactionHorizontalComponentsList;
+    mSolutionResult = solutionResult;
 }
 
-void Solver::setReactionVerticalComponentsList(QList<qreal> reactionVerticalComponentsList)
+void Solver::setSolverStatistics(SolverStatistics statistics)
 {
-    mReactionVerticalComponentsList = reactionVerticalComponentsList;
+    mSolverStatistics = statistics;
+    mSolverDiagnosticsDialog->setStatistics(mSolverStatistics);
 }
 
 void Solver::showScaleDeflectionsDialog()
@@ -9213,21 +9563,336 @@ void Solver::clearSolution()
     }
     else
     {
-        mHorizontalDeflectionComponentsList.clear();
-        mVerticalDeflectionComponentsList.clear();
-        mBarLoadsList.clear();
-        mReactionHorizontalComponentsList.clear();
-        mReactionVerticalComponentsList.clear();
-        mInfluenceLoadResult->resetParameters();
+        resetSolution();
+    }
+}
+
+void Solver::resetSolution()
+{
+    mSolutionResult.clear();
+    mInfluenceLoadResult->resetParameters();
+    mSolverStatistics = SolverStatistics();
+    mSolverDiagnosticsDialog->setStatistics(mSolverStatistics);
+
+    mHasSolution = false;
+    mSolutionInfluenceLoadName.clear();
+    mSolutionOptionComboBox->setCurrentIndex(-1);
+    mSolutionOptionComboBox->setEnabled(false);
+    mSolvePushButton->setEnabled(true);
+    mClearPushButton->setEnabled(false);
+    mReportPushButton->setEnabled(false);
+    setSolutionTableViewModels();
+}
+
+QVector<qint32> Solver::solutionOptions() const
+{
+    QVector<qint32> options;
+    options.append(qint32(mJointLoadsCheckBox->isEnabled() && mJointLoadsCheckBox->isChecked()));
+    options.append(qint32(mSelfWeightCheckBox->isEnabled() && mSelfWeightCheckBox->isChecked()));
+    options.append(qint32(mSupportSettlementsCheckBox->isEnabled() && mSupportSettlementsCheckBox->isChecked()));
+    options.append(qint32(mThermalEffectsCheckBox->isEnabled() && mThermalEffectsCheckBox->isChecked()));
+    options.append(qint32(mFabricationErrorsCheckBox->isEnabled() && mFabricationErrorsCheckBox->isChecked()));
+    options.append(qint32(mInfluenceLoadsCheckBox->isEnabled() && mInfluenceLoadsCheckBox->isChecked()));
+
+    return options;
+}
+
+QByteArray Solver::solutionSignature(const QVector<qint32> &options, const QString &influenceLoadName) const
+{
+    //The model check signature covers joints, bar ends and supports, and the rest is what ModelSolver reads besides
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    ModelIndex modelIndex(mJointsList, mBarsList, mSupportsList);
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+
+    //Signatures are kept with cached solutions, so the encoding must not follow the Qt version
+    out.setVersion(QDataStream::Qt_5_4);
+
+    out << modelCheckSignature();
+    out << mUnitsAndLimits.system() << mUnitsAndLimits.coordinateUnit() << mUnitsAndLimits.areaUnit();
+    out << mUnitsAndLimits.modulusUnit() << mUnitsAndLimits.unitWeightUnit() << mUnitsAndLimits.loadUnit();
+    out << mUnitsAndLimits.supportSettlementUnit() << mUnitsAndLimits.temperatureChangeUnit();
+    out << mUnitsAndLimits.thermalCoefficientUnit() << mUnitsAndLimits.lengthErrorUnit();
+    out << qint32(mBarsTableModel->columnCount());
+
+    foreach (Bar *bar, mBarsList)
+    {
+        out << bar->area() << bar->modulus() << bar->factor() << bar->unitWeight();
+    }
+
+    out << qint32(mJointLoadsList.size());
+
+    foreach (JointLoad *load, mJointLoadsList)
+    {
+        out << qint32(modelIndex.jointIndex(load->loadJoint()));
+        out << load->horizontalComponent() << load->verticalComponent() << load->position();
+    }
+
+    out << qint32(mSupportSettlementsList.size());
+
+    foreach (SupportSettlement *supportSettlement, mSupportSettlementsList)
+    {
+        out << qint32(modelIndex.supportIndex(supportSettlement->settlementSupport()));
+        out << supportSettlement->settlement();
+    }
+
+    out << qint32(mThermalEffectsList.size());
+
+    foreach (ThermalEffect *thermalEffect, mThermalEffectsList)
+    {
+        out << qint32(modelIndex.barIndex(thermalEffect->thermalEffectBar()));
+        out << thermalEffect->temperatureChange() << thermalEffect->thermalCoefficient();
+    }
+
+    out << qint32(mFabricationErrorsList.size());
+
+    foreach (FabricationError *fabricationError, mFabricationErrorsList)
+    {
+        out << qint32(modelIndex.barIndex(fabricationError->fabricationErrorBar()));
+        out << fabricationError->lengthError();
+    }
+
+    out << qint32(mInfluenceLoadsList.size());
+
+    foreach (InfluenceLoad *influenceLoad, mInfluenceLoadsList)
+    {
+        out << influenceLoad->name() << influenceLoad->direction() << influenceLoad->path();
+        out << influenceLoad->pointLoads() << influenceLoad->pointLoadPositions();
+    }
+
+    out << options << influenceLoadName;
+
+    hash.addData(data);
+
+    return hash.result();
+}
+
+void Solver::writeSolution(ModelFile &modelFile) const
+{
+    QVector<qint32> options = solutionOptions();
+
+    QStringList texts;
+    texts.append(mSolutionInfluenceLoadName);
+    texts.append(mSolutionResult->note());
+
+    QString fingerprint = QString::fromLatin1(solutionSignature(options, mSolutionInfluenceLoadName).toHex());
+
+    modelFile.setTexts(ModelFile::SOLUTION_FINGERPRINT, QStringList(fingerprint));
+    modelFile.setIntegers(ModelFile::SOLUTION_OPTIONS, options);
+    modelFile.setTexts(ModelFile::SOLUTION_TEXTS, texts);
+    modelFile.setReals(ModelFile::JOINT_HORIZONTAL_DEFLECTIONS, mSolutionResult->horizontalDeflectionComponents());
+    modelFile.setReals(ModelFile::JOINT_VERTICAL_DEFLECTIONS, mSolutionResult->verticalDeflectionComponents());
+    modelFile.setReals(ModelFile::BAR_LOADS, mSolutionResult->barLoads());
+    modelFile.setReals(ModelFile::REACTION_HORIZONTAL_COMPONENTS, mSolutionResult->reactionHorizontalComponents());
+    modelFile.setReals(ModelFile::REACTION_VERTICAL_COMPONENTS, mSolutionResult->reactionVerticalComponents());
+
+    QVector<qint32> reactionJoints;
+    reactionJoints.reserve(mSolutionResult->reactionsCount());
+
+    for (int i = 0; i < mSolutionResult->reactionsCount(); ++i)
+    {
+        reactionJoints.append(qint32(mSolutionResult->reactionJointNumber(i)));
+    }
+
+    modelFile.setIntegers(ModelFile::REACTION_JOINTS, reactionJoints);
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Influence load ordinates, row by row, and the envelope of each bar
+    // -----------------------------------------------------------------------------------------------------------------
+
+    int barsCount      = mInfluenceLoadResult->barsCount();
+    int ordinatesCount = mInfluenceLoadResult->ordinatesCount();
+
+    if (barsCount == 0)
+    {
+        return;
+    }
+
+    QVector<qint32> sizes;
+    sizes.append(qint32(barsCount));
+    sizes.append(qint32(ordinatesCount));
+    sizes.append(qint32(mInfluenceLoadResult->solvedOrdinatesCount()));
+    sizes.append(qint32(mInfluenceLoadResult->precision()));
+
+    QVector<qreal> ordinates;
+    QVector<qreal> minLoads;
+    QVector<qreal> maxLoads;
+    QStringList minLoadPositions;
+    QStringList maxLoadPositions;
+
+    ordinates.reserve(barsCount * ordinatesCount);
+    minLoads.reserve(barsCount);
+    maxLoads.reserve(barsCount);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        InfluenceLoadOrdinatesSpan barOrdinates = mInfluenceLoadResult->barOrdinates(i);
+
+        for (int j = 0; j < barOrdinates.size(); ++j)
+        {
+            ordinates.append(barOrdinates.at(j));
+        }
+
+        minLoads.append(mInfluenceLoadResult->minLoad(i));
+        minLoadPositions.append(mInfluenceLoadResult->minloadPosition(i));
+        maxLoads.append(mInfluenceLoadResult->maxLoad(i));
+        maxLoadPositions.append(mInfluenceLoadResult->maxloadPosition(i));
+    }
+
+    modelFile.setIntegers(ModelFile::INFLUENCE_RESULT_SIZES, sizes);
+    modelFile.setReals(ModelFile::INFLUENCE_RESULT_ORDINATES, ordinates);
+    modelFile.setReals(ModelFile::INFLUENCE_RESULT_MIN_LOADS, minLoads);
+    modelFile.setTexts(ModelFile::INFLUENCE_RESULT_MIN_LOAD_POSITIONS, minLoadPositions);
+    modelFile.setReals(ModelFile::INFLUENCE_RESULT_MAX_LOADS, maxLoads);
+    modelFile.setTexts(ModelFile::INFLUENCE_RESULT_MAX_LOAD_POSITIONS, maxLoadPositions);
+}
+
+bool Solver::readSolution(const ModelFile &modelFile)
+{
+    QVector<qint32> options   = modelFile.integers(ModelFile::SOLUTION_OPTIONS);
+    QStringList texts         = modelFile.texts(ModelFile::SOLUTION_TEXTS);
+    QString influenceLoadName = texts.value(0);
+    QString fingerprint       = modelFile.texts(ModelFile::SOLUTION_FINGERPRINT).value(0);
+
+    //A solution of other inputs than those in the file is left out, and the model has to be solved again
+
+    if (options.size() != solutionOptions().size())
+    {
+        return false;
+    }
+
+    if (fingerprint != QString::fromLatin1(solutionSignature(options, influenceLoadName).toHex()))
+    {
+        return false;
+    }
+
+    QVector<qreal> horizontalDeflections = modelFile.reals(ModelFile::JOINT_HORIZONTAL_DEFLECTIONS);
+    QVector<qreal> verticalDeflections   = modelFile.reals(ModelFile::JOINT_VERTICAL_DEFLECTIONS);
+    QVector<qreal> barLoads              = modelFile.reals(ModelFile::BAR_LOADS);
+    QVector<qreal> reactionHorizontals   = modelFile.reals(ModelFile::REACTION_HORIZONTAL_COMPONENTS);
+    QVector<qreal> reactionVerticals     = modelFile.reals(ModelFile::REACTION_VERTICAL_COMPONENTS);
+    QVector<qint32> reactionJoints       = modelFile.integers(ModelFile::REACTION_JOINTS);
+
+    bool checkA = horizontalDeflections.isEmpty() || (horizontalDeflections.size() == mJointsList.size());
+    bool checkB = (verticalDeflections.size() == horizontalDeflections.size());
+    bool checkC = barLoads.isEmpty() || (barLoads.size() == mBarsList.size());
+    bool checkD = (reactionVerticals.size() == reactionHorizontals.size());
+    bool checkE = (reactionJoints.size() == reactionHorizontals.size());
+
+    if (!(checkA && checkB && checkC && checkD && checkE))
+    {
+        return false;
+    }
 
-        mHasSolution = false;
-        mSolutionInfluenceLoadName.clear();
-        mSolutionOptionComboBox->setCurrentIndex(-1);
-        mSolutionOptionComboBox->setEnabled(false);
-        mSolvePushButton->setEnabled(true);
-        mClearPushButton->setEnabled(false);
-        mReportPushButton->setEnabled(false);
-        setSolutionTableViewModels();
+    QVector<qint32> sizes = modelFile.integers(ModelFile::INFLUENCE_RESULT_SIZES);
+
+    if (sizes.size() == 4)
+    {
+        int barsCount      = sizes.at(0);
+        int ordinatesCount = sizes.at(1);
+
+        QVector<qreal> ordinates     = modelFile.reals(ModelFile::INFLUENCE_RESULT_ORDINATES);
+        QVector<qreal> minLoads      = modelFile.reals(ModelFile::INFLUENCE_RESULT_MIN_LOADS);
+        QStringList minLoadPositions = modelFile.texts(ModelFile::INFLUENCE_RESULT_MIN_LOAD_POSITIONS);
+        QVector<qreal> maxLoads      = modelFile.reals(ModelFile::INFLUENCE_RESULT_MAX_LOADS);
+        QStringList maxLoadPositions = modelFile.texts(ModelFile::INFLUENCE_RESULT_MAX_LOAD_POSITIONS);
+
+        bool checkF = (barsCount == mBarsList.size()) && (ordinatesCount >= 0);
+        bool checkG = (ordinates.size() == barsCount * ordinatesCount);
+        bool checkH = (minLoads.size() == barsCount) && (minLoadPositions.size() == barsCount);
+        bool checkI = (maxLoads.size() == barsCount) && (maxLoadPositions.size() == barsCount);
+
+        if (!(checkF && checkG && checkH && checkI))
+        {
+            return false;
+        }
+
+        InfluenceLoadResult::Precision precision = InfluenceLoadResult::DOUBLE_PRECISION;
+
+        if (sizes.at(3) == qint32(InfluenceLoadResult::SINGLE_PRECISION))
+        {
+            precision = InfluenceLoadResult::SINGLE_PRECISION;
+        }
+
+        mInfluenceLoadResult->setParameters(barsCount, ordinatesCount, precision);
+
+        for (int i = 0; i < barsCount; ++i)
+        {
+            for (int j = 0; j < ordinatesCount; ++j)
+            {
+                mInfluenceLoadResult->setOrdinate(i, j, ordinates.at(i * ordinatesCount + j));
+            }
+
+            mInfluenceLoadResult->setMinLoad(i, minLoads.at(i));
+            mInfluenceLoadResult->setMinLoadPosition(i, minLoadPositions.at(i));
+            mInfluenceLoadResult->setMaxLoad(i, maxLoads.at(i));
+            mInfluenceLoadResult->setMaxLoadPosition(i, maxLoadPositions.at(i));
+        }
+
+        mInfluenceLoadResult->setSolvedOrdinatesCount(sizes.at(2));
+    }
+
+    SolutionResult *solutionResult = new SolutionResult(horizontalDeflections,
+                                                        verticalDeflections,
+                                                        barLoads,
+                                                        reactionHorizontals,
+                                                        reactionVerticals,
+                                                        reactionJoints,
+                                                        influenceLoadName,
+                                                        mBarsTableModel->columnCount() == 5,
+                                                        texts.value(1));
+
+    mPendingSolutionResult            = QSharedPointer<const SolutionResult>(solutionResult);
+    mPendingSolutionOptions           = options;
+    mPendingSolutionInfluenceLoadName = influenceLoadName;
+    mPendingSolutionRevision          = mModelRevision;
+
+    return true;
+}
+
+void Solver::restoreSolution()
+{
+    QSharedPointer<const SolutionResult> solutionResult = mPendingSolutionResult;
+    mPendingSolutionResult.clear();
+
+    if (!mIsStable || (mPendingSolutionRevision != mModelRevision) || mHasSolution)
+    {
+        if (!mHasSolution)
+        {
+            mInfluenceLoadResult->resetParameters();
+        }
+
+        return;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Tick the load cases the solution was solved for, as solveModel would have found them
+    // -----------------------------------------------------------------------------------------------------------------
+
+    setSolutionOptions();
+
+    mJointLoadsCheckBox->setChecked(mJointLoadsCheckBox->isEnabled() && (mPendingSolutionOptions.at(0) != 0));
+    mSelfWeightCheckBox->setChecked(mSelfWeightCheckBox->isEnabled() && (mPendingSolutionOptions.at(1) != 0));
+    mSupportSettlementsCheckBox->setChecked(mSupportSettlementsCheckBox->isEnabled()
+                                            && (mPendingSolutionOptions.at(2) != 0));
+    mThermalEffectsCheckBox->setChecked(mThermalEffectsCheckBox->isEnabled() && (mPendingSolutionOptions.at(3) != 0));
+    mFabricationErrorsCheckBox->setChecked(mFabricationErrorsCheckBox->isEnabled()
+                                           && (mPendingSolutionOptions.at(4) != 0));
+    mInfluenceLoadsCheckBox->setChecked(mInfluenceLoadsCheckBox->isEnabled() && (mPendingSolutionOptions.at(5) != 0));
+
+    if (mInfluenceLoadsCheckBox->isChecked())
+    {
+        mInfluenceLoadsComboBox->setCurrentIndex(mInfluenceLoadsComboBox->findText(mPendingSolutionInfluenceLoadName));
+        mSolutionInfluenceLoadName = mPendingSolutionInfluenceLoadName;
+    }
+
+    mSolutionResult = solutionResult;
+    enableSolutionReset();
+
+    if (mSelectionTabWidget->currentIndex() != 4)
+    {
+        emit modelSolutionSignal(ModelViewer::NO_SOLUTION, 0);
     }
 }
 
@@ -9242,47 +9907,54 @@ void Solver::reportSolution()
     if (!exportDirectory.isEmpty())
     {
         mLastReportLocation = exportDirectory;
-        QString title;
+        exportReport(exportDirectory);
+    }
+}
 
-        if (!mCurrentFile.isEmpty())
-        {
-            title = strippedName(mCurrentFile);
-            title.remove(tr(".ttmdl"));
-        }
-        else
-        {
-            title = tr("untitled");
-        }
-
-        HtmlReportExporter exporter(title,
-                                    &mDescriptionText,
-                                    exportDirectory,
-                                    &mJointsList,
-                                    &mBarsList,
-                                    mBarsStandardItemModel,
-                                    &mSupportsList,
-                                    mModelViewer,
-                                    mJointLoadsCheckBox,
-                                    mSelfWeightCheckBox,
-                                    mSupportSettlementsCheckBox,
-                                    mThermalEffectsCheckBox,
-                                    mFabricationErrorsCheckBox,
-                                    mInfluenceLoadsCheckBox,
-                                    &mJointLoadsList,
-                                    &mSupportSettlementsList,
-                                    &mThermalEffectsList,
-                                    &mFabricationErrorsList,
-                                    &mInfluenceLoadsList,
-                                    &mHorizontalDeflectionComponentsList,
-                                    &mVerticalDeflectionComponentsList,
-                                    &mBarLoadsList,
-                                    &mReactionHorizontalComponentsList,
-                                    &mReactionVerticalComponentsList,
-                                    &mSolutionInfluenceLoadName,
-                                    mInfluenceLoadResult,
-                                    &mUnitsAndLimits,
-                                    this);
-
-        exporter.exportHtmlReport();
+bool Solver::exportReport(const QString &directory)
+{
+    if (!mHasSolution)
+    {
+        return false;
     }
+
+    QString title;
+
+    if (!mCurrentFile.isEmpty())
+    {
+        title = strippedName(mCurrentFile);
+        title.remove(tr(".ttmdl"));
+    }
+    else
+    {
+        title = tr("untitled");
+    }
+
+    HtmlReportExporter exporter(title,
+                                &mDescriptionText,
+                                directory,
+                                &mJointsList,
+                                &mBarsList,
+                                mBarsTableModel,
+                                &mSupportsList,
+                                mModelViewer,
+                                mJointLoadsCheckBox,
+                                mSelfWeightCheckBox,
+                                mSupportSettlementsCheckBox,
+                                mThermalEffectsCheckBox,
+                                mFabricationErrorsCheckBox,
+                                mInfluenceLoadsCheckBox,
+                                &mJointLoadsList,
+                                &mSupportSettlementsList,
+                                &mThermalEffectsList,
+                                &mFabricationErrorsList,
+                                &mInfluenceLoadsList,
+                                mSolutionResult,
+                                &mSolutionInfluenceLoadName,
+                                mInfluenceLoadResult,
+                                &mUnitsAndLimits,
+                                this);
+
+    exporter.exportHtmlReport();
+    return true;
 }
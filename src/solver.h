@@ -26,36 +26,47 @@
 #include <QAction>
 #include <QCheckBox>
 #include <QCloseEvent>
+#include <QCryptographicHash>
 #include <QDockWidget>
+#include <QEventLoop>
 #include <QFileDialog>
 #include <QGridLayout>
 #include <QGroupBox>
+#include <QHash>
 #include <QHeaderView>
+#include <QInputDialog>
 #include <QLabel>
 #include <QListWidget>
+#include <QLockFile>
 #include <QMainWindow>
 #include <QMenu>
 #include <QMenuBar>
 #include <QMessageBox>
+#include <QPair>
 #include <QProgressBar>
 #include <QPushButton>
 #include <QRadioButton>
 #include <QResizeEvent>
 #include <QSaveFile>
 #include <QSettings>
+#include <QSharedPointer>
 #include <QStandardItemModel>
 #include <QStatusBar>
 #include <QTableView>
 #include <QTabWidget>
+#include <QTimer>
 #include <QToolBar>
 #include <QToolButton>
+#include <QUuid>
 #include <QVBoxLayout>
+#include <QVector>
 
 #include "bar.h"
 #include "fabricationerror.h"
 #include "joint.h"
 #include "jointload.h"
 #include "point.h"
+#include "spatialindex.h"
 #include "support.h"
 #include "supportsettlement.h"
 #include "thermaleffect.h"
@@ -87,16 +98,29 @@
 #include "editsupportsettlementsdialog.h"
 #include "editthermaleffectsdialog.h"
 #include "exportmodelimagedialog.h"
+#include "generatetrussdialog.h"
 #include "htmlreportexporter.h"
 #include "influenceloadresult.h"
 #include "modelareadialog.h"
 #include "modelchecker.h"
+#include "modelfile.h"
+#include "modelfilewriter.h"
+#include "modelindex.h"
+#include "modeljournal.h"
 #include "modelsolver.h"
+#include "modeltablefile.h"
+#include "modeltablemodel.h"
 #include "modelviewer.h"
 #include "notesdialog.h"
+#include "parametrictruss.h"
 #include "scaledeflectionsdialog.h"
 #include "scaleforcesdialog.h"
+#include "scriptconsoledialog.h"
 #include "scrollarea.h"
+#include "solutionresult.h"
+#include "solutiontablemodel.h"
+#include "solverdiagnosticsdialog.h"
+#include "solverstatistics.h"
 #include "unitsandlimits.h"
 #include "unitsandsetupdialog.h"
 
@@ -111,6 +135,71 @@ class Solver : public QMainWindow
 
         bool loadFile(const QString &fileName);
 
+        //Save and return once the model file is written
+        bool saveFile(const QString &fileName);
+
+        //Offer to recover the models of autosave journals that no running window holds
+        void recoverAutosaves();
+
+        //Model lists read from CSV or JSON Lines tables into an empty model, one table to a file
+        bool importTables(const QStringList &fileNames);
+
+        //Model lists, and the solution when there is one, written as a table file each to a directory
+        bool exportTables(const QString &directory, ModelTableFile::Format format);
+
+        //Edits made while a transaction is open leave the joint renumbering, the dialog options, the model check
+        //and the viewer as they are, with the tables not repainting. The outermost commit publishes them once.
+        //Joints keep the numbers they were added with until then.
+        void beginEditTransaction();
+        void commitEditTransaction();
+
+        const QList<Joint *> &jointsList() const;
+        const QList<Bar *> &barsList() const;
+        const QList<Support *> &supportsList() const;
+        QSharedPointer<const SolutionResult> solutionResult() const;
+        const SolverStatistics &solverStatistics() const;
+
+        //Bars take an area, modulus and unit weight, or else a factor. The option can change until bars are added.
+        bool areaModulusOption() const;
+        bool setAxialRigidityOption(bool areaModulusOption);
+
+        //Model building for scripts, without dialogs or selections. The number of the appended joint, bar or first
+        //truss joint is returned, or zero when the edit is not valid. Inside an edit transaction the numbers hold
+        //until the commit renumbers the joints.
+        int appendJoint(qreal xCoordinate, qreal yCoordinate);
+        int appendBar(int   firstJointNumber,
+                      int   secondJointNumber,
+                      qreal area,
+                      qreal modulus,
+                      qreal factor,
+                      qreal unitWeight);
+        bool appendSupport(int                         jointNumber,
+                           UnitsAndLimits::SupportType type,
+                           qreal                       angle);
+        bool appendJointLoad(int            jointNumber,
+                             qreal          horizontalComponent,
+                             qreal          verticalComponent,
+                             const QString &position);
+        int appendTruss(const ParametricTruss &truss);
+
+        //Check and solve the model with no edit transaction open, returning once the checker or solver thread has
+        //finished. Loads can only be applied to a stable model, and a solve replaces any solution the model has.
+        bool checkModelAndWait();
+        bool solveModelAndWait(bool           jointLoads,
+                               bool           selfWeight,
+                               bool           supportSettlements,
+                               bool           thermalEffects,
+                               bool           fabricationErrors,
+                               const QString &influenceLoadName = QString());
+
+        bool exportReport(const QString &directory);
+
+        //Quiet time after a model edit before the model is checked in the background
+        static const int kBackgroundCheckDelay = 500;
+
+        //Milliseconds between autosaves of a modified model
+        static const int kAutosaveInterval = 60000;
+
     protected:
         void closeEvent(QCloseEvent *event);
 
@@ -120,6 +209,12 @@ class Solver : public QMainWindow
         void updateModelSignal();
         void modelLoadSignal(ModelViewer::LoadDisplayOption option);
         void modelSolutionSignal(ModelViewer::SolutionDisplayOption option, int influenceLoadBarIndex);
+        void modelCheckedSignal();
+        void modelSolvedSignal();
+        void modelWrittenSignal();
+
+        //Emitted when the joints are renumbered by position, with the new position of each joint at its old one
+        void jointsRenumberedSignal(QVector<int> jointPositions);
 
     private:
         void initializeUiComponents();
@@ -139,11 +234,85 @@ class Solver : public QMainWindow
         void readSettings();
         void writeSettings();
         bool promptForSave();
-        bool saveFile(const QString &fileName);
         void setCurrentFile(const QString &fileName);
         void updateRecentFileActions();
         QString strippedName(const QString &fullFileName);
 
+        //Model file sections to and from the model lists, shared by the model files and the table files
+        void loadModelFile(const ModelFile &modelFile);
+        void fillModelFile(ModelFile &modelFile) const;
+
+        //Snapshot the model and write it on a writer thread, waiting for any write already running to finish first
+        void startSave(const QString &fileName);
+        bool waitForSave();
+        void waitForWriter();
+
+        void closeJournal();
+
+        void invalidateModelCheck();
+        QByteArray modelCheckSignature() const;
+
+        void resetSolution();
+
+        //Load cases ticked for the solution, in the order of the solution check boxes
+        QVector<qint32> solutionOptions() const;
+
+        //Everything a solution is solved from: the model, its loads and units, and the load cases solved for
+        QByteArray solutionSignature(const QVector<qint32> &options, const QString &influenceLoadName) const;
+
+        void writeSolution(ModelFile &modelFile) const;
+        bool readSolution(const ModelFile &modelFile);
+        void restoreSolution();
+
+        //Keeps an edit transaction open for its lifetime, in the manner of QMutexLocker
+        class EditTransaction
+        {
+            public:
+                explicit EditTransaction(Solver *solver);
+
+                ~EditTransaction();
+
+            private:
+                Solver *mSolver;
+        };
+
+        void updateJointOptions();
+
+        void invalidateSpatialIndex();
+        void updateSpatialIndex();
+        void indexJoint(int jointIndex);
+        void indexBar(int barIndex);
+
+        //Placement checks against the joints and bars of the model through the spatial index. Flagged joints or
+        //bars are left out, as those being moved by an edit.
+        bool hasJointNear(qreal x, qreal y, const QVector<bool> &skippedJoints = QVector<bool>());
+        bool hasBarThrough(qreal x, qreal y, const QVector<bool> &skippedBars = QVector<bool>());
+        bool hasJointOnBar(qreal x1,
+                           qreal y1,
+                           qreal x2,
+                           qreal y2);
+        bool hasOverlappingBar(qreal               x1,
+                               qreal               y1,
+                               qreal               x2,
+                               qreal               y2,
+                               const QVector<bool> &skippedBars = QVector<bool>());
+        int jointAt(qreal x, qreal y);
+
+        static bool isPointOnBar(qreal x,
+                                 qreal y,
+                                 qreal x1,
+                                 qreal y1,
+                                 qreal x2,
+                                 qreal y2);
+        static bool isBarOverlap(qreal firstX1,
+                                 qreal firstY1,
+                                 qreal firstX2,
+                                 qreal firstY2,
+                                 qreal secondX1,
+                                 qreal secondY1,
+                                 qreal secondX2,
+                                 qreal secondY2);
+
     private slots:
         void updateModelViewer();
         void newFile();
@@ -151,6 +320,11 @@ class Solver : public QMainWindow
         bool promptForOpenFileName();
         bool save();
         bool saveAs();
+        void importData();
+        void exportData();
+        void autosave();
+        void storeSaveResult(QString fileName, bool isWritten, QString errorString);
+        void finishWrite();
         void openRecentFile();
         void clearRecentFileActions();
         void setUnits();
@@ -160,7 +334,10 @@ class Solver : public QMainWindow
         void showAboutQtDialog();
         void showSelectionPanel();
         void showNotes();
+        void showSolverDiagnostics();
         void showModelAreaDialog();
+        void showGenerateTrussDialog();
+        void showScriptConsole();
         void showExportModelImageDialog();
     
         void showAddJointsDialog();
@@ -184,6 +361,8 @@ class Solver : public QMainWindow
                        QList<int> selectedJoints);
         void deleteJoints();
     
+        void generateTruss(const ParametricTruss &truss);
+    
         void showAddBarsDialog();
         void showEditBarsDialog();
         void showDeleteBarsDialog();
@@ -253,6 +432,15 @@ class Solver : public QMainWindow
         void setRedundantSupportsList(QList<Support *> supportsList);
         void setModelStability(bool stability);
         void enableLoadsEntry();
+        void startBackgroundCheck();
+        void storeCheckNote(QString note);
+        void storeRedundantBarsList(QList<Bar *> barsList);
+        void storeRedundantSupportsList(QList<Support *> supportsList);
+        void storeModelStability(bool stability);
+        void storeMechanismModes(QList<QVector<qreal> > modesList);
+        void finishBackgroundCheck();
+        void setMechanismModes(QList<QVector<qreal> > modesList);
+        void showNextMechanismMode();
     
         void setLoadsTableView(int index);
         void setLoadDisplayOption(int index);
@@ -308,14 +496,13 @@ class Solver : public QMainWindow
         void setInfluenceLoadBarOptions(int index);
         void enableSolutionReset();
         void setSolutionTableViewModels();
-        void setJointHorizontalDeflectionsList(QList<qreal> horizontalDeflectionComponentsList);
-        void setJointVerticalDeflectionsList(QList<qreal> verticalDeflectionComponentsList);
-        void setBarLoadsList(QList<qreal> barLoadsList);
-        void setReactionHorizontalComponentsList(QList<qreal> reactionHorizontalComponentsList);
-        void setReactionVerticalComponentsList(QList<qreal> reactionVerticalComponentsList);
+        void setSolutionResult(QSharedPointer<const SolutionResult> solutionResult);
+        void setSolverStatistics(SolverStatistics statistics);
     
         void showScaleDeflectionsDialog();
     
+        void finishSolution();
+    
         void clearSolution();
         void reportSolution();
 
@@ -383,31 +570,42 @@ class Solver : public QMainWindow
         QPushButton *mReportPushButton;
         QTableView  *mSolutionsTableView;
     
-        UnitsAndLimits         mUnitsAndLimits;
-        QString                mDescriptionText;
-        ScrollArea             *mScrollArea;
-        ModelViewer            *mModelViewer;
-        QLabel                 *mCoordinatesLabel;
-        NotesDialog            *mNotesDialog;
-        ModelAreaDialog        *mModelAreaDialog;
-        ExportModelImageDialog *mExportModelImageDialog;
+        UnitsAndLimits          mUnitsAndLimits;
+        QString                 mDescriptionText;
+        ScrollArea              *mScrollArea;
+        ModelViewer             *mModelViewer;
+        QLabel                  *mCoordinatesLabel;
+        NotesDialog             *mNotesDialog;
+        SolverDiagnosticsDialog *mSolverDiagnosticsDialog;
+        ModelAreaDialog         *mModelAreaDialog;
+        GenerateTrussDialog     *mGenerateTrussDialog;
+        ScriptConsoleDialog     *mScriptConsoleDialog;
+        ExportModelImageDialog  *mExportModelImageDialog;
     
         QAction *mNewAction;
         QAction *mOpenAction;
         QAction *mSaveAction;
         QAction *mSaveAsAction;
+        QAction *mSaveSolutionAction;
+        QAction *mCompressModelFilesAction;
+        QAction *mImportDataAction;
+        QAction *mExportDataAction;
         QAction *mExportModelImageAction;
         QAction *mExitAction;
         QAction *mSelectionPanelAction;
         QAction *mShowNotesAction;
+        QAction *mShowSolverDiagnosticsAction;
         QAction *mUnitsAction;
         QAction *mSetModelAreaAction;
+        QAction *mGenerateTrussAction;
+        QAction *mScriptConsoleAction;
         QAction *mShowHideAxesAction;
         QAction *mShowHideJointNumberAction;
         QAction *mShowHideBarNumberAction;
         QAction *mScaleForcesAction;
         QAction *mScaleDeflectionsAction;
         QAction *mCheckModelAction;
+        QAction *mShowNextMechanismModeAction;
         QAction *mHelpAction;
         QAction *mAboutTrussTablesAction;
         QAction *mAboutQtAction;
@@ -462,18 +660,37 @@ class Solver : public QMainWindow
         QList<ThermalEffect *>     mThermalEffectsList;
         QList<FabricationError *>  mFabricationErrorsList;
         QList<InfluenceLoad *>     mInfluenceLoadsList;
-    
-        QStandardItemModel *mJointsStandardItemModel;
-        QStandardItemModel *mBarsStandardItemModel;
-        QStandardItemModel *mSupportsStandardItemModel;
+
+        //Uniform grid over the joints and bars by their positions in the lists, extended as joints and bars are
+        //added and rebuilt on the next placement check after any other edit
+        SpatialIndex mSpatialIndex;
+        bool         mIsSpatialIndexValid;
+
+        int  mEditTransactionDepth;
+        bool mIsNormalizationPending;
+        bool mIsJointOptionsUpdatePending;
+        bool mIsModelCheckPending;
+        bool mIsViewerUpdatePending;
+
+        //Extent of the joints of the open edit transaction, kept up to date by appendJoint so that it does not scan
+        //the joints for every joint appended, and dropped with the spatial index or when the transaction commits
+        bool  mIsJointsExtentValid;
+        qreal mJointsXMin;
+        qreal mJointsXMax;
+        qreal mJointsYMin;
+        qreal mJointsYMax;
+    
+        ModelTableModel    *mJointsTableModel;
+        ModelTableModel    *mBarsTableModel;
+        ModelTableModel    *mSupportsTableModel;
         QStandardItemModel *mJointLoadsStandardItemModel;
         QStandardItemModel *mSupportSettlementsStandardItemModel;
         QStandardItemModel *mThermalEffectsStandardItemModel;
         QStandardItemModel *mFabricationErrorsStandardItemModel;
         QStandardItemModel *mInfluenceLoadsStandardItemModel;
-        QStandardItemModel *mJointDeflectionsStandardItemModel;
-        QStandardItemModel *mBarLoadsStandardItemModel;
-        QStandardItemModel *mSupportReactionsStandardItemModel;
+        SolutionTableModel *mJointDeflectionsTableModel;
+        SolutionTableModel *mBarLoadsTableModel;
+        SolutionTableModel *mSupportReactionsTableModel;
         QStandardItemModel *mInfluenceLoadResultsStandardItemModel;
     
         bool             mModelCheckRequired;
@@ -487,16 +704,40 @@ class Solver : public QMainWindow
         QList<Bar *>     mRedundantBarsList;
         QList<Support *> mRedundantSupportsList;
         bool             mIsStable;
-    
-        QList<qreal>        mHorizontalDeflectionComponentsList;
-        QList<qreal>        mVerticalDeflectionComponentsList;
-        QList<qreal>        mBarLoadsList;
-        QList<qreal>        mReactionHorizontalComponentsList;
-        QList<qreal>        mReactionVerticalComponentsList;
-        InfluenceLoadResult *mInfluenceLoadResult;
+
+        //Zero-energy modes of the last unstable model checked, drawn one at a time as deflected shapes
+        QList<QVector<qreal> > mMechanismModesList;
+        int                    mMechanismModeIndex;
+
+        //Results of the background check of the model revision it ran on, kept as bar and support indices and
+        //reused for any later revision with the same signature
+        QTimer                 *mBackgroundCheckTimer;
+        quint64                mModelRevision;
+        quint64                mBackgroundCheckRevision;
+        quint64                mCheckedRevision;
+        bool                   mIsBackgroundCheckRunning;
+        QByteArray             mBackgroundCheckSignature;
+        QByteArray             mCheckedSignature;
+        QString                mCheckedNote;
+        QList<int>             mCheckedRedundantBars;
+        QList<int>             mCheckedRedundantSupports;
+        bool                   mCheckedStability;
+        QList<QVector<qreal> > mCheckedMechanismModes;
+    
+        QSharedPointer<const SolutionResult> mSolutionResult;
+        SolverStatistics                     mSolverStatistics;
+        InfluenceLoadResult                  *mInfluenceLoadResult;
     
         bool    mHasSolution;
         QString mSolutionInfluenceLoadName;
+        bool    mIsModelCheckRunning;
+        bool    mIsSolutionRunning;
+
+        //Solution read with the model file, shown once the model check of the revision it was read with passes
+        QSharedPointer<const SolutionResult> mPendingSolutionResult;
+        QVector<qint32>                      mPendingSolutionOptions;
+        QString                              mPendingSolutionInfluenceLoadName;
+        quint64                              mPendingSolutionRevision;
     
         ScaleDeflectionsDialog *mScaleDeflectionsDialog;
     
@@ -506,6 +747,13 @@ class Solver : public QMainWindow
         QString     mLastExportModelImageLocation;
         QString     mLastReportLocation;
         QString     mCurrentFile;
+
+        //One snapshot is written at a time, either a save or an autosave journal record
+        QTimer       *mAutosaveTimer;
+        ModelJournal mJournal;
+        QLockFile    *mJournalLock;
+        bool         mIsWriterRunning;
+        bool         mIsSaved;
         enum {MAX_RECENT_FILES = 10};
         QAction *mClearMenuAction;
         QAction *mRecentFileActionsArray[MAX_RECENT_FILES];
@@ -0,0 +1,288 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solverstatistics.cpp */
+
+#include "solverstatistics.h"
+
+SolverStatistics::SolverStatistics()
+{
+    mDegreesOfFreedom  = 0;
+    mStiffnessNonZeros = 0;
+    mFactorNonZeros    = 0;
+    mPeakMemory        = -1;
+}
+
+SolverStatistics::~SolverStatistics()
+{
+
+}
+
+void SolverStatistics::beginPhase(const QString &name)
+{
+    endPhase();
+
+    mCurrentPhase = name;
+    mPhaseTimer.start();
+}
+
+void SolverStatistics::endPhase()
+{
+    if (mCurrentPhase.isEmpty())
+    {
+        return;
+    }
+
+    Phase phase;
+    phase.name               = mCurrentPhase;
+    phase.elapsedNanoseconds = mPhaseTimer.nsecsElapsed();
+    mPhasesList.append(phase);
+
+    mCurrentPhase.clear();
+}
+
+void SolverStatistics::addSolve(const QString &loadCase,
+                                const QString &method,
+                                qint64        iterations,
+                                qreal         residualNorm,
+                                qint64        elapsedNanoseconds,
+                                bool          converged)
+{
+    //Repeated solves of one load case, such as every influence path joint, are accumulated into one entry
+
+    int index = -1;
+
+    for (int i = 0; i < mSolvesList.size(); ++i)
+    {
+        if (mSolvesList.at(i).loadCase == loadCase)
+        {
+            index = i;
+            break;
+        }
+    }
+
+    if (index == -1)
+    {
+        Solve solve;
+        solve.loadCase            = loadCase;
+        solve.solvesCount         = 0;
+        solve.failuresCount       = 0;
+        solve.iterations          = 0;
+        solve.residualChecksCount = 0;
+        solve.maxResidualNorm     = 0.0;
+        solve.elapsedNanoseconds  = 0;
+        mSolvesList.append(solve);
+        index = mSolvesList.size() - 1;
+    }
+
+    Solve &solve = mSolvesList[index];
+
+    if (!method.isEmpty() && !solve.methodsList.contains(method))
+    {
+        solve.methodsList.append(method);
+    }
+
+    solve.solvesCount        += 1;
+    solve.failuresCount      += converged ? 0 : 1;
+    solve.iterations         += iterations;
+    solve.elapsedNanoseconds += elapsedNanoseconds;
+
+    if (residualNorm >= 0.0)
+    {
+        solve.residualChecksCount += 1;
+        solve.maxResidualNorm      = qMax(solve.maxResidualNorm, residualNorm);
+    }
+}
+
+bool SolverStatistics::isEmpty() const
+{
+    return mPhasesList.isEmpty() && mSolvesList.isEmpty();
+}
+
+qreal SolverStatistics::totalMilliseconds() const
+{
+    qint64 elapsedNanoseconds = 0;
+
+    foreach (const Phase &phase, mPhasesList)
+    {
+        elapsedNanoseconds += phase.elapsedNanoseconds;
+    }
+
+    return elapsedNanoseconds / 1.0e+6;
+}
+
+int SolverStatistics::degreesOfFreedom() const
+{
+    return mDegreesOfFreedom;
+}
+
+void SolverStatistics::setDegreesOfFreedom(int degreesOfFreedom)
+{
+    mDegreesOfFreedom = degreesOfFreedom;
+}
+
+qint64 SolverStatistics::stiffnessNonZeros() const
+{
+    return mStiffnessNonZeros;
+}
+
+void SolverStatistics::setStiffnessNonZeros(qint64 stiffnessNonZeros)
+{
+    mStiffnessNonZeros = stiffnessNonZeros;
+}
+
+qint64 SolverStatistics::factorNonZeros() const
+{
+    return mFactorNonZeros;
+}
+
+void SolverStatistics::setFactorNonZeros(qint64 factorNonZeros)
+{
+    mFactorNonZeros = qMax(mFactorNonZeros, factorNonZeros);
+}
+
+qint64 SolverStatistics::fillIn() const
+{
+    //Fill-in is measured against the lower triangle of the symmetric stiffness matrix
+
+    if (mFactorNonZeros == 0)
+    {
+        return 0;
+    }
+
+    qint64 lowerNonZeros = (mStiffnessNonZeros + mDegreesOfFreedom) / 2;
+
+    return qMax(Q_INT64_C(0), mFactorNonZeros - lowerNonZeros);
+}
+
+qint64 SolverStatistics::peakMemory() const
+{
+    return mPeakMemory;
+}
+
+void SolverStatistics::setPeakMemory(qint64 peakMemory)
+{
+    mPeakMemory = peakMemory;
+}
+
+QString SolverStatistics::toText() const
+{
+    QString text = tr("Phases:\n");
+
+    foreach (const Phase &phase, mPhasesList)
+    {
+        text += QString("  %1%2 ms\n")
+                .arg(phase.name, -36)
+                .arg(QString::number(phase.elapsedNanoseconds / 1.0e+6, 'f', 3), 12);
+    }
+
+    text += QString("  %1%2 ms\n")
+            .arg(tr("Total"), -36)
+            .arg(QString::number(totalMilliseconds(), 'f', 3), 12);
+
+    text += tr("\nSolves:\n");
+
+    foreach (const Solve &solve, mSolvesList)
+    {
+        text += tr("  %1 (%2)\n    solves: %3, failed: %4, iterations: %5\n"
+                            "    max residual: %6 (%7 checked), time: %8 ms\n")
+                .arg(solve.loadCase)
+                .arg(solve.methodsList.join(QString(", ")))
+                .arg(solve.solvesCount)
+                .arg(solve.failuresCount)
+                .arg(solve.iterations)
+                .arg(QString::number(solve.maxResidualNorm, 'g', 3))
+                .arg(solve.residualChecksCount)
+                .arg(QString::number(solve.elapsedNanoseconds / 1.0e+6, 'f', 3));
+    }
+
+    text += tr("\nDegrees of freedom: %1\n").arg(mDegreesOfFreedom);
+    text += tr("Stiffness non-zeros: %1\n").arg(mStiffnessNonZeros);
+    text += tr("Factor non-zeros: %1\n").arg(mFactorNonZeros);
+    text += tr("Fill-in: %1\n").arg(fillIn());
+
+    if (mPeakMemory >= 0)
+    {
+        text += tr("Peak memory: %1 MB\n").arg(QString::number(mPeakMemory / 1048576.0, 'f', 1));
+    }
+    else
+    {
+        text += tr("Peak memory: not available\n");
+    }
+
+    return text;
+}
+
+QJsonObject SolverStatistics::toJson() const
+{
+    QJsonArray phasesArray;
+
+    foreach (const Phase &phase, mPhasesList)
+    {
+        QJsonObject object;
+        object.insert(QString("name"), phase.name);
+        object.insert(QString("milliseconds"), phase.elapsedNanoseconds / 1.0e+6);
+        phasesArray.append(object);
+    }
+
+    QJsonArray solvesArray;
+
+    foreach (const Solve &solve, mSolvesList)
+    {
+        QJsonObject object;
+        object.insert(QString("loadCase"), solve.loadCase);
+        object.insert(QString("methods"), QJsonArray::fromStringList(solve.methodsList));
+        object.insert(QString("solves"), solve.solvesCount);
+        object.insert(QString("failures"), solve.failuresCount);
+        object.insert(QString("iterations"), double(solve.iterations));
+        object.insert(QString("residualChecks"), solve.residualChecksCount);
+        object.insert(QString("maxResidualNorm"), solve.maxResidualNorm);
+        object.insert(QString("milliseconds"), solve.elapsedNanoseconds / 1.0e+6);
+        solvesArray.append(object);
+    }
+
+    QJsonObject object;
+    object.insert(QString("phases"), phasesArray);
+    object.insert(QString("solves"), solvesArray);
+    object.insert(QString("totalMilliseconds"), totalMilliseconds());
+    object.insert(QString("degreesOfFreedom"), mDegreesOfFreedom);
+    object.insert(QString("stiffnessNonZeros"), double(mStiffnessNonZeros));
+    object.insert(QString("factorNonZeros"), double(mFactorNonZeros));
+    object.insert(QString("fillIn"), double(fillIn()));
+    object.insert(QString("peakMemoryBytes"), double(mPeakMemory));
+
+    return object;
+}
+
+qint64 SolverStatistics::peakResidentMemory()
+{
+#ifdef Q_OS_UNIX
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return -1;
+    }
+
+#ifdef Q_OS_MAC
+    return qint64(usage.ru_maxrss);
+#else
+    return qint64(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return -1;
+#endif
+}
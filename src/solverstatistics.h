@@ -0,0 +1,117 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* solverstatistics.h */
+
+#ifndef SOLVERSTATISTICS_H
+#define SOLVERSTATISTICS_H
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QList>
+#include <QMetaType>
+#include <QString>
+#include <QStringList>
+
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+//Wall time per solver phase, per load case solve counts, iterations and residuals, and matrix and memory sizes
+class SolverStatistics
+{
+        Q_DECLARE_TR_FUNCTIONS(SolverStatistics)
+
+    public:
+        SolverStatistics();
+
+        ~SolverStatistics();
+
+        void beginPhase(const QString &name);
+
+        void endPhase();
+
+        //A negative residual norm marks a solve whose residual was not computed, as for the sampled influence solves
+        void addSolve(const QString &loadCase,
+                      const QString &method,
+                      qint64        iterations,
+                      qreal         residualNorm,
+                      qint64        elapsedNanoseconds,
+                      bool          converged);
+
+        bool isEmpty() const;
+
+        qreal totalMilliseconds() const;
+
+        int degreesOfFreedom() const;
+
+        void setDegreesOfFreedom(int degreesOfFreedom);
+
+        qint64 stiffnessNonZeros() const;
+
+        void setStiffnessNonZeros(qint64 stiffnessNonZeros);
+
+        qint64 factorNonZeros() const;
+
+        void setFactorNonZeros(qint64 factorNonZeros);
+
+        qint64 fillIn() const;
+
+        qint64 peakMemory() const;
+
+        void setPeakMemory(qint64 peakMemory);
+
+        QString toText() const;
+
+        QJsonObject toJson() const;
+
+        //Peak resident set size of the process in bytes, or -1 where the platform does not report it
+        static qint64 peakResidentMemory();
+
+    private:
+        struct Phase
+        {
+            QString name;
+            qint64  elapsedNanoseconds;
+        };
+
+        struct Solve
+        {
+            QString     loadCase;
+            QStringList methodsList;
+            int         solvesCount;
+            int         failuresCount;
+            qint64      iterations;
+            int         residualChecksCount;
+            qreal       maxResidualNorm;
+            qint64      elapsedNanoseconds;
+        };
+
+        QList<Phase>  mPhasesList;
+        QList<Solve>  mSolvesList;
+        QString       mCurrentPhase;
+        QElapsedTimer mPhaseTimer;
+        int           mDegreesOfFreedom;
+        qint64        mStiffnessNonZeros;
+        qint64        mFactorNonZeros;
+        qint64        mPeakMemory;
+};
+
+Q_DECLARE_METATYPE(SolverStatistics)
+
+#endif // SOLVERSTATISTICS_H
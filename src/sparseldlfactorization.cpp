@@ -0,0 +1,596 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* sparseldlfactorization.cpp */
+
+#include "sparseldlfactorization.h"
+
+SparseLdlFactorization::SparseLdlFactorization(const gsl_spmatrix *tripletMatrix, qreal pivotTolerance)
+{
+    mOrder          = int(tripletMatrix->size1);
+    mFactorNonZeros = 0;
+    mIsValid        = false;
+
+    //Symmetric adjacency of the off-diagonal pattern
+
+    QVector<int> adjacencyPointers(mOrder + 1, 0);
+
+    for (size_t k = 0; k < tripletMatrix->nz; ++k)
+    {
+        int row = int(tripletMatrix->i[k]);
+        int col = int(tripletMatrix->p[k]);
+
+        if (row > col)
+        {
+            ++adjacencyPointers[row + 1];
+            ++adjacencyPointers[col + 1];
+        }
+    }
+
+    for (int i = 0; i < mOrder; ++i)
+    {
+        adjacencyPointers[i + 1] += adjacencyPointers[i];
+    }
+
+    QVector<int> adjacencyIndices(adjacencyPointers.at(mOrder));
+    QVector<int> positions(adjacencyPointers);
+
+    for (size_t k = 0; k < tripletMatrix->nz; ++k)
+    {
+        int row = int(tripletMatrix->i[k]);
+        int col = int(tripletMatrix->p[k]);
+
+        if (row > col)
+        {
+            adjacencyIndices[positions[row]++] = col;
+            adjacencyIndices[positions[col]++] = row;
+        }
+    }
+
+    orderNestedDissection(adjacencyPointers, adjacencyIndices);
+    factorize(tripletMatrix, pivotTolerance);
+}
+
+SparseLdlFactorization::~SparseLdlFactorization()
+{
+
+}
+
+bool SparseLdlFactorization::isValid() const
+{
+    return mIsValid;
+}
+
+bool SparseLdlFactorization::isSingular() const
+{
+    return !mIsValid || !mZeroEnergyDegreesOfFreedom.isEmpty();
+}
+
+int SparseLdlFactorization::order() const
+{
+    return mOrder;
+}
+
+int SparseLdlFactorization::rank() const
+{
+    return mOrder - mZeroEnergyDegreesOfFreedom.size();
+}
+
+qint64 SparseLdlFactorization::factorNonZeros() const
+{
+    return mFactorNonZeros;
+}
+
+const QList<int> &SparseLdlFactorization::zeroEnergyDegreesOfFreedom() const
+{
+    return mZeroEnergyDegreesOfFreedom;
+}
+
+void SparseLdlFactorization::orderNestedDissection(const QVector<int> &adjacencyPointers,
+                                                   const QVector<int> &adjacencyIndices)
+{
+    //Level structure dissection: a breadth first search from a pseudo-peripheral vertex splits each connected
+    //sub graph at its middle level, which is numbered after both halves
+
+    struct Range
+    {
+        QVector<int> nodes;
+        int          begin;
+    };
+
+    mPermutation.fill(0, mOrder);
+
+    QVector<int> part(mOrder, 0);
+    QVector<int> level(mOrder, -1);
+    QVector<int> visited(mOrder, 0);
+    QVector<int> queue;
+    queue.reserve(mOrder);
+
+    int partCount  = 0;
+    int visitCount = 0;
+
+    QVector<Range> stack;
+    Range range;
+    range.begin = 0;
+    range.nodes.reserve(mOrder);
+
+    for (int i = 0; i < mOrder; ++i)
+    {
+        range.nodes.append(i);
+    }
+
+    stack.append(range);
+
+    while (!stack.isEmpty())
+    {
+        range = stack.last();
+        stack.removeLast();
+
+        if (range.nodes.size() <= kMinPartSize)
+        {
+            for (int k = 0; k < range.nodes.size(); ++k)
+            {
+                mPermutation[range.begin + k] = range.nodes.at(k);
+            }
+
+            continue;
+        }
+
+        ++partCount;
+
+        foreach (int node, range.nodes)
+        {
+            part[node] = partCount;
+        }
+
+        int start = range.nodes.first();
+
+        for (int sweep = 0; sweep < 2; ++sweep)
+        {
+            ++visitCount;
+            queue.clear();
+            queue.append(start);
+            visited[start] = visitCount;
+            level[start]   = 0;
+
+            for (int head = 0; head < queue.size(); ++head)
+            {
+                int node = queue.at(head);
+
+                for (int p = adjacencyPointers.at(node); p < adjacencyPointers.at(node + 1); ++p)
+                {
+                    int neighbour = adjacencyIndices.at(p);
+
+                    if (part.at(neighbour) == partCount && visited.at(neighbour) != visitCount)
+                    {
+                        visited[neighbour] = visitCount;
+                        level[neighbour]   = level.at(node) + 1;
+                        queue.append(neighbour);
+                    }
+                }
+            }
+
+            start = queue.last();
+
+            if (queue.size() < range.nodes.size())
+            {
+                break;
+            }
+        }
+
+        if (queue.size() < range.nodes.size())
+        {
+            //Disconnected sub graph, split off the component reached
+
+            Range componentRange;
+            componentRange.begin = range.begin;
+            componentRange.nodes = queue;
+
+            Range remainderRange;
+            remainderRange.begin = range.begin + queue.size();
+
+            foreach (int node, range.nodes)
+            {
+                if (visited.at(node) != visitCount)
+                {
+                    remainderRange.nodes.append(node);
+                }
+            }
+
+            stack.append(componentRange);
+            stack.append(remainderRange);
+            continue;
+        }
+
+        int middleLevel = level.at(queue.last()) / 2;
+
+        if (middleLevel < 1)
+        {
+            for (int k = 0; k < queue.size(); ++k)
+            {
+                mPermutation[range.begin + k] = queue.at(k);
+            }
+
+            continue;
+        }
+
+        Range firstRange;
+        Range secondRange;
+        QVector<int> separator;
+
+        foreach (int node, queue)
+        {
+            if (level.at(node) < middleLevel)
+            {
+                firstRange.nodes.append(node);
+            }
+            else if (level.at(node) > middleLevel)
+            {
+                secondRange.nodes.append(node);
+            }
+            else
+            {
+                separator.append(node);
+            }
+        }
+
+        firstRange.begin  = range.begin;
+        secondRange.begin = range.begin + firstRange.nodes.size();
+
+        int separatorBegin = secondRange.begin + secondRange.nodes.size();
+
+        for (int k = 0; k < separator.size(); ++k)
+        {
+            mPermutation[separatorBegin + k] = separator.at(k);
+        }
+
+        stack.append(firstRange);
+        stack.append(secondRange);
+    }
+}
+
+void SparseLdlFactorization::factorize(const gsl_spmatrix *tripletMatrix, qreal pivotTolerance)
+{
+    int n = mOrder;
+
+    mInversePermutation.fill(0, n);
+
+    for (int k = 0; k < n; ++k)
+    {
+        mInversePermutation[mPermutation.at(k)] = k;
+    }
+
+    const QVector<int> &inversePermutation = mInversePermutation;
+
+    //Upper triangle of the permuted matrix in compressed column form
+
+    QVector<int> columnPointers(n + 1, 0);
+
+    for (size_t k = 0; k < tripletMatrix->nz; ++k)
+    {
+        int row = int(tripletMatrix->i[k]);
+        int col = int(tripletMatrix->p[k]);
+
+        if (row >= col)
+        {
+            int column = qMax(inversePermutation.at(row), inversePermutation.at(col));
+            ++columnPointers[column + 1];
+        }
+    }
+
+    for (int k = 0; k < n; ++k)
+    {
+        columnPointers[k + 1] += columnPointers[k];
+    }
+
+    QVector<int> rowIndices(columnPointers.at(n));
+    QVector<qreal> values(columnPointers.at(n));
+    QVector<int> positions(columnPointers);
+
+    for (size_t k = 0; k < tripletMatrix->nz; ++k)
+    {
+        int row = int(tripletMatrix->i[k]);
+        int col = int(tripletMatrix->p[k]);
+
+        if (row >= col)
+        {
+            int permutedRow = inversePermutation.at(row);
+            int permutedCol = inversePermutation.at(col);
+            int column      = qMax(permutedRow, permutedCol);
+            int p           = positions[column]++;
+
+            rowIndices[p] = qMin(permutedRow, permutedCol);
+            values[p]     = tripletMatrix->data[k];
+        }
+    }
+
+    //Symbolic factorization: elimination tree and column counts of L
+
+    QVector<int> parent(n, -1);
+    QVector<int> flag(n, -1);
+    QVector<int> columnCounts(n, 0);
+
+    for (int k = 0; k < n; ++k)
+    {
+        flag[k] = k;
+
+        for (int p = columnPointers.at(k); p < columnPointers.at(k + 1); ++p)
+        {
+            for (int i = rowIndices.at(p); i < k && flag.at(i) != k; i = parent.at(i))
+            {
+                if (parent.at(i) == -1)
+                {
+                    parent[i] = k;
+                }
+
+                ++columnCounts[i];
+                flag[i] = k;
+            }
+        }
+    }
+
+    qint64 factorNonZeros = 0;
+
+    for (int k = 0; k < n; ++k)
+    {
+        factorNonZeros += columnCounts.at(k);
+    }
+
+    mFactorNonZeros = factorNonZeros + n;
+
+    if (factorNonZeros > qint64(std::numeric_limits<int>::max()))
+    {
+        return;
+    }
+
+    mFactorPointers.fill(0, n + 1);
+
+    for (int k = 0; k < n; ++k)
+    {
+        mFactorPointers[k + 1] = mFactorPointers.at(k) + columnCounts.at(k);
+    }
+
+    //Numeric factorization, one row of L at a time. Row indices within each column of L come out sorted.
+
+    int factorSize = int(factorNonZeros);
+
+    mFactorIndices.fill(0, factorSize);
+    mFactorValues.fill(0.0, factorSize);
+    mDiagonal.fill(0.0, n);
+
+    const QVector<int> &factorPointers = mFactorPointers;
+    QVector<int> &factorIndices        = mFactorIndices;
+    QVector<qreal> &factorValues       = mFactorValues;
+    QVector<qreal> &diagonal           = mDiagonal;
+    QVector<qreal> y(n, 0.0);
+    QVector<qreal> matrixDiagonal(n, 0.0);
+    QVector<int> pattern(n, 0);
+
+    columnCounts.fill(0);
+    flag.fill(-1);
+
+    for (int k = 0; k < n; ++k)
+    {
+        int top = n;
+        flag[k] = k;
+
+        for (int p = columnPointers.at(k); p < columnPointers.at(k + 1); ++p)
+        {
+            int i = rowIndices.at(p);
+            y[i] += values.at(p);
+
+            int length = 0;
+
+            for (; flag.at(i) != k; i = parent.at(i))
+            {
+                pattern[length++] = i;
+                flag[i]           = k;
+            }
+
+            while (length > 0)
+            {
+                pattern[--top] = pattern[--length];
+            }
+        }
+
+        diagonal[k]       = y.at(k);
+        matrixDiagonal[k] = y.at(k);
+        y[k]              = 0.0;
+
+        for (; top < n; ++top)
+        {
+            int i    = pattern.at(top);
+            qreal yi = y.at(i);
+            y[i]     = 0.0;
+
+            int end = factorPointers.at(i) + columnCounts.at(i);
+
+            for (int p = factorPointers.at(i); p < end; ++p)
+            {
+                y[factorIndices.at(p)] -= factorValues.at(p) * yi;
+            }
+
+            qreal lki = yi / diagonal.at(i);
+            diagonal[k] -= lki * yi;
+
+            factorIndices[end] = k;
+            factorValues[end]  = lki;
+            ++columnCounts[i];
+        }
+
+        //A pivot lost to cancellation is held by a spring much stiffer than its own diagonal
+
+        if (diagonal.at(k) <= pivotTolerance * matrixDiagonal.at(k))
+        {
+            mZeroEnergyDegreesOfFreedom.append(mPermutation.at(k));
+            diagonal[k] = (matrixDiagonal.at(k) > 0.0 ? matrixDiagonal.at(k) : 1.0) / pivotTolerance;
+        }
+    }
+
+    mIsValid = true;
+}
+
+void SparseLdlFactorization::solve(QVector<qreal> &vector) const
+{
+    if (!mIsValid)
+    {
+        return;
+    }
+
+    int n = mOrder;
+
+    QVector<qreal> y(n);
+
+    for (int k = 0; k < n; ++k)
+    {
+        y[k] = vector.at(mPermutation.at(k));
+    }
+
+    for (int j = 0; j < n; ++j)
+    {
+        for (int p = mFactorPointers.at(j); p < mFactorPointers.at(j + 1); ++p)
+        {
+            y[mFactorIndices.at(p)] -= mFactorValues.at(p) * y.at(j);
+        }
+    }
+
+    for (int j = 0; j < n; ++j)
+    {
+        y[j] /= mDiagonal.at(j);
+    }
+
+    for (int j = n - 1; j >= 0; --j)
+    {
+        for (int p = mFactorPointers.at(j); p < mFactorPointers.at(j + 1); ++p)
+        {
+            y[j] -= mFactorValues.at(p) * y.at(mFactorIndices.at(p));
+        }
+    }
+
+    for (int k = 0; k < n; ++k)
+    {
+        vector[mPermutation.at(k)] = y.at(k);
+    }
+}
+
+void SparseLdlFactorization::computeSelectedInverse()
+{
+    if (!mIsValid || hasSelectedInverse())
+    {
+        return;
+    }
+
+    int n = mOrder;
+
+    mInverseValues.fill(0.0, mFactorValues.size());
+    mInverseDiagonal.fill(0.0, n);
+
+    //Position of each row of the current column's pattern, which is a clique of the filled graph
+
+    QVector<int> position(n, -1);
+    QVector<qreal> z;
+
+    for (int j = n - 1; j >= 0; --j)
+    {
+        int begin = mFactorPointers.at(j);
+        int end   = mFactorPointers.at(j + 1);
+
+        z.fill(0.0, end - begin);
+
+        for (int p = begin; p < end; ++p)
+        {
+            position[mFactorIndices.at(p)] = p - begin;
+        }
+
+        //z(i) = sum over k of Z(i, k) L(k, j) for i, k in the pattern of column j
+
+        for (int p = begin; p < end; ++p)
+        {
+            int k     = mFactorIndices.at(p);
+            int a     = p - begin;
+            qreal lkj = mFactorValues.at(p);
+
+            z[a] += mInverseDiagonal.at(k) * lkj;
+
+            for (int q = mFactorPointers.at(k); q < mFactorPointers.at(k + 1); ++q)
+            {
+                int b = position.at(mFactorIndices.at(q));
+
+                if (b >= 0)
+                {
+                    z[b] += mInverseValues.at(q) * lkj;
+                    z[a] += mInverseValues.at(q) * mFactorValues.at(begin + b);
+                }
+            }
+        }
+
+        qreal zjj = 1.0 / mDiagonal.at(j);
+
+        for (int p = begin; p < end; ++p)
+        {
+            mInverseValues[p] = -z.at(p - begin);
+            zjj              += mFactorValues.at(p) * z.at(p - begin);
+            position[mFactorIndices.at(p)] = -1;
+        }
+
+        mInverseDiagonal[j] = zjj;
+    }
+}
+
+bool SparseLdlFactorization::hasSelectedInverse() const
+{
+    return mInverseDiagonal.size() == mOrder && mOrder > 0;
+}
+
+qreal SparseLdlFactorization::inverseQuadraticForm(const QVector<int> &indices, const QVector<qreal> &values) const
+{
+    qreal result = 0.0;
+
+    for (int a = 0; a < indices.size(); ++a)
+    {
+        int row = mInversePermutation.at(indices.at(a));
+
+        result += values.at(a) * values.at(a) * mInverseDiagonal.at(row);
+
+        for (int b = a + 1; b < indices.size(); ++b)
+        {
+            int col = mInversePermutation.at(indices.at(b));
+
+            result += 2.0 * values.at(a) * values.at(b) * selectedInverseEntry(row, col);
+        }
+    }
+
+    return result;
+}
+
+qreal SparseLdlFactorization::selectedInverseEntry(int row, int col) const
+{
+    if (row < col)
+    {
+        qSwap(row, col);
+    }
+
+    const int *begin = mFactorIndices.constData() + mFactorPointers.at(col);
+    const int *end   = mFactorIndices.constData() + mFactorPointers.at(col + 1);
+    const int *found = std::lower_bound(begin, end, row);
+
+    if (found == end || *found != row)
+    {
+        return 0.0;
+    }
+
+    return mInverseValues.at(int(found - mFactorIndices.constData()));
+}
@@ -0,0 +1,95 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* sparseldlfactorization.h */
+
+#ifndef SPARSELDLFACTORIZATION_H
+#define SPARSELDLFACTORIZATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QList>
+#include <QVector>
+
+#include <gsl/gsl_spmatrix.h>
+
+//Sparse LDL' factorization of a symmetric positive semi-definite matrix in a nested dissection ordering.
+//Pivots below the tolerance relative to their diagonal entry mark zero-energy degrees of freedom, which are then
+//held by a stiff spring so the factorization runs to completion and reveals the rank.
+class SparseLdlFactorization
+{
+    public:
+        //Only entries on and below the diagonal of the triplet matrix are read
+        explicit SparseLdlFactorization(const gsl_spmatrix *tripletMatrix,
+                                        qreal              pivotTolerance = kPivotTolerance);
+
+        ~SparseLdlFactorization();
+
+        static const qreal kPivotTolerance = 1.0e-9;
+
+        //Sub graphs at or below this size are not dissected further
+        static const int kMinPartSize = 64;
+
+        bool isValid() const;
+
+        bool isSingular() const;
+
+        int order() const;
+
+        int rank() const;
+
+        qint64 factorNonZeros() const;
+
+        //Matrix indices of the pivots found below the tolerance, in elimination order
+        const QList<int> &zeroEnergyDegreesOfFreedom() const;
+
+        //Solve A x = b in place. For a singular matrix the zero-energy pivots are held by their springs, so the solution
+        //for a unit load at such a pivot is a multiple of a zero-energy mode.
+        void solve(QVector<qreal> &vector) const;
+
+        //Entries of the inverse on the pattern of L + L', by the Takahashi recurrences from the last column back
+        void computeSelectedInverse();
+
+        bool hasSelectedInverse() const;
+
+        //v' inv(A) v for a vector with the given values at the given matrix indices. Every pair of indices must
+        //share an entry of the matrix, otherwise its inverse entry is taken as zero.
+        qreal inverseQuadraticForm(const QVector<int> &indices, const QVector<qreal> &values) const;
+
+    private:
+        void orderNestedDissection(const QVector<int> &adjacencyPointers, const QVector<int> &adjacencyIndices);
+
+        void factorize(const gsl_spmatrix *tripletMatrix, qreal pivotTolerance);
+
+        qreal selectedInverseEntry(int row, int col) const;
+
+        int            mOrder;
+        QVector<int>   mPermutation;
+        QVector<int>   mInversePermutation;
+        QVector<int>   mFactorPointers;
+        QVector<int>   mFactorIndices;
+        QVector<qreal> mFactorValues;
+        QVector<qreal> mDiagonal;
+        QVector<qreal> mInverseValues;
+        QVector<qreal> mInverseDiagonal;
+        QList<int>     mZeroEnergyDegreesOfFreedom;
+        qint64         mFactorNonZeros;
+        bool           mIsValid;
+};
+
+#endif // SPARSELDLFACTORIZATION_H
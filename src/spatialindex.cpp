@@ -0,0 +1,199 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* spatialindex.cpp */
+
+#include "spatialindex.h"
+
+SpatialIndex::SpatialIndex(qreal cellSize)
+{
+    mCellSize = cellSize;
+    mStamp    = 0;
+}
+
+SpatialIndex::~SpatialIndex()
+{
+
+}
+
+void SpatialIndex::clear(qreal cellSize)
+{
+    mCellSize = cellSize;
+    mPointCells.clear();
+    mSegmentCells.clear();
+    mPointStamps.clear();
+    mSegmentStamps.clear();
+    mStamp = 0;
+}
+
+qreal SpatialIndex::cellSize() const
+{
+    return mCellSize;
+}
+
+void SpatialIndex::insertPoint(int index, qreal x, qreal y)
+{
+    mPointCells[cellKey(cell(x), cell(y))].append(index);
+
+    if (index >= mPointStamps.size())
+    {
+        mPointStamps.resize(index + 1);
+    }
+}
+
+void SpatialIndex::insertSegment(int   index,
+                                 qreal x1,
+                                 qreal y1,
+                                 qreal x2,
+                                 qreal y2)
+{
+    QVector<quint64> keys = segmentCells(x1, y1, x2, y2, kCellMargin * mCellSize);
+
+    foreach (quint64 key, keys)
+    {
+        mSegmentCells[key].append(index);
+    }
+
+    if (index >= mSegmentStamps.size())
+    {
+        mSegmentStamps.resize(index + 1);
+    }
+}
+
+QVector<int> SpatialIndex::pointsNear(qreal x, qreal y, qreal distance) const
+{
+    QVector<int> indices;
+    collect(mPointCells, segmentCells(x, y, x, y, distance), mPointStamps, indices);
+    return indices;
+}
+
+QVector<int> SpatialIndex::pointsNear(qreal x1,
+                                      qreal y1,
+                                      qreal x2,
+                                      qreal y2,
+                                      qreal distance) const
+{
+    QVector<int> indices;
+    collect(mPointCells, segmentCells(x1, y1, x2, y2, distance), mPointStamps, indices);
+    return indices;
+}
+
+QVector<int> SpatialIndex::segmentsNear(qreal x, qreal y, qreal distance) const
+{
+    QVector<int> indices;
+    collect(mSegmentCells, segmentCells(x, y, x, y, distance), mSegmentStamps, indices);
+    return indices;
+}
+
+QVector<int> SpatialIndex::segmentsNear(qreal x1,
+                                        qreal y1,
+                                        qreal x2,
+                                        qreal y2,
+                                        qreal distance) const
+{
+    QVector<int> indices;
+    collect(mSegmentCells, segmentCells(x1, y1, x2, y2, distance), mSegmentStamps, indices);
+    return indices;
+}
+
+int SpatialIndex::cell(qreal coordinate) const
+{
+    qreal position = std::floor(coordinate / mCellSize);
+    return int(qBound(qreal(-1.0e9), position, qreal(1.0e9)));
+}
+
+quint64 SpatialIndex::cellKey(int column, int row) const
+{
+    return (quint64(quint32(column)) << 32) | quint64(quint32(row));
+}
+
+QVector<quint64> SpatialIndex::segmentCells(qreal x1,
+                                            qreal y1,
+                                            qreal x2,
+                                            qreal y2,
+                                            qreal margin) const
+{
+    //Walk the columns crossed by the segment and take the rows its widened span covers in each of them, which
+    //keeps the cells of a long diagonal segment proportional to its length rather than to its bounding box
+
+    QVector<quint64> keys;
+
+    if (x1 > x2)
+    {
+        qSwap(x1, x2);
+        qSwap(y1, y2);
+    }
+
+    qreal xComponent = x2 - x1;
+    int firstColumn  = cell(x1 - margin);
+    int lastColumn   = cell(x2 + margin);
+
+    for (int column = firstColumn; column <= lastColumn; ++column)
+    {
+        qreal xStart = qMax(x1, column * mCellSize - margin);
+        qreal xEnd   = qMin(x2, (column + 1) * mCellSize + margin);
+
+        qreal yStart = y1;
+        qreal yEnd   = y2;
+
+        if (xComponent > 0.0)
+        {
+            yStart = y1 + (y2 - y1) * (xStart - x1) / xComponent;
+            yEnd   = y1 + (y2 - y1) * (xEnd - x1) / xComponent;
+        }
+
+        int firstRow = cell(qMin(yStart, yEnd) - margin);
+        int lastRow  = cell(qMax(yStart, yEnd) + margin);
+
+        for (int row = firstRow; row <= lastRow; ++row)
+        {
+            keys.append(cellKey(column, row));
+        }
+    }
+
+    return keys;
+}
+
+void SpatialIndex::collect(const QHash<quint64, QVector<int> > &cells,
+                           const QVector<quint64>              &keys,
+                           QVector<int>                        &stamps,
+                           QVector<int>                        &indices) const
+{
+    ++mStamp;
+
+    foreach (quint64 key, keys)
+    {
+        QHash<quint64, QVector<int> >::const_iterator iterator = cells.constFind(key);
+
+        if (iterator == cells.constEnd())
+        {
+            continue;
+        }
+
+        const QVector<int> &cellIndices = iterator.value();
+
+        for (int i = 0; i < cellIndices.size(); ++i)
+        {
+            int index = cellIndices.at(i);
+
+            if (stamps.at(index) != mStamp)
+            {
+                stamps[index] = mStamp;
+                indices.append(index);
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* spatialindex.h */
+
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+#include <cmath>
+
+#include <QHash>
+#include <QVector>
+#include <QtGlobal>
+
+//Uniform grid over the points and segments of a model, hashed by cell so that only occupied cells take memory.
+//Points and segments are kept by the numbers they are inserted with, usually their positions in the joints and
+//bars lists. Queries return candidates from the cells around the queried region, each once, and leave the exact
+//geometric test to the caller. The index does not follow later edits of the model.
+class SpatialIndex
+{
+    public:
+        SpatialIndex(qreal cellSize = 1.0);
+
+        ~SpatialIndex();
+
+        //Remove all points and segments and start over with a new cell size
+        void clear(qreal cellSize);
+
+        qreal cellSize() const;
+
+        void insertPoint(int index, qreal x, qreal y);
+
+        void insertSegment(int   index,
+                           qreal x1,
+                           qreal y1,
+                           qreal x2,
+                           qreal y2);
+
+        //Points in the cells overlapping the square of half side distance around (x, y)
+        QVector<int> pointsNear(qreal x, qreal y, qreal distance) const;
+
+        //Points in the cells crossed by the segment widened by distance
+        QVector<int> pointsNear(qreal x1,
+                                qreal y1,
+                                qreal x2,
+                                qreal y2,
+                                qreal distance) const;
+
+        //Segments in the cells overlapping the square of half side distance around (x, y)
+        QVector<int> segmentsNear(qreal x, qreal y, qreal distance) const;
+
+        //Segments in the cells crossed by the segment widened by distance
+        QVector<int> segmentsNear(qreal x1,
+                                  qreal y1,
+                                  qreal x2,
+                                  qreal y2,
+                                  qreal distance) const;
+
+        //Share of a cell by which segments are widened on insertion, so that a point lying on a segment is always
+        //found in a cell of the segment
+        static const qreal kCellMargin = 1.0e-6;
+
+    private:
+        int cell(qreal coordinate) const;
+
+        quint64 cellKey(int column, int row) const;
+
+        //Cells of the segment widened by margin, column by column
+        QVector<quint64> segmentCells(qreal x1,
+                                      qreal y1,
+                                      qreal x2,
+                                      qreal y2,
+                                      qreal margin) const;
+
+        void collect(const QHash<quint64, QVector<int> > &cells,
+                     const QVector<quint64>              &keys,
+                     QVector<int>                        &stamps,
+                     QVector<int>                        &indices) const;
+
+        qreal                         mCellSize;
+        QHash<quint64, QVector<int> > mPointCells;
+        QHash<quint64, QVector<int> > mSegmentCells;
+
+        //Query stamps of points and segments, so that each candidate is returned once
+        mutable QVector<int> mPointStamps;
+        mutable QVector<int> mSegmentStamps;
+        mutable int          mStamp;
+};
+
+#endif // SPATIALINDEX_H
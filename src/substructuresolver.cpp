@@ -0,0 +1,720 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* substructuresolver.cpp */
+
+#include "substructuresolver.h"
+
+SubstructureSolver::SubstructureSolver(const QList<Joint *> &jointsList,
+                                       const QList<Bar *>   &barsList,
+                                       const QList<int>     &degreesOfFreedom,
+                                       const gsl_spmatrix   *k11TripletFormat)
+{
+    mReducedStiffness = 0;
+    mIsActive         = false;
+
+    if (createPanels(jointsList, barsList, degreesOfFreedom, k11TripletFormat)
+            && createReducedSystem(k11TripletFormat))
+    {
+        mIsActive = true;
+    }
+    else
+    {
+        clear();
+    }
+}
+
+SubstructureSolver::~SubstructureSolver()
+{
+    clear();
+}
+
+bool SubstructureSolver::isActive() const
+{
+    return mIsActive;
+}
+
+int SubstructureSolver::panelsCount() const
+{
+    return mPanelsList.size();
+}
+
+int SubstructureSolver::superelementsCount() const
+{
+    return mSuperelementsList.size();
+}
+
+int SubstructureSolver::reducedOrder() const
+{
+    return mReducedDegreesOfFreedom.size();
+}
+
+qint64 SubstructureSolver::factorNonZeros() const
+{
+    qint64 order          = mReducedDegreesOfFreedom.size();
+    qint64 factorNonZeros = order * (order + 1) / 2;
+
+    foreach (const Superelement &superelement, mSuperelementsList)
+    {
+        qint64 interiorOrder = superelement.interiorOrder;
+        factorNonZeros += interiorOrder * (interiorOrder + 1) / 2;
+    }
+
+    return factorNonZeros;
+}
+
+int SubstructureSolver::solve(const gsl_vector *loadsColumnVector, gsl_vector *deflectionsColumnVector) const
+{
+    if (!mIsActive)
+    {
+        return GSL_FAILURE;
+    }
+
+    //Condense the interior loads of every panel onto its boundary
+
+    int count = mPanelsList.size();
+    QVector<PanelWork> worksList(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const Panel &panel               = mPanelsList.at(i);
+        const Superelement &superelement = mSuperelementsList.at(panel.superelementIndex);
+
+        PanelWork &work              = worksList[i];
+        work.superelement            = &superelement;
+        work.panel                   = &panel;
+        work.loadsColumnVector       = loadsColumnVector;
+        work.deflectionsColumnVector = deflectionsColumnVector;
+        work.interiorColumnVector    = gsl_vector_alloc(superelement.interiorOrder);
+        work.boundaryColumnVector    = gsl_vector_alloc(superelement.boundaryOrder);
+    }
+
+    QtConcurrent::blockingMap(worksList, &SubstructureSolver::condensePanelLoads);
+
+    //Solve the reduced interface system
+
+    int order                       = mReducedDegreesOfFreedom.size();
+    gsl_vector *reducedColumnVector = gsl_vector_alloc(order);
+
+    for (int i = 0; i < order; ++i)
+    {
+        gsl_vector_set(reducedColumnVector, i, gsl_vector_get(loadsColumnVector, mReducedDegreesOfFreedom.at(i)));
+    }
+
+    foreach (const PanelWork &work, worksList)
+    {
+        const QVector<int> &boundaryDegreesOfFreedom = work.panel->boundaryDegreesOfFreedom;
+
+        for (int i = 0; i < boundaryDegreesOfFreedom.size(); ++i)
+        {
+            int index   = mReducedIndices.at(boundaryDegreesOfFreedom.at(i));
+            qreal value = gsl_vector_get(reducedColumnVector, index) - gsl_vector_get(work.boundaryColumnVector, i);
+            gsl_vector_set(reducedColumnVector, index, value);
+        }
+    }
+
+    int status = gsl_linalg_cholesky_svx(mReducedStiffness, reducedColumnVector);
+
+    if (status == GSL_SUCCESS)
+    {
+        gsl_vector_set_zero(deflectionsColumnVector);
+
+        for (int i = 0; i < order; ++i)
+        {
+            gsl_vector_set(deflectionsColumnVector, mReducedDegreesOfFreedom.at(i), gsl_vector_get(reducedColumnVector, i));
+        }
+
+        //Recover the interior deflections of every panel from its boundary deflections
+
+        QtConcurrent::blockingMap(worksList, &SubstructureSolver::recoverPanelDeflections);
+    }
+
+    gsl_vector_free(reducedColumnVector);
+
+    foreach (const PanelWork &work, worksList)
+    {
+        gsl_vector_free(work.interiorColumnVector);
+        gsl_vector_free(work.boundaryColumnVector);
+    }
+
+    return status;
+}
+
+void SubstructureSolver::condensePanelLoads(PanelWork &work)
+{
+    const QVector<int> &interiorDegreesOfFreedom = work.panel->interiorDegreesOfFreedom;
+
+    for (int i = 0; i < interiorDegreesOfFreedom.size(); ++i)
+    {
+        gsl_vector_set(work.interiorColumnVector, i, gsl_vector_get(work.loadsColumnVector, interiorDegreesOfFreedom.at(i)));
+    }
+
+    gsl_linalg_cholesky_svx(work.superelement->interiorStiffness, work.interiorColumnVector);
+
+    gsl_blas_dgemv(CblasTrans,
+                   1.0,
+                   work.superelement->interiorBoundaryStiffness,
+                   work.interiorColumnVector,
+                   0.0,
+                   work.boundaryColumnVector);
+}
+
+void SubstructureSolver::recoverPanelDeflections(PanelWork &work)
+{
+    const QVector<int> &interiorDegreesOfFreedom = work.panel->interiorDegreesOfFreedom;
+    const QVector<int> &boundaryDegreesOfFreedom = work.panel->boundaryDegreesOfFreedom;
+
+    for (int i = 0; i < boundaryDegreesOfFreedom.size(); ++i)
+    {
+        gsl_vector_set(work.boundaryColumnVector, i, gsl_vector_get(work.deflectionsColumnVector, boundaryDegreesOfFreedom.at(i)));
+    }
+
+    for (int i = 0; i < interiorDegreesOfFreedom.size(); ++i)
+    {
+        gsl_vector_set(work.interiorColumnVector, i, gsl_vector_get(work.loadsColumnVector, interiorDegreesOfFreedom.at(i)));
+    }
+
+    gsl_blas_dgemv(CblasNoTrans,
+                   -1.0,
+                   work.superelement->interiorBoundaryStiffness,
+                   work.boundaryColumnVector,
+                   1.0,
+                   work.interiorColumnVector);
+
+    gsl_linalg_cholesky_svx(work.superelement->interiorStiffness, work.interiorColumnVector);
+
+    for (int i = 0; i < interiorDegreesOfFreedom.size(); ++i)
+    {
+        gsl_vector_set(work.deflectionsColumnVector, interiorDegreesOfFreedom.at(i), gsl_vector_get(work.interiorColumnVector, i));
+    }
+}
+
+bool SubstructureSolver::matricesEqual(const gsl_matrix *matrixA, const gsl_matrix *matrixB)
+{
+    if (matrixA->size1 != matrixB->size1 || matrixA->size2 != matrixB->size2)
+    {
+        return false;
+    }
+
+    qreal scale = std::max(gsl_matrix_max(matrixA), -gsl_matrix_min(matrixA));
+
+    for (size_t i = 0; i < matrixA->size1; ++i)
+    {
+        for (size_t j = 0; j < matrixA->size2; ++j)
+        {
+            qreal difference = gsl_matrix_get(matrixA, i, j) - gsl_matrix_get(matrixB, i, j);
+
+            if (std::fabs(difference) > kStiffnessTolerance * scale)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool SubstructureSolver::findPeriod(const QList<Joint *> &jointsList,
+                                    const QList<Bar *>   &barsList,
+                                    qreal                tolerance,
+                                    qreal                &periodX,
+                                    qreal                &periodY) const
+{
+    //The period is the shortest translation mapping most joints and bars onto other joints and bars
+
+    int jointsCount = jointsList.size();
+
+    QHash<const Joint *, int> jointIndicesHash;
+    QHash<QPair<qint64, qint64>, int> coordinatesHash;
+    int anchorIndex = 0;
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        const Joint *joint  = jointsList.at(i);
+        const Joint *anchor = jointsList.at(anchorIndex);
+        jointIndicesHash.insert(joint, i);
+        coordinatesHash.insert(qMakePair(qRound64(joint->xCoordinate() / tolerance),
+                                         qRound64(joint->yCoordinate() / tolerance)), i);
+
+        if (joint->xCoordinate() < anchor->xCoordinate()
+                || (joint->xCoordinate() == anchor->xCoordinate() && joint->yCoordinate() < anchor->yCoordinate()))
+        {
+            anchorIndex = i;
+        }
+    }
+
+    QSet< QPair<int, int> > barsSet;
+
+    foreach (const Bar *bar, barsList)
+    {
+        int indexA = jointIndicesHash.value(bar->firstJoint());
+        int indexB = jointIndicesHash.value(bar->secondJoint());
+        barsSet.insert(qMakePair(std::min(indexA, indexB), std::max(indexA, indexB)));
+    }
+
+    QList< QPair<qreal, int> > candidatesList;
+    const Joint *anchor = jointsList.at(anchorIndex);
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        if (i == anchorIndex)
+        {
+            continue;
+        }
+
+        qreal deltaX = jointsList.at(i)->xCoordinate() - anchor->xCoordinate();
+        qreal deltaY = jointsList.at(i)->yCoordinate() - anchor->yCoordinate();
+        candidatesList.append(qMakePair(deltaX * deltaX + deltaY * deltaY, i));
+    }
+
+    std::sort(candidatesList.begin(), candidatesList.end());
+
+    int count = std::min(candidatesList.size(), int(kMaxPeriodCandidates));
+
+    for (int k = 0; k < count; ++k)
+    {
+        const Joint *candidate = jointsList.at(candidatesList.at(k).second);
+        qreal deltaX           = candidate->xCoordinate() - anchor->xCoordinate();
+        qreal deltaY           = candidate->yCoordinate() - anchor->yCoordinate();
+
+        QVector<int> translatedIndices(jointsCount, -1);
+        int matchedJointsCount = 0;
+
+        for (int i = 0; i < jointsCount; ++i)
+        {
+            QPair<qint64, qint64> key = qMakePair(qRound64((jointsList.at(i)->xCoordinate() + deltaX) / tolerance),
+                                                  qRound64((jointsList.at(i)->yCoordinate() + deltaY) / tolerance));
+
+            if (coordinatesHash.contains(key))
+            {
+                translatedIndices[i] = coordinatesHash.value(key);
+                ++matchedJointsCount;
+            }
+        }
+
+        if (4 * matchedJointsCount < 3 * jointsCount)
+        {
+            continue;
+        }
+
+        int matchedBarsCount = 0;
+
+        foreach (const Bar *bar, barsList)
+        {
+            int indexA = translatedIndices.at(jointIndicesHash.value(bar->firstJoint()));
+            int indexB = translatedIndices.at(jointIndicesHash.value(bar->secondJoint()));
+
+            if (indexA >= 0 && indexB >= 0
+                    && barsSet.contains(qMakePair(std::min(indexA, indexB), std::max(indexA, indexB))))
+            {
+                ++matchedBarsCount;
+            }
+        }
+
+        if (3 * matchedBarsCount < 2 * barsList.size())
+        {
+            continue;
+        }
+
+        periodX = deltaX;
+        periodY = deltaY;
+        return true;
+    }
+
+    return false;
+}
+
+bool SubstructureSolver::createPanels(const QList<Joint *> &jointsList,
+                                      const QList<Bar *>   &barsList,
+                                      const QList<int>     &degreesOfFreedom,
+                                      const gsl_spmatrix   *k11TripletFormat)
+{
+    int jointsCount = jointsList.size();
+    int barsCount   = barsList.size();
+
+    if (jointsCount < 2 * kMinPanelsCount || barsCount == 0)
+    {
+        return false;
+    }
+
+    qreal minX = jointsList.first()->xCoordinate();
+    qreal maxX = minX;
+    qreal minY = jointsList.first()->yCoordinate();
+    qreal maxY = minY;
+
+    foreach (const Joint *joint, jointsList)
+    {
+        minX = std::min(minX, joint->xCoordinate());
+        maxX = std::max(maxX, joint->xCoordinate());
+        minY = std::min(minY, joint->yCoordinate());
+        maxY = std::max(maxY, joint->yCoordinate());
+    }
+
+    qreal extent = std::max(maxX - minX, maxY - minY);
+
+    if (extent <= 0.0)
+    {
+        return false;
+    }
+
+    qreal tolerance = kCoordinateTolerance * extent;
+    qreal periodX   = 0.0;
+    qreal periodY   = 0.0;
+
+    if (!findPeriod(jointsList, barsList, tolerance, periodX, periodY))
+    {
+        return false;
+    }
+
+    //Group consecutive periods into panels so that joints between panel boundaries can be condensed
+
+    qreal periodLengthSquared = periodX * periodX + periodY * periodY;
+    QVector<qreal> jointPositions(jointsCount);
+    QHash<const Joint *, int> jointIndicesHash;
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        const Joint *joint = jointsList.at(i);
+        jointPositions[i]  = (joint->xCoordinate() * periodX + joint->yCoordinate() * periodY) / periodLengthSquared;
+        jointIndicesHash.insert(joint, i);
+    }
+
+    qreal minPosition = *std::min_element(jointPositions.constBegin(), jointPositions.constEnd());
+    qreal maxPosition = *std::max_element(jointPositions.constBegin(), jointPositions.constEnd());
+
+    int periodsCount           = qRound(maxPosition - minPosition);
+    int periodsPerPanel        = std::max(2, int(qRound(std::sqrt(qreal(periodsCount)))));
+    int panelsCount            = (periodsCount + periodsPerPanel - 1) / periodsPerPanel;
+    qreal epsilonPositionSmall = 1.0e-9;
+
+    if (panelsCount < kMinPanelsCount)
+    {
+        return false;
+    }
+
+    QVector<int> barPanels(barsCount);
+    QVector<int> jointPanels(jointsCount, -1);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        int indexA     = jointIndicesHash.value(barsList.at(i)->firstJoint());
+        int indexB     = jointIndicesHash.value(barsList.at(i)->secondJoint());
+        qreal position = (jointPositions.at(indexA) + jointPositions.at(indexB)) / 2.0 - minPosition;
+        int panel      = int(std::floor(position / periodsPerPanel + epsilonPositionSmall));
+        panel          = std::max(0, std::min(panel, panelsCount - 1));
+        barPanels[i]   = panel;
+
+        //A joint reached by bars of two panels is shared and stays on the interface
+
+        jointPanels[indexA] = (jointPanels.at(indexA) == -1 || jointPanels.at(indexA) == panel) ? panel : -2;
+        jointPanels[indexB] = (jointPanels.at(indexB) == -1 || jointPanels.at(indexB) == panel) ? panel : -2;
+    }
+
+    QVector<int> freeIndices(2 * jointsCount, -1);
+
+    for (int i = 0; i < degreesOfFreedom.size(); ++i)
+    {
+        freeIndices[degreesOfFreedom.at(i)] = i;
+    }
+
+    QVector<bool> isInterior(jointsCount, false);
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        isInterior[i] = jointPanels.at(i) >= 0 && freeIndices.at(2 * i) >= 0 && freeIndices.at(2 * i + 1) >= 0;
+    }
+
+    QVector< QList< QPair<QPair<qint64, qint64>, int> > > interiorJointsLists(panelsCount);
+    QVector< QList< QPair<QPair<qint64, qint64>, int> > > boundaryJointsLists(panelsCount);
+    QVector< QSet<int> > boundaryJointsSets(panelsCount);
+
+    for (int i = 0; i < barsCount; ++i)
+    {
+        int panel     = barPanels.at(i);
+        qreal originX = panel * periodsPerPanel * periodX;
+        qreal originY = panel * periodsPerPanel * periodY;
+        int indexA    = jointIndicesHash.value(barsList.at(i)->firstJoint());
+        int indexB    = jointIndicesHash.value(barsList.at(i)->secondJoint());
+
+        for (int k = 0; k < 2; ++k)
+        {
+            int index                 = (k == 0) ? indexA : indexB;
+            const Joint *joint        = jointsList.at(index);
+            QPair<qint64, qint64> key = qMakePair(qRound64((joint->xCoordinate() - originX) / tolerance),
+                                                  qRound64((joint->yCoordinate() - originY) / tolerance));
+
+            if (isInterior.at(index))
+            {
+                if (!interiorJointsLists.at(panel).contains(qMakePair(key, index)))
+                {
+                    interiorJointsLists[panel].append(qMakePair(key, index));
+                }
+            }
+            else if (!boundaryJointsSets.at(panel).contains(index))
+            {
+                boundaryJointsSets[panel].insert(index);
+                boundaryJointsLists[panel].append(qMakePair(key, index));
+            }
+        }
+    }
+
+    //Condense each panel, sharing one superelement between panels with identical stiffness blocks
+
+    qint64 denseEntries = 0;
+
+    for (int p = 0; p < panelsCount; ++p)
+    {
+        if (interiorJointsLists.at(p).isEmpty())
+        {
+            continue;
+        }
+
+        std::sort(interiorJointsLists[p].begin(), interiorJointsLists[p].end());
+        std::sort(boundaryJointsLists[p].begin(), boundaryJointsLists[p].end());
+
+        Panel panel;
+
+        for (int i = 0; i < interiorJointsLists.at(p).size(); ++i)
+        {
+            int index = interiorJointsLists.at(p).at(i).second;
+            panel.interiorDegreesOfFreedom.append(freeIndices.at(2 * index));
+            panel.interiorDegreesOfFreedom.append(freeIndices.at(2 * index + 1));
+        }
+
+        for (int i = 0; i < boundaryJointsLists.at(p).size(); ++i)
+        {
+            int index = boundaryJointsLists.at(p).at(i).second;
+
+            for (int j = 2 * index; j <= 2 * index + 1; ++j)
+            {
+                if (freeIndices.at(j) >= 0)
+                {
+                    panel.boundaryDegreesOfFreedom.append(freeIndices.at(j));
+                }
+            }
+        }
+
+        int interiorOrder = panel.interiorDegreesOfFreedom.size();
+        int boundaryOrder = panel.boundaryDegreesOfFreedom.size();
+
+        if (boundaryOrder == 0)
+        {
+            return false;
+        }
+
+        qint64 blockEntries = qint64(interiorOrder) * (interiorOrder + boundaryOrder);
+
+        if ((interiorOrder > kMaxDenseOrder)
+                || (boundaryOrder > kMaxDenseOrder)
+                || (denseEntries + blockEntries > kMaxDenseEntries))
+        {
+            return false;
+        }
+
+        gsl_matrix *interiorStiffness         = gsl_matrix_alloc(interiorOrder, interiorOrder);
+        gsl_matrix *interiorBoundaryStiffness = gsl_matrix_alloc(interiorOrder, boundaryOrder);
+
+        for (int i = 0; i < interiorOrder; ++i)
+        {
+            int row = panel.interiorDegreesOfFreedom.at(i);
+
+            for (int j = 0; j < interiorOrder; ++j)
+            {
+                gsl_matrix_set(interiorStiffness,
+                               i,
+                               j,
+                               gsl_spmatrix_get(k11TripletFormat, row, panel.interiorDegreesOfFreedom.at(j)));
+            }
+
+            for (int j = 0; j < boundaryOrder; ++j)
+            {
+                gsl_matrix_set(interiorBoundaryStiffness,
+                               i,
+                               j,
+                               gsl_spmatrix_get(k11TripletFormat, row, panel.boundaryDegreesOfFreedom.at(j)));
+            }
+        }
+
+        panel.superelementIndex = -1;
+
+        for (int i = 0; i < mSuperelementsList.size(); ++i)
+        {
+            const Superelement &superelement = mSuperelementsList.at(i);
+
+            if (matricesEqual(superelement.interiorStiffness, interiorStiffness)
+                    && matricesEqual(superelement.interiorBoundaryStiffness, interiorBoundaryStiffness))
+            {
+                panel.superelementIndex = i;
+                break;
+            }
+        }
+
+        if (panel.superelementIndex == -1)
+        {
+            Superelement superelement;
+            superelement.interiorOrder             = interiorOrder;
+            superelement.boundaryOrder             = boundaryOrder;
+            superelement.interiorStiffness         = interiorStiffness;
+            superelement.interiorBoundaryStiffness = interiorBoundaryStiffness;
+            superelement.condensedStiffness        = 0;
+            panel.superelementIndex                = mSuperelementsList.size();
+            mSuperelementsList.append(superelement);
+            denseEntries += blockEntries;
+        }
+        else
+        {
+            gsl_matrix_free(interiorStiffness);
+            gsl_matrix_free(interiorBoundaryStiffness);
+        }
+
+        mPanelsList.append(panel);
+    }
+
+    if (mPanelsList.size() < kMinPanelsCount || mSuperelementsList.size() == mPanelsList.size())
+    {
+        return false;
+    }
+
+    //Factorise the interior block and form the condensed boundary stiffness once per superelement
+
+    for (int i = 0; i < mSuperelementsList.size(); ++i)
+    {
+        Superelement &superelement = mSuperelementsList[i];
+
+        int status = gsl_linalg_cholesky_decomp1(superelement.interiorStiffness);
+
+        if (status != GSL_SUCCESS)
+        {
+            return false;
+        }
+
+        gsl_matrix *product = gsl_matrix_alloc(superelement.interiorOrder, superelement.boundaryOrder);
+        gsl_matrix_memcpy(product, superelement.interiorBoundaryStiffness);
+        gsl_blas_dtrsm(CblasLeft,
+                       CblasLower,
+                       CblasNoTrans,
+                       CblasNonUnit,
+                       1.0,
+                       superelement.interiorStiffness,
+                       product);
+
+        superelement.condensedStiffness = gsl_matrix_alloc(superelement.boundaryOrder, superelement.boundaryOrder);
+        gsl_blas_dgemm(CblasTrans,
+                       CblasNoTrans,
+                       1.0,
+                       product,
+                       product,
+                       0.0,
+                       superelement.condensedStiffness);
+
+        gsl_matrix_free(product);
+    }
+
+    return true;
+}
+
+bool SubstructureSolver::createReducedSystem(const gsl_spmatrix *k11TripletFormat)
+{
+    int order = k11TripletFormat->size1;
+
+    mReducedIndices = QVector<int>(order, 0);
+
+    foreach (const Panel &panel, mPanelsList)
+    {
+        foreach (int index, panel.interiorDegreesOfFreedom)
+        {
+            mReducedIndices[index] = -1;
+        }
+    }
+
+    for (int i = 0; i < order; ++i)
+    {
+        if (mReducedIndices.at(i) == 0)
+        {
+            mReducedIndices[i] = mReducedDegreesOfFreedom.size();
+            mReducedDegreesOfFreedom.append(i);
+        }
+    }
+
+    int reducedOrder = mReducedDegreesOfFreedom.size();
+
+    if ((reducedOrder == 0) || (reducedOrder > kMaxDenseOrder))
+    {
+        return false;
+    }
+
+    mReducedStiffness = gsl_matrix_calloc(reducedOrder, reducedOrder);
+
+    for (size_t k = 0; k < k11TripletFormat->nz; ++k)
+    {
+        int row = mReducedIndices.at(k11TripletFormat->i[k]);
+        int col = mReducedIndices.at(k11TripletFormat->p[k]);
+
+        if (row >= 0 && col >= 0)
+        {
+            qreal value = gsl_matrix_get(mReducedStiffness, row, col) + k11TripletFormat->data[k];
+            gsl_matrix_set(mReducedStiffness, row, col, value);
+        }
+    }
+
+    foreach (const Panel &panel, mPanelsList)
+    {
+        const Superelement &superelement = mSuperelementsList.at(panel.superelementIndex);
+
+        for (int i = 0; i < superelement.boundaryOrder; ++i)
+        {
+            int row = mReducedIndices.at(panel.boundaryDegreesOfFreedom.at(i));
+
+            for (int j = 0; j < superelement.boundaryOrder; ++j)
+            {
+                int col     = mReducedIndices.at(panel.boundaryDegreesOfFreedom.at(j));
+                qreal value = gsl_matrix_get(mReducedStiffness, row, col)
+                        - gsl_matrix_get(superelement.condensedStiffness, i, j);
+                gsl_matrix_set(mReducedStiffness, row, col, value);
+            }
+        }
+    }
+
+    int status = gsl_linalg_cholesky_decomp1(mReducedStiffness);
+
+    return status == GSL_SUCCESS;
+}
+
+void SubstructureSolver::clear()
+{
+    foreach (const Superelement &superelement, mSuperelementsList)
+    {
+        gsl_matrix_free(superelement.interiorStiffness);
+        gsl_matrix_free(superelement.interiorBoundaryStiffness);
+
+        if (superelement.condensedStiffness)
+        {
+            gsl_matrix_free(superelement.condensedStiffness);
+        }
+    }
+
+    if (mReducedStiffness)
+    {
+        gsl_matrix_free(mReducedStiffness);
+    }
+
+    mSuperelementsList.clear();
+    mPanelsList.clear();
+    mReducedIndices.clear();
+    mReducedDegreesOfFreedom.clear();
+    mReducedStiffness = 0;
+    mIsActive         = false;
+}
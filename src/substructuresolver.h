@@ -0,0 +1,134 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* substructuresolver.h */
+
+#ifndef SUBSTRUCTURESOLVER_H
+#define SUBSTRUCTURESOLVER_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QSet>
+#include <QtConcurrent>
+#include <QVector>
+
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_vector.h>
+
+#include "bar.h"
+#include "joint.h"
+
+//Detects panels repeated along a translation, condenses their interior degrees of freedom into boundary
+//superelements and solves the reduced interface system. Identical panels share one condensed superelement.
+class SubstructureSolver
+{
+    public:
+        SubstructureSolver(const QList<Joint *> &jointsList,
+                           const QList<Bar *>   &barsList,
+                           const QList<int>     &degreesOfFreedom,
+                           const gsl_spmatrix   *k11TripletFormat);
+
+        ~SubstructureSolver();
+
+        static const int kMinPanelsCount      = 3;
+        static const int kMaxPeriodCandidates = 32;
+
+        //Largest interior, boundary or reduced order held in a dense matrix, above which the solver stays inactive
+        static const int kMaxDenseOrder = 4000;
+
+        //Entries of the dense interior blocks kept for all superelements together
+        static const qint64 kMaxDenseEntries = 16000000;
+
+        static const qreal kCoordinateTolerance = 1.0e-6;
+        static const qreal kStiffnessTolerance  = 1.0e-9;
+
+        bool isActive() const;
+
+        int panelsCount() const;
+
+        int superelementsCount() const;
+
+        int reducedOrder() const;
+
+        qint64 factorNonZeros() const;
+
+        int solve(const gsl_vector *loadsColumnVector, gsl_vector *deflectionsColumnVector) const;
+
+    private:
+        struct Superelement
+        {
+            int        interiorOrder;
+            int        boundaryOrder;
+            gsl_matrix *interiorStiffness;
+            gsl_matrix *interiorBoundaryStiffness;
+            gsl_matrix *condensedStiffness;
+        };
+
+        struct Panel
+        {
+            int          superelementIndex;
+            QVector<int> interiorDegreesOfFreedom;
+            QVector<int> boundaryDegreesOfFreedom;
+        };
+
+        struct PanelWork
+        {
+            const Superelement *superelement;
+            const Panel        *panel;
+            const gsl_vector   *loadsColumnVector;
+            gsl_vector         *deflectionsColumnVector;
+            gsl_vector         *interiorColumnVector;
+            gsl_vector         *boundaryColumnVector;
+        };
+
+        static void condensePanelLoads(PanelWork &work);
+
+        static void recoverPanelDeflections(PanelWork &work);
+
+        static bool matricesEqual(const gsl_matrix *matrixA, const gsl_matrix *matrixB);
+
+        bool findPeriod(const QList<Joint *> &jointsList,
+                        const QList<Bar *>   &barsList,
+                        qreal                tolerance,
+                        qreal                &periodX,
+                        qreal                &periodY) const;
+
+        bool createPanels(const QList<Joint *> &jointsList,
+                          const QList<Bar *>   &barsList,
+                          const QList<int>     &degreesOfFreedom,
+                          const gsl_spmatrix   *k11TripletFormat);
+
+        bool createReducedSystem(const gsl_spmatrix *k11TripletFormat);
+
+        void clear();
+
+        QVector<Superelement> mSuperelementsList;
+        QVector<Panel>        mPanelsList;
+        QVector<int>          mReducedIndices;
+        QVector<int>          mReducedDegreesOfFreedom;
+        gsl_matrix            *mReducedStiffness;
+        bool                  mIsActive;
+};
+
+#endif // SUBSTRUCTURESOLVER_H
@@ -0,0 +1,396 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* symmetrysolver.cpp */
+
+#include "symmetrysolver.h"
+
+SymmetrySolver::SymmetrySolver(const QList<Joint *> &jointsList,
+                               const QList<int>     &degreesOfFreedom,
+                               const gsl_spmatrix   *k11TripletFormat)
+{
+    mMirrorAxis             = NO_AXIS;
+    mAxisCoordinate         = 0.0;
+    mSymmetricStiffness     = 0;
+    mAntisymmetricStiffness = 0;
+    mIsActive               = false;
+
+    QList<MirrorAxis> axesList;
+    axesList.append(VERTICAL_AXIS);
+    axesList.append(HORIZONTAL_AXIS);
+
+    foreach (MirrorAxis axis, axesList)
+    {
+        QVector<int> mirrorJoints;
+
+        if (findMirrorJoints(jointsList, axis, mirrorJoints)
+                && createHalfModels(degreesOfFreedom, mirrorJoints, axis, k11TripletFormat))
+        {
+            mIsActive = true;
+            break;
+        }
+
+        clear();
+    }
+}
+
+SymmetrySolver::~SymmetrySolver()
+{
+    clear();
+}
+
+bool SymmetrySolver::isActive() const
+{
+    return mIsActive;
+}
+
+SymmetrySolver::MirrorAxis SymmetrySolver::mirrorAxis() const
+{
+    return mMirrorAxis;
+}
+
+qreal SymmetrySolver::axisCoordinate() const
+{
+    return mAxisCoordinate;
+}
+
+int SymmetrySolver::symmetricOrder() const
+{
+    return mSymmetricStiffness ? int(mSymmetricStiffness->size1) : 0;
+}
+
+int SymmetrySolver::antisymmetricOrder() const
+{
+    return mAntisymmetricStiffness ? int(mAntisymmetricStiffness->size1) : 0;
+}
+
+qint64 SymmetrySolver::factorNonZeros() const
+{
+    qint64 symmetric     = symmetricOrder();
+    qint64 antisymmetric = antisymmetricOrder();
+
+    return symmetric * (symmetric + 1) / 2 + antisymmetric * (antisymmetric + 1) / 2;
+}
+
+int SymmetrySolver::solve(const gsl_vector *loadsColumnVector, gsl_vector *deflectionsColumnVector) const
+{
+    if (!mIsActive)
+    {
+        return GSL_FAILURE;
+    }
+
+    //Project the loads onto the symmetric and antisymmetric half models
+
+    int order                             = mSymmetricIndices.size();
+    gsl_vector *symmetricColumnVector     = gsl_vector_calloc(mSymmetricStiffness->size1);
+    gsl_vector *antisymmetricColumnVector = gsl_vector_calloc(mAntisymmetricStiffness->size1);
+
+    for (int i = 0; i < order; ++i)
+    {
+        qreal load = gsl_vector_get(loadsColumnVector, i);
+
+        if (mSymmetricIndices.at(i) >= 0)
+        {
+            int index   = mSymmetricIndices.at(i);
+            qreal value = gsl_vector_get(symmetricColumnVector, index) + mSymmetricCoefficients.at(i) * load;
+            gsl_vector_set(symmetricColumnVector, index, value);
+        }
+
+        if (mAntisymmetricIndices.at(i) >= 0)
+        {
+            int index   = mAntisymmetricIndices.at(i);
+            qreal value = gsl_vector_get(antisymmetricColumnVector, index) + mAntisymmetricCoefficients.at(i) * load;
+            gsl_vector_set(antisymmetricColumnVector, index, value);
+        }
+    }
+
+    int status = gsl_linalg_cholesky_svx(mSymmetricStiffness, symmetricColumnVector);
+
+    if (status == GSL_SUCCESS)
+    {
+        status = gsl_linalg_cholesky_svx(mAntisymmetricStiffness, antisymmetricColumnVector);
+    }
+
+    //Recombine both half model solutions on the full model
+
+    if (status == GSL_SUCCESS)
+    {
+        for (int i = 0; i < order; ++i)
+        {
+            qreal value = 0.0;
+
+            if (mSymmetricIndices.at(i) >= 0)
+            {
+                value += mSymmetricCoefficients.at(i)
+                        * gsl_vector_get(symmetricColumnVector, mSymmetricIndices.at(i));
+            }
+
+            if (mAntisymmetricIndices.at(i) >= 0)
+            {
+                value += mAntisymmetricCoefficients.at(i)
+                        * gsl_vector_get(antisymmetricColumnVector, mAntisymmetricIndices.at(i));
+            }
+
+            gsl_vector_set(deflectionsColumnVector, i, value);
+        }
+    }
+
+    gsl_vector_free(symmetricColumnVector);
+    gsl_vector_free(antisymmetricColumnVector);
+
+    return status;
+}
+
+bool SymmetrySolver::findMirrorJoints(const QList<Joint *> &jointsList, MirrorAxis axis, QVector<int> &mirrorJoints)
+{
+    int count = jointsList.size();
+
+    if (count < 2)
+    {
+        return false;
+    }
+
+    qreal minX = jointsList.first()->xCoordinate();
+    qreal maxX = minX;
+    qreal minY = jointsList.first()->yCoordinate();
+    qreal maxY = minY;
+
+    foreach (const Joint *joint, jointsList)
+    {
+        minX = std::min(minX, joint->xCoordinate());
+        maxX = std::max(maxX, joint->xCoordinate());
+        minY = std::min(minY, joint->yCoordinate());
+        maxY = std::max(maxY, joint->yCoordinate());
+    }
+
+    qreal extent = std::max(maxX - minX, maxY - minY);
+
+    if (extent <= 0.0)
+    {
+        return false;
+    }
+
+    qreal tolerance      = kCoordinateTolerance * extent;
+    qreal axisCoordinate = (axis == VERTICAL_AXIS) ? (minX + maxX) / 2.0 : (minY + maxY) / 2.0;
+
+    QHash<QPair<qint64, qint64>, int> coordinatesHash;
+
+    for (int i = 0; i < count; ++i)
+    {
+        coordinatesHash.insert(qMakePair(qRound64(jointsList.at(i)->xCoordinate() / tolerance),
+                                         qRound64(jointsList.at(i)->yCoordinate() / tolerance)), i);
+    }
+
+    mirrorJoints = QVector<int>(count, -1);
+
+    for (int i = 0; i < count; ++i)
+    {
+        qreal x = jointsList.at(i)->xCoordinate();
+        qreal y = jointsList.at(i)->yCoordinate();
+
+        if (axis == VERTICAL_AXIS)
+        {
+            x = 2.0 * axisCoordinate - x;
+        }
+        else
+        {
+            y = 2.0 * axisCoordinate - y;
+        }
+
+        QPair<qint64, qint64> key = qMakePair(qRound64(x / tolerance), qRound64(y / tolerance));
+
+        if (!coordinatesHash.contains(key))
+        {
+            return false;
+        }
+
+        mirrorJoints[i] = coordinatesHash.value(key);
+    }
+
+    mMirrorAxis     = axis;
+    mAxisCoordinate = axisCoordinate;
+
+    return true;
+}
+
+bool SymmetrySolver::createHalfModels(const QList<int>   &degreesOfFreedom,
+                                      const QVector<int> &mirrorJoints,
+                                      MirrorAxis         axis,
+                                      const gsl_spmatrix *k11TripletFormat)
+{
+    //Map every free degree of freedom onto its mirror image; the component normal to the axis changes sign
+
+    int order = k11TripletFormat->size1;
+
+    QVector<int> freeIndices(2 * mirrorJoints.size(), -1);
+
+    for (int i = 0; i < degreesOfFreedom.size(); ++i)
+    {
+        freeIndices[degreesOfFreedom.at(i)] = i;
+    }
+
+    QVector<int> mirrorIndices(order);
+    QVector<qreal> mirrorSigns(order);
+
+    for (int i = 0; i < order; ++i)
+    {
+        int degreeOfFreedom = degreesOfFreedom.at(i);
+        int component       = degreeOfFreedom % 2;
+        int mirrorIndex     = freeIndices.at(2 * mirrorJoints.at(degreeOfFreedom / 2) + component);
+
+        if (mirrorIndex < 0)
+        {
+            return false;
+        }
+
+        mirrorIndices[i] = mirrorIndex;
+        mirrorSigns[i]   = ((axis == VERTICAL_AXIS) == (component == 0)) ? -1.0 : 1.0;
+    }
+
+    //The stiffness matrix must be invariant under the reflection
+
+    qreal scale = 0.0;
+
+    for (size_t k = 0; k < k11TripletFormat->nz; ++k)
+    {
+        scale = std::max(scale, std::fabs(k11TripletFormat->data[k]));
+    }
+
+    for (size_t k = 0; k < k11TripletFormat->nz; ++k)
+    {
+        int row        = k11TripletFormat->i[k];
+        int col        = k11TripletFormat->p[k];
+        qreal expected = mirrorSigns.at(row) * mirrorSigns.at(col) * k11TripletFormat->data[k];
+        qreal actual   = gsl_spmatrix_get(k11TripletFormat, mirrorIndices.at(row), mirrorIndices.at(col));
+
+        if (std::fabs(actual - expected) > kStiffnessTolerance * scale)
+        {
+            return false;
+        }
+    }
+
+    //Build the symmetric and antisymmetric bases: one vector per mirrored pair in each, while degrees of freedom
+    //on the axis belong to the symmetric or antisymmetric half only
+
+    mSymmetricIndices          = QVector<int>(order, -1);
+    mSymmetricCoefficients     = QVector<qreal>(order, 0.0);
+    mAntisymmetricIndices      = QVector<int>(order, -1);
+    mAntisymmetricCoefficients = QVector<qreal>(order, 0.0);
+
+    int symmetricOrder     = 0;
+    int antisymmetricOrder = 0;
+    bool hasMirroredPairs  = false;
+
+    for (int i = 0; i < order; ++i)
+    {
+        int mirrorIndex = mirrorIndices.at(i);
+
+        if (mirrorIndex == i)
+        {
+            if (mirrorSigns.at(i) > 0.0)
+            {
+                mSymmetricIndices[i]      = symmetricOrder++;
+                mSymmetricCoefficients[i] = 1.0;
+            }
+            else
+            {
+                mAntisymmetricIndices[i]      = antisymmetricOrder++;
+                mAntisymmetricCoefficients[i] = 1.0;
+            }
+        }
+        else if (i < mirrorIndex)
+        {
+            mSymmetricIndices[i]                    = symmetricOrder;
+            mSymmetricIndices[mirrorIndex]          = symmetricOrder++;
+            mSymmetricCoefficients[i]               = 1.0;
+            mSymmetricCoefficients[mirrorIndex]     = mirrorSigns.at(i);
+            mAntisymmetricIndices[i]                = antisymmetricOrder;
+            mAntisymmetricIndices[mirrorIndex]      = antisymmetricOrder++;
+            mAntisymmetricCoefficients[i]           = 1.0;
+            mAntisymmetricCoefficients[mirrorIndex] = -mirrorSigns.at(i);
+            hasMirroredPairs                        = true;
+        }
+    }
+
+    if (!hasMirroredPairs || symmetricOrder == 0 || antisymmetricOrder == 0)
+    {
+        return false;
+    }
+
+    if (symmetricOrder > kMaxDenseOrder || antisymmetricOrder > kMaxDenseOrder)
+    {
+        return false;
+    }
+
+    mSymmetricStiffness     = gsl_matrix_calloc(symmetricOrder, symmetricOrder);
+    mAntisymmetricStiffness = gsl_matrix_calloc(antisymmetricOrder, antisymmetricOrder);
+
+    for (size_t k = 0; k < k11TripletFormat->nz; ++k)
+    {
+        int row     = k11TripletFormat->i[k];
+        int col     = k11TripletFormat->p[k];
+        qreal entry = k11TripletFormat->data[k];
+
+        if (mSymmetricIndices.at(row) >= 0 && mSymmetricIndices.at(col) >= 0)
+        {
+            int rowIndex = mSymmetricIndices.at(row);
+            int colIndex = mSymmetricIndices.at(col);
+            qreal value  = gsl_matrix_get(mSymmetricStiffness, rowIndex, colIndex)
+                    + mSymmetricCoefficients.at(row) * mSymmetricCoefficients.at(col) * entry;
+            gsl_matrix_set(mSymmetricStiffness, rowIndex, colIndex, value);
+        }
+
+        if (mAntisymmetricIndices.at(row) >= 0 && mAntisymmetricIndices.at(col) >= 0)
+        {
+            int rowIndex = mAntisymmetricIndices.at(row);
+            int colIndex = mAntisymmetricIndices.at(col);
+            qreal value  = gsl_matrix_get(mAntisymmetricStiffness, rowIndex, colIndex)
+                    + mAntisymmetricCoefficients.at(row) * mAntisymmetricCoefficients.at(col) * entry;
+            gsl_matrix_set(mAntisymmetricStiffness, rowIndex, colIndex, value);
+        }
+    }
+
+    //Factorise both half models side by side
+
+    QFuture<int> symmetricFuture = QtConcurrent::run(gsl_linalg_cholesky_decomp1, mSymmetricStiffness);
+    int antisymmetricStatus      = gsl_linalg_cholesky_decomp1(mAntisymmetricStiffness);
+    int symmetricStatus          = symmetricFuture.result();
+
+    return symmetricStatus == GSL_SUCCESS && antisymmetricStatus == GSL_SUCCESS;
+}
+
+void SymmetrySolver::clear()
+{
+    if (mSymmetricStiffness)
+    {
+        gsl_matrix_free(mSymmetricStiffness);
+    }
+
+    if (mAntisymmetricStiffness)
+    {
+        gsl_matrix_free(mAntisymmetricStiffness);
+    }
+
+    mSymmetricIndices.clear();
+    mSymmetricCoefficients.clear();
+    mAntisymmetricIndices.clear();
+    mAntisymmetricCoefficients.clear();
+    mSymmetricStiffness     = 0;
+    mAntisymmetricStiffness = 0;
+    mMirrorAxis             = NO_AXIS;
+    mAxisCoordinate         = 0.0;
+    mIsActive               = false;
+}
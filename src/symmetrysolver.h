@@ -0,0 +1,99 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* symmetrysolver.h */
+
+#ifndef SYMMETRYSOLVER_H
+#define SYMMETRYSOLVER_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <QFuture>
+#include <QHash>
+#include <QList>
+#include <QPair>
+#include <QtConcurrent>
+#include <QVector>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_vector.h>
+
+#include "joint.h"
+
+//Detects a mirror axis of geometry, supports and stiffness, splits every load vector into its symmetric and
+//antisymmetric parts and solves each part on a half model
+class SymmetrySolver
+{
+    public:
+        enum MirrorAxis
+        {
+            NO_AXIS,
+            VERTICAL_AXIS,
+            HORIZONTAL_AXIS
+        };
+
+        SymmetrySolver(const QList<Joint *> &jointsList,
+                       const QList<int>     &degreesOfFreedom,
+                       const gsl_spmatrix   *k11TripletFormat);
+
+        ~SymmetrySolver();
+
+        static const qreal kCoordinateTolerance = 1.0e-6;
+        static const qreal kStiffnessTolerance  = 1.0e-9;
+
+        //Largest half model order held in a dense matrix, above which the solver stays inactive
+        static const int kMaxDenseOrder = 4000;
+
+        bool isActive() const;
+
+        MirrorAxis mirrorAxis() const;
+
+        qreal axisCoordinate() const;
+
+        int symmetricOrder() const;
+
+        int antisymmetricOrder() const;
+
+        qint64 factorNonZeros() const;
+
+        int solve(const gsl_vector *loadsColumnVector, gsl_vector *deflectionsColumnVector) const;
+
+    private:
+        bool findMirrorJoints(const QList<Joint *> &jointsList, MirrorAxis axis, QVector<int> &mirrorJoints);
+
+        bool createHalfModels(const QList<int>   &degreesOfFreedom,
+                              const QVector<int> &mirrorJoints,
+                              MirrorAxis         axis,
+                              const gsl_spmatrix *k11TripletFormat);
+
+        void clear();
+
+        MirrorAxis     mMirrorAxis;
+        qreal          mAxisCoordinate;
+        QVector<int>   mSymmetricIndices;
+        QVector<qreal> mSymmetricCoefficients;
+        QVector<int>   mAntisymmetricIndices;
+        QVector<qreal> mAntisymmetricCoefficients;
+        gsl_matrix     *mSymmetricStiffness;
+        gsl_matrix     *mAntisymmetricStiffness;
+        bool           mIsActive;
+};
+
+#endif // SYMMETRYSOLVER_H
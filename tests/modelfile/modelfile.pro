@@ -0,0 +1,10 @@
+include(../tests.pri)
+
+QT += concurrent
+
+TARGET = tst_modelfile
+
+SOURCES += tst_modelfile.cpp \
+           ../../src/modelfile.cpp
+
+HEADERS += ../../src/modelfile.h
@@ -0,0 +1,264 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* tst_modelfile.cpp */
+
+#include <QBuffer>
+#include <QDataStream>
+#include <QTemporaryFile>
+#include <QtEndian>
+#include <QtTest>
+
+#include "modelfile.h"
+
+//Model files written and read back raw and compressed, files of the earlier single stream format, and images that
+//must be refused
+class TestModelFile : public QObject
+{
+        Q_OBJECT
+
+    private slots:
+        void roundTrip_data();
+
+        void roundTrip();
+
+        void legacyFormat();
+
+        void malformedImage();
+
+    private:
+        //A chain of joints along a gentle curve, with a bar between each pair of neighbours, a support at each end
+        //and a load at the second joint
+        static void fillChain(ModelFile *modelFile, int jointsCount);
+
+        static QByteArray image(const ModelFile &modelFile);
+};
+
+void TestModelFile::fillChain(ModelFile *modelFile, int jointsCount)
+{
+    QVector<qreal> xCoordinates;
+    QVector<qreal> yCoordinates;
+    QVector<qint32> firstJoints;
+    QVector<qint32> secondJoints;
+    QVector<qreal> factors;
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        xCoordinates.append(0.25 * i);
+        yCoordinates.append(1.0e-3 * i * (jointsCount - i));
+    }
+
+    for (int i = 1; i < jointsCount; ++i)
+    {
+        firstJoints.append(i);
+        secondJoints.append(i + 1);
+        factors.append(1.0 + (i % 3));
+    }
+
+    modelFile->setProperty(ModelFile::VERSION, QString("2.0"));
+    modelFile->setProperty(ModelFile::DESCRIPTION, QString("Chain of %1 joints, écrit en UTF-8").arg(jointsCount));
+    modelFile->setProperty(ModelFile::AXIAL_RIGIDITY_OPTION, QString("false"));
+    modelFile->setReals(ModelFile::JOINT_X_COORDINATES, xCoordinates);
+    modelFile->setReals(ModelFile::JOINT_Y_COORDINATES, yCoordinates);
+    modelFile->setIntegers(ModelFile::BAR_FIRST_JOINTS, firstJoints);
+    modelFile->setIntegers(ModelFile::BAR_SECOND_JOINTS, secondJoints);
+    modelFile->setReals(ModelFile::BAR_AREAS, QVector<qreal>(jointsCount - 1, 0.0));
+    modelFile->setReals(ModelFile::BAR_MODULI, QVector<qreal>(jointsCount - 1, 0.0));
+    modelFile->setReals(ModelFile::BAR_FACTORS, factors);
+    modelFile->setReals(ModelFile::BAR_UNIT_WEIGHTS, QVector<qreal>(jointsCount - 1, 0.0));
+    modelFile->setIntegers(ModelFile::SUPPORT_JOINTS, QVector<qint32>() << 1 << jointsCount);
+    modelFile->setIntegers(ModelFile::SUPPORT_TYPES, QVector<qint32>() << 3 << 8);
+    modelFile->setReals(ModelFile::SUPPORT_ANGLES, QVector<qreal>() << 0.0 << 0.0);
+    modelFile->setIntegers(ModelFile::JOINT_LOAD_JOINTS, QVector<qint32>() << 2);
+    modelFile->setReals(ModelFile::JOINT_LOAD_HORIZONTAL_COMPONENTS, QVector<qreal>() << 0.0);
+    modelFile->setReals(ModelFile::JOINT_LOAD_VERTICAL_COMPONENTS, QVector<qreal>() << -10.0);
+    modelFile->setTexts(ModelFile::JOINT_LOAD_POSITIONS, QStringList() << QString("tail"));
+}
+
+QByteArray TestModelFile::image(const ModelFile &modelFile)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    if (!modelFile.write(&buffer))
+    {
+        return QByteArray();
+    }
+
+    return buffer.data();
+}
+
+void TestModelFile::roundTrip_data()
+{
+    QTest::addColumn<bool>("compressed");
+    QTest::addColumn<int>("jointsCount");
+    QTest::addColumn<int>("majorVersion");
+
+    //Enough joints in the compressed file for its coordinate sections to span several blocks
+
+    QTest::newRow("raw") << false << 50 << int(ModelFile::kFirstMajorVersion);
+    QTest::newRow("compressed") << true << 300000 << int(ModelFile::kMajorVersion);
+}
+
+void TestModelFile::roundTrip()
+{
+    QFETCH(bool, compressed);
+    QFETCH(int, jointsCount);
+    QFETCH(int, majorVersion);
+
+    ModelFile written;
+    fillChain(&written, jointsCount);
+    written.setCompressed(compressed);
+
+    QByteArray contents = image(written);
+
+    QVERIFY(!contents.isEmpty());
+    QCOMPARE(qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(contents.constData())),
+             quint32(ModelFile::kMagic));
+    QCOMPARE(int(qFromLittleEndian<quint16>(reinterpret_cast<const uchar *>(contents.constData()) + 4)), majorVersion);
+
+    if (compressed)
+    {
+        ModelFile raw;
+        fillChain(&raw, jointsCount);
+
+        QVERIFY(contents.size() < image(raw).size() / 2);
+    }
+
+    ModelFile read;
+
+    QVERIFY(read.openContents(contents));
+    QCOMPARE(read.error(), ModelFile::NO_FILE_ERROR);
+    QVERIFY(!read.isLegacyFormat());
+    QVERIFY(read.isConsistent());
+    QCOMPARE(read.sections(), written.sections());
+
+    QCOMPARE(read.property(ModelFile::VERSION), written.property(ModelFile::VERSION));
+    QCOMPARE(read.property(ModelFile::DESCRIPTION), written.property(ModelFile::DESCRIPTION));
+    QCOMPARE(read.count(ModelFile::JOINT_X_COORDINATES), jointsCount);
+    QCOMPARE(read.count(ModelFile::LENGTH_ERRORS), 0);
+
+    QCOMPARE(read.reals(ModelFile::JOINT_X_COORDINATES), written.reals(ModelFile::JOINT_X_COORDINATES));
+    QCOMPARE(read.reals(ModelFile::JOINT_Y_COORDINATES), written.reals(ModelFile::JOINT_Y_COORDINATES));
+    QCOMPARE(read.integers(ModelFile::BAR_FIRST_JOINTS), written.integers(ModelFile::BAR_FIRST_JOINTS));
+    QCOMPARE(read.integers(ModelFile::BAR_SECOND_JOINTS), written.integers(ModelFile::BAR_SECOND_JOINTS));
+    QCOMPARE(read.reals(ModelFile::BAR_FACTORS), written.reals(ModelFile::BAR_FACTORS));
+    QCOMPARE(read.integers(ModelFile::SUPPORT_TYPES), written.integers(ModelFile::SUPPORT_TYPES));
+    QCOMPARE(read.reals(ModelFile::JOINT_LOAD_VERTICAL_COMPONENTS), QVector<qreal>() << -10.0);
+    QCOMPARE(read.texts(ModelFile::JOINT_LOAD_POSITIONS), QStringList() << QString("tail"));
+
+    //Copied sections are decoded and written again, compressed when the file is
+
+    ModelFile copied;
+    copied.copySection(read, ModelFile::JOINT_X_COORDINATES);
+    copied.setCompressed(compressed);
+
+    ModelFile copiedRead;
+
+    QVERIFY(copiedRead.openContents(image(copied)));
+    QCOMPARE(copiedRead.reals(ModelFile::JOINT_X_COORDINATES), written.reals(ModelFile::JOINT_X_COORDINATES));
+}
+
+void TestModelFile::legacyFormat()
+{
+    //The single stream of the earlier format, big-endian as QDataStream writes it, with no loads
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_4);
+
+    out << ModelFile::kLegacyMagic;
+
+    for (int i = ModelFile::VERSION; i <= ModelFile::LENGTH_ERROR_UNIT; ++i)
+    {
+        out << QString("property %1").arg(i);
+    }
+
+    out << (QList<qreal>() << 0.0 << 3.0 << 1.5);
+    out << (QList<qreal>() << 0.0 << 0.0 << 2.0);
+    out << QString("false");
+    out << (QList<qint32>() << 1 << 2 << 3);
+    out << (QList<qint32>() << 2 << 3 << 1);
+    out << (QList<qreal>() << 0.0 << 0.0 << 0.0);
+    out << (QList<qreal>() << 0.0 << 0.0 << 0.0);
+    out << (QList<qreal>() << 1.0 << 1.0 << 2.0);
+    out << (QList<qreal>() << 0.0 << 0.0 << 0.0);
+    out << (QList<qint32>() << 1 << 2);
+    out << (QList<qint32>() << 3 << 8);
+    out << (QList<qreal>() << 0.0 << 0.0);
+    out << false;
+
+    file.close();
+
+    ModelFile read;
+
+    QVERIFY(read.open(file.fileName()));
+    QVERIFY(read.isLegacyFormat());
+    QVERIFY(read.isConsistent());
+    QCOMPARE(read.property(ModelFile::DESCRIPTION), QString("property %1").arg(int(ModelFile::DESCRIPTION)));
+    QCOMPARE(read.property(ModelFile::AXIAL_RIGIDITY_OPTION), QString("false"));
+    QCOMPARE(read.reals(ModelFile::JOINT_X_COORDINATES), QVector<qreal>() << 0.0 << 3.0 << 1.5);
+    QCOMPARE(read.reals(ModelFile::JOINT_Y_COORDINATES), QVector<qreal>() << 0.0 << 0.0 << 2.0);
+    QCOMPARE(read.integers(ModelFile::BAR_SECOND_JOINTS), QVector<qint32>() << 2 << 3 << 1);
+    QCOMPARE(read.reals(ModelFile::BAR_FACTORS), QVector<qreal>() << 1.0 << 1.0 << 2.0);
+    QCOMPARE(read.integers(ModelFile::SUPPORT_TYPES), QVector<qint32>() << 3 << 8);
+    QCOMPARE(read.count(ModelFile::JOINT_LOAD_JOINTS), 0);
+}
+
+void TestModelFile::malformedImage()
+{
+    ModelFile written;
+    fillChain(&written, 50);
+
+    QByteArray contents = image(written);
+
+    //Wrong magic
+
+    QByteArray wrongMagic = contents;
+    wrongMagic[0] = wrongMagic.at(0) ^ 0x01;
+
+    ModelFile readA;
+    QVERIFY(!readA.openContents(wrongMagic));
+    QCOMPARE(readA.error(), ModelFile::FORMAT_ERROR);
+
+    //Section table cut short
+
+    ModelFile readB;
+    QVERIFY(!readB.openContents(contents.left(ModelFile::kHeaderSize + ModelFile::kSectionEntrySize / 2)));
+    QCOMPARE(readB.error(), ModelFile::FORMAT_ERROR);
+
+    //Sections cut short, which the table then points past
+
+    ModelFile readC;
+    QVERIFY(!readC.openContents(contents.left(contents.size() - 8)));
+    QCOMPARE(readC.error(), ModelFile::FORMAT_ERROR);
+
+    //A section length of INT_MAX + 1 in the first entry of the table, past the end of the file as well
+
+    QByteArray longSection = contents;
+    uchar *entryData = reinterpret_cast<uchar *>(longSection.data()) + ModelFile::kHeaderSize;
+    qToLittleEndian<quint64>(quint64(INT_MAX) + 1, entryData + 24);
+
+    ModelFile readD;
+    QVERIFY(!readD.openContents(longSection));
+    QCOMPARE(readD.error(), ModelFile::FORMAT_ERROR);
+}
+
+QTEST_APPLESS_MAIN(TestModelFile)
+
+#include "tst_modelfile.moc"
@@ -0,0 +1,12 @@
+include(../tests.pri)
+
+QT += concurrent
+
+TARGET = tst_modeltablefile
+
+SOURCES += tst_modeltablefile.cpp \
+           ../../src/modelfile.cpp \
+           ../../src/modeltablefile.cpp
+
+HEADERS += ../../src/modelfile.h \
+           ../../src/modeltablefile.h
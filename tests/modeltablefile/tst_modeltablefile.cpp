@@ -0,0 +1,182 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* tst_modeltablefile.cpp */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <QBuffer>
+#include <QtTest>
+
+#include "modelfile.h"
+#include "modeltablefile.h"
+
+//Numbers of CSV tables as the in-place parsers read them. Reals must come out bit for bit as strtod rounds them, on
+//the exact path of up to 19 digits and on the fallback past it, and integers must stay within 32 bits.
+class TestModelTableFile : public QObject
+{
+        Q_OBJECT
+
+    private slots:
+        void reals_data();
+
+        void reals();
+
+        void integers_data();
+
+        void integers();
+
+    private:
+        static bool readTable(const QByteArray &contents, ModelFile *modelFile, ModelTableFile::Table *table);
+};
+
+bool TestModelTableFile::readTable(const QByteArray &contents, ModelFile *modelFile, ModelTableFile::Table *table)
+{
+    QBuffer buffer;
+    buffer.setData(contents);
+    buffer.open(QIODevice::ReadOnly);
+
+    QString errorMessage;
+
+    return ModelTableFile::read(&buffer, ModelTableFile::CSV, modelFile, table, &errorMessage);
+}
+
+void TestModelTableFile::reals_data()
+{
+    QTest::addColumn<QByteArray>("text");
+    QTest::addColumn<bool>("isValid");
+
+    QTest::newRow("zero") << QByteArray("0") << true;
+    QTest::newRow("negative zero") << QByteArray("-0") << true;
+    QTest::newRow("plus sign") << QByteArray("+1.5") << true;
+    QTest::newRow("spaces") << QByteArray("  2.25  ") << true;
+    QTest::newRow("no integer part") << QByteArray(".5") << true;
+    QTest::newRow("no fraction") << QByteArray("5.") << true;
+    QTest::newRow("tenth") << QByteArray("0.1") << true;
+    QTest::newRow("exponent") << QByteArray("1e3") << true;
+    QTest::newRow("negative exponent") << QByteArray("1E-3") << true;
+    QTest::newRow("signed exponent") << QByteArray("-2.5e+10") << true;
+    QTest::newRow("exact power limit") << QByteArray("1e22") << true;
+    QTest::newRow("past exact power limit") << QByteArray("1e23") << true;
+    QTest::newRow("18 digits") << QByteArray("123456789012345678") << true;
+    QTest::newRow("19 digits") << QByteArray("1234567890123456789") << true;
+    QTest::newRow("23 digits") << QByteArray("12345678901234567890123") << true;
+    QTest::newRow("22 fraction digits") << QByteArray("0.1234567890123456789012") << true;
+    QTest::newRow("trailing zeros past 19 digits") << QByteArray("1.0000000000000000000000") << true;
+    QTest::newRow("2^53") << QByteArray("9007199254740992") << true;
+    QTest::newRow("2^53 + 1") << QByteArray("9007199254740993") << true;
+    QTest::newRow("leading zeros") << QByteArray("0000000000000000000000012.5") << true;
+    QTest::newRow("largest") << QByteArray("1.7976931348623157e308") << true;
+
+    QTest::newRow("sign alone") << QByteArray("-") << false;
+    QTest::newRow("point alone") << QByteArray(".") << false;
+    QTest::newRow("exponent without digits") << QByteArray("1e") << false;
+    QTest::newRow("exponent sign alone") << QByteArray("1e+") << false;
+    QTest::newRow("two points") << QByteArray("1.2.3") << false;
+    QTest::newRow("two signs") << QByteArray("+-1") << false;
+    QTest::newRow("trailing letter") << QByteArray("1x") << false;
+    QTest::newRow("hexadecimal") << QByteArray("0x10") << false;
+    QTest::newRow("letters") << QByteArray("abc") << false;
+    QTest::newRow("infinity") << QByteArray("inf") << false;
+    QTest::newRow("not a number") << QByteArray("nan") << false;
+    QTest::newRow("overflow") << QByteArray("1e400") << false;
+    QTest::newRow("inner space") << QByteArray("1 5") << false;
+}
+
+void TestModelTableFile::reals()
+{
+    QFETCH(QByteArray, text);
+    QFETCH(bool, isValid);
+
+    ModelFile modelFile;
+    ModelTableFile::Table table;
+
+    bool isRead = readTable(QByteArray("x,y\n") + text + QByteArray(",0\n"), &modelFile, &table);
+
+    QCOMPARE(isRead, isValid);
+
+    if (!isValid)
+    {
+        return;
+    }
+
+    QCOMPARE(table, ModelTableFile::JOINTS);
+
+    QVector<qreal> values = modelFile.reals(ModelFile::JOINT_X_COORDINATES);
+
+    QCOMPARE(values.size(), 1);
+
+    double expected = std::strtod(text.trimmed().constData(), 0);
+    double value    = values.first();
+
+    QVERIFY2(std::memcmp(&value, &expected, sizeof(double)) == 0,
+             qPrintable(QString("%1 read as %2, strtod gives %3").arg(QString(text))
+                        .arg(value, 0, 'g', 17)
+                        .arg(expected, 0, 'g', 17)));
+}
+
+void TestModelTableFile::integers_data()
+{
+    QTest::addColumn<QByteArray>("text");
+    QTest::addColumn<bool>("isValid");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("zero") << QByteArray("0") << true << 0;
+    QTest::newRow("positive") << QByteArray("42") << true << 42;
+    QTest::newRow("plus sign") << QByteArray("+7") << true << 7;
+    QTest::newRow("negative") << QByteArray("-7") << true << -7;
+    QTest::newRow("spaces") << QByteArray(" 12 ") << true << 12;
+    QTest::newRow("leading zeros") << QByteArray("000000000000000000000031") << true << 31;
+    QTest::newRow("largest") << QByteArray("2147483647") << true << int(INT_MAX);
+    QTest::newRow("smallest") << QByteArray("-2147483648") << true << int(INT_MIN);
+
+    QTest::newRow("past largest") << QByteArray("2147483648") << false << 0;
+    QTest::newRow("past smallest") << QByteArray("-2147483649") << false << 0;
+    QTest::newRow("20 digits") << QByteArray("99999999999999999999") << false << 0;
+    QTest::newRow("sign alone") << QByteArray("-") << false << 0;
+    QTest::newRow("fraction") << QByteArray("1.0") << false << 0;
+    QTest::newRow("exponent") << QByteArray("1e3") << false << 0;
+    QTest::newRow("two signs") << QByteArray("--1") << false << 0;
+    QTest::newRow("letters") << QByteArray("one") << false << 0;
+    QTest::newRow("inner space") << QByteArray("1 2") << false << 0;
+}
+
+void TestModelTableFile::integers()
+{
+    QFETCH(QByteArray, text);
+    QFETCH(bool, isValid);
+    QFETCH(int, expected);
+
+    ModelFile modelFile;
+    ModelTableFile::Table table;
+
+    bool isRead = readTable(QByteArray("joint,type\n") + text + QByteArray(",3\n"), &modelFile, &table);
+
+    QCOMPARE(isRead, isValid);
+
+    if (!isValid)
+    {
+        return;
+    }
+
+    QCOMPARE(table, ModelTableFile::SUPPORTS);
+    QCOMPARE(modelFile.integers(ModelFile::SUPPORT_JOINTS), QVector<qint32>() << qint32(expected));
+}
+
+QTEST_APPLESS_MAIN(TestModelTableFile)
+
+#include "tst_modeltablefile.moc"
@@ -0,0 +1,12 @@
+include(../tests.pri)
+
+TARGET = tst_parametrictruss
+
+SOURCES += tst_parametrictruss.cpp \
+           ../../src/joint.cpp \
+           ../../src/parametrictruss.cpp \
+           ../../src/point.cpp
+
+HEADERS += ../../src/joint.h \
+           ../../src/parametrictruss.h \
+           ../../src/point.h
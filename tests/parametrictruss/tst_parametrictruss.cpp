@@ -0,0 +1,145 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* tst_parametrictruss.cpp */
+
+#include <QSet>
+#include <QtTest>
+
+#include "parametrictruss.h"
+
+Q_DECLARE_METATYPE(ParametricTruss::Topology)
+
+//Joint and member counts of each topology, and the redundancy they give on the pinned and roller supports of the
+//truss, members + 3 - 2 x joints, which is zero for the statically determinate layouts
+class TestParametricTruss : public QObject
+{
+        Q_OBJECT
+
+    private slots:
+        void counts_data();
+
+        void counts();
+
+        void members_data();
+
+        void members();
+};
+
+void TestParametricTruss::counts_data()
+{
+    QTest::addColumn<ParametricTruss::Topology>("topology");
+    QTest::addColumn<int>("panelsCount");
+    QTest::addColumn<int>("rowsCount");
+    QTest::addColumn<int>("expectedPanelsCount");
+    QTest::addColumn<int>("jointsCount");
+    QTest::addColumn<int>("membersCount");
+    QTest::addColumn<int>("redundancy");
+
+    QTest::newRow("pratt") << ParametricTruss::PRATT_TRUSS << 6 << 1 << 6 << 12 << 21 << 0;
+    QTest::newRow("howe") << ParametricTruss::HOWE_TRUSS << 6 << 1 << 6 << 12 << 21 << 0;
+    QTest::newRow("warren") << ParametricTruss::WARREN_TRUSS << 6 << 1 << 6 << 13 << 23 << 0;
+    QTest::newRow("k") << ParametricTruss::K_TRUSS << 6 << 1 << 6 << 19 << 36 << 1;
+    QTest::newRow("bowstring") << ParametricTruss::BOWSTRING_TRUSS << 6 << 1 << 6 << 12 << 21 << 0;
+    QTest::newRow("fan") << ParametricTruss::FAN_TRUSS << 6 << 1 << 6 << 9 << 15 << 0;
+    QTest::newRow("grid") << ParametricTruss::GRID << 6 << 1 << 6 << 14 << 25 << 0;
+    QTest::newRow("grid of 3 rows") << ParametricTruss::GRID << 6 << 3 << 6 << 28 << 63 << 10;
+    QTest::newRow("triangulated grid") << ParametricTruss::TRIANGULATED_GRID << 6 << 1 << 6 << 13 << 23 << 0;
+    QTest::newRow("triangulated grid of 2 rows") << ParametricTruss::TRIANGULATED_GRID << 6 << 2 << 6 << 20 << 41 << 4;
+
+    //Panel counts raised to the minimum of the topology, or to an even count
+
+    QTest::newRow("pratt of 1 panel") << ParametricTruss::PRATT_TRUSS << 1 << 1 << 2 << 4 << 5 << 0;
+    QTest::newRow("k of 5 panels") << ParametricTruss::K_TRUSS << 5 << 1 << 6 << 19 << 36 << 1;
+    QTest::newRow("fan of 3 panels") << ParametricTruss::FAN_TRUSS << 3 << 1 << 4 << 6 << 9 << 0;
+    QTest::newRow("pratt of 2 rows") << ParametricTruss::PRATT_TRUSS << 6 << 2 << 6 << 12 << 21 << 0;
+}
+
+void TestParametricTruss::counts()
+{
+    QFETCH(ParametricTruss::Topology, topology);
+    QFETCH(int, panelsCount);
+    QFETCH(int, rowsCount);
+    QFETCH(int, expectedPanelsCount);
+    QFETCH(int, jointsCount);
+    QFETCH(int, membersCount);
+    QFETCH(int, redundancy);
+
+    ParametricTruss truss(topology, panelsCount, 1.0, 1.0, 0.0, rowsCount);
+
+    QCOMPARE(truss.panelsCount(), expectedPanelsCount);
+    QCOMPARE(truss.joints().size(), jointsCount);
+    QCOMPARE(truss.members().size(), membersCount);
+    QCOMPARE(truss.members().size() + 3 - 2 * truss.joints().size(), redundancy);
+    QCOMPARE(truss.pinnedJoint(), 0);
+    QCOMPARE(truss.rollerJoint(), expectedPanelsCount);
+}
+
+void TestParametricTruss::members_data()
+{
+    QTest::addColumn<ParametricTruss::Topology>("topology");
+    QTest::addColumn<int>("rowsCount");
+
+    QTest::newRow("pratt") << ParametricTruss::PRATT_TRUSS << 1;
+    QTest::newRow("howe") << ParametricTruss::HOWE_TRUSS << 1;
+    QTest::newRow("warren") << ParametricTruss::WARREN_TRUSS << 1;
+    QTest::newRow("k") << ParametricTruss::K_TRUSS << 1;
+    QTest::newRow("bowstring") << ParametricTruss::BOWSTRING_TRUSS << 1;
+    QTest::newRow("fan") << ParametricTruss::FAN_TRUSS << 1;
+    QTest::newRow("grid") << ParametricTruss::GRID << 3;
+    QTest::newRow("triangulated grid") << ParametricTruss::TRIANGULATED_GRID << 3;
+}
+
+void TestParametricTruss::members()
+{
+    //Every member joins two distinct joints once, and every joint takes at least two members
+
+    QFETCH(ParametricTruss::Topology, topology);
+    QFETCH(int, rowsCount);
+
+    ParametricTruss truss(topology, 8, 2.0, 1.5, 0.1, rowsCount);
+
+    int jointsCount = truss.joints().size();
+    QVector<int> membersAtJoint(jointsCount, 0);
+    QSet<qint64> memberEnds;
+
+    foreach (const ParametricTruss::Member &member, truss.members())
+    {
+        QVERIFY(member.firstJoint >= 0 && member.firstJoint < jointsCount);
+        QVERIFY(member.secondJoint >= 0 && member.secondJoint < jointsCount);
+        QVERIFY(member.firstJoint != member.secondJoint);
+
+        qint64 firstJoint  = qMin(member.firstJoint, member.secondJoint);
+        qint64 secondJoint = qMax(member.firstJoint, member.secondJoint);
+
+        QVERIFY(!memberEnds.contains(firstJoint * jointsCount + secondJoint));
+        memberEnds.insert(firstJoint * jointsCount + secondJoint);
+
+        ++membersAtJoint[member.firstJoint];
+        ++membersAtJoint[member.secondJoint];
+    }
+
+    for (int i = 0; i < jointsCount; ++i)
+    {
+        QVERIFY2(membersAtJoint.at(i) >= 2, qPrintable(QString("joint %1").arg(i)));
+    }
+
+    QVERIFY(truss.minMemberLength() > 0.0);
+}
+
+QTEST_APPLESS_MAIN(TestParametricTruss)
+
+#include "tst_parametrictruss.moc"
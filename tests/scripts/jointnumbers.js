@@ -0,0 +1,68 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* jointnumbers.js */
+
+//Joint numbers returned by addJoint hold through the renumbering of a commit. The joints are added from the top
+//down, so that the commit renumbers them from the bottom up, and the top joint alone is loaded. Run with
+//trusstables --script tests/scripts/jointnumbers.js, which exits with an error when a check fails.
+
+function check(condition, message) {
+    if (!condition) {
+        throw new Error(message);
+    }
+}
+
+var top   = model.addJoint(2.0, 3.0);
+var right = model.addJoint(4.0, 0.0);
+var left  = model.addJoint(0.0, 0.0);
+
+model.addBar(top, right);
+model.addBar(right, left);
+model.addBar(left, top);
+
+check(model.addSupport(left, "fixedBottom"), "support at the left joint not added");
+check(model.addSupport(right, "rollerBottom"), "support at the right joint not added");
+check(model.addJointLoad(top, 0.0, -10.0), "load at the top joint not added");
+
+var joint = model.joint(top);
+check((joint.x === 2.0) && (joint.y === 3.0), "joint " + top + " moved to " + joint.x + ", " + joint.y);
+check(model.bar(1).firstJoint === top, "bar 1 starts at joint " + model.bar(1).firstJoint);
+
+check(model.solve(), "model not solved");
+
+//Loaded at a support instead, the bars would carry nothing
+
+var barLoads = model.barLoads();
+
+for (var i = 0; i < barLoads.length; ++i) {
+    check(Math.abs(barLoads[i].load) > 1.0e-9, "bar " + barLoads[i].bar + " carries no load");
+}
+
+check(Math.abs(Math.abs(barLoads[0].load) - Math.abs(barLoads[2].load)) < 1.0e-9, "sloping bars loaded unequally");
+
+var reactions = model.supportReactions();
+
+check(reactions.length === 2, reactions.length + " reactions");
+
+for (var j = 0; j < reactions.length; ++j) {
+    check((reactions[j].joint === left) || (reactions[j].joint === right),
+          "reaction at joint " + reactions[j].joint);
+    check(Math.abs(Math.abs(reactions[j].vertical) - 5.0) < 1.0e-9,
+          "reaction of " + reactions[j].vertical + " at joint " + reactions[j].joint);
+}
+
+print("joint numbers hold:", top, right, left);
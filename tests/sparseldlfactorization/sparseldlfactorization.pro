@@ -0,0 +1,8 @@
+include(../tests.pri)
+
+TARGET = tst_sparseldlfactorization
+
+SOURCES += tst_sparseldlfactorization.cpp \
+           ../../src/sparseldlfactorization.cpp
+
+HEADERS += ../../src/sparseldlfactorization.h
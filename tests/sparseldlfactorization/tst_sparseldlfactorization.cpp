@@ -0,0 +1,238 @@
+/********************************************************************************************
+ * This file is part of TrussTables
+ * Copyright 2018, Ambrose Louis Okune <sambero.osilu@gmail.com>
+ *
+ * TrussTables is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Public License as published by the Free Software Foundation, either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * TrussTables is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with TrussTables.
+ * If not, see <http://www.gnu.org/licenses/>.
+ ********************************************************************************************/
+
+/* tst_sparseldlfactorization.cpp */
+
+#include <cmath>
+
+#include <QtTest>
+
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_vector.h>
+
+#include "sparseldlfactorization.h"
+
+//Solves and selected inverse entries of grid Laplacians checked against dense Cholesky factors of the same matrices.
+//The grid is large enough to be dissected.
+class TestSparseLdlFactorization : public QObject
+{
+        Q_OBJECT
+
+    private slots:
+        void solve();
+
+        void selectedInverse();
+
+        void singularMatrix();
+
+    private:
+        //Five point Laplacian of a square grid with free edges and the shift added to its diagonal
+        static gsl_matrix *gridLaplacian(int side, qreal shift);
+
+        //Entries on and below the diagonal of a dense matrix
+        static gsl_spmatrix *tripletMatrix(const gsl_matrix *denseMatrix);
+
+        static const int kGridSide = 12;
+};
+
+gsl_matrix *TestSparseLdlFactorization::gridLaplacian(int side, qreal shift)
+{
+    int order               = side * side;
+    gsl_matrix *denseMatrix = gsl_matrix_calloc(order, order);
+
+    for (int i = 0; i < side; ++i)
+    {
+        for (int j = 0; j < side; ++j)
+        {
+            int node = i * side + j;
+
+            gsl_matrix_set(denseMatrix, node, node, shift);
+
+            if (j + 1 < side)
+            {
+                *gsl_matrix_ptr(denseMatrix, node, node)         += 1.0;
+                *gsl_matrix_ptr(denseMatrix, node + 1, node + 1) += 1.0;
+                gsl_matrix_set(denseMatrix, node, node + 1, -1.0);
+                gsl_matrix_set(denseMatrix, node + 1, node, -1.0);
+            }
+
+            if (i + 1 < side)
+            {
+                *gsl_matrix_ptr(denseMatrix, node, node)               += 1.0;
+                *gsl_matrix_ptr(denseMatrix, node + side, node + side) += 1.0;
+                gsl_matrix_set(denseMatrix, node, node + side, -1.0);
+                gsl_matrix_set(denseMatrix, node + side, node, -1.0);
+            }
+        }
+    }
+
+    return denseMatrix;
+}
+
+gsl_spmatrix *TestSparseLdlFactorization::tripletMatrix(const gsl_matrix *denseMatrix)
+{
+    gsl_spmatrix *matrix = gsl_spmatrix_alloc(denseMatrix->size1, denseMatrix->size2);
+
+    for (size_t i = 0; i < denseMatrix->size1; ++i)
+    {
+        for (size_t j = 0; j <= i; ++j)
+        {
+            if (gsl_matrix_get(denseMatrix, i, j) != 0.0)
+            {
+                gsl_spmatrix_set(matrix, i, j, gsl_matrix_get(denseMatrix, i, j));
+            }
+        }
+    }
+
+    return matrix;
+}
+
+void TestSparseLdlFactorization::solve()
+{
+    int order               = kGridSide * kGridSide;
+    gsl_matrix *denseMatrix = gridLaplacian(kGridSide, 0.5);
+    gsl_spmatrix *matrix    = tripletMatrix(denseMatrix);
+
+    SparseLdlFactorization factorization(matrix);
+
+    QVERIFY(factorization.isValid());
+    QVERIFY(!factorization.isSingular());
+    QCOMPARE(factorization.order(), order);
+    QCOMPARE(factorization.rank(), order);
+    QVERIFY(factorization.factorNonZeros() < qint64(order) * (order - 1) / 2);
+
+    QVector<qreal> vector(order);
+    gsl_vector *loadsVector       = gsl_vector_alloc(order);
+    gsl_vector *deflectionsVector = gsl_vector_alloc(order);
+
+    for (int i = 0; i < order; ++i)
+    {
+        vector[i] = std::sin(qreal(i + 1));
+        gsl_vector_set(loadsVector, i, vector.at(i));
+    }
+
+    factorization.solve(vector);
+
+    gsl_linalg_cholesky_decomp1(denseMatrix);
+    gsl_linalg_cholesky_solve(denseMatrix, loadsVector, deflectionsVector);
+
+    for (int i = 0; i < order; ++i)
+    {
+        qreal expected = gsl_vector_get(deflectionsVector, i);
+        QVERIFY2(std::fabs(vector.at(i) - expected) <= 1.0e-10 * (1.0 + std::fabs(expected)),
+                 qPrintable(QString("entry %1: %2, dense %3").arg(i).arg(vector.at(i)).arg(expected)));
+    }
+
+    gsl_vector_free(loadsVector);
+    gsl_vector_free(deflectionsVector);
+    gsl_spmatrix_free(matrix);
+    gsl_matrix_free(denseMatrix);
+}
+
+void TestSparseLdlFactorization::selectedInverse()
+{
+    int order               = kGridSide * kGridSide;
+    gsl_matrix *denseMatrix = gridLaplacian(kGridSide, 0.5);
+    gsl_spmatrix *matrix    = tripletMatrix(denseMatrix);
+
+    SparseLdlFactorization factorization(matrix);
+
+    QVERIFY(!factorization.hasSelectedInverse());
+    factorization.computeSelectedInverse();
+    QVERIFY(factorization.hasSelectedInverse());
+
+    gsl_linalg_cholesky_decomp1(denseMatrix);
+    gsl_linalg_cholesky_invert(denseMatrix);
+
+    //Each node with its right neighbour, or its lower one on the last column, which share an entry of the matrix
+    //as the ends of a bar do
+
+    for (int node = 0; node + 1 < order; ++node)
+    {
+        QVector<int> indices;
+        QVector<qreal> values;
+
+        indices.append(node);
+        values.append(1.0);
+
+        if ((node + 1) % kGridSide != 0)
+        {
+            indices.append(node + 1);
+        }
+        else
+        {
+            indices.append(node + kGridSide);
+        }
+
+        values.append(-2.0);
+
+        qreal expected = 0.0;
+
+        for (int a = 0; a < indices.size(); ++a)
+        {
+            for (int b = 0; b < indices.size(); ++b)
+            {
+                expected += values.at(a) * values.at(b) * gsl_matrix_get(denseMatrix, indices.at(a), indices.at(b));
+            }
+        }
+
+        qreal form = factorization.inverseQuadraticForm(indices, values);
+
+        QVERIFY2(std::fabs(form - expected) <= 1.0e-10 * (1.0 + std::fabs(expected)),
+                 qPrintable(QString("node %1: %2, dense %3").arg(node).arg(form).arg(expected)));
+    }
+
+    gsl_spmatrix_free(matrix);
+    gsl_matrix_free(denseMatrix);
+}
+
+void TestSparseLdlFactorization::singularMatrix()
+{
+    //Without the shift the Laplacian of the connected grid has the uniform vector as its one zero-energy mode
+
+    int order               = kGridSide * kGridSide;
+    gsl_matrix *denseMatrix = gridLaplacian(kGridSide, 0.0);
+    gsl_spmatrix *matrix    = tripletMatrix(denseMatrix);
+
+    SparseLdlFactorization factorization(matrix);
+
+    QVERIFY(factorization.isValid());
+    QVERIFY(factorization.isSingular());
+    QCOMPARE(factorization.rank(), order - 1);
+    QCOMPARE(factorization.zeroEnergyDegreesOfFreedom().size(), 1);
+
+    QVector<qreal> vector(order, 0.0);
+    vector[factorization.zeroEnergyDegreesOfFreedom().first()] = 1.0;
+
+    factorization.solve(vector);
+
+    QVERIFY(vector.first() > 0.0);
+
+    for (int i = 1; i < order; ++i)
+    {
+        QVERIFY2(std::fabs(vector.at(i) - vector.first()) <= 1.0e-6 * vector.first(),
+                 qPrintable(QString("entry %1: %2, first %3").arg(i).arg(vector.at(i)).arg(vector.first())));
+    }
+
+    gsl_spmatrix_free(matrix);
+    gsl_matrix_free(denseMatrix);
+}
+
+QTEST_APPLESS_MAIN(TestSparseLdlFactorization)
+
+#include "tst_sparseldlfactorization.moc"
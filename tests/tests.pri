@@ -0,0 +1,29 @@
+#-------------------------------------------------
+#
+# Settings shared by the unit tests
+#
+#-------------------------------------------------
+
+QT       += core testlib
+QT       -= gui
+
+CONFIG   += console testcase
+CONFIG   -= app_bundle
+
+TEMPLATE = app
+
+INCLUDEPATH += $$PWD/../src
+
+win32:CONFIG(release, debug|release): LIBS += -L$$PWD/../gsl/lib/ -llibgsl -llibgslcblas
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$PWD/../gsl/lib/ -llibgsl -llibgslcblas
+
+win32:INCLUDEPATH += $$PWD/../gsl/include
+win32:DEPENDPATH += $$PWD/../gsl/include
+
+win64:CONFIG(release, debug|release): LIBS += -L$$PWD/../gsl/lib/ -llibgsl -llibgslcblas
+else:win64:CONFIG(debug, debug|release): LIBS += -L$$PWD/../gsl/lib/ -llibgsl -llibgslcblas
+
+win64:INCLUDEPATH += $$PWD/../gsl/include
+win64:DEPENDPATH += $$PWD/../gsl/include
+
+unix:LIBS += -L/usr/local/lib -lgsl -L/usr/local/lib -lgslcblas -L/usr/local/lib -lm
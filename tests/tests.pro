@@ -0,0 +1,12 @@
+#-------------------------------------------------
+#
+# Unit tests, each building the sources it tests from src
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += modelfile \
+           modeltablefile \
+           parametrictruss \
+           sparseldlfactorization